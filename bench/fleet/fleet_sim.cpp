@@ -0,0 +1,802 @@
+/**
+ * @file fleet_sim.cpp
+ * @brief Frota de dispositivos virtuais do Pull contra um servidor de atualizações
+ *
+ * Uso: program [opções]  (--help lista todas)
+ *
+ *   program --devices 2000 --interval-min 60 --strategy jitter --speed 60 --duration-h 6
+ *
+ * Cada dispositivo segue o ciclo do OTAPullUpdateManager: no boot o init()
+ * verifica a versão, a task do Pull espera 5 s e verifica de novo, e depois
+ * verifica a cada intervalo, contado a partir do fim da verificação
+ * anterior. Verificar é GET /version (com os cabeçalhos do Pull) e
+ * OTAManager::compareVersions(); se o servidor tem versão mais nova vem o
+ * GET /firmware, lido no ritmo de --device-kbps. Terminado o download o
+ * dispositivo reinicia (--reboot-s) com a versão nova. Falhas esperam o
+ * próximo intervalo, como no Pull.
+ *
+ * Todos os dispositivos rodam num único processo, num laço epoll com
+ * sockets não bloqueantes. O tempo é virtual e corre --speed vezes mais
+ * rápido que o real: intervalos, boots e a banda de cada dispositivo são
+ * escalados, então o servidor recebe --speed vezes a carga real da frota e
+ * os resultados são informados em tempo virtual. Os timeouts do HTTPClient
+ * (10 s na versão, 60 s sem dados no firmware) também são virtuais, mas o
+ * servidor responde em tempo real: erros e timeouts só valem como previsão
+ * com --speed 1; velocidades altas mostram a forma da carga.
+ *
+ * Estratégias de agendamento:
+ *   fixed   a do Pull: intervalo fixo desde o boot
+ *   jitter  intervalo sorteado em ±--jitter-pct
+ *   slotted primeira verificação da task deslocada por id/N do intervalo
+ */
+
+#include <OTAManager.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace
+{
+    enum Strategy
+    {
+        STRATEGY_FIXED,
+        STRATEGY_JITTER,
+        STRATEGY_SLOTTED
+    };
+
+    struct Options
+    {
+        const char *host = "127.0.0.1";
+        uint16_t port = 8000; // Porta do Pull
+        uint32_t devices = 1000;
+        double intervalMin = 60;
+        Strategy strategy = STRATEGY_FIXED;
+        double jitterPct = 20;
+        double bootSpreadS = 0; // 0 = todos ligam juntos (volta de energia)
+        double deviceKbps = 400;
+        double rebootS = 8;
+        double speed = 60;
+        double durationH = 4;
+        double bucketS = 300;
+        const char *fromVersion = FIRMWARE_VERSION;
+        uint32_t seed = 1;
+        bool untilUpdated = true;
+        bool json = false;
+    };
+
+    enum Phase
+    {
+        PHASE_OFF,      // Ainda não ligou / reiniciando
+        PHASE_IDLE,     // Aguardando a próxima verificação
+        PHASE_VERSION,  // GET /version
+        PHASE_FIRMWARE, // GET /firmware
+        PHASE_CONFIRM,  // GET /version antes do ESP.restart()
+    };
+
+    struct Device
+    {
+        Phase phase = PHASE_OFF;
+        int fd = -1;
+        uint32_t generation = 0; // Invalida temporizadores antigos
+        bool updated = false;
+        bool bootCheck = false; // Próxima verificação é a do init()
+        String version;
+
+        std::string request;
+        size_t sent = 0;
+        std::string head;
+        bool headDone = false;
+        int status = 0;
+        long contentLength = -1;
+        size_t bodyRead = 0;
+        std::string body;
+        uint64_t downloadStartNs = 0;
+        uint64_t lastActivityNs = 0;
+        bool paused = false;
+    };
+
+    struct Timer
+    {
+        uint64_t atNs;
+        uint32_t device;
+        uint32_t generation;
+        bool operator>(const Timer &other) const { return atNs > other.atNs; }
+    };
+
+    struct Bucket
+    {
+        uint32_t versionRequests = 0;
+        uint32_t firmwareRequests = 0;
+        uint64_t bytes = 0;
+        uint32_t maxDownloads = 0;
+        uint32_t updated = 0;
+        uint32_t errors = 0;
+    };
+
+    Options opt;
+    std::vector<Device> devices;
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers;
+    std::vector<Bucket> buckets;
+    std::mt19937 rng;
+    int epollFd = -1;
+    sockaddr_in server = {};
+    uint64_t startNs = 0;
+    String serverVersion;
+
+    uint32_t downloads = 0;
+    uint32_t peakDownloads = 0;
+    double peakAtS = 0;
+    uint32_t updatedCount = 0;
+    uint64_t bytesServed = 0;
+    uint32_t connectErrors = 0;
+    uint32_t httpErrors = 0;
+    uint32_t truncated = 0;
+    uint32_t timeouts = 0;
+    double reachedS[4] = {-1, -1, -1, -1};
+    const double REACH[4] = {0.5, 0.9, 0.99, 1.0};
+
+    uint64_t nowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    // Tempo virtual (s) <-> tempo real (ns)
+    double virtualS() { return (nowNs() - startNs) / 1e9 * opt.speed; }
+    uint64_t realNsAfter(double virtualSeconds) { return nowNs() + (uint64_t)(virtualSeconds / opt.speed * 1e9); }
+
+    Bucket &bucket()
+    {
+        size_t index = (size_t)(virtualS() / opt.bucketS);
+        if (index >= buckets.size())
+            buckets.resize(index + 1);
+        return buckets[index];
+    }
+
+    void schedule(uint32_t id, double virtualSeconds)
+    {
+        Device &device = devices[id];
+        device.generation++;
+        timers.push({realNsAfter(virtualSeconds), id, device.generation});
+    }
+
+    double intervalS()
+    {
+        double interval = opt.intervalMin * 60;
+        if (opt.strategy == STRATEGY_JITTER)
+        {
+            std::uniform_real_distribution<double> jitter(-opt.jitterPct / 100, opt.jitterPct / 100);
+            interval *= 1 + jitter(rng);
+        }
+        return interval;
+    }
+
+    // ============ CICLO DO PULL ============
+
+    void boot(uint32_t id)
+    {
+        Device &device = devices[id];
+        device.phase = PHASE_IDLE;
+        device.bootCheck = true;
+        schedule(id, 0); // init(): verifica já no boot
+    }
+
+    // Fim de uma verificação: o laço da task espera o intervalo
+    void finishCheck(uint32_t id)
+    {
+        Device &device = devices[id];
+        device.phase = PHASE_IDLE;
+        if (device.bootCheck)
+        {
+            // Depois do init(), a task do Pull espera 5 s antes da primeira verificação
+            device.bootCheck = false;
+            double first = 5;
+            if (opt.strategy == STRATEGY_SLOTTED)
+                first += opt.intervalMin * 60 * id / opt.devices;
+            schedule(id, first);
+        }
+        else
+        {
+            schedule(id, intervalS());
+        }
+    }
+
+    void closeConnection(Device &device)
+    {
+        if (device.fd >= 0)
+        {
+            epoll_ctl(epollFd, EPOLL_CTL_DEL, device.fd, nullptr);
+            close(device.fd);
+            device.fd = -1;
+        }
+        if (device.phase == PHASE_FIRMWARE)
+            downloads--;
+    }
+
+    void reboot(uint32_t id);
+
+    void fail(uint32_t id, uint32_t &counter)
+    {
+        Device &device = devices[id];
+        counter++;
+        bucket().errors++;
+        closeConnection(device);
+        if (device.phase == PHASE_CONFIRM)
+            reboot(id); // Já instalado: reinicia mesmo sem a versão
+        else
+            finishCheck(id);
+    }
+
+    void startRequest(uint32_t id, const char *path)
+    {
+        Device &device = devices[id];
+        device.request = std::string("GET ") + path + " HTTP/1.1\r\nHost: " + opt.host +
+                         "\r\nUser-Agent: ESP32-OTA-Client\r\nCache-Control: no-cache\r\nConnection: close\r\n\r\n";
+        device.sent = 0;
+        device.head.clear();
+        device.headDone = false;
+        device.status = 0;
+        device.contentLength = -1;
+        device.bodyRead = 0;
+        device.body.clear();
+        device.paused = false;
+        device.lastActivityNs = nowNs();
+
+        device.fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+        if (device.fd < 0)
+        {
+            fail(id, connectErrors);
+            return;
+        }
+        int one = 1;
+        setsockopt(device.fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        if (connect(device.fd, (sockaddr *)&server, sizeof(server)) < 0 && errno != EINPROGRESS)
+        {
+            fail(id, connectErrors);
+            return;
+        }
+
+        epoll_event event = {};
+        event.events = EPOLLOUT | EPOLLIN;
+        event.data.u32 = id;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, device.fd, &event);
+    }
+
+    void check(uint32_t id)
+    {
+        Device &device = devices[id];
+        device.phase = PHASE_VERSION;
+        bucket().versionRequests++;
+        startRequest(id, "/version");
+    }
+
+    void download(uint32_t id)
+    {
+        Device &device = devices[id];
+        device.phase = PHASE_FIRMWARE;
+        device.downloadStartNs = nowNs();
+        downloads++;
+        if (downloads > peakDownloads)
+        {
+            peakDownloads = downloads;
+            peakAtS = virtualS();
+        }
+        Bucket &current = bucket();
+        current.firmwareRequests++;
+        current.maxDownloads = std::max(current.maxDownloads, downloads);
+        startRequest(id, "/firmware");
+    }
+
+    void installed(uint32_t id)
+    {
+        Device &device = devices[id];
+        closeConnection(device);
+        device.version = serverVersion;
+        if (!device.updated)
+        {
+            device.updated = true;
+            updatedCount++;
+            for (int i = 0; i < 4; i++)
+            {
+                if (reachedS[i] < 0 && updatedCount >= std::ceil(REACH[i] * opt.devices))
+                    reachedS[i] = virtualS();
+            }
+        }
+
+        // O Pull busca a versão de novo para gravá-la antes de reiniciar
+        device.phase = PHASE_CONFIRM;
+        bucket().versionRequests++;
+        startRequest(id, "/version");
+    }
+
+    // ESP.restart(): o boot com a versão nova verifica de novo
+    void reboot(uint32_t id)
+    {
+        Device &device = devices[id];
+        device.phase = PHASE_OFF;
+        schedule(id, opt.rebootS);
+    }
+
+    // Resposta completa de /version
+    void versionReceived(uint32_t id)
+    {
+        Device &device = devices[id];
+        closeConnection(device);
+        if (device.phase == PHASE_CONFIRM)
+        {
+            reboot(id);
+            return;
+        }
+        if (device.status != 200)
+        {
+            httpErrors++;
+            bucket().errors++;
+            finishCheck(id);
+            return;
+        }
+
+        String latest(device.body.c_str());
+        latest.trim();
+        serverVersion = latest;
+        if (OTAManager::compareVersions(latest, device.version) == OTAManager::VERSION_NEWER)
+            download(id);
+        else
+            finishCheck(id);
+    }
+
+    // ============ E/S ============
+
+    bool isVersion(const Device &device)
+    {
+        return device.phase == PHASE_VERSION || device.phase == PHASE_CONFIRM;
+    }
+
+    bool parseHead(Device &device)
+    {
+        size_t end = device.head.find("\r\n\r\n");
+        if (end == std::string::npos)
+            return false;
+
+        std::string rest = device.head.substr(end + 4);
+        device.head.resize(end);
+        device.headDone = true;
+        sscanf(device.head.c_str(), "HTTP/%*s %d", &device.status);
+
+        std::string lower = device.head;
+        std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+        size_t length = lower.find("\r\ncontent-length:");
+        if (length != std::string::npos)
+            device.contentLength = strtol(lower.c_str() + length + 17, nullptr, 10);
+
+        device.bodyRead = rest.size();
+        if (isVersion(device))
+            device.body = rest;
+        return true;
+    }
+
+    // Bytes que o dispositivo já poderia ter recebido no ritmo de --device-kbps
+    size_t allowance(const Device &device)
+    {
+        if (opt.deviceKbps <= 0)
+            return SIZE_MAX;
+        double seconds = (nowNs() - device.downloadStartNs) / 1e9;
+        return (size_t)(seconds * opt.deviceKbps * 125 * opt.speed) + 4096;
+    }
+
+    void pause(uint32_t id)
+    {
+        Device &device = devices[id];
+        device.paused = true;
+        epoll_event event = {};
+        event.data.u32 = id;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, device.fd, &event);
+
+        // Retoma quando a cota alcançar mais 4 KB
+        double bytesPerNs = opt.deviceKbps * 125 * opt.speed / 1e9;
+        uint64_t waitNs = (uint64_t)(4096 / bytesPerNs);
+        device.generation++;
+        timers.push({nowNs() + waitNs, id, device.generation});
+    }
+
+    void resume(uint32_t id)
+    {
+        Device &device = devices[id];
+        device.paused = false;
+        device.lastActivityNs = nowNs();
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u32 = id;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, device.fd, &event);
+    }
+
+    void onReadable(uint32_t id)
+    {
+        Device &device = devices[id];
+        char buffer[16384];
+
+        for (;;)
+        {
+            size_t want = sizeof(buffer);
+            if (device.phase == PHASE_FIRMWARE && device.headDone)
+            {
+                size_t allowed = allowance(device);
+                if (device.bodyRead >= allowed)
+                {
+                    pause(id);
+                    return;
+                }
+                want = std::min(want, allowed - device.bodyRead);
+            }
+
+            ssize_t n = recv(device.fd, buffer, want, 0);
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                return;
+            device.lastActivityNs = nowNs();
+
+            if (n <= 0)
+            {
+                // Conexão encerrada: completa só se o corpo chegou inteiro
+                bool complete = device.headDone && device.contentLength >= 0 &&
+                                device.bodyRead >= (size_t)device.contentLength;
+                if (isVersion(device) && device.headDone && device.contentLength < 0)
+                    complete = true;
+                if (!complete)
+                {
+                    fail(id, device.headDone ? truncated : connectErrors);
+                    return;
+                }
+                if (isVersion(device))
+                    versionReceived(id);
+                else if (device.status == 200)
+                    installed(id);
+                else
+                    fail(id, httpErrors);
+                return;
+            }
+
+            if (!device.headDone)
+            {
+                device.head.append(buffer, n);
+                if (!parseHead(device))
+                    continue;
+                bucket().bytes += device.bodyRead;
+                bytesServed += device.bodyRead;
+            }
+            else
+            {
+                device.bodyRead += n;
+                bucket().bytes += n;
+                bytesServed += n;
+                if (isVersion(device))
+                    device.body.append(buffer, n);
+            }
+
+            if (device.phase == PHASE_FIRMWARE && device.status != 200 && device.headDone)
+            {
+                fail(id, httpErrors);
+                return;
+            }
+            if (device.contentLength >= 0 && device.bodyRead >= (size_t)device.contentLength)
+            {
+                if (isVersion(device))
+                    versionReceived(id);
+                else
+                    installed(id);
+                return;
+            }
+        }
+    }
+
+    void onWritable(uint32_t id)
+    {
+        Device &device = devices[id];
+        int error = 0;
+        socklen_t length = sizeof(error);
+        getsockopt(device.fd, SOL_SOCKET, SO_ERROR, &error, &length);
+        if (error != 0)
+        {
+            fail(id, connectErrors);
+            return;
+        }
+
+        while (device.sent < device.request.size())
+        {
+            ssize_t n = send(device.fd, device.request.data() + device.sent, device.request.size() - device.sent,
+                             MSG_NOSIGNAL);
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                return;
+            if (n <= 0)
+            {
+                fail(id, connectErrors);
+                return;
+            }
+            device.sent += n;
+        }
+
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u32 = id;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, device.fd, &event);
+    }
+
+    void onTimer(uint32_t id)
+    {
+        Device &device = devices[id];
+        if (device.phase == PHASE_OFF)
+            boot(id);
+        else if (device.phase == PHASE_IDLE)
+            check(id);
+        else if (device.phase == PHASE_FIRMWARE && device.paused)
+            resume(id), onReadable(id);
+    }
+
+    // Timeouts do HTTPClient no Pull: 10 s em /version, 60 s sem dados no firmware
+    void expire()
+    {
+        uint64_t now = nowNs();
+        for (uint32_t id = 0; id < devices.size(); id++)
+        {
+            Device &device = devices[id];
+            if (device.fd < 0 || device.paused)
+                continue;
+            double limitS = device.phase == PHASE_FIRMWARE ? 60 : device.phase == PHASE_CONFIRM ? 5 : 10;
+            if ((now - device.lastActivityNs) / 1e9 * opt.speed > limitS)
+                fail(id, timeouts);
+        }
+    }
+
+    // ============ RELATÓRIO ============
+
+    // A última linha cobre só o trecho simulado
+    double bucketWidth(size_t index, double elapsedS)
+    {
+        return std::max(std::min(opt.bucketS, elapsedS - index * opt.bucketS), 1.0);
+    }
+
+    void report(double elapsedS, double realS)
+    {
+        if (opt.json)
+        {
+            printf("{\"devices\":%u,\"interval_min\":%.1f,\"strategy\":\"%s\",\"speed\":%.1f,\"simulated_s\":%.0f,"
+                   "\"real_s\":%.1f,\"peak_downloads\":%u,\"peak_at_s\":%.0f,\"bytes_served\":%llu,"
+                   "\"connect_errors\":%u,\"http_errors\":%u,\"timeouts\":%u,\"truncated\":%u,\"updated\":%u,",
+                   opt.devices, opt.intervalMin,
+                   opt.strategy == STRATEGY_FIXED ? "fixed" : opt.strategy == STRATEGY_JITTER ? "jitter" : "slotted",
+                   opt.speed, elapsedS, realS, peakDownloads, peakAtS, (unsigned long long)bytesServed,
+                   connectErrors, httpErrors, timeouts, truncated, updatedCount);
+            printf("\"time_to_pct_s\":{\"50\":%.0f,\"90\":%.0f,\"99\":%.0f,\"100\":%.0f},\"buckets\":[",
+                   reachedS[0], reachedS[1], reachedS[2], reachedS[3]);
+            for (size_t i = 0; i < buckets.size(); i++)
+            {
+                const Bucket &b = buckets[i];
+                double width = bucketWidth(i, elapsedS);
+                printf("%s{\"t\":%.0f,\"version_rps\":%.3f,\"firmware_rps\":%.3f,\"mb_per_s\":%.3f,"
+                       "\"max_downloads\":%u,\"errors\":%u,\"updated\":%u}",
+                       i ? "," : "", i * opt.bucketS, b.versionRequests / width, b.firmwareRequests / width,
+                       b.bytes / 1e6 / width, b.maxDownloads, b.errors, b.updated);
+            }
+            printf("]}\n");
+            return;
+        }
+
+        printf("%u dispositivos, intervalo %.0f min (%s), %.1f h simuladas em %.1f s (x%.0f)\n\n", opt.devices,
+               opt.intervalMin,
+               opt.strategy == STRATEGY_FIXED ? "fixed" : opt.strategy == STRATEGY_JITTER ? "jitter" : "slotted",
+               elapsedS / 3600, realS, opt.speed);
+        printf("%10s %12s %12s %10s %10s %8s %12s\n", "t (min)", "/version/s", "/firmware/s", "MB/s", "downloads",
+               "erros", "atualizados");
+        for (size_t i = 0; i < buckets.size(); i++)
+        {
+            const Bucket &b = buckets[i];
+            double width = bucketWidth(i, elapsedS);
+            printf("%10.0f %12.2f %12.3f %10.3f %10u %8u %11.1f%%\n", i * opt.bucketS / 60,
+                   b.versionRequests / width, b.firmwareRequests / width, b.bytes / 1e6 / width, b.maxDownloads,
+                   b.errors, 100.0 * b.updated / opt.devices);
+        }
+        printf("\nPico de downloads simultâneos: %u (t = %.0f min)\n", peakDownloads, peakAtS / 60);
+        printf("Servido: %.1f MB\n", bytesServed / 1e6);
+        printf("Erros: %u de conexão, %u HTTP, %u timeouts, %u downloads incompletos\n", connectErrors, httpErrors,
+               timeouts, truncated);
+        printf("Atualizados: %u/%u\n", updatedCount, opt.devices);
+        for (int i = 0; i < 4; i++)
+        {
+            if (reachedS[i] >= 0)
+                printf("  %3.0f%% em %.1f min\n", REACH[i] * 100, reachedS[i] / 60);
+            else
+                printf("  %3.0f%% não atingido\n", REACH[i] * 100);
+        }
+    }
+
+    void usage(const char *program)
+    {
+        fprintf(stderr,
+                "uso: %s [opções]\n"
+                "  --host ip            servidor (padrão 127.0.0.1, porta 8000 como o Pull)\n"
+                "  --port n\n"
+                "  --devices n          tamanho da frota (padrão 1000)\n"
+                "  --interval-min m     intervalo do Pull (padrão 60)\n"
+                "  --strategy s         fixed | jitter | slotted (padrão fixed)\n"
+                "  --jitter-pct p       variação do intervalo em jitter (padrão 20)\n"
+                "  --boot-spread-s s    boots sorteados em [0, s) (padrão 0: todos juntos)\n"
+                "  --device-kbps k      banda de cada dispositivo (padrão 400, 0 = sem limite)\n"
+                "  --reboot-s s         reinício após instalar (padrão 8)\n"
+                "  --speed x            tempo virtual por tempo real (padrão 60)\n"
+                "  --duration-h h       tempo simulado máximo (padrão 4)\n"
+                "  --bucket-s s         largura das linhas do relatório (padrão 300)\n"
+                "  --from-version v     versão inicial da frota (padrão FIRMWARE_VERSION)\n"
+                "  --keep-running       não para quando toda a frota atualizou\n"
+                "  --seed n\n"
+                "  --json\n",
+                program);
+    }
+
+    bool parse(int argc, char **argv)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const char *name = argv[i];
+            const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+            if (strcmp(name, "--json") == 0)
+            {
+                opt.json = true;
+                continue;
+            }
+            if (strcmp(name, "--keep-running") == 0)
+            {
+                opt.untilUpdated = false;
+                continue;
+            }
+            if (value == nullptr)
+                return false;
+            i++;
+
+            if (strcmp(name, "--host") == 0)
+                opt.host = value;
+            else if (strcmp(name, "--port") == 0)
+                opt.port = atoi(value);
+            else if (strcmp(name, "--devices") == 0)
+                opt.devices = atoi(value);
+            else if (strcmp(name, "--interval-min") == 0)
+                opt.intervalMin = atof(value);
+            else if (strcmp(name, "--strategy") == 0)
+            {
+                if (strcmp(value, "fixed") == 0)
+                    opt.strategy = STRATEGY_FIXED;
+                else if (strcmp(value, "jitter") == 0)
+                    opt.strategy = STRATEGY_JITTER;
+                else if (strcmp(value, "slotted") == 0)
+                    opt.strategy = STRATEGY_SLOTTED;
+                else
+                    return false;
+            }
+            else if (strcmp(name, "--jitter-pct") == 0)
+                opt.jitterPct = atof(value);
+            else if (strcmp(name, "--boot-spread-s") == 0)
+                opt.bootSpreadS = atof(value);
+            else if (strcmp(name, "--device-kbps") == 0)
+                opt.deviceKbps = atof(value);
+            else if (strcmp(name, "--reboot-s") == 0)
+                opt.rebootS = atof(value);
+            else if (strcmp(name, "--speed") == 0)
+                opt.speed = atof(value);
+            else if (strcmp(name, "--duration-h") == 0)
+                opt.durationH = atof(value);
+            else if (strcmp(name, "--bucket-s") == 0)
+                opt.bucketS = atof(value);
+            else if (strcmp(name, "--from-version") == 0)
+                opt.fromVersion = value;
+            else if (strcmp(name, "--seed") == 0)
+                opt.seed = atoi(value);
+            else
+                return false;
+        }
+        return opt.devices > 0 && opt.speed > 0 && opt.intervalMin > 0 && opt.bucketS > 0;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (!parse(argc, argv))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    // Um socket por dispositivo em transferência
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0)
+    {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+        if (limit.rlim_cur < opt.devices + 16)
+            fprintf(stderr, "aviso: limite de %lu descritores para %u dispositivos\n",
+                    (unsigned long)limit.rlim_cur, opt.devices);
+    }
+
+    server.sin_family = AF_INET;
+    server.sin_port = htons(opt.port);
+    if (inet_pton(AF_INET, opt.host, &server.sin_addr) != 1)
+    {
+        fprintf(stderr, "endereço inválido: %s\n", opt.host);
+        return 2;
+    }
+
+    rng.seed(opt.seed);
+    epollFd = epoll_create1(0);
+    devices.resize(opt.devices);
+    startNs = nowNs();
+
+    std::uniform_real_distribution<double> bootAt(0, opt.bootSpreadS);
+    for (uint32_t id = 0; id < opt.devices; id++)
+    {
+        devices[id].version = opt.fromVersion;
+        schedule(id, opt.bootSpreadS > 0 ? bootAt(rng) : 0);
+    }
+
+    double durationS = opt.durationH * 3600;
+    std::vector<epoll_event> events(1024);
+    uint64_t lastSweepNs = startNs;
+    while (virtualS() < durationS && !(opt.untilUpdated && updatedCount == opt.devices))
+    {
+        uint64_t now = nowNs();
+        while (!timers.empty() && timers.top().atNs <= now)
+        {
+            Timer timer = timers.top();
+            timers.pop();
+            if (timer.generation == devices[timer.device].generation)
+                onTimer(timer.device);
+        }
+
+        int timeoutMs = 100;
+        if (!timers.empty())
+        {
+            uint64_t next = timers.top().atNs;
+            timeoutMs = next > now ? (int)std::min<uint64_t>((next - now) / 1000000 + 1, 100) : 0;
+        }
+
+        int count = epoll_wait(epollFd, events.data(), events.size(), timeoutMs);
+        for (int i = 0; i < count; i++)
+        {
+            uint32_t id = events[i].data.u32;
+            Device &device = devices[id];
+            if (device.fd < 0)
+                continue;
+            if (device.sent < device.request.size())
+                onWritable(id);
+            else
+                onReadable(id);
+        }
+
+        if (nowNs() - lastSweepNs > 100000000)
+        {
+            expire();
+            lastSweepNs = nowNs();
+        }
+
+        // Atualizados ao fim de cada linha do relatório
+        bucket().updated = updatedCount;
+    }
+
+    double realS = (nowNs() - startNs) / 1e9;
+    report(virtualS(), realS);
+    return 0;
+}
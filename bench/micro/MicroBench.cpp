@@ -0,0 +1,277 @@
+/**
+ * @file MicroBench.cpp
+ * @brief Execução, contagem de alocações e comparação com a base
+ */
+
+#include "MicroBench.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+// ============ CONTAGEM DE ALOCAÇÕES ============
+// malloc e companhia são substituídos e repassam à glibc; operator new da
+// libstdc++ e a String do shim passam por aqui
+
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t count, size_t size);
+    void *__libc_realloc(void *ptr, size_t size);
+    void __libc_free(void *ptr);
+}
+
+namespace
+{
+    // Só a thread que roda o laço conta (tasks do shim continuam livres)
+    thread_local bool counting = false;
+    uint64_t allocationCount = 0;
+    uint64_t allocationBytes = 0;
+
+    inline void countAllocation(size_t size)
+    {
+        if (counting)
+        {
+            allocationCount++;
+            allocationBytes += size;
+        }
+    }
+
+    uint64_t nowNs()
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+    }
+
+    struct Entry
+    {
+        const char *name;
+        MicroBench::Function function;
+    };
+
+    std::vector<Entry> &registry()
+    {
+        static std::vector<Entry> entries;
+        return entries;
+    }
+
+    struct Result
+    {
+        std::string name;
+        uint64_t iterations;
+        double nsPerOp;
+        double allocsPerOp;
+        double bytesPerOp;
+        double mbPerS;
+    };
+
+    MicroBench::State measure(MicroBench::Function function, uint64_t iterations)
+    {
+        MicroBench::State state(iterations);
+        function(state);
+        return state;
+    }
+
+    // Lê um número após "chave": numa linha do JSON gerado por run()
+    bool readNumber(const char *line, const char *key, double &value)
+    {
+        char field[48];
+        snprintf(field, sizeof(field), "\"%s\":", key);
+        const char *found = strstr(line, field);
+        if (!found)
+            return false;
+        value = strtod(found + strlen(field), nullptr);
+        return true;
+    }
+
+    bool loadBaseline(const char *path, std::vector<Result> &baseline)
+    {
+        FILE *file = fopen(path, "r");
+        if (!file)
+            return false;
+
+        char line[512];
+        while (fgets(line, sizeof(line), file))
+        {
+            const char *name = strstr(line, "\"name\":\"");
+            if (!name)
+                continue;
+            name += 8;
+            const char *end = strchr(name, '"');
+            if (!end)
+                continue;
+
+            Result result = {std::string(name, end - name), 0, 0, 0, 0, 0};
+            readNumber(line, "ns_per_op", result.nsPerOp);
+            readNumber(line, "allocs_per_op", result.allocsPerOp);
+            baseline.push_back(result);
+        }
+        fclose(file);
+        return true;
+    }
+}
+
+extern "C"
+{
+    void *malloc(size_t size)
+    {
+        countAllocation(size);
+        return __libc_malloc(size);
+    }
+
+    void *calloc(size_t count, size_t size)
+    {
+        countAllocation(count * size);
+        return __libc_calloc(count, size);
+    }
+
+    void *realloc(void *ptr, size_t size)
+    {
+        countAllocation(size);
+        return __libc_realloc(ptr, size);
+    }
+
+    void free(void *ptr)
+    {
+        __libc_free(ptr);
+    }
+}
+
+// ============ STATE ============
+
+MicroBench::State::Iterator MicroBench::State::begin()
+{
+    allocationCount = 0;
+    allocationBytes = 0;
+    counting = true;
+    _startNs = nowNs();
+    return Iterator(this, _iterations);
+}
+
+void MicroBench::State::stop()
+{
+    elapsedNs = nowNs() - _startNs;
+    counting = false;
+    allocations = allocationCount;
+    allocatedBytes = allocationBytes;
+}
+
+// ============ EXECUÇÃO ============
+
+bool MicroBench::add(const char *name, Function function)
+{
+    registry().push_back({name, function});
+    return true;
+}
+
+int MicroBench::run(int argc, char **argv)
+{
+    const char *filter = nullptr;
+    const char *baselinePath = nullptr;
+    double minTime = 0.2;
+    double maxRegression = 0.10;
+    bool json = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++i];
+        else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc)
+            minTime = atof(argv[++i]);
+        else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc)
+            baselinePath = argv[++i];
+        else if (strcmp(argv[i], "--max-regression") == 0 && i + 1 < argc)
+            maxRegression = atof(argv[++i]);
+        else if (strcmp(argv[i], "--json") == 0)
+            json = true;
+        else
+        {
+            fprintf(stderr, "uso: %s [--filter texto] [--min-time s] [--json] "
+                            "[--baseline arquivo.json [--max-regression 0.10]]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+
+    std::vector<Result> baseline;
+    if (baselinePath && !loadBaseline(baselinePath, baseline))
+    {
+        fprintf(stderr, "não foi possível ler %s\n", baselinePath);
+        return 2;
+    }
+
+    if (json)
+        printf("{\"benchmarks\":[\n");
+    else
+        printf("%-36s %12s %12s %10s %12s %10s\n", "benchmark", "iter", "ns/op", "allocs/op", "bytes/op", "MB/s");
+
+    int failures = 0;
+    bool first = true;
+    for (const Entry &entry : registry())
+    {
+        if (filter && !strstr(entry.name, filter))
+            continue;
+
+        // Como o Google Benchmark: aumenta as iterações até o laço durar minTime
+        uint64_t iterations = 1;
+        State state = measure(entry.function, iterations);
+        uint64_t targetNs = (uint64_t)(minTime * 1e9);
+        while (state.elapsedNs < targetNs && iterations < 1000000000ull)
+        {
+            double scale = state.elapsedNs > 0 ? 1.4 * targetNs / state.elapsedNs : 10.0;
+            uint64_t next = (uint64_t)(iterations * (scale < 10.0 ? scale : 10.0));
+            iterations = next > iterations ? next : iterations + 1;
+            state = measure(entry.function, iterations);
+        }
+
+        Result result;
+        result.name = entry.name;
+        result.iterations = iterations;
+        result.nsPerOp = (double)state.elapsedNs / iterations;
+        result.allocsPerOp = (double)state.allocations / iterations;
+        result.bytesPerOp = (double)state.allocatedBytes / iterations;
+        result.mbPerS = state.bytesPerIteration() ? state.bytesPerIteration() * 1000.0 / result.nsPerOp : 0;
+
+        if (json)
+        {
+            printf("%s{\"name\":\"%s\",\"iterations\":%llu,\"ns_per_op\":%.1f,\"allocs_per_op\":%.2f,"
+                   "\"bytes_per_op\":%.1f,\"mb_per_s\":%.1f}",
+                   first ? "" : ",\n", result.name.c_str(), (unsigned long long)result.iterations,
+                   result.nsPerOp, result.allocsPerOp, result.bytesPerOp, result.mbPerS);
+        }
+        else
+        {
+            printf("%-36s %12llu %12.1f %10.2f %12.1f %10s\n", result.name.c_str(),
+                   (unsigned long long)result.iterations, result.nsPerOp, result.allocsPerOp, result.bytesPerOp,
+                   result.mbPerS > 0 ? std::to_string((int)result.mbPerS).c_str() : "-");
+        }
+        first = false;
+
+        for (const Result &base : baseline)
+        {
+            if (base.name != result.name)
+                continue;
+            if (result.nsPerOp > base.nsPerOp * (1 + maxRegression))
+            {
+                fprintf(stderr, "REGRESSÃO %s: %.1f ns/op (base %.1f)\n", result.name.c_str(), result.nsPerOp,
+                        base.nsPerOp);
+                failures++;
+            }
+            // Alocações são determinísticas: qualquer aumento conta
+            if (result.allocsPerOp > base.allocsPerOp + 0.005)
+            {
+                fprintf(stderr, "REGRESSÃO %s: %.2f allocs/op (base %.2f)\n", result.name.c_str(),
+                        result.allocsPerOp, base.allocsPerOp);
+                failures++;
+            }
+        }
+    }
+
+    if (json)
+        printf("\n]}\n");
+    return failures > 0 ? 1 : 0;
+}
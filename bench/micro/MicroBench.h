@@ -0,0 +1,117 @@
+#pragma once
+
+/**
+ * @file MicroBench.h
+ * @brief Micro-benchmarks no estilo do Google Benchmark, com contagem de alocações
+ *
+ * Cada benchmark recebe um State e repete o trecho medido dentro do laço:
+ * @code
+ * MICRO_BENCH(compareVersions)
+ * {
+ *     for (auto _ : state)
+ *         MicroBench::doNotOptimize(OTAManager::compareVersions("2.1.8", "2.1.9"));
+ * }
+ * @endcode
+ *
+ * O número de iterações cresce até o laço durar --min-time. Além do tempo por
+ * chamada, malloc/calloc/realloc feitos pela thread do benchmark dentro do
+ * laço são contados (alocações e bytes por chamada). Só funciona com a glibc
+ * (build nativo).
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MicroBench
+{
+    class State
+    {
+    public:
+        explicit State(uint64_t iterations) : _iterations(iterations) {}
+
+        /// Valor do "_" em for (auto _ : state): o atributo evita -Wunused nos laços
+        struct [[maybe_unused]] Iteration
+        {
+        };
+
+        class Iterator
+        {
+        public:
+            Iterator(State *state, uint64_t remaining) : _state(state), _remaining(remaining) {}
+            bool operator!=(const Iterator &) const
+            {
+                if (_remaining != 0)
+                    return true;
+                _state->stop();
+                return false;
+            }
+            void operator++() { _remaining--; }
+            Iteration operator*() const { return Iteration(); }
+
+        private:
+            State *_state;
+            uint64_t _remaining;
+        };
+
+        Iterator begin();
+        Iterator end() { return Iterator(this, 0); }
+
+        uint64_t iterations() const { return _iterations; }
+
+        /**
+         * @brief Bytes processados por iteração (a saída mostra MB/s)
+         */
+        void setBytesPerIteration(size_t bytes) { _bytesPerIteration = bytes; }
+
+        // Resultados, preenchidos ao fim do laço
+        uint64_t elapsedNs = 0;
+        uint64_t allocations = 0;
+        uint64_t allocatedBytes = 0;
+        size_t bytesPerIteration() const { return _bytesPerIteration; }
+
+    private:
+        void stop();
+
+        uint64_t _iterations;
+        uint64_t _startNs = 0;
+        size_t _bytesPerIteration = 0;
+    };
+
+    typedef void (*Function)(State &state);
+
+    /**
+     * @brief Registra um benchmark (usado por MICRO_BENCH)
+     */
+    bool add(const char *name, Function function);
+
+    /**
+     * @brief Roda os benchmarks registrados
+     *
+     * Opções: --filter <substring>, --min-time <s>, --json, e
+     * --baseline <arquivo.json> [--max-regression <fração>] para falhar
+     * (código 1) se algum benchmark ficou mais lento que a base além da
+     * tolerância ou passou a alocar mais.
+     */
+    int run(int argc, char **argv);
+
+    /**
+     * @brief Impede o compilador de descartar um resultado não usado
+     */
+    template <class T>
+    inline void doNotOptimize(const T &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+}
+
+#define MICRO_BENCH_CONCAT2(a, b) a##b
+#define MICRO_BENCH_CONCAT(a, b) MICRO_BENCH_CONCAT2(a, b)
+
+/**
+ * @brief Define e registra um benchmark; o corpo recebe `MicroBench::State &state`
+ */
+#define MICRO_BENCH(name)                                                                          \
+    static void MICRO_BENCH_CONCAT(microBench_, __LINE__)(MicroBench::State & state);              \
+    static bool MICRO_BENCH_CONCAT(microBenchAdded_, __LINE__) =                                   \
+        MicroBench::add(name, MICRO_BENCH_CONCAT(microBench_, __LINE__));                          \
+    static void MICRO_BENCH_CONCAT(microBench_, __LINE__)(MicroBench::State & state)
@@ -0,0 +1,199 @@
+/**
+ * @file bench_micro.cpp
+ * @brief Micro-benchmarks dos helpers de texto da biblioteca
+ *
+ * Uso: program [--filter texto] [--min-time s] [--json] [--baseline base.json]
+ *
+ * Mede tempo e alocações por chamada de:
+ * - OTAManager::compareVersions()
+ * - os escritores JSON da API (/api/status, /api/system, /api/ota), que
+ *   substituíram os templates HTML das páginas, e o texto de /metrics
+ * - extractVersionFromBinary() sobre o primeiro bloco de 4 KB de um upload
+ * - formatTime(), getCurrentDateTime() e formatBuildDate()
+ */
+
+#include "MicroBench.h"
+
+#include <OTAJsonWriter.h>
+#include <OTAManager.h>
+#include <OTAMetrics.h>
+#include <OTAPushUpdateManager.h>
+
+#include <cstring>
+
+// Acesso aos helpers privados de OTAPushUpdateManager
+class OTAMicroBench
+{
+public:
+    static String extractVersion(const uint8_t *data, size_t length)
+    {
+        return OTAPushUpdateManager::extractVersionFromBinary(data, length);
+    }
+    static String buildDate() { return OTAPushUpdateManager::formatBuildDate(); }
+    static void status(OTAJsonWriter &json) { OTAPushUpdateManager::writeStatusJson(json); }
+    static void system(OTAJsonWriter &json) { OTAPushUpdateManager::writeSystemJson(json); }
+    static void ota(OTAJsonWriter &json) { OTAPushUpdateManager::writeOtaJson(json); }
+};
+
+namespace
+{
+    // Destino que descarta a saída e conta os bytes
+    class NullPrint : public Print
+    {
+    public:
+        size_t write(uint8_t) override
+        {
+            bytes++;
+            return 1;
+        }
+        size_t write(const uint8_t *, size_t size) override
+        {
+            bytes += size;
+            return size;
+        }
+        size_t bytes = 0;
+    };
+
+    const size_t CHUNK_SIZE = 4096;
+
+    /**
+     * @brief Primeiro bloco de uma imagem do ESP32: cabeçalho, esp_app_desc_t
+     *        e código (bytes pseudoaleatórios com algumas strings)
+     * @param marker Texto com a versão no meio do bloco (nullptr = nenhum)
+     */
+    void buildChunk(uint8_t *chunk, const char *marker)
+    {
+        uint32_t seed = 0x12345678;
+        for (size_t i = 0; i < CHUNK_SIZE; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            chunk[i] = (uint8_t)(seed >> 24);
+        }
+
+        chunk[0] = 0xE9; // Magic da imagem
+        const uint32_t appDescMagic = 0xABCD5432;
+        memcpy(chunk + 32, &appDescMagic, sizeof(appDescMagic));
+        memset(chunk + 48, 0, 32);
+        memcpy(chunk + 48, "2.1.8", 5);  // esp_app_desc_t.version
+        memset(chunk + 80, 0, 32);
+        memcpy(chunk + 80, "arduino-lib-builder", 19); // esp_app_desc_t.project_name
+
+        const char *strings[] = {"E (%u) wifi: timeout", "heap_caps_malloc failed", "/littlefs/version.txt"};
+        size_t offset = 512;
+        for (const char *text : strings)
+        {
+            memcpy(chunk + offset, text, strlen(text) + 1);
+            offset += 700;
+        }
+        if (marker)
+            memcpy(chunk + 3000, marker, strlen(marker));
+    }
+
+    template <void (*Writer)(OTAJsonWriter &)>
+    void benchJson(MicroBench::State &state)
+    {
+        NullPrint out;
+        for (auto _ : state)
+        {
+            OTAJsonWriter json(out);
+            Writer(json);
+            json.flush();
+        }
+        state.setBytesPerIteration(out.bytes / state.iterations());
+    }
+}
+
+// ============ VERSÕES ============
+
+MICRO_BENCH("compareVersions/equal")
+{
+    String a = "2.1.8", b = "2.1.8";
+    for (auto _ : state)
+        MicroBench::doNotOptimize(OTAManager::compareVersions(a, b));
+}
+
+MICRO_BENCH("compareVersions/prefixed")
+{
+    String a = "v2.10.3", b = "V2.9.12";
+    for (auto _ : state)
+        MicroBench::doNotOptimize(OTAManager::compareVersions(a, b));
+}
+
+MICRO_BENCH("compareVersions/short")
+{
+    String a = "3", b = "2.9";
+    for (auto _ : state)
+        MicroBench::doNotOptimize(OTAManager::compareVersions(a, b));
+}
+
+// ============ API JSON ============
+
+MICRO_BENCH("json/status")
+{
+    benchJson<OTAMicroBench::status>(state);
+}
+
+MICRO_BENCH("json/system")
+{
+    benchJson<OTAMicroBench::system>(state);
+}
+
+MICRO_BENCH("json/ota")
+{
+    benchJson<OTAMicroBench::ota>(state);
+}
+
+MICRO_BENCH("metrics/write")
+{
+    NullPrint out;
+    for (auto _ : state)
+        OTAMetrics::write(out);
+    state.setBytesPerIteration(out.bytes / state.iterations());
+}
+
+// ============ UPLOAD ============
+
+MICRO_BENCH("extractVersionFromBinary/4k_found")
+{
+    static uint8_t chunk[CHUNK_SIZE];
+    buildChunk(chunk, "FIRMWARE_VERSION=\"2.2.0\"");
+    for (auto _ : state)
+        MicroBench::doNotOptimize(OTAMicroBench::extractVersion(chunk, sizeof(chunk)));
+    state.setBytesPerIteration(sizeof(chunk));
+}
+
+MICRO_BENCH("extractVersionFromBinary/4k_missing")
+{
+    static uint8_t chunk[CHUNK_SIZE];
+    buildChunk(chunk, nullptr);
+    for (auto _ : state)
+        MicroBench::doNotOptimize(OTAMicroBench::extractVersion(chunk, sizeof(chunk)));
+    state.setBytesPerIteration(sizeof(chunk));
+}
+
+// ============ DATAS ============
+
+MICRO_BENCH("formatTime")
+{
+    unsigned long rawTime = 1760000000;
+    for (auto _ : state)
+        MicroBench::doNotOptimize(OTAPushUpdateManager::formatTime(rawTime++));
+}
+
+MICRO_BENCH("getCurrentDateTime")
+{
+    for (auto _ : state)
+        MicroBench::doNotOptimize(OTAPushUpdateManager::getCurrentDateTime());
+}
+
+MICRO_BENCH("formatBuildDate")
+{
+    for (auto _ : state)
+        MicroBench::doNotOptimize(OTAMicroBench::buildDate());
+}
+
+int main(int argc, char **argv)
+{
+    WiFi.begin("bench");
+    return MicroBench::run(argc, argv);
+}
@@ -0,0 +1,123 @@
+/**
+ * @file bench_pull.cpp
+ * @brief Uma medição do pipeline do Pull (verificação, download, Update)
+ *
+ * Uso: program <url_do_servidor> [tentativas] [intervalo_entre_tentativas_ms]
+ *
+ * Roda OTAPullUpdateManager sem alterações contra o servidor indicado (porta
+ * 8000): init() faz a primeira tentativa e checkForUpdates() as seguintes,
+ * até a imagem ser instalada. As fases chegam pelo sink do OTAEvents; ao
+ * final uma linha JSON vai para o stdout:
+ *
+ *   {"ok":true,"attempts":2,"bytes":1048576,"wasted":524288,"download_ms":812,
+ *    "install_ms":1630,"retry_ms":540,"mb_per_s":1.29,"flash_ms":4210.0,"erases":16}
+ *
+ * bytes/download_ms/mb_per_s são da tentativa que concluiu; wasted soma os
+ * bytes gravados nas tentativas que falharam e retry_ms o tempo até o início
+ * da última tentativa (esperas incluídas). flash_ms e erases vêm do modelo de
+ * flash do shim (HostFlash.h) para a última gravação; com
+ * OTA_NATIVE_FLASH_TIMING=1 esse tempo também entra no download. Usado por
+ * run_bench.py.
+ */
+
+#include <HostFlash.h>
+#include <OTAEvents.h>
+#include <OTAPullUpdateManager.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    uint32_t benchStartMs = 0;
+    uint32_t attemptStartMs = 0;
+    uint32_t downloadMs = 0;
+    uint32_t retryMs = 0;
+    uint32_t attempts = 0;
+    size_t attemptBytes = 0;
+    size_t wastedBytes = 0;
+
+    bool phaseIs(const char *data, const char *phase)
+    {
+        char field[32];
+        snprintf(field, sizeof(field), "\"phase\":\"%s\"", phase);
+        return strstr(data, field) != nullptr;
+    }
+
+    size_t readBytes(const char *data)
+    {
+        const char *field = strstr(data, "\"bytes\":");
+        return field ? strtoul(field + 8, nullptr, 10) : 0;
+    }
+
+    void report(bool ok)
+    {
+        uint32_t installMs = millis() - benchStartMs;
+        double mbPerS = downloadMs > 0 ? attemptBytes / 1000.0 / downloadMs : 0;
+        HostFlash::Stats flash = HostFlash::stats();
+
+        printf("{\"ok\":%s,\"attempts\":%u,\"bytes\":%zu,\"wasted\":%zu,\"download_ms\":%u,"
+               "\"install_ms\":%u,\"retry_ms\":%u,\"mb_per_s\":%.3f,\"flash_ms\":%.1f,\"erases\":%u}\n",
+               ok ? "true" : "false", attempts, attemptBytes, wastedBytes, downloadMs, installMs, retryMs, mbPerS,
+               flash.busyUs / 1000.0, flash.sectorErases + flash.blockErases);
+        fflush(stdout);
+    }
+
+    // Eventos do Pull: início, fim do download, conclusão ou erro de cada tentativa
+    void onEvent(const char *event, const char *data)
+    {
+        if (strcmp(event, "progress") != 0 || strstr(data, "\"source\":\"pull\"") == nullptr)
+            return;
+
+        if (phaseIs(data, "start"))
+        {
+            attemptStartMs = millis();
+            attemptBytes = 0;
+        }
+        else if (phaseIs(data, "finalize"))
+        {
+            attemptBytes = readBytes(data);
+            downloadMs = millis() - attemptStartMs;
+        }
+        else if (phaseIs(data, "done"))
+        {
+            report(true); // Em seguida o Pull chama ESP.restart(), que encerra o processo
+        }
+        else if (phaseIs(data, "error"))
+        {
+            wastedBytes += readBytes(data);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "uso: %s <url_do_servidor> [tentativas] [intervalo_ms]\n", argv[0]);
+        return 2;
+    }
+    uint32_t maxAttempts = argc > 2 ? atoi(argv[2]) : 5;
+    uint32_t retryDelayMs = argc > 3 ? atoi(argv[3]) : 500;
+
+    WiFi.begin("bench");
+    OTAEvents::setSink(onEvent);
+
+    // Cada tentativa é uma verificação completa (versão + download);
+    // só volta para cá se a tentativa falhou
+    benchStartMs = millis();
+    attempts = 1;
+    OTAPullUpdateManager::init(argv[1]);
+
+    while (attempts < maxAttempts)
+    {
+        delay(retryDelayMs);
+        retryMs = millis() - benchStartMs; // Tudo até aqui foi perdido
+        attempts++;
+        OTAPullUpdateManager::checkForUpdates();
+    }
+    retryMs = millis() - benchStartMs;
+
+    report(false);
+    return 1;
+}
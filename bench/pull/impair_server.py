@@ -0,0 +1,214 @@
+"""
+Servidor de atualizações com rede degradada, para medir o Pull.
+
+Atende /version e /firmware como tools/update_server.py, mas entrega as
+respostas através de um modelo simples de enlace:
+
+- latência e jitter: cada resposta espera um RTT antes dos cabeçalhos, e o
+  corpo sai em janelas de --window bytes com um RTT por janela (o emissor
+  TCP espera as confirmações do receptor)
+- banda: --bandwidth limita a vazão em kbit/s
+- perda: cada segmento de --mss bytes é "perdido" com probabilidade --loss;
+  a retransmissão custa um RTO (max(200 ms, 2 RTT)), como no TCP
+- quedas: --disconnect-at fecha a conexão depois de uma fração do firmware,
+  nas primeiras --disconnect-count requisições de /firmware
+
+A perda é modelada no nível da aplicação (o TCP do host nunca perde dados):
+o efeito observado é o atraso da retransmissão.
+
+Uso:
+    python bench/pull/impair_server.py firmware.bin --version 9.9.9 --latency 50 --jitter 20 \\
+        --bandwidth 2000 --loss 0.01 --disconnect-at 0.5
+
+Também é importado por run_bench.py, que troca o perfil entre as medições.
+"""
+
+import argparse
+import http.server
+import random
+import socket
+import sys
+import threading
+import time
+from dataclasses import dataclass
+
+
+@dataclass
+class Profile:
+    latency_ms: float = 0.0  # RTT base
+    jitter_ms: float = 0.0  # variação uniforme somada ao RTT (0..jitter)
+    bandwidth_kbps: float = 0.0  # 0 = sem limite
+    loss: float = 0.0  # probabilidade de perda por segmento
+    disconnect_at: float = 0.0  # fração do firmware antes da queda (0 = nunca)
+    disconnect_count: int = 1  # quantas requisições de /firmware caem
+    window: int = 5744  # janela de recepção (4 x MSS, padrão do lwIP no ESP32)
+    mss: int = 1436
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.reset()
+
+    def reset(self):
+        with self.lock:
+            self.firmware_requests = 0
+            self.version_requests = 0
+            self.bytes_sent = 0
+            self.disconnects = 0
+            self.losses = 0
+
+    def add(self, **counters):
+        with self.lock:
+            for name, value in counters.items():
+                setattr(self, name, getattr(self, name) + value)
+
+    def snapshot(self):
+        with self.lock:
+            return {
+                "firmware_requests": self.firmware_requests,
+                "version_requests": self.version_requests,
+                "bytes_sent": self.bytes_sent,
+                "disconnects": self.disconnects,
+                "losses": self.losses,
+            }
+
+
+class ImpairServer:
+    """Servidor em uma thread; profile e firmware podem ser trocados entre medições."""
+
+    def __init__(self, firmware, version, port=8000, bind="127.0.0.1", profile=None, seed=None):
+        self.firmware = firmware
+        self.version = version
+        self.profile = profile or Profile()
+        self.stats = Stats()
+        self.random = random.Random(seed)
+        self._httpd = http.server.ThreadingHTTPServer((bind, port), self._handler())
+        self._httpd.daemon_threads = True
+        self._thread = None
+
+    def serve_forever(self):
+        self._httpd.serve_forever()
+
+    def start(self):
+        self._thread = threading.Thread(target=self._httpd.serve_forever, daemon=True)
+        self._thread.start()
+        return self
+
+    def stop(self):
+        self._httpd.shutdown()
+        self._httpd.server_close()
+
+    def reset(self, profile=None):
+        if profile is not None:
+            self.profile = profile
+        self.stats.reset()
+
+    def rtt(self):
+        p = self.profile
+        return (p.latency_ms + self.random.uniform(0, p.jitter_ms)) / 1000.0
+
+    def _handler(self):
+        server = self
+
+        class Handler(http.server.BaseHTTPRequestHandler):
+            protocol_version = "HTTP/1.1"
+
+            def do_GET(self):
+                path = self.path.split("?", 1)[0]
+                if path == "/version":
+                    server.stats.add(version_requests=1)
+                    self.respond(server.version.encode(), "text/plain", None)
+                elif path == "/firmware":
+                    server.stats.add(firmware_requests=1)
+                    number = server.stats.snapshot()["firmware_requests"]
+                    p = server.profile
+                    cut = None
+                    if p.disconnect_at > 0 and number <= p.disconnect_count:
+                        cut = int(len(server.firmware) * p.disconnect_at)
+                    self.respond(server.firmware, "application/octet-stream", cut)
+                else:
+                    self.send_error(404)
+
+            def respond(self, body, content_type, cut):
+                p = server.profile
+                time.sleep(server.rtt())  # Requisição + resposta
+                self.send_response(200)
+                self.send_header("Content-Type", content_type)
+                self.send_header("Content-Length", str(len(body)))
+                self.end_headers()
+                self.wfile.flush()
+
+                byte_time = 8.0 / (p.bandwidth_kbps * 1000) if p.bandwidth_kbps > 0 else 0.0
+                sent = 0
+                try:
+                    while sent < len(body):
+                        window_start = time.monotonic()
+                        window_end = min(sent + p.window, len(body))
+                        if cut is not None:
+                            window_end = min(window_end, cut)
+
+                        while sent < window_end:
+                            segment = body[sent:min(sent + p.mss, window_end)]
+                            if p.loss > 0 and server.random.random() < p.loss:
+                                server.stats.add(losses=1)
+                                time.sleep(max(0.2, 2 * server.rtt()))
+                            self.wfile.write(segment)
+                            sent += len(segment)
+                            server.stats.add(bytes_sent=len(segment))
+                            if byte_time:
+                                time.sleep(len(segment) * byte_time)
+
+                        if cut is not None and sent >= cut:
+                            server.stats.add(disconnects=1)
+                            self.connection.shutdown(socket.SHUT_RDWR)
+                            self.close_connection = True
+                            return
+
+                        # Espera as confirmações da janela: um RTT desde o início dela
+                        if sent < len(body):
+                            remaining = server.rtt() - (time.monotonic() - window_start)
+                            if remaining > 0:
+                                time.sleep(remaining)
+                except (BrokenPipeError, ConnectionResetError):
+                    self.close_connection = True
+
+            def log_message(self, format, *args):
+                pass
+
+        return Handler
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Servidor de atualizações com rede degradada")
+    parser.add_argument("firmware", help="arquivo .bin servido em /firmware")
+    parser.add_argument("--version", required=True, help="versão anunciada em /version")
+    parser.add_argument("--port", type=int, default=8000)
+    parser.add_argument("--bind", default="127.0.0.1")
+    parser.add_argument("--latency", type=float, default=0, help="RTT base (ms)")
+    parser.add_argument("--jitter", type=float, default=0, help="variação do RTT (ms)")
+    parser.add_argument("--bandwidth", type=float, default=0, help="limite de banda (kbit/s, 0 = sem limite)")
+    parser.add_argument("--loss", type=float, default=0, help="probabilidade de perda por segmento")
+    parser.add_argument("--disconnect-at", type=float, default=0, help="fração do firmware antes da queda")
+    parser.add_argument("--disconnect-count", type=int, default=1, help="requisições de /firmware que caem")
+    parser.add_argument("--window", type=int, default=Profile.window, help="janela de recepção (bytes)")
+    parser.add_argument("--seed", type=int, help="semente do gerador (perdas e jitter reprodutíveis)")
+    args = parser.parse_args()
+
+    with open(args.firmware, "rb") as f:
+        firmware = f.read()
+
+    profile = Profile(args.latency, args.jitter, args.bandwidth, args.loss, args.disconnect_at,
+                      args.disconnect_count, args.window)
+    server = ImpairServer(firmware, args.version, args.port, args.bind, profile, args.seed)
+    print(f"Servindo {args.firmware} ({len(firmware)} bytes) como v{args.version} em "
+          f"http://{args.bind}:{args.port} com {profile}", file=sys.stderr)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    print(server.stats.snapshot(), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,120 @@
+"""
+Matriz de medição do Pull: tamanhos de buffer x perfis de rede.
+
+Para cada OTA_PULL_BUFFER compila bench/pull/bench_pull.cpp no ambiente
+bench_pull (pio run -e bench_pull) e roda --repeat instalações de uma imagem
+de --size bytes contra o impair_server.py em cada perfil. Cada execução usa
+diretórios novos de LittleFS e de flash, então toda medição é uma instalação
+completa.
+
+Uso:
+    python bench/pull/run_bench.py
+    python bench/pull/run_bench.py --buffers 1024 4096 --profiles lan wifi_poor --repeat 5
+    python bench/pull/run_bench.py --binary-pattern "build/bench_pull_{buffer}"   # binários já compilados
+
+Colunas: vazão do download (MB/s), tempo total até a instalação, tentativas
+e sobrecarga de retransmissão (bytes servidos / tamanho da imagem - 1).
+"""
+
+import argparse
+import json
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from impair_server import ImpairServer, Profile  # noqa: E402
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+PROFILES = {
+    "lan": Profile(),
+    "wifi_good": Profile(latency_ms=5, jitter_ms=2, bandwidth_kbps=20000),
+    "wifi_poor": Profile(latency_ms=50, jitter_ms=30, bandwidth_kbps=2000, loss=0.01),
+    "cellular": Profile(latency_ms=100, jitter_ms=50, bandwidth_kbps=1000, loss=0.02),
+    "flaky": Profile(latency_ms=20, jitter_ms=10, bandwidth_kbps=5000, disconnect_at=0.5),
+}
+
+
+def build(buffer):
+    """Compila o bench para um tamanho de buffer e devolve o caminho do binário."""
+    env = dict(os.environ, PLATFORMIO_BUILD_FLAGS=f"-DOTA_PULL_BUFFER={buffer}")
+    subprocess.run(["pio", "run", "-e", "bench_pull"], cwd=ROOT, env=env, check=True,
+                   stdout=subprocess.DEVNULL)
+    target = os.path.join(tempfile.gettempdir(), f"bench_pull_{buffer}")
+    shutil.copy(os.path.join(ROOT, ".pio", "build", "bench_pull", "program"), target)
+    return target
+
+
+def run_once(binary, attempts, retry_delay_ms, timeout):
+    with tempfile.TemporaryDirectory(prefix="bench_pull_") as work:
+        env = dict(os.environ,
+                   OTA_NATIVE_FS_DIR=os.path.join(work, "littlefs"),
+                   OTA_NATIVE_FLASH_DIR=os.path.join(work, "flash"))
+        result = subprocess.run([binary, "http://127.0.0.1", str(attempts), str(retry_delay_ms)],
+                                env=env, capture_output=True, text=True, timeout=timeout)
+    for line in reversed(result.stdout.splitlines()):
+        if line.startswith("{"):
+            return json.loads(line)
+    raise RuntimeError(f"{binary} não reportou resultado (código {result.returncode}):\n{result.stderr}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Matriz de medição do Pull")
+    parser.add_argument("--buffers", type=int, nargs="+", default=[512, 1024, 4096, 8192])
+    parser.add_argument("--profiles", nargs="+", default=list(PROFILES), choices=list(PROFILES))
+    parser.add_argument("--repeat", type=int, default=3)
+    parser.add_argument("--size", type=int, default=1024 * 1024, help="tamanho da imagem (bytes)")
+    parser.add_argument("--attempts", type=int, default=5, help="tentativas por instalação")
+    parser.add_argument("--retry-delay", type=int, default=500, help="intervalo entre tentativas (ms)")
+    parser.add_argument("--timeout", type=float, default=300, help="limite por instalação (s)")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--binary-pattern", help="binários prontos, ex.: build/bench_pull_{buffer}")
+    parser.add_argument("--json", action="store_true", help="uma linha JSON por medição em vez da tabela")
+    args = parser.parse_args()
+
+    # Primeiro byte 0xE9 (magic de imagem do ESP32), resto pseudoaleatório
+    image = b"\xE9" + os.urandom(args.size - 1)
+    # O Pull sempre consulta a porta 8000
+    server = ImpairServer(image, "9.9.9", port=8000, seed=args.seed).start()
+
+    rows = []
+    try:
+        for buffer in args.buffers:
+            binary = args.binary_pattern.format(buffer=buffer) if args.binary_pattern else build(buffer)
+            for name in args.profiles:
+                samples = []
+                for _ in range(args.repeat):
+                    server.reset(PROFILES[name])
+                    sample = run_once(binary, args.attempts, args.retry_delay, args.timeout)
+                    sample["overhead"] = server.stats.snapshot()["bytes_sent"] / args.size - 1
+                    samples.append(sample)
+                    if args.json:
+                        print(json.dumps(dict(sample, buffer=buffer, profile=name)), flush=True)
+                rows.append((buffer, name, samples))
+                if not args.json:
+                    print(f"  {buffer:>6} {name:<10} concluído", file=sys.stderr)
+    finally:
+        server.stop()
+
+    if args.json:
+        return
+
+    print(f"{'buffer':>6}  {'perfil':<10} {'ok':>5} {'MB/s':>7} {'±':>6} {'instalação':>11} "
+          f"{'tentativas':>10} {'sobrecarga':>10}")
+    for buffer, name, samples in rows:
+        ok = [s for s in samples if s["ok"]]
+        speeds = [s["mb_per_s"] for s in ok] or [0.0]
+        install = statistics.median(s["install_ms"] for s in ok) / 1000 if ok else float("nan")
+        attempts = statistics.mean(s["attempts"] for s in samples)
+        overhead = statistics.mean(s["overhead"] for s in samples)
+        spread = statistics.stdev(speeds) if len(speeds) > 1 else 0.0
+        print(f"{buffer:>6}  {name:<10} {len(ok):>2}/{len(samples):<2} {statistics.median(speeds):>7.3f} "
+              f"{spread:>6.3f} {install:>10.2f}s {attempts:>10.1f} {overhead:>9.1%}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,253 @@
+"""
+Teste de carga da interface web do OTAPushUpdateManager.
+
+Simula técnicos abrindo o painel ao mesmo tempo: --concurrency clientes
+repetem requisições às rotas (sorteadas pelo peso) durante --duration
+segundos, cada uma numa conexão nova, como o navegador faz com o WebServer
+síncrono. Um coletor à parte consulta /metrics a cada --scrape-interval
+segundos, como o Prometheus, e registra a memória livre do dispositivo.
+
+Funciona contra o build nativo (pio run -e native) ou um ESP32 na rede:
+    python bench/web/load_test.py 127.0.0.1:8080 --concurrency 4 --duration 30
+    python bench/web/load_test.py 192.168.0.10 -u admin -p senha --route /=3 --route /system=1
+    python bench/web/load_test.py esp32-ota.local --json > carga.json
+
+Para cada rota: requisições, erros, vazão e latência (p50/p90/p99/máx, do
+connect ao último byte). O tempo dos handlers medido pelo dispositivo
+(ota_http_request_duration_seconds) é comparado com a média vista pelo
+cliente: a diferença é o tempo na fila do servidor. /check-updates consulta
+o servidor de atualizações a cada chamada; tire-o da lista com --route se a
+medição não deve chegar até ele.
+"""
+
+import argparse
+import base64
+import http.client
+import json
+import random
+import re
+import sys
+import threading
+import time
+
+DEFAULT_ROUTES = ["/", "/system", "/update", "/check-updates", "/favicon.ico"]
+
+# Rótulo do histograma do dispositivo para cada rota (as páginas dividem um só)
+METRIC_ROUTES = {"/": "page", "/system": "page", "/update": "page", "/favicon.ico": "asset"}
+
+METRIC_LINE = re.compile(r'^ota_http_request_duration_seconds_(sum|count)\{route="([^"]+)"\} (\S+)$')
+
+
+class Target:
+    def __init__(self, address, auth, timeout):
+        host, _, port = address.partition(":")
+        self.host = host
+        self.port = int(port) if port else 80
+        self.auth = auth
+        self.timeout = timeout
+
+    def get(self, path):
+        """GET numa conexão nova; retorna (status, corpo, segundos até o último byte)."""
+        start = time.monotonic()
+        connection = http.client.HTTPConnection(self.host, self.port, timeout=self.timeout)
+        try:
+            headers = {"Connection": "close", "Accept-Encoding": "gzip"}
+            if self.auth:
+                headers["Authorization"] = "Basic " + self.auth
+            connection.request("GET", path, headers=headers)
+            response = connection.getresponse()
+            body = response.read()
+            return response.status, body, time.monotonic() - start
+        finally:
+            connection.close()
+
+
+class Recorder:
+    """Latências e erros por rota, de todos os clientes."""
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.routes = {}
+
+    def add(self, route, seconds, nbytes, error):
+        with self.lock:
+            entry = self.routes.setdefault(route, {"latencies": [], "errors": 0, "bytes": 0, "reasons": {}})
+            if error:
+                entry["errors"] += 1
+                entry["reasons"][error] = entry["reasons"].get(error, 0) + 1
+            else:
+                entry["latencies"].append(seconds)
+                entry["bytes"] += nbytes
+
+
+def percentile(values, fraction):
+    if not values:
+        return float("nan")
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, max(0, int(round(fraction * len(ordered))) - 1))
+    return ordered[index]
+
+
+def request(target, recorder, route):
+    try:
+        status, body, seconds = target.get(route)
+        error = None if status < 400 else "HTTP %d" % status
+        recorder.add(route, seconds, len(body), error)
+        return body if error is None else None
+    except (OSError, http.client.HTTPException) as exc:
+        recorder.add(route, 0.0, 0, type(exc).__name__)
+        return None
+
+
+def parse_metrics(text):
+    """Soma e contagem do histograma de handlers, por rótulo de rota."""
+    handlers = {}
+    for line in text.splitlines():
+        match = METRIC_LINE.match(line)
+        if match:
+            kind, route, value = match.groups()
+            handlers.setdefault(route, {"sum": 0.0, "count": 0})[kind] = float(value)
+        elif line.startswith("ota_heap_free_bytes "):
+            handlers["heap_free"] = int(line.split()[1])
+        elif line.startswith("ota_heap_min_free_bytes "):
+            handlers["heap_min"] = int(line.split()[1])
+    return handlers
+
+
+def scrape(target, recorder):
+    body = request(target, recorder, "/metrics")
+    return parse_metrics(body.decode("utf-8", "replace")) if body is not None else None
+
+
+def client(target, recorder, routes, weights, deadline, think, seed):
+    rng = random.Random(seed)
+    while time.monotonic() < deadline:
+        request(target, recorder, rng.choices(routes, weights)[0])
+        if think:
+            time.sleep(think)
+
+
+def scraper(target, recorder, interval, stop, samples):
+    while not stop.wait(interval):
+        metrics = scrape(target, recorder)
+        if metrics and "heap_free" in metrics:
+            samples.append(metrics["heap_free"])
+
+
+def parse_routes(values):
+    routes, weights = [], []
+    for value in values:
+        path, _, weight = value.partition("=")
+        routes.append(path)
+        weights.append(float(weight) if weight else 1.0)
+    return routes, weights
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Teste de carga da interface web")
+    parser.add_argument("target", help="endereço do dispositivo (host[:porta])")
+    parser.add_argument("--concurrency", type=int, default=4, help="clientes simultâneos")
+    parser.add_argument("--duration", type=float, default=30, help="duração (s)")
+    parser.add_argument("--route", action="append", help="rota[=peso]; pode repetir (padrão: rotas do painel)")
+    parser.add_argument("--think", type=float, default=0, help="pausa de cada cliente entre requisições (ms)")
+    parser.add_argument("--scrape-interval", type=float, default=5, help="intervalo do coletor de /metrics (s, 0 = sem coletor)")
+    parser.add_argument("--timeout", type=float, default=10, help="limite por requisição (s)")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("-u", "--user", help="usuário (autenticação básica)")
+    parser.add_argument("-p", "--password", default="", help="senha")
+    parser.add_argument("--json", action="store_true", help="resultado em JSON em vez da tabela")
+    args = parser.parse_args()
+
+    auth = base64.b64encode(("%s:%s" % (args.user, args.password)).encode()).decode() if args.user else None
+    target = Target(args.target, auth, args.timeout)
+    routes, weights = parse_routes(args.route or DEFAULT_ROUTES)
+
+    # Estado inicial do dispositivo (fora das estatísticas)
+    before = scrape(target, Recorder())
+    if before is None:
+        print("aviso: /metrics indisponível; sem memória nem tempo dos handlers", file=sys.stderr)
+
+    recorder = Recorder()
+    heap_samples = []
+    stop = threading.Event()
+    deadline = time.monotonic() + args.duration
+    threads = [threading.Thread(target=client, args=(target, recorder, routes, weights, deadline,
+                                                     args.think / 1000.0, args.seed + i))
+               for i in range(args.concurrency)]
+    if args.scrape_interval > 0 and before is not None:
+        threads.append(threading.Thread(target=scraper, args=(target, recorder, args.scrape_interval,
+                                                              stop, heap_samples)))
+
+    start = time.monotonic()
+    for thread in threads:
+        thread.start()
+    for thread in threads[:args.concurrency]:
+        thread.join()
+    stop.set()
+    for thread in threads[args.concurrency:]:
+        thread.join()
+    elapsed = time.monotonic() - start
+
+    after = scrape(target, Recorder())
+
+    report = {"target": args.target, "concurrency": args.concurrency, "seconds": round(elapsed, 2), "routes": {}}
+    for route, entry in sorted(recorder.routes.items()):
+        latencies = entry["latencies"]
+        row = {
+            "requests": len(latencies) + entry["errors"],
+            "errors": entry["errors"],
+            "rps": round(len(latencies) / elapsed, 2),
+            "kb_per_s": round(entry["bytes"] / 1024 / elapsed, 1),
+            "p50_ms": round(percentile(latencies, 0.50) * 1000, 1),
+            "p90_ms": round(percentile(latencies, 0.90) * 1000, 1),
+            "p99_ms": round(percentile(latencies, 0.99) * 1000, 1),
+            "max_ms": round(max(latencies) * 1000, 1) if latencies else None,
+            "mean_ms": round(sum(latencies) / len(latencies) * 1000, 1) if latencies else None,
+        }
+        if entry["reasons"]:
+            row["error_reasons"] = entry["reasons"]
+        report["routes"][route] = row
+
+    if before and after:
+        # Tempo médio dos handlers no período, pelo histograma do dispositivo
+        handlers = {}
+        for name, values in after.items():
+            if not isinstance(values, dict):
+                continue
+            previous = before.get(name, {"sum": 0.0, "count": 0})
+            count = values["count"] - previous["count"]
+            if count > 0:
+                handlers[name] = round((values["sum"] - previous["sum"]) / count * 1000, 2)
+        report["handler_mean_ms"] = handlers
+        samples = heap_samples + [after.get("heap_free", 0)]
+        report["heap"] = {
+            "free_start": before.get("heap_free"),
+            "free_end": after.get("heap_free"),
+            "free_lowest_sampled": min(samples),
+            "low_water_start": before.get("heap_min"),
+            "low_water_end": after.get("heap_min"),
+        }
+
+    if args.json:
+        print(json.dumps(report, indent=2))
+        return
+
+    print("%s, %d clientes, %.1f s" % (args.target, args.concurrency, elapsed))
+    print("%-16s %8s %6s %8s %8s %8s %8s %8s %9s" % ("rota", "req", "erros", "req/s", "p50 ms",
+                                                     "p90 ms", "p99 ms", "máx ms", "handler"))
+    for route, row in report["routes"].items():
+        handler = report.get("handler_mean_ms", {}).get(METRIC_ROUTES.get(route, route))
+        print("%-16s %8d %6d %8.2f %8.1f %8.1f %8.1f %8s %9s" % (
+            route, row["requests"], row["errors"], row["rps"], row["p50_ms"], row["p90_ms"], row["p99_ms"],
+            row["max_ms"], "%.1f ms" % handler if handler is not None else "-"))
+    heap = report.get("heap")
+    if heap:
+        print("heap livre: %d -> %d bytes (menor amostra %d); mínimo desde o boot: %d -> %d bytes" % (
+            heap["free_start"], heap["free_end"], heap["free_lowest_sampled"],
+            heap["low_water_start"], heap["low_water_end"]))
+    if any(row["errors"] for row in report["routes"].values()):
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,54 @@
+/**
+ * @file main.cpp
+ * @brief Programa do ambiente nativo: a biblioteca sem alterações no Linux
+ *
+ * Uso: program [url_do_servidor] [porta_web] [manual|automatic|hybrid]
+ *
+ * A interface web fica em http://127.0.0.1:<porta_web>/ e o Pull consulta
+ * <url_do_servidor>:8000/version e /firmware (ver tools/update_server.py).
+ * Variáveis de ambiente:
+ *   OTA_NATIVE_FS_DIR          diretório do LittleFS (padrão ./.native_littlefs)
+ *   OTA_NATIVE_FLASH_DIR       partições fake do Update (padrão ./.native_flash)
+ *   OTA_NATIVE_SNTP_DRIFT_PPM  deslocamento simulado do cristal
+ *   OTA_NATIVE_FILES_PATH      habilita a sincronização de arquivos do Pull (ex: /files)
+ * ESP.restart() encerra o processo com código 0.
+ */
+
+#include <OTAManager.h>
+#include <OTAPullUpdateManager.h>
+
+#include <cstring>
+
+namespace
+{
+    OTAManager::UpdateMode parseMode(const char *name)
+    {
+        if (strcmp(name, "manual") == 0)
+            return OTAManager::MANUAL;
+        if (strcmp(name, "automatic") == 0)
+            return OTAManager::AUTOMATIC;
+        return OTAManager::HYBRID;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *serverUrl = argc > 1 ? argv[1] : "";
+    uint16_t webPort = argc > 2 ? (uint16_t)atoi(argv[2]) : 8080;
+    OTAManager::UpdateMode mode = parseMode(argc > 3 ? argv[3] : "hybrid");
+
+    Serial.begin(115200);
+    WiFi.begin("native");
+
+    if (const char *filesPath = getenv("OTA_NATIVE_FILES_PATH"))
+    {
+        OTAPullUpdateManager::setFilesPath(filesPath);
+    }
+
+    OTAManager::begin(serverUrl, webPort, mode);
+
+    for (;;)
+    {
+        delay(1000);
+    }
+}
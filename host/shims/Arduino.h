@@ -0,0 +1,167 @@
+#pragma once
+
+/**
+ * @file Arduino.h
+ * @brief Shim mínimo do core Arduino-ESP32 para o build nativo (Linux)
+ *
+ * Cobre apenas o que a biblioteca usa: String, Print/Stream, Serial,
+ * millis()/delay(), a classe ESP e os códigos esp_err_t.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <sys/time.h>
+
+#include "WString.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+// Como no arduino-esp32 3.x
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define PGM_P const char *
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void yield();
+
+class Print
+{
+public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--)
+            n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+
+    size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return print(String(v)); }
+    size_t print(unsigned int v) { return print(String(v)); }
+    size_t print(long v) { return print(String(v)); }
+    size_t print(unsigned long v) { return print(String(v)); }
+    size_t print(double v, int digits = 2) { return print(String(v, digits)); }
+    template <typename T>
+    size_t println(const T &v) { return print(v) + println(); }
+    size_t println() { return write((const uint8_t *)"\r\n", 2); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char buf[256];
+        va_list args;
+        va_start(args, format);
+        int len = vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        if (len < 0)
+            return 0;
+        return write((const uint8_t *)buf, std::min<size_t>(len, sizeof(buf) - 1));
+    }
+    virtual void flush() {}
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() { return -1; }
+    void setTimeout(unsigned long timeout) { _timeout = timeout; }
+    unsigned long getTimeout() const { return _timeout; }
+    virtual size_t readBytes(uint8_t *buffer, size_t length)
+    {
+        size_t count = 0;
+        unsigned long start = millis();
+        while (count < length && millis() - start < _timeout)
+        {
+            int c = read();
+            if (c < 0)
+            {
+                delay(1);
+                continue;
+            }
+            buffer[count++] = (uint8_t)c;
+        }
+        return count;
+    }
+    size_t readBytes(char *buffer, size_t length) { return readBytes((uint8_t *)buffer, length); }
+    String readString()
+    {
+        String s;
+        uint8_t buf[256];
+        size_t n;
+        while ((n = readBytes(buf, sizeof(buf))) > 0)
+            s.concat((const char *)buf, n);
+        return s;
+    }
+    String readStringUntil(char terminator)
+    {
+        String s;
+        int c;
+        while ((c = read()) >= 0 && c != terminator)
+            s.concat((char)c);
+        return s;
+    }
+
+protected:
+    unsigned long _timeout = 1000;
+};
+
+class HardwareSerial : public Stream
+{
+public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stdout); }
+    size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    void flush() override { fflush(stdout); }
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+class EspClass
+{
+public:
+    uint32_t getFreeHeap();
+    uint32_t getHeapSize();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getPsramSize() { return 0; }
+    uint32_t getFreePsram() { return 0; }
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getFlashChipSize() { return 4 * 1024 * 1024; }
+    const char *getSdkVersion() { return "native-shim"; }
+    uint32_t getCycleCount();
+    [[noreturn]] void restart();
+};
+
+extern EspClass ESP;
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char *server1,
+                const char *server2 = nullptr, const char *server3 = nullptr);
+bool getLocalTime(struct tm *info, uint32_t ms = 5000);
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
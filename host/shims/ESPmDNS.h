@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Arduino.h"
+
+class MDNSResponder
+{
+public:
+    bool begin(const char *hostname)
+    {
+        _hostname = hostname;
+        return true;
+    }
+    void end() {}
+    void addService(const char *, const char *, uint16_t) {}
+
+private:
+    String _hostname;
+};
+
+extern MDNSResponder MDNS;
@@ -0,0 +1,85 @@
+#pragma once
+
+/**
+ * @file FS.h
+ * @brief Sistema de arquivos do Arduino-ESP32 mapeado para um diretório do host
+ */
+
+#include "Arduino.h"
+#include <memory>
+
+namespace fs
+{
+
+class FileImpl;
+
+class File : public Stream
+{
+public:
+    File() = default;
+    explicit File(std::shared_ptr<FileImpl> impl) : _impl(std::move(impl)) {}
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    size_t read(uint8_t *buffer, size_t size);
+    size_t readBytes(uint8_t *buffer, size_t length) override { return read(buffer, length); }
+    using Stream::readBytes;
+    int peek() override;
+    void flush() override;
+    bool seek(uint32_t pos);
+    size_t position() const;
+    size_t size() const;
+    void close();
+    operator bool() const;
+    const char *path() const;
+    const char *name() const;
+    bool isDirectory() const;
+    File openNextFile(const char *mode = "r");
+
+private:
+    std::shared_ptr<FileImpl> _impl;
+};
+
+class FS
+{
+public:
+    explicit FS(const char *envVar, const char *defaultRoot) : _envVar(envVar), _defaultRoot(defaultRoot) {}
+
+    bool begin(bool formatOnFail = false, const char *basePath = "/littlefs", uint8_t maxOpenFiles = 10,
+               const char *partitionLabel = "spiffs");
+    void end() { _mounted = false; }
+    bool format();
+
+    File open(const char *path, const char *mode = "r", bool create = false);
+    File open(const String &path, const char *mode = "r", bool create = false) { return open(path.c_str(), mode, create); }
+    bool exists(const char *path);
+    bool exists(const String &path) { return exists(path.c_str()); }
+    bool remove(const char *path);
+    bool remove(const String &path) { return remove(path.c_str()); }
+    bool rename(const char *pathFrom, const char *pathTo);
+    bool rename(const String &pathFrom, const String &pathTo) { return rename(pathFrom.c_str(), pathTo.c_str()); }
+    bool mkdir(const char *path);
+    bool mkdir(const String &path) { return mkdir(path.c_str()); }
+    bool rmdir(const char *path);
+    bool rmdir(const String &path) { return rmdir(path.c_str()); }
+    size_t totalBytes() { return 0x70000; }
+    size_t usedBytes();
+
+    /// Diretório do host que representa a raiz do sistema de arquivos
+    String hostRoot() const;
+
+private:
+    const char *_envVar;
+    const char *_defaultRoot;
+    bool _mounted = false;
+
+    String hostPath(const char *path) const;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
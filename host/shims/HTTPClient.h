@@ -0,0 +1,88 @@
+#pragma once
+
+/**
+ * @file HTTPClient.h
+ * @brief Cliente HTTP/1.1 mínimo sobre WiFiClient (build nativo)
+ *
+ * Suporta apenas http:// com Content-Length ou fechamento de conexão,
+ * o suficiente para os endpoints /version e /firmware.
+ */
+
+#include "Arduino.h"
+#include "WiFi.h"
+#include <utility>
+#include <vector>
+
+#define HTTPCLIENT_DEFAULT_TCP_TIMEOUT (5000)
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_STREAM (-6)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_TOO_LESS_RAM (-8)
+#define HTTPC_ERROR_ENCODING (-9)
+#define HTTPC_ERROR_STREAM_WRITE (-10)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+typedef enum
+{
+    HTTP_CODE_OK = 200,
+    HTTP_CODE_PARTIAL_CONTENT = 206,
+    HTTP_CODE_NOT_MODIFIED = 304,
+    HTTP_CODE_BAD_REQUEST = 400,
+    HTTP_CODE_NOT_FOUND = 404,
+    HTTP_CODE_RANGE_NOT_SATISFIABLE = 416,
+    HTTP_CODE_TOO_MANY_REQUESTS = 429,
+    HTTP_CODE_INTERNAL_SERVER_ERROR = 500,
+    HTTP_CODE_SERVICE_UNAVAILABLE = 503
+} t_http_codes;
+
+class HTTPClient
+{
+public:
+    HTTPClient() = default;
+    ~HTTPClient() { end(); }
+
+    bool begin(const String &url);
+    bool begin(WiFiClient &, const String &url) { return begin(url); }
+    void end();
+
+    void setTimeout(uint16_t timeoutMs) { _timeoutMs = timeoutMs; }
+    void setConnectTimeout(int32_t timeoutMs) { _connectTimeoutMs = timeoutMs; }
+    void setUserAgent(const String &userAgent) { _userAgent = userAgent; }
+    void setReuse(bool) {}
+    void addHeader(const String &name, const String &value);
+    void collectHeaders(const char *[], size_t) {}
+
+    int GET();
+    int POST(const String &payload) { return sendRequest("POST", (const uint8_t *)payload.c_str(), payload.length()); }
+    int POST(const uint8_t *payload, size_t size) { return sendRequest("POST", payload, size); }
+    int sendRequest(const char *method, const uint8_t *payload = nullptr, size_t size = 0);
+
+    int getSize() const { return _size; }
+    String getString();
+    WiFiClient *getStreamPtr() { return &_client; }
+    WiFiClient &getStream() { return _client; }
+    bool connected();
+    bool hasHeader(const char *name) const;
+    String header(const char *name) const;
+
+    static String errorToString(int error);
+
+private:
+    String _host;
+    uint16_t _port = 80;
+    String _path;
+    String _userAgent = "ESP32HTTPClient";
+    std::vector<std::pair<String, String>> _requestHeaders;
+    std::vector<std::pair<String, String>> _responseHeaders;
+    WiFiClient _client;
+    int _size = -1;
+    uint16_t _timeoutMs = HTTPCLIENT_DEFAULT_TCP_TIMEOUT;
+    int32_t _connectTimeoutMs = HTTPCLIENT_DEFAULT_TCP_TIMEOUT;
+
+    bool readResponseHeaders(int &code);
+};
@@ -0,0 +1,120 @@
+/**
+ * @file HostCore.cpp
+ * @brief Implementação do core Arduino/ESP-IDF para o build nativo
+ */
+
+#include "Arduino.h"
+#include "ESPmDNS.h"
+#include "HostFlash.h"
+#include "WiFi.h"
+
+#include <chrono>
+#include <malloc.h>
+#include <thread>
+#include <x86intrin.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+MDNSResponder MDNS;
+
+namespace
+{
+const auto kBootTime = std::chrono::steady_clock::now();
+constexpr uint32_t kSimulatedHeapSize = 320 * 1024;
+uint32_t minFreeHeap = kSimulatedHeapSize;
+} // namespace
+
+unsigned long millis()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - kBootTime)
+        .count();
+}
+
+unsigned long micros()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - kBootTime)
+        .count();
+}
+
+void delay(uint32_t ms)
+{
+    HostFlash::waitForCache();
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void yield()
+{
+    HostFlash::waitForCache();
+    std::this_thread::yield();
+}
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char *, const char *, const char *)
+{
+    // O relógio do host já está sincronizado; apenas aplica o fuso horário.
+    char tz[32];
+    long offsetHours = -(gmtOffset_sec + daylightOffset_sec) / 3600;
+    snprintf(tz, sizeof(tz), "UTC%+ld", offsetHours);
+    setenv("TZ", tz, 1);
+    tzset();
+}
+
+bool getLocalTime(struct tm *info, uint32_t)
+{
+    time_t now = time(nullptr);
+    localtime_r(&now, info);
+    return info->tm_year > (2016 - 1900);
+}
+
+esp_reset_reason_t esp_reset_reason()
+{
+    return ESP_RST_POWERON;
+}
+
+uint32_t EspClass::getHeapSize()
+{
+    return kSimulatedHeapSize;
+}
+
+uint32_t EspClass::getFreeHeap()
+{
+    struct mallinfo2 info = mallinfo2();
+    size_t used = info.uordblks;
+    uint32_t freeHeap = used >= kSimulatedHeapSize ? 0 : kSimulatedHeapSize - (uint32_t)used;
+    if (freeHeap < minFreeHeap)
+        minFreeHeap = freeHeap;
+    return freeHeap;
+}
+
+uint32_t EspClass::getMinFreeHeap()
+{
+    getFreeHeap();
+    return minFreeHeap;
+}
+
+uint32_t EspClass::getMaxAllocHeap()
+{
+    return getFreeHeap();
+}
+
+uint32_t EspClass::getCycleCount()
+{
+    // Mesmo ritmo de um ESP32 a 240 MHz
+    return (uint32_t)(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - kBootTime).count() * 240 / 1000);
+}
+
+void EspClass::restart()
+{
+    fflush(stdout);
+    fprintf(stderr, "[native] ESP.restart() solicitado - encerrando processo\n");
+    exit(0);
+}
+
+wl_status_t WiFiClass::begin(const char *ssid, const char *)
+{
+    _ssid = ssid;
+    _status = WL_CONNECTED;
+    return _status;
+}
@@ -0,0 +1,247 @@
+/**
+ * @file HostFS.cpp
+ * @brief LittleFS mapeado para um diretório do host
+ */
+
+#include "LittleFS.h"
+
+#include <cerrno>
+#include <dirent.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+fs::FS LittleFS("OTA_NATIVE_FS_DIR", ".native_littlefs");
+
+namespace fs
+{
+
+class FileImpl
+{
+public:
+    FILE *file = nullptr;
+    DIR *dir = nullptr;
+    String path;
+    String hostPath;
+    String name;
+
+    ~FileImpl()
+    {
+        if (file)
+            fclose(file);
+        if (dir)
+            closedir(dir);
+    }
+};
+
+size_t File::write(const uint8_t *buffer, size_t size)
+{
+    return (_impl && _impl->file) ? fwrite(buffer, 1, size, _impl->file) : 0;
+}
+
+int File::available()
+{
+    if (!_impl || !_impl->file)
+        return 0;
+    long pos = ftell(_impl->file);
+    return (int)(size() - (size_t)pos);
+}
+
+int File::read()
+{
+    if (!_impl || !_impl->file)
+        return -1;
+    int c = fgetc(_impl->file);
+    return c == EOF ? -1 : c;
+}
+
+size_t File::read(uint8_t *buffer, size_t size)
+{
+    return (_impl && _impl->file) ? fread(buffer, 1, size, _impl->file) : 0;
+}
+
+int File::peek()
+{
+    if (!_impl || !_impl->file)
+        return -1;
+    int c = fgetc(_impl->file);
+    if (c != EOF)
+        ungetc(c, _impl->file);
+    return c == EOF ? -1 : c;
+}
+
+void File::flush()
+{
+    if (_impl && _impl->file)
+        fflush(_impl->file);
+}
+
+bool File::seek(uint32_t pos)
+{
+    return _impl && _impl->file && fseek(_impl->file, pos, SEEK_SET) == 0;
+}
+
+size_t File::position() const
+{
+    return (_impl && _impl->file) ? (size_t)ftell(_impl->file) : 0;
+}
+
+size_t File::size() const
+{
+    if (!_impl)
+        return 0;
+    if (_impl->file)
+        fflush(_impl->file);
+    struct stat st;
+    return stat(_impl->hostPath.c_str(), &st) == 0 ? (size_t)st.st_size : 0;
+}
+
+void File::close()
+{
+    _impl.reset();
+}
+
+File::operator bool() const
+{
+    return _impl && (_impl->file || _impl->dir);
+}
+
+const char *File::path() const
+{
+    return _impl ? _impl->path.c_str() : "";
+}
+
+const char *File::name() const
+{
+    return _impl ? _impl->name.c_str() : "";
+}
+
+bool File::isDirectory() const
+{
+    return _impl && _impl->dir;
+}
+
+File File::openNextFile(const char *)
+{
+    if (!_impl || !_impl->dir)
+        return File();
+
+    dirent *entry;
+    while ((entry = readdir(_impl->dir)) != nullptr)
+    {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+            continue;
+
+        auto impl = std::make_shared<FileImpl>();
+        impl->path = _impl->path.endsWith("/") ? _impl->path + entry->d_name : _impl->path + "/" + entry->d_name;
+        impl->hostPath = _impl->hostPath + "/" + entry->d_name;
+        impl->name = entry->d_name;
+
+        struct stat st;
+        if (stat(impl->hostPath.c_str(), &st) == 0 && S_ISDIR(st.st_mode))
+            impl->dir = opendir(impl->hostPath.c_str());
+        else
+            impl->file = fopen(impl->hostPath.c_str(), "rb");
+        return File(impl);
+    }
+    return File();
+}
+
+bool FS::begin(bool, const char *, uint8_t, const char *)
+{
+    String root = hostRoot();
+    ::mkdir(root.c_str(), 0755);
+    struct stat st;
+    _mounted = stat(root.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+    return _mounted;
+}
+
+bool FS::format()
+{
+    String command = "rm -rf '" + hostRoot() + "'";
+    return system(command.c_str()) == 0 && begin();
+}
+
+String FS::hostRoot() const
+{
+    const char *dir = getenv(_envVar);
+    return dir ? String(dir) : String(_defaultRoot);
+}
+
+String FS::hostPath(const char *path) const
+{
+    String p = path ? path : "/";
+    if (!p.startsWith("/"))
+        p = "/" + p;
+    return hostRoot() + p;
+}
+
+File FS::open(const char *path, const char *mode, bool create)
+{
+    auto impl = std::make_shared<FileImpl>();
+    impl->path = path;
+    impl->hostPath = hostPath(path);
+    int slash = impl->path.lastIndexOf('/');
+    impl->name = slash >= 0 ? impl->path.substring(slash + 1) : impl->path;
+
+    struct stat st;
+    bool isDir = stat(impl->hostPath.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+    if (isDir)
+    {
+        impl->dir = opendir(impl->hostPath.c_str());
+        return impl->dir ? File(impl) : File();
+    }
+
+    String fopenMode = String(mode) + "b";
+    if (create && mode[0] != 'r')
+    {
+        // Cria diretórios intermediários, como o LittleFS do ESP32 faz com create=true
+        String dir = impl->hostPath.substring(0, impl->hostPath.lastIndexOf('/'));
+        String command = "mkdir -p '" + dir + "'";
+        if (system(command.c_str()) != 0)
+            return File();
+    }
+    impl->file = fopen(impl->hostPath.c_str(), fopenMode.c_str());
+    return impl->file ? File(impl) : File();
+}
+
+bool FS::exists(const char *path)
+{
+    struct stat st;
+    return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char *path)
+{
+    return ::unlink(hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char *pathFrom, const char *pathTo)
+{
+    return ::rename(hostPath(pathFrom).c_str(), hostPath(pathTo).c_str()) == 0;
+}
+
+bool FS::mkdir(const char *path)
+{
+    return ::mkdir(hostPath(path).c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+bool FS::rmdir(const char *path)
+{
+    return ::rmdir(hostPath(path).c_str()) == 0;
+}
+
+size_t FS::usedBytes()
+{
+    String command = "du -sb '" + hostRoot() + "' 2>/dev/null";
+    FILE *pipe = popen(command.c_str(), "r");
+    if (!pipe)
+        return 0;
+    unsigned long used = 0;
+    if (fscanf(pipe, "%lu", &used) != 1)
+        used = 0;
+    pclose(pipe);
+    return used;
+}
+
+} // namespace fs
@@ -0,0 +1,193 @@
+/**
+ * @file HostFlash.cpp
+ * @brief Modelo de tempo, cache e desgaste da flash (ver HostFlash.h)
+ */
+
+#include "HostFlash.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Timing
+{
+    bool enabled;
+    uint64_t sectorEraseUs;
+    uint64_t blockEraseUs;
+    uint64_t pageProgramUs;
+};
+
+uint64_t envUs(const char *name, uint64_t fallback)
+{
+    const char *value = getenv(name);
+    return value ? strtoull(value, nullptr, 10) : fallback;
+}
+
+const Timing &timing()
+{
+    static const Timing config = {
+        getenv("OTA_NATIVE_FLASH_TIMING") && atoi(getenv("OTA_NATIVE_FLASH_TIMING")) != 0,
+        envUs("OTA_NATIVE_FLASH_SECTOR_ERASE_US", 45000),
+        envUs("OTA_NATIVE_FLASH_BLOCK_ERASE_US", 150000),
+        envUs("OTA_NATIVE_FLASH_PAGE_PROGRAM_US", 400),
+    };
+    return config;
+}
+
+// Mantido pela thread que grava enquanto a flash está ocupada
+std::mutex cacheMutex;
+std::atomic<bool> cacheDisabled{false};
+std::atomic<uint64_t> stallUs{0};
+std::chrono::steady_clock::time_point busyUntil; // Fim da última operação simulada
+
+HostFlash::Stats current = {};
+std::string wearPath;
+std::string statsPath;
+std::vector<uint32_t> wear;   // Apagamentos por setor
+size_t erasedUntil = 0;       // Fim da última região apagada nesta gravação
+
+uint64_t nowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+bool blank(const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        if (data[i] != 0xFF)
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+bool HostFlash::timingEnabled()
+{
+    return timing().enabled;
+}
+
+void HostFlash::begin(const std::string &dir, const char *partition, size_t partitionSize)
+{
+    current = {};
+    stallUs = 0;
+    erasedUntil = 0;
+    wearPath = dir + "/" + partition + ".wear";
+    statsPath = dir + "/flash_stats.json";
+
+    wear.assign(partitionSize / SECTOR_SIZE, 0);
+    if (FILE *file = fopen(wearPath.c_str(), "rb"))
+    {
+        size_t read = fread(wear.data(), sizeof(uint32_t), wear.size(), file);
+        (void)read;
+        fclose(file);
+    }
+}
+
+void HostFlash::busy(uint64_t us)
+{
+    current.busyUs += us;
+    if (!timing().enabled || us == 0)
+        return;
+
+    // Operações seguidas encadeiam no fim da anterior: o atraso do sleep não acumula
+    auto now = std::chrono::steady_clock::now();
+    busyUntil = std::max(now, busyUntil) + std::chrono::microseconds(us);
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cacheDisabled = true;
+    std::this_thread::sleep_until(busyUntil);
+    cacheDisabled = false;
+}
+
+void HostFlash::erase(size_t offset, size_t length, bool block)
+{
+    for (size_t sector = offset / SECTOR_SIZE; sector < (offset + length) / SECTOR_SIZE && sector < wear.size(); sector++)
+        wear[sector]++;
+
+    if (block)
+        current.blockErases++;
+    else
+        current.sectorErases++;
+    erasedUntil = offset + length;
+    busy(block ? timing().blockEraseUs : timing().sectorEraseUs);
+}
+
+void HostFlash::writeSector(size_t offset, const uint8_t *data, size_t length, size_t remaining)
+{
+    // Mesmo critério do Updater do Arduino-ESP32 2.x
+    if (offset >= erasedUntil)
+    {
+        bool block = offset % BLOCK_SIZE == 0 && remaining >= BLOCK_SIZE;
+        erase(offset, block ? BLOCK_SIZE : SECTOR_SIZE, block);
+    }
+
+    if (blank(data, length))
+    {
+        current.skippedSectors++;
+        return;
+    }
+
+    // Uma operação por página: o cache volta a ligar entre elas
+    for (size_t page = 0; page < length; page += PAGE_SIZE)
+    {
+        current.pagePrograms++;
+        busy(timing().pageProgramUs);
+    }
+}
+
+void HostFlash::end()
+{
+    if (wearPath.empty())
+        return;
+
+    if (FILE *file = fopen(wearPath.c_str(), "wb"))
+    {
+        fwrite(wear.data(), sizeof(uint32_t), wear.size(), file);
+        fclose(file);
+    }
+
+    Stats result = stats();
+    if (FILE *file = fopen(statsPath.c_str(), "w"))
+    {
+        fprintf(file,
+                "{\"sector_erases\":%u,\"block_erases\":%u,\"page_programs\":%u,\"skipped_sectors\":%u,"
+                "\"busy_ms\":%.1f,\"stall_ms\":%.1f,\"max_wear\":%u,\"timing\":%s}\n",
+                result.sectorErases, result.blockErases, result.pagePrograms, result.skippedSectors,
+                result.busyUs / 1000.0, result.stallUs / 1000.0, result.maxWear,
+                timing().enabled ? "true" : "false");
+        fclose(file);
+    }
+    wearPath.clear();
+}
+
+void HostFlash::waitForCache()
+{
+    if (!cacheDisabled)
+        return;
+
+    uint64_t start = nowUs();
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    stallUs += nowUs() - start;
+}
+
+HostFlash::Stats HostFlash::stats()
+{
+    Stats result = current;
+    result.stallUs = stallUs;
+    for (uint32_t count : wear)
+    {
+        if (count > result.maxWear)
+            result.maxWear = count;
+    }
+    return result;
+}
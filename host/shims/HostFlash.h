@@ -0,0 +1,81 @@
+#pragma once
+
+/**
+ * @file HostFlash.h
+ * @brief Modelo de tempo e desgaste da flash SPI para o shim do Update
+ *
+ * O UpdateClass do shim grava em setores de 4 KB como o do Arduino-ESP32
+ * 2.x: bloco de 64 KB apagado de uma vez quando alinhado e com 64 KB ou mais
+ * pela frente, setor de 4 KB no resto, e setor só com 0xFF não programado.
+ * Cada apagamento conta no desgaste do setor, e os contadores são mantidos
+ * em <OTA_NATIVE_FLASH_DIR>/<partição>.wear entre execuções.
+ *
+ * Com OTA_NATIVE_FLASH_TIMING=1 as operações também levam o tempo da flash
+ * real, e durante elas o cache fica "desligado": as outras threads que
+ * chamarem delay()/yield()/vTaskDelay() esperam a operação terminar (no
+ * ESP32 nenhuma task rodando da flash executa nesse intervalo). Tempos em
+ * microssegundos, ajustáveis por variáveis de ambiente:
+ *   OTA_NATIVE_FLASH_SECTOR_ERASE_US  apagar 4 KB (padrão 45000)
+ *   OTA_NATIVE_FLASH_BLOCK_ERASE_US   apagar 64 KB (padrão 150000)
+ *   OTA_NATIVE_FLASH_PAGE_PROGRAM_US  programar 256 bytes (padrão 400)
+ *
+ * Ao fim de cada gravação as estatísticas vão para
+ * <OTA_NATIVE_FLASH_DIR>/flash_stats.json.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class HostFlash
+{
+public:
+    static const size_t SECTOR_SIZE = 4096;
+    static const size_t BLOCK_SIZE = 65536;
+    static const size_t PAGE_SIZE = 256;
+
+    struct Stats
+    {
+        uint32_t sectorErases;
+        uint32_t blockErases;
+        uint32_t pagePrograms;
+        uint32_t skippedSectors; ///< Setores só com 0xFF, não programados
+        uint64_t busyUs;         ///< Tempo de flash ocupada (cache desligado)
+        uint64_t stallUs;        ///< Tempo que outras threads esperaram pelo cache
+        uint32_t maxWear;        ///< Maior número de apagamentos de um setor da partição
+    };
+
+    /**
+     * @brief Início de uma gravação na partição (zera as estatísticas)
+     * @param dir Diretório das partições fake
+     * @param partition Nome da partição (app_next, spiffs)
+     * @param partitionSize Tamanho da partição em bytes
+     */
+    static void begin(const std::string &dir, const char *partition, size_t partitionSize);
+
+    /**
+     * @brief Apaga (se preciso) e programa um setor
+     * @param offset Posição do setor na partição (múltiplo de SECTOR_SIZE)
+     * @param data Conteúdo (até SECTOR_SIZE bytes)
+     * @param remaining Bytes da imagem a partir de offset (decide o apagamento em bloco)
+     */
+    static void writeSector(size_t offset, const uint8_t *data, size_t length, size_t remaining);
+
+    /**
+     * @brief Fim da gravação: salva o desgaste e as estatísticas
+     */
+    static void end();
+
+    /**
+     * @brief Espera uma operação em andamento liberar o cache
+     * Chamado por delay(), yield() e vTaskDelay() do shim
+     */
+    static void waitForCache();
+
+    static Stats stats();
+    static bool timingEnabled();
+
+private:
+    static void busy(uint64_t us);
+    static void erase(size_t offset, size_t length, bool block);
+};
@@ -0,0 +1,211 @@
+/**
+ * @file HostFreeRTOS.cpp
+ * @brief Tasks e mutexes do FreeRTOS implementados com pthreads
+ */
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "Arduino.h"
+
+#include <mutex>
+#include <pthread.h>
+#include <string>
+#include <time.h>
+#include <vector>
+
+struct HostTask
+{
+    pthread_t thread;
+    TaskFunction_t function;
+    void *parameters;
+    std::string name;
+    uint32_t stackDepth;
+    UBaseType_t priority;
+    BaseType_t core;
+    clockid_t clock;
+};
+
+struct HostSemaphore
+{
+    pthread_mutex_t mutex;
+};
+
+namespace
+{
+thread_local HostTask *currentTask = nullptr;
+
+std::mutex &taskListMutex() { static std::mutex m; return m; }
+std::vector<HostTask *> &taskList() { static std::vector<HostTask *> list; return list; }
+
+void *taskEntry(void *arg)
+{
+    HostTask *task = static_cast<HostTask *>(arg);
+    currentTask = task;
+    pthread_getcpuclockid(pthread_self(), &task->clock);
+    pthread_setname_np(pthread_self(), task->name.substr(0, 15).c_str());
+    task->function(task->parameters);
+    return nullptr;
+}
+} // namespace
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name,
+                                   uint32_t stackDepth, void *parameters,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t core)
+{
+    HostTask *task = new HostTask{pthread_t(), function, parameters, name ? name : "task", stackDepth, priority, core, CLOCK_THREAD_CPUTIME_ID};
+    {
+        std::lock_guard<std::mutex> lock(taskListMutex());
+        taskList().push_back(task);
+    }
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    // A stack do host precisa de folga: libc e sockets usam mais que no ESP32
+    pthread_attr_setstacksize(&attr, std::max<size_t>(stackDepth * 4, 256 * 1024));
+    int rc = pthread_create(&task->thread, &attr, taskEntry, task);
+    pthread_attr_destroy(&attr);
+
+    if (rc != 0)
+    {
+        delete task;
+        return pdFAIL;
+    }
+    if (handle)
+        *handle = task;
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task == nullptr || task == currentTask)
+    {
+        // A memória do HostTask é mantida: handles podem ainda ser consultados
+        pthread_exit(nullptr);
+    }
+    pthread_cancel(task->thread);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    delay(ticks * portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return currentTask;
+}
+
+TickType_t xTaskGetTickCount()
+{
+    return (TickType_t)(millis() / portTICK_PERIOD_MS);
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+{
+    // Sem instrumentação de stack no host: informa a stack inteira como livre
+    return task ? task->stackDepth : 0;
+}
+
+BaseType_t xPortGetCoreID()
+{
+    return 0;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    HostSemaphore *semaphore = new HostSemaphore;
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&semaphore->mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+    return semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    if (ticks == portMAX_DELAY)
+        return pthread_mutex_lock(&semaphore->mutex) == 0 ? pdTRUE : pdFALSE;
+
+    unsigned long start = millis();
+    do
+    {
+        if (pthread_mutex_trylock(&semaphore->mutex) == 0)
+            return pdTRUE;
+        delay(1);
+    } while (millis() - start < ticks * portTICK_PERIOD_MS);
+    return pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    return pthread_mutex_unlock(&semaphore->mutex) == 0 ? pdTRUE : pdFALSE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    pthread_mutex_destroy(&semaphore->mutex);
+    delete semaphore;
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task)
+{
+    task = task ? task : currentTask;
+    return task ? task->priority : 1;
+}
+
+BaseType_t xTaskGetAffinity(TaskHandle_t task)
+{
+    task = task ? task : currentTask;
+    return task ? task->core : tskNO_AFFINITY;
+}
+
+TaskHandle_t xTaskGetHandle(const char *name)
+{
+    std::lock_guard<std::mutex> lock(taskListMutex());
+    for (HostTask *task : taskList())
+    {
+        if (task->name == name)
+            return task;
+    }
+    return nullptr;
+}
+
+UBaseType_t uxTaskGetNumberOfTasks()
+{
+    std::lock_guard<std::mutex> lock(taskListMutex());
+    return taskList().size();
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *states, UBaseType_t count, uint32_t *totalRunTime)
+{
+    // Contadores em microssegundos; o total é o tempo de parede (um núcleo)
+    std::lock_guard<std::mutex> lock(taskListMutex());
+    UBaseType_t n = 0;
+    for (HostTask *task : taskList())
+    {
+        if (n >= count)
+            break;
+        struct timespec ts = {};
+        clock_gettime(task->clock, &ts);
+        states[n++] = {task, task->name.c_str(), (uint32_t)(ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000)};
+    }
+    if (totalRunTime)
+        *totalRunTime = (uint32_t)micros();
+    return n;
+}
+
+TaskHandle_t xTaskGetIdleTaskHandleForCPU(UBaseType_t)
+{
+    return nullptr; // Sem tasks IDLE no host
+}
+
+char *pcTaskGetName(TaskHandle_t task)
+{
+    task = task ? task : currentTask;
+    static char mainName[] = "main";
+    return task ? &task->name[0] : mainName;
+}
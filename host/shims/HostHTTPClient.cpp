@@ -0,0 +1,213 @@
+/**
+ * @file HostHTTPClient.cpp
+ * @brief HTTPClient mínimo para o build nativo
+ */
+
+#include "HTTPClient.h"
+
+bool HTTPClient::begin(const String &url)
+{
+    end();
+    _responseHeaders.clear();
+    _size = -1;
+
+    String rest = url;
+    if (rest.startsWith("http://"))
+    {
+        rest = rest.substring(7);
+        _port = 80;
+    }
+    else if (rest.startsWith("https://"))
+    {
+        fprintf(stderr, "[native] HTTPClient: https não suportado no build nativo: %s\n", url.c_str());
+        return false;
+    }
+
+    int slash = rest.indexOf('/');
+    String hostPort = slash >= 0 ? rest.substring(0, slash) : rest;
+    _path = slash >= 0 ? rest.substring(slash) : String("/");
+
+    int colon = hostPort.indexOf(':');
+    if (colon >= 0)
+    {
+        _host = hostPort.substring(0, colon);
+        _port = (uint16_t)hostPort.substring(colon + 1).toInt();
+    }
+    else
+    {
+        _host = hostPort;
+    }
+    return !_host.isEmpty();
+}
+
+void HTTPClient::end()
+{
+    _client.stop();
+    _requestHeaders.clear();
+}
+
+void HTTPClient::addHeader(const String &name, const String &value)
+{
+    _requestHeaders.emplace_back(name, value);
+}
+
+int HTTPClient::GET()
+{
+    return sendRequest("GET");
+}
+
+int HTTPClient::sendRequest(const char *method, const uint8_t *payload, size_t size)
+{
+    if (_host.isEmpty())
+        return HTTPC_ERROR_CONNECTION_REFUSED;
+    if (!_client.connect(_host.c_str(), _port, _connectTimeoutMs))
+        return HTTPC_ERROR_CONNECTION_REFUSED;
+    _client.setTimeout(_timeoutMs);
+
+    String request = String(method) + " " + _path + " HTTP/1.1\r\n";
+    request += "Host: " + _host + ":" + String(_port) + "\r\n";
+    request += "User-Agent: " + _userAgent + "\r\n";
+    request += "Connection: close\r\n";
+    for (const auto &header : _requestHeaders)
+        request += header.first + ": " + header.second + "\r\n";
+    if (payload != nullptr || strcmp(method, "POST") == 0 || strcmp(method, "PUT") == 0)
+        request += "Content-Length: " + String((unsigned long)size) + "\r\n";
+    request += "\r\n";
+
+    if (_client.write((const uint8_t *)request.c_str(), request.length()) != request.length())
+        return HTTPC_ERROR_SEND_HEADER_FAILED;
+    if (payload != nullptr && size > 0 && _client.write(payload, size) != size)
+        return HTTPC_ERROR_SEND_PAYLOAD_FAILED;
+
+    int code = 0;
+    if (!readResponseHeaders(code))
+        return HTTPC_ERROR_READ_TIMEOUT;
+    return code;
+}
+
+bool HTTPClient::readResponseHeaders(int &code)
+{
+    String line;
+    bool statusLine = true;
+    _responseHeaders.clear();
+    _size = -1;
+
+    unsigned long start = millis();
+    while (millis() - start < _timeoutMs)
+    {
+        uint8_t c;
+        if (_client.readBytes(&c, 1) != 1)
+        {
+            if (!_client.connected())
+                return false;
+            continue;
+        }
+        if (c == '\r')
+            continue;
+        if (c != '\n')
+        {
+            line += (char)c;
+            continue;
+        }
+
+        if (statusLine)
+        {
+            int space = line.indexOf(' ');
+            if (space < 0)
+                return false;
+            code = line.substring(space + 1).toInt();
+            statusLine = false;
+        }
+        else if (line.isEmpty())
+        {
+            return true;
+        }
+        else
+        {
+            int colon = line.indexOf(':');
+            if (colon > 0)
+            {
+                String name = line.substring(0, colon);
+                String value = line.substring(colon + 1);
+                value.trim();
+                if (name.equalsIgnoreCase("Content-Length"))
+                    _size = (int)value.toInt();
+                _responseHeaders.emplace_back(name, value);
+            }
+        }
+        line = "";
+    }
+    return false;
+}
+
+String HTTPClient::getString()
+{
+    String body;
+    uint8_t buffer[1024];
+    size_t remaining = _size >= 0 ? (size_t)_size : SIZE_MAX;
+    while (remaining > 0)
+    {
+        size_t n = _client.readBytes(buffer, std::min(sizeof(buffer), remaining));
+        if (n == 0)
+            break;
+        body.concat((const char *)buffer, n);
+        remaining -= n;
+    }
+    return body;
+}
+
+bool HTTPClient::connected()
+{
+    return _client.connected() || _client.available() > 0;
+}
+
+bool HTTPClient::hasHeader(const char *name) const
+{
+    for (const auto &header : _responseHeaders)
+    {
+        if (header.first.equalsIgnoreCase(name))
+            return true;
+    }
+    return false;
+}
+
+String HTTPClient::header(const char *name) const
+{
+    for (const auto &header : _responseHeaders)
+    {
+        if (header.first.equalsIgnoreCase(name))
+            return header.second;
+    }
+    return String();
+}
+
+String HTTPClient::errorToString(int error)
+{
+    switch (error)
+    {
+    case HTTPC_ERROR_CONNECTION_REFUSED:
+        return "connection refused";
+    case HTTPC_ERROR_SEND_HEADER_FAILED:
+        return "send header failed";
+    case HTTPC_ERROR_SEND_PAYLOAD_FAILED:
+        return "send payload failed";
+    case HTTPC_ERROR_NOT_CONNECTED:
+        return "not connected";
+    case HTTPC_ERROR_CONNECTION_LOST:
+        return "connection lost";
+    case HTTPC_ERROR_NO_STREAM:
+        return "no stream";
+    case HTTPC_ERROR_NO_HTTP_SERVER:
+        return "no HTTP server";
+    case HTTPC_ERROR_TOO_LESS_RAM:
+        return "too less ram";
+    case HTTPC_ERROR_ENCODING:
+        return "Transfer-Encoding not supported";
+    case HTTPC_ERROR_STREAM_WRITE:
+        return "Stream write error";
+    case HTTPC_ERROR_READ_TIMEOUT:
+        return "read Timeout";
+    default:
+        return String();
+    }
+}
@@ -0,0 +1,111 @@
+/**
+ * @file HostMD5.cpp
+ * @brief MD5Builder em software (sem mbedtls)
+ */
+
+#include "MD5Builder.h"
+
+#include <cmath>
+
+namespace
+{
+uint32_t rotl(uint32_t x, int n)
+{
+    return (x << n) | (x >> (32 - n));
+}
+
+// Um bloco de 64 bytes do MD5 (RFC 1321)
+void md5Compress(uint32_t state[4], const uint8_t block[64])
+{
+    static uint32_t k[64];
+    static const uint8_t shift[16] = {7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21};
+    if (k[0] == 0)
+    {
+        for (int i = 0; i < 64; i++)
+            k[i] = (uint32_t)(std::fabs(std::sin(i + 1.0)) * 4294967296.0);
+    }
+
+    uint32_t m[16];
+    for (int i = 0; i < 16; i++)
+        m[i] = block[i * 4] | block[i * 4 + 1] << 8 | block[i * 4 + 2] << 16 | (uint32_t)block[i * 4 + 3] << 24;
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    for (int i = 0; i < 64; i++)
+    {
+        uint32_t f;
+        int g;
+        if (i < 16)
+            f = (b & c) | (~b & d), g = i;
+        else if (i < 32)
+            f = (d & b) | (~d & c), g = (5 * i + 1) % 16;
+        else if (i < 48)
+            f = b ^ c ^ d, g = (3 * i + 5) % 16;
+        else
+            f = c ^ (b | ~d), g = (7 * i) % 16;
+
+        f += a + k[i] + m[g];
+        a = d;
+        d = c;
+        c = b;
+        b += rotl(f, shift[(i / 16) * 4 + i % 4]);
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+}
+} // namespace
+
+void MD5Builder::begin()
+{
+    _state[0] = 0x67452301;
+    _state[1] = 0xefcdab89;
+    _state[2] = 0x98badcfe;
+    _state[3] = 0x10325476;
+    _bytes = 0;
+}
+
+void MD5Builder::add(const uint8_t *data, size_t len)
+{
+    while (len > 0)
+    {
+        size_t used = _bytes % 64;
+        size_t n = std::min(len, 64 - used);
+        memcpy(_block + used, data, n);
+        _bytes += n;
+        data += n;
+        len -= n;
+        if (used + n == 64)
+            md5Compress(_state, _block);
+    }
+}
+
+void MD5Builder::calculate()
+{
+    uint64_t bits = _bytes * 8;
+    uint8_t pad = 0x80;
+    add(&pad, 1);
+    pad = 0;
+    while (_bytes % 64 != 56)
+        add(&pad, 1);
+    uint8_t length[8];
+    for (int i = 0; i < 8; i++)
+        length[i] = (uint8_t)(bits >> (8 * i));
+    add(length, 8);
+
+    for (int i = 0; i < 16; i++)
+        _digest[i] = (uint8_t)(_state[i / 4] >> (8 * (i % 4)));
+}
+
+void MD5Builder::getChars(char *output) const
+{
+    for (int i = 0; i < 16; i++)
+        snprintf(output + i * 2, 3, "%02x", _digest[i]);
+}
+
+String MD5Builder::toString() const
+{
+    char out[33];
+    getChars(out);
+    return String(out);
+}
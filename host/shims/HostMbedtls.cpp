@@ -0,0 +1,42 @@
+#include <mbedtls/sha1.h>
+#include <mbedtls/base64.h>
+#include <string.h>
+static uint32_t rol(uint32_t v, int n) { return (v << n) | (v >> (32 - n)); }
+int mbedtls_sha1_ret(const unsigned char *in, size_t len, unsigned char out[20])
+{
+    uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+    size_t total = ((len + 8) / 64 + 1) * 64;
+    unsigned char *m = new unsigned char[total]();
+    memcpy(m, in, len); m[len] = 0x80;
+    uint64_t bits = (uint64_t)len * 8;
+    for (int i = 0; i < 8; i++) m[total - 1 - i] = bits >> (8 * i);
+    for (size_t o = 0; o < total; o += 64)
+    {
+        uint32_t w[80];
+        for (int i = 0; i < 16; i++) w[i] = (m[o+4*i]<<24)|(m[o+4*i+1]<<16)|(m[o+4*i+2]<<8)|m[o+4*i+3];
+        for (int i = 16; i < 80; i++) w[i] = rol(w[i-3]^w[i-8]^w[i-14]^w[i-16], 1);
+        uint32_t a=h[0],b=h[1],c=h[2],d=h[3],e=h[4];
+        for (int i = 0; i < 80; i++)
+        {
+            uint32_t f,k;
+            if (i<20){f=(b&c)|(~b&d);k=0x5A827999;} else if(i<40){f=b^c^d;k=0x6ED9EBA1;} else if(i<60){f=(b&c)|(b&d)|(c&d);k=0x8F1BBCDC;} else {f=b^c^d;k=0xCA62C1D6;}
+            uint32_t t=rol(a,5)+f+e+k+w[i]; e=d;d=c;c=rol(b,30);b=a;a=t;
+        }
+        h[0]+=a;h[1]+=b;h[2]+=c;h[3]+=d;h[4]+=e;
+    }
+    delete[] m;
+    for (int i = 0; i < 20; i++) out[i] = h[i/4] >> (24 - 8*(i%4));
+    return 0;
+}
+int mbedtls_base64_encode(unsigned char *dst, size_t dlen, size_t *olen, const unsigned char *src, size_t slen)
+{
+    static const char t[]="ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    size_t n = 0;
+    for (size_t i = 0; i < slen; i += 3)
+    {
+        uint32_t v = src[i] << 16 | (i+1<slen?src[i+1]<<8:0) | (i+2<slen?src[i+2]:0);
+        dst[n++]=t[v>>18&63]; dst[n++]=t[v>>12&63];
+        dst[n++]= i+1<slen?t[v>>6&63]:'='; dst[n++]= i+2<slen?t[v&63]:'=';
+    }
+    dst[n]=0; *olen=n; (void)dlen; return 0;
+}
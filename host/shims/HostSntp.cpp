@@ -0,0 +1,44 @@
+#include "esp_sntp.h"
+#include "Arduino.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+
+namespace
+{
+std::atomic<bool> enabled{false};
+std::atomic<uint32_t> intervalMs{3600000};
+sntp_sync_time_cb_t syncCallback = nullptr;
+}
+
+bool sntp_enabled() { return enabled; }
+void sntp_stop() { enabled = false; }
+void sntp_setoperatingmode(int) {}
+void sntp_setservername(int, const char *) {}
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) { syncCallback = callback; }
+void sntp_set_sync_interval(uint32_t interval_ms) { intervalMs = interval_ms; }
+uint32_t sntp_get_sync_interval() { return intervalMs; }
+
+void sntp_init()
+{
+    enabled = true;
+    std::thread([] {
+        const char *driftEnv = getenv("OTA_NATIVE_SNTP_DRIFT_PPM");
+        double drift = driftEnv ? atof(driftEnv) : 0;
+        delay(200); // Resposta do servidor
+        while (enabled)
+        {
+            // O "servidor" anda (1 + drift) vezes mais rápido que millis()
+            struct timeval tv;
+            gettimeofday(&tv, nullptr);
+            double extraMs = millis() * drift / 1e6;
+            int64_t us = (int64_t)tv.tv_sec * 1000000 + tv.tv_usec + (int64_t)(extraMs * 1000);
+            tv.tv_sec = us / 1000000;
+            tv.tv_usec = us % 1000000;
+            if (syncCallback)
+                syncCallback(&tv);
+            delay(intervalMs);
+        }
+    }).detach();
+}
@@ -0,0 +1,295 @@
+/**
+ * @file HostUpdate.cpp
+ * @brief UpdateClass gravando a imagem em arquivos (partição fake)
+ */
+
+#include "Update.h"
+#include "HostFlash.h"
+#include "esp_ota_ops.h"
+
+#include <sys/stat.h>
+
+UpdateClass Update;
+
+namespace
+{
+constexpr size_t kAppPartitionSize = 0x1C0000;    // app0/app1 em partitions.csv
+constexpr size_t kSpiffsPartitionSize = 0x70000;  // spiffs em partitions.csv
+
+String flashDir()
+{
+    const char *dir = getenv("OTA_NATIVE_FLASH_DIR");
+    String path = dir ? dir : ".native_flash";
+    mkdir(path.c_str(), 0755);
+    return path;
+}
+
+const esp_partition_t kApp0 = {0x10000, kAppPartitionSize, "app0"};
+const esp_partition_t kApp1 = {0x1D0000, kAppPartitionSize, "app1"};
+} // namespace
+
+// ============ PARTIÇÕES DE APP (esp_ota_ops.h) ============
+
+const esp_partition_t *esp_ota_get_running_partition()
+{
+    return &kApp0;
+}
+
+const esp_partition_t *esp_ota_get_next_update_partition(const esp_partition_t *)
+{
+    return &kApp1;
+}
+
+const esp_partition_t *esp_ota_get_boot_partition()
+{
+    FILE *file = fopen((flashDir() + "/otadata").c_str(), "r");
+    if (file == nullptr)
+        return &kApp0;
+    char label[17] = "";
+    fscanf(file, "%16s", label);
+    fclose(file);
+    return strcmp(label, kApp1.label) == 0 ? &kApp1 : &kApp0;
+}
+
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t *partition)
+{
+    if (partition != &kApp0 && partition != &kApp1)
+        return ESP_ERR_INVALID_ARG;
+    FILE *file = fopen((flashDir() + "/otadata").c_str(), "w");
+    if (file == nullptr)
+        return ESP_FAIL;
+    fprintf(file, "%s\n", partition->label);
+    fclose(file);
+    return ESP_OK;
+}
+
+// ============ UPDATE ============
+
+size_t UpdateClass::partitionSize() const
+{
+    return _command == U_SPIFFS ? kSpiffsPartitionSize : kAppPartitionSize;
+}
+
+String UpdateClass::partitionPath(bool staging) const
+{
+    String name = _command == U_SPIFFS ? "spiffs" : "app_next";
+    return flashDir() + "/" + name + (staging ? ".partial" : ".bin");
+}
+
+bool UpdateClass::begin(size_t size, int command, int, uint8_t, const char *)
+{
+    if (_running)
+    {
+        _error = UPDATE_ERROR_BAD_ARGUMENT;
+        return false;
+    }
+    if (command != U_FLASH && command != U_SPIFFS)
+    {
+        _error = UPDATE_ERROR_BAD_ARGUMENT;
+        return false;
+    }
+
+    _command = command;
+    _error = UPDATE_ERROR_OK;
+    if (size == 0 || (size != UPDATE_SIZE_UNKNOWN && size > partitionSize()))
+    {
+        _error = UPDATE_ERROR_SPACE;
+        return false;
+    }
+
+    _file = fopen(partitionPath(true).c_str(), "wb");
+    if (_file == nullptr)
+    {
+        _error = UPDATE_ERROR_NO_PARTITION;
+        return false;
+    }
+
+    _size = size == UPDATE_SIZE_UNKNOWN ? partitionSize() : size;
+    _progress = 0;
+    _bufferLen = 0;
+    _written = 0;
+    _running = true;
+    _targetMd5[0] = '\0';
+    _md5.begin();
+    HostFlash::begin(flashDir().c_str(), _command == U_SPIFFS ? "spiffs" : "app_next", partitionSize());
+    return true;
+}
+
+size_t UpdateClass::write(uint8_t *data, size_t len)
+{
+    if (!_running || hasError())
+        return 0;
+
+    if (_progress + len > _size)
+    {
+        _error = UPDATE_ERROR_SPACE;
+        return 0;
+    }
+    if (_progress == 0 && _command == U_FLASH && len > 0 && data[0] != 0xE9)
+    {
+        _error = UPDATE_ERROR_MAGIC_BYTE;
+        return 0;
+    }
+
+    _md5.add(data, len);
+    size_t left = len;
+    while (left > 0)
+    {
+        size_t n = std::min(left, sizeof(_buffer) - _bufferLen);
+        memcpy(_buffer + _bufferLen, data, n);
+        _bufferLen += n;
+        data += n;
+        left -= n;
+        if (_bufferLen == sizeof(_buffer) && !writeBuffer())
+            return len - left - n;
+    }
+    _progress += len;
+    return len;
+}
+
+bool UpdateClass::setMD5(const char *expectedMD5)
+{
+    if (expectedMD5 == nullptr || strlen(expectedMD5) != 32)
+        return false;
+    for (int i = 0; i < 32; i++)
+        _targetMd5[i] = (char)tolower((unsigned char)expectedMD5[i]);
+    _targetMd5[32] = '\0';
+    return true;
+}
+
+bool UpdateClass::writeBuffer()
+{
+    HostFlash::writeSector(_written, _buffer, _bufferLen, _size - _written);
+    if (fwrite(_buffer, 1, _bufferLen, _file) != _bufferLen)
+    {
+        _error = UPDATE_ERROR_WRITE;
+        return false;
+    }
+    _written += _bufferLen;
+    _bufferLen = 0;
+    return true;
+}
+
+size_t UpdateClass::writeStream(Stream &data)
+{
+    uint8_t buffer[4096];
+    size_t total = 0;
+    while (_running && !hasError())
+    {
+        size_t toRead = std::min(sizeof(buffer), _size - _progress);
+        if (toRead == 0)
+            break;
+        size_t n = data.readBytes(buffer, toRead);
+        if (n == 0)
+            break;
+        total += write(buffer, n);
+    }
+    return total;
+}
+
+bool UpdateClass::end(bool evenIfRemaining)
+{
+    if (!_running || hasError())
+    {
+        abort();
+        return false;
+    }
+
+    if (_progress != _size && !evenIfRemaining)
+    {
+        _error = UPDATE_ERROR_SIZE;
+        abort();
+        return false;
+    }
+    if (_progress == 0)
+    {
+        _error = UPDATE_ERROR_SIZE;
+        abort();
+        return false;
+    }
+
+    if (_targetMd5[0] != '\0')
+    {
+        char md5[33];
+        _md5.calculate();
+        _md5.getChars(md5);
+        if (strcmp(md5, _targetMd5) != 0)
+        {
+            _error = UPDATE_ERROR_MD5;
+            abort();
+            return false;
+        }
+    }
+
+    if (_bufferLen > 0 && !writeBuffer())
+    {
+        abort();
+        return false;
+    }
+
+    fclose(_file);
+    _file = nullptr;
+    _running = false;
+    HostFlash::end();
+    if (::rename(partitionPath(true).c_str(), partitionPath(false).c_str()) != 0)
+    {
+        _error = UPDATE_ERROR_ACTIVATE;
+        return false;
+    }
+    _size = _progress;
+    if (_command == U_FLASH && esp_ota_set_boot_partition(esp_ota_get_next_update_partition(nullptr)) != ESP_OK)
+    {
+        _error = UPDATE_ERROR_ACTIVATE;
+        return false;
+    }
+    return true;
+}
+
+void UpdateClass::abort()
+{
+    if (_file)
+    {
+        fclose(_file);
+        _file = nullptr;
+        ::remove(partitionPath(true).c_str());
+        HostFlash::end();
+    }
+    if (_running && _error == UPDATE_ERROR_OK)
+        _error = UPDATE_ERROR_ABORT;
+    _running = false;
+}
+
+const char *UpdateClass::errorString()
+{
+    switch (_error)
+    {
+    case UPDATE_ERROR_OK:
+        return "No Error";
+    case UPDATE_ERROR_WRITE:
+        return "Flash Write Failed";
+    case UPDATE_ERROR_ERASE:
+        return "Flash Erase Failed";
+    case UPDATE_ERROR_READ:
+        return "Flash Read Failed";
+    case UPDATE_ERROR_SPACE:
+        return "Not Enough Space";
+    case UPDATE_ERROR_SIZE:
+        return "Bad Size Given";
+    case UPDATE_ERROR_STREAM:
+        return "Stream Read Timeout";
+    case UPDATE_ERROR_MD5:
+        return "MD5 Check Failed";
+    case UPDATE_ERROR_MAGIC_BYTE:
+        return "Wrong Magic Byte";
+    case UPDATE_ERROR_ACTIVATE:
+        return "Could Not Activate The Firmware";
+    case UPDATE_ERROR_NO_PARTITION:
+        return "Partition Could Not be Found";
+    case UPDATE_ERROR_BAD_ARGUMENT:
+        return "Bad Argument";
+    case UPDATE_ERROR_ABORT:
+        return "Aborted";
+    default:
+        return "UNKNOWN";
+    }
+}
@@ -0,0 +1,687 @@
+/**
+ * @file HostWebServer.cpp
+ * @brief WebServer síncrono do ESP32 reimplementado sobre sockets POSIX
+ */
+
+#include "WebServer.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace
+{
+constexpr unsigned long kRequestTimeoutMs = 5000;
+
+const char *kAlwaysCollected[] = {"Authorization", "Content-Type", "Content-Length", "Host"};
+
+String base64Decode(const String &input)
+{
+    static const std::string chars =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    String out;
+    int val = 0;
+    int bits = -8;
+    for (unsigned int i = 0; i < input.length(); i++)
+    {
+        size_t pos = chars.find(input[i]);
+        if (pos == std::string::npos)
+            break;
+        val = (val << 6) + (int)pos;
+        bits += 6;
+        if (bits >= 0)
+        {
+            out += (char)((val >> bits) & 0xFF);
+            bits -= 8;
+        }
+    }
+    return out;
+}
+
+String headerParam(const String &header, const char *param)
+{
+    String key = String(param) + "=";
+    int start = header.indexOf(key);
+    if (start < 0)
+        return String();
+    start += key.length();
+    if (header[start] == '"')
+    {
+        int end = header.indexOf('"', start + 1);
+        return header.substring(start + 1, end < 0 ? header.length() : end);
+    }
+    int end = header.indexOf(';', start);
+    String value = header.substring(start, end < 0 ? header.length() : end);
+    value.trim();
+    return value;
+}
+} // namespace
+
+WebServer::WebServer(int port) : _port(port)
+{
+    _currentUpload = new HTTPUpload();
+    _currentRaw = new HTTPRaw();
+}
+
+WebServer::~WebServer()
+{
+    close();
+    delete _currentUpload;
+    delete _currentRaw;
+}
+
+void WebServer::begin(uint16_t port)
+{
+    _port = port;
+    begin();
+}
+
+void WebServer::begin()
+{
+    close();
+    _listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (_listenFd < 0)
+        return;
+
+    int one = 1;
+    setsockopt(_listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons((uint16_t)_port);
+    if (bind(_listenFd, (sockaddr *)&addr, sizeof(addr)) != 0 || listen(_listenFd, 16) != 0)
+    {
+        fprintf(stderr, "[native] WebServer: falha ao escutar na porta %d\n", _port);
+        ::close(_listenFd);
+        _listenFd = -1;
+        return;
+    }
+    fcntl(_listenFd, F_SETFL, fcntl(_listenFd, F_GETFL, 0) | O_NONBLOCK);
+}
+
+void WebServer::close()
+{
+    if (_listenFd >= 0)
+    {
+        ::close(_listenFd);
+        _listenFd = -1;
+    }
+}
+
+void WebServer::on(const String &uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn)
+{
+    _routes.push_back(Route{uri, method, fn, ufn});
+}
+
+void WebServer::collectHeaders(const char *headerKeys[], const size_t headerKeysCount)
+{
+    _headers.clear();
+    for (const char *key : kAlwaysCollected)
+        _headers.push_back(Arg{key, String()});
+    for (size_t i = 0; i < headerKeysCount; i++)
+        _headers.push_back(Arg{headerKeys[i], String()});
+}
+
+String WebServer::header(const String &name)
+{
+    for (const auto &header : _headers)
+    {
+        if (header.key.equalsIgnoreCase(name))
+            return header.value;
+    }
+    return String();
+}
+
+bool WebServer::hasHeader(const String &name)
+{
+    for (const auto &header : _headers)
+    {
+        if (header.key.equalsIgnoreCase(name) && !header.value.isEmpty())
+            return true;
+    }
+    return false;
+}
+
+String WebServer::arg(const String &name)
+{
+    for (const auto &arg : _args)
+    {
+        if (arg.key == name)
+            return arg.value;
+    }
+    return String();
+}
+
+String WebServer::arg(int i)
+{
+    return i >= 0 && i < (int)_args.size() ? _args[i].value : String();
+}
+
+String WebServer::argName(int i)
+{
+    return i >= 0 && i < (int)_args.size() ? _args[i].key : String();
+}
+
+bool WebServer::hasArg(const String &name)
+{
+    for (const auto &arg : _args)
+    {
+        if (arg.key == name)
+            return true;
+    }
+    return false;
+}
+
+String WebServer::urlDecode(const String &text)
+{
+    String decoded;
+    for (unsigned int i = 0; i < text.length(); i++)
+    {
+        char c = text[i];
+        if (c == '+')
+        {
+            decoded += ' ';
+        }
+        else if (c == '%' && i + 2 < text.length())
+        {
+            char hex[3] = {text[i + 1], text[i + 2], 0};
+            decoded += (char)strtol(hex, nullptr, 16);
+            i += 2;
+        }
+        else
+        {
+            decoded += c;
+        }
+    }
+    return decoded;
+}
+
+void WebServer::parseArguments(const String &data)
+{
+    unsigned int pos = 0;
+    while (pos < data.length())
+    {
+        int amp = data.indexOf('&', pos);
+        String pair = data.substring(pos, amp < 0 ? data.length() : amp);
+        int eq = pair.indexOf('=');
+        if (!pair.isEmpty())
+        {
+            _args.push_back(Arg{urlDecode(eq < 0 ? pair : pair.substring(0, eq)),
+                                eq < 0 ? String() : urlDecode(pair.substring(eq + 1))});
+        }
+        if (amp < 0)
+            break;
+        pos = amp + 1;
+    }
+}
+
+bool WebServer::parseRequest(Route *&route, size_t &bodyLength, String &contentType)
+{
+    String line;
+    bool requestLine = true;
+    unsigned long start = millis();
+    _currentClient.setTimeout(kRequestTimeoutMs);
+
+    for (auto &header : _headers)
+        header.value = String();
+    if (_headers.empty())
+        collectHeaders(nullptr, 0);
+
+    while (millis() - start < kRequestTimeoutMs)
+    {
+        uint8_t c;
+        if (_currentClient.readBytes(&c, 1) != 1)
+            return false;
+        if (c == '\r')
+            continue;
+        if (c != '\n')
+        {
+            line += (char)c;
+            continue;
+        }
+
+        if (requestLine)
+        {
+            int sp1 = line.indexOf(' ');
+            int sp2 = line.indexOf(' ', sp1 + 1);
+            if (sp1 < 0 || sp2 < 0)
+                return false;
+            String method = line.substring(0, sp1);
+            String url = line.substring(sp1 + 1, sp2);
+
+            _currentMethod = method == "GET"       ? HTTP_GET
+                             : method == "POST"    ? HTTP_POST
+                             : method == "PUT"     ? HTTP_PUT
+                             : method == "DELETE"  ? HTTP_DELETE
+                             : method == "HEAD"    ? HTTP_HEAD
+                             : method == "OPTIONS" ? HTTP_OPTIONS
+                             : method == "PATCH"   ? HTTP_PATCH
+                                                   : HTTP_ANY;
+            int query = url.indexOf('?');
+            _currentUri = query < 0 ? url : url.substring(0, query);
+            if (query >= 0)
+                parseArguments(url.substring(query + 1));
+            requestLine = false;
+        }
+        else if (line.isEmpty())
+        {
+            break;
+        }
+        else
+        {
+            int colon = line.indexOf(':');
+            if (colon > 0)
+            {
+                String name = line.substring(0, colon);
+                String value = line.substring(colon + 1);
+                value.trim();
+                if (name.equalsIgnoreCase("Content-Length"))
+                    bodyLength = _clientContentLength = (size_t)value.toInt();
+                if (name.equalsIgnoreCase("Content-Type"))
+                    contentType = value;
+                if (name.equalsIgnoreCase("Host"))
+                    _hostHeader = value;
+                for (auto &header : _headers)
+                {
+                    if (header.key.equalsIgnoreCase(name))
+                        header.value = value;
+                }
+            }
+        }
+        line = "";
+    }
+
+    route = nullptr;
+    for (auto &candidate : _routes)
+    {
+        if (candidate.uri == _currentUri &&
+            (candidate.method == HTTP_ANY || candidate.method == _currentMethod))
+        {
+            route = &candidate;
+            break;
+        }
+    }
+    return true;
+}
+
+void WebServer::readBody(size_t bodyLength, String &body)
+{
+    uint8_t buffer[1024];
+    while (body.length() < bodyLength)
+    {
+        size_t n = _currentClient.readBytes(buffer, std::min(sizeof(buffer), bodyLength - body.length()));
+        if (n == 0)
+            break;
+        body.concat((const char *)buffer, n);
+    }
+}
+
+void WebServer::handleRawBody(Route *route, size_t bodyLength)
+{
+    HTTPRaw &raw = *_currentRaw;
+    raw.status = RAW_START;
+    raw.totalSize = 0;
+    raw.currentSize = 0;
+    route->ufn();
+
+    size_t remaining = bodyLength;
+    while (remaining > 0)
+    {
+        size_t n = _currentClient.readBytes(raw.buf, std::min<size_t>(HTTP_RAW_BUFLEN, remaining));
+        if (n == 0)
+        {
+            raw.status = RAW_ABORTED;
+            raw.currentSize = 0;
+            route->ufn();
+            return;
+        }
+        raw.status = RAW_WRITE;
+        raw.currentSize = n;
+        raw.totalSize += n;
+        remaining -= n;
+        route->ufn();
+    }
+
+    raw.status = RAW_END;
+    raw.currentSize = 0;
+    route->ufn();
+}
+
+void WebServer::handleMultipart(Route *route, const String &boundary, size_t bodyLength)
+{
+    const std::string delimiter = "\r\n--" + boundary.std();
+    std::string buffer = "\r\n"; // Permite casar o primeiro delimitador como os demais
+    size_t remaining = bodyLength;
+
+    auto fill = [&]() -> bool {
+        if (remaining == 0)
+            return false;
+        uint8_t chunk[4096];
+        size_t n = _currentClient.readBytes(chunk, std::min(sizeof(chunk), remaining));
+        if (n == 0)
+            return false;
+        remaining -= n;
+        buffer.append((const char *)chunk, n);
+        return true;
+    };
+    auto readLine = [&](std::string &line) -> bool {
+        size_t eol;
+        while ((eol = buffer.find("\r\n")) == std::string::npos)
+        {
+            if (!fill())
+                return false;
+        }
+        line = buffer.substr(0, eol);
+        buffer.erase(0, eol + 2);
+        return true;
+    };
+
+    // Avança até o primeiro delimitador
+    size_t pos;
+    while ((pos = buffer.find(delimiter)) == std::string::npos)
+    {
+        if (!fill())
+            return;
+    }
+    buffer.erase(0, pos + delimiter.size());
+
+    while (true)
+    {
+        std::string line;
+        if (!readLine(line) || line == "--")
+            return; // Fim do corpo multipart
+
+        String disposition;
+        String partType;
+        while (readLine(line) && !line.empty())
+        {
+            String header(line);
+            if (header.startsWith("Content-Disposition") || header.startsWith("content-disposition"))
+                disposition = header;
+            else if (header.startsWith("Content-Type") || header.startsWith("content-type"))
+                partType = header.substring(header.indexOf(':') + 1);
+        }
+        partType.trim();
+
+        String name = headerParam(disposition, "name");
+        bool isFile = disposition.indexOf("filename=") >= 0;
+        HTTPUpload &upload = *_currentUpload;
+
+        if (isFile && route && route->ufn)
+        {
+            upload.status = UPLOAD_FILE_START;
+            upload.name = name;
+            upload.filename = headerParam(disposition, "filename");
+            upload.type = partType;
+            upload.totalSize = 0;
+            upload.currentSize = 0;
+            route->ufn();
+        }
+
+        String value;
+        bool found = false;
+        while (!found)
+        {
+            pos = buffer.find(delimiter);
+            size_t emit;
+            if (pos != std::string::npos)
+            {
+                emit = pos;
+                found = true;
+            }
+            else
+            {
+                // Mantém bytes que podem ser o início do delimitador
+                emit = buffer.size() > delimiter.size() ? buffer.size() - delimiter.size() : 0;
+            }
+
+            size_t offset = 0;
+            while (offset < emit)
+            {
+                size_t n = std::min<size_t>(HTTP_UPLOAD_BUFLEN, emit - offset);
+                if (isFile && route && route->ufn)
+                {
+                    memcpy(upload.buf, buffer.data() + offset, n);
+                    upload.currentSize = n;
+                    upload.totalSize += n;
+                    upload.status = UPLOAD_FILE_WRITE;
+                    route->ufn();
+                }
+                else if (!isFile)
+                {
+                    value.concat(buffer.data() + offset, n);
+                }
+                offset += n;
+            }
+            buffer.erase(0, emit);
+
+            if (found)
+            {
+                buffer.erase(0, delimiter.size());
+            }
+            else if (!fill())
+            {
+                if (isFile && route && route->ufn)
+                {
+                    upload.status = UPLOAD_FILE_ABORTED;
+                    upload.currentSize = 0;
+                    route->ufn();
+                }
+                return;
+            }
+        }
+
+        if (isFile && route && route->ufn)
+        {
+            upload.status = UPLOAD_FILE_END;
+            upload.currentSize = 0;
+            route->ufn();
+        }
+        else if (!isFile)
+        {
+            _args.push_back(Arg{name, value});
+        }
+    }
+}
+
+void WebServer::handleClient()
+{
+    if (_listenFd < 0)
+        return;
+
+    int fd = accept(_listenFd, nullptr, nullptr);
+    if (fd < 0)
+        return;
+
+    _currentClient = WiFiClient(fd);
+    _args.clear();
+    _responseHeaders = "";
+    _contentLength = CONTENT_LENGTH_NOT_SET;
+    _clientContentLength = 0;
+    _chunked = false;
+    _headersSent = false;
+    _hostHeader = "";
+
+    Route *route = nullptr;
+    size_t bodyLength = 0;
+    String contentType;
+    if (!parseRequest(route, bodyLength, contentType))
+    {
+        _currentClient.stop();
+        return;
+    }
+
+    if (bodyLength > 0)
+    {
+        if (contentType.startsWith("multipart/form-data"))
+        {
+            handleMultipart(route, headerParam(contentType, "boundary"), bodyLength);
+        }
+        else if (contentType.startsWith("application/x-www-form-urlencoded"))
+        {
+            String body;
+            readBody(bodyLength, body);
+            parseArguments(body);
+        }
+        else if (route && route->ufn)
+        {
+            handleRawBody(route, bodyLength);
+        }
+        else
+        {
+            String body;
+            readBody(bodyLength, body);
+            _args.push_back(Arg{"plain", body});
+        }
+    }
+
+    if (route)
+    {
+        route->fn();
+    }
+    else if (_notFoundHandler)
+    {
+        _notFoundHandler();
+    }
+    else
+    {
+        send(404, "text/plain", String("Not found: ") + _currentUri);
+    }
+
+    finalizeResponse();
+    _currentClient.stop();
+}
+
+bool WebServer::authenticate(const char *username, const char *password)
+{
+    String authorization = header("Authorization");
+    if (!authorization.startsWith("Basic "))
+        return false;
+    String decoded = base64Decode(authorization.substring(6));
+    return decoded == String(username) + ":" + password;
+}
+
+void WebServer::requestAuthentication(HTTPAuthMethod, const char *realm, const String &authFailMsg)
+{
+    sendHeader("WWW-Authenticate", String("Basic realm=\"") + (realm ? realm : "Login Required") + "\"");
+    send(401, "text/html", authFailMsg);
+}
+
+void WebServer::sendHeader(const String &name, const String &value, bool first)
+{
+    String line = name + ": " + value + "\r\n";
+    if (first)
+        _responseHeaders = line + _responseHeaders;
+    else
+        _responseHeaders += line;
+}
+
+const char *WebServer::responseCodeToString(int code)
+{
+    switch (code)
+    {
+    case 200:
+        return "OK";
+    case 201:
+        return "Created";
+    case 202:
+        return "Accepted";
+    case 204:
+        return "No Content";
+    case 206:
+        return "Partial Content";
+    case 302:
+        return "Found";
+    case 304:
+        return "Not Modified";
+    case 400:
+        return "Bad Request";
+    case 401:
+        return "Unauthorized";
+    case 404:
+        return "Not Found";
+    case 409:
+        return "Conflict";
+    case 411:
+        return "Length Required";
+    case 413:
+        return "Payload Too Large";
+    case 416:
+        return "Range Not Satisfiable";
+    case 429:
+        return "Too Many Requests";
+    case 500:
+        return "Internal Server Error";
+    case 503:
+        return "Service Unavailable";
+    default:
+        return "";
+    }
+}
+
+void WebServer::sendResponseHeaders(int code, const char *contentType, size_t contentLength)
+{
+    String response = String("HTTP/1.1 ") + String(code) + " " + responseCodeToString(code) + "\r\n";
+    if (contentType && *contentType)
+        response += String("Content-Type: ") + contentType + "\r\n";
+    if (_contentLength == CONTENT_LENGTH_UNKNOWN)
+    {
+        response += "Transfer-Encoding: chunked\r\n";
+        _chunked = true;
+    }
+    else
+    {
+        size_t length = _contentLength == CONTENT_LENGTH_NOT_SET ? contentLength : _contentLength;
+        response += "Content-Length: " + String((unsigned long)length) + "\r\n";
+    }
+    response += _responseHeaders;
+    response += "Connection: close\r\n\r\n";
+    _currentClient.write((const uint8_t *)response.c_str(), response.length());
+    _responseHeaders = "";
+    _headersSent = true;
+}
+
+void WebServer::send(int code, const char *contentType, const String &content)
+{
+    sendResponseHeaders(code, contentType, content.length());
+    if (content.length() > 0)
+        sendContent(content);
+}
+
+void WebServer::send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength)
+{
+    sendResponseHeaders(code, contentType, contentLength);
+    sendContent(content, contentLength);
+}
+
+void WebServer::sendContent(const char *content, size_t contentLength)
+{
+    if (_chunked)
+    {
+        if (contentLength == 0)
+        {
+            // Chunk vazio encerra a resposta
+            _currentClient.write((const uint8_t *)"0\r\n\r\n", 5);
+            _chunked = false;
+            return;
+        }
+        char size[16];
+        int n = snprintf(size, sizeof(size), "%zx\r\n", contentLength);
+        _currentClient.write((const uint8_t *)size, n);
+        _currentClient.write((const uint8_t *)content, contentLength);
+        _currentClient.write((const uint8_t *)"\r\n", 2);
+        return;
+    }
+    _currentClient.write((const uint8_t *)content, contentLength);
+}
+
+void WebServer::finalizeResponse()
+{
+    if (_chunked)
+        sendContent("", 0);
+}
@@ -0,0 +1,215 @@
+/**
+ * @file HostWiFiClient.cpp
+ * @brief WiFiClient sobre sockets TCP do host
+ */
+
+#include "WiFiClient.h"
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClient::Socket::~Socket()
+{
+    if (fd >= 0)
+        ::close(fd);
+}
+
+WiFiClient::WiFiClient(int fd)
+{
+    if (fd >= 0)
+    {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        _socket = std::make_shared<Socket>(fd);
+    }
+}
+
+int WiFiClient::connect(const char *host, uint16_t port, int32_t timeoutMs)
+{
+    stop();
+
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo *result = nullptr;
+    char portStr[8];
+    snprintf(portStr, sizeof(portStr), "%u", port);
+    if (getaddrinfo(host, portStr, &hints, &result) != 0 || result == nullptr)
+        return 0;
+
+    int fd = socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+    if (fd < 0)
+    {
+        freeaddrinfo(result);
+        return 0;
+    }
+
+    // Conexão não bloqueante para respeitar o timeout
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    int rc = ::connect(fd, result->ai_addr, result->ai_addrlen);
+    freeaddrinfo(result);
+
+    if (rc < 0 && errno != EINPROGRESS)
+    {
+        ::close(fd);
+        return 0;
+    }
+    if (rc < 0)
+    {
+        pollfd pfd{fd, POLLOUT, 0};
+        if (poll(&pfd, 1, timeoutMs) <= 0)
+        {
+            ::close(fd);
+            return 0;
+        }
+        int err = 0;
+        socklen_t len = sizeof(err);
+        getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len);
+        if (err != 0)
+        {
+            ::close(fd);
+            return 0;
+        }
+    }
+    fcntl(fd, F_SETFL, flags);
+
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    _socket = std::make_shared<Socket>(fd);
+    _peeked = -1;
+    return 1;
+}
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size)
+{
+    if (!_socket)
+        return 0;
+    size_t sent = 0;
+    while (sent < size)
+    {
+        ssize_t n = ::send(_socket->fd, buffer + sent, size - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+        sent += (size_t)n;
+    }
+    return sent;
+}
+
+int WiFiClient::available()
+{
+    if (!_socket)
+        return 0;
+    int count = 0;
+    if (ioctl(_socket->fd, FIONREAD, &count) < 0)
+        return 0;
+    return count + (_peeked >= 0 ? 1 : 0);
+}
+
+int WiFiClient::read()
+{
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size)
+{
+    if (!_socket || size == 0)
+        return -1;
+    size_t offset = 0;
+    if (_peeked >= 0)
+    {
+        buffer[offset++] = (uint8_t)_peeked;
+        _peeked = -1;
+        if (offset == size)
+            return (int)offset;
+    }
+    ssize_t n = ::recv(_socket->fd, buffer + offset, size - offset, MSG_DONTWAIT);
+    if (n <= 0)
+        return offset > 0 ? (int)offset : -1;
+    return (int)(offset + n);
+}
+
+int WiFiClient::peek()
+{
+    if (_peeked < 0)
+    {
+        uint8_t c;
+        if (_socket && ::recv(_socket->fd, &c, 1, MSG_DONTWAIT) == 1)
+            _peeked = c;
+    }
+    return _peeked;
+}
+
+size_t WiFiClient::readBytes(uint8_t *buffer, size_t length)
+{
+    size_t count = 0;
+    unsigned long start = millis();
+    while (count < length && _socket)
+    {
+        int n = read(buffer + count, length - count);
+        if (n > 0)
+        {
+            count += (size_t)n;
+            continue;
+        }
+
+        unsigned long elapsed = millis() - start;
+        if (elapsed >= _timeout)
+            break;
+        pollfd pfd{_socket->fd, POLLIN, 0};
+        int rc = poll(&pfd, 1, (int)(_timeout - elapsed));
+        if (rc <= 0)
+            break;
+        if (pfd.revents & (POLLHUP | POLLERR) && !(pfd.revents & POLLIN))
+            break;
+        if ((pfd.revents & POLLIN) && available() == 0)
+        {
+            // Legível mas sem dados: conexão encerrada pelo outro lado
+            break;
+        }
+    }
+    return count;
+}
+
+uint8_t WiFiClient::connected()
+{
+    if (!_socket)
+        return 0;
+    if (_peeked >= 0)
+        return 1;
+    uint8_t c;
+    ssize_t n = ::recv(_socket->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (n == 0)
+        return 0;
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+        return 0;
+    return 1;
+}
+
+void WiFiClient::stop()
+{
+    _socket.reset();
+    _peeked = -1;
+}
+
+IPAddress WiFiClient::remoteIP() const
+{
+    if (!_socket)
+        return IPAddress();
+    sockaddr_in addr{};
+    socklen_t len = sizeof(addr);
+    if (getpeername(_socket->fd, (sockaddr *)&addr, &len) != 0)
+        return IPAddress();
+    return IPAddress((uint32_t)addr.sin_addr.s_addr);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+/**
+ * @file LogLibrary.h
+ * @brief Macros de log compatíveis com cturqueti/LogLibrary (build nativo)
+ */
+
+#include <cstdio>
+
+#ifndef LOG_NATIVE_LEVEL
+#define LOG_NATIVE_LEVEL 3 // 0=ERROR 1=WARN 2=INFO 3=DEBUG
+#endif
+
+#define LOG_NATIVE_PRINT(level, tag, fmt, ...)                               \
+    do                                                                       \
+    {                                                                        \
+        if ((level) <= LOG_NATIVE_LEVEL)                                     \
+            fprintf(stderr, "[" tag "] " fmt "\n", ##__VA_ARGS__);            \
+    } while (0)
+
+#define LOG_ERROR(fmt, ...) LOG_NATIVE_PRINT(0, "E", fmt, ##__VA_ARGS__)
+#define LOG_WARN(fmt, ...) LOG_NATIVE_PRINT(1, "W", fmt, ##__VA_ARGS__)
+#define LOG_INFO(fmt, ...) LOG_NATIVE_PRINT(2, "I", fmt, ##__VA_ARGS__)
+#define LOG_DEBUG(fmt, ...) LOG_NATIVE_PRINT(3, "D", fmt, ##__VA_ARGS__)
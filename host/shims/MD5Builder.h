@@ -0,0 +1,27 @@
+#pragma once
+
+/**
+ * @file MD5Builder.h
+ * @brief MD5Builder do Arduino-ESP32 (RFC 1321 em software, build nativo)
+ */
+
+#include "Arduino.h"
+
+class MD5Builder
+{
+public:
+    void begin();
+    void add(const uint8_t *data, size_t len);
+    void add(const char *data) { add(reinterpret_cast<const uint8_t *>(data), strlen(data)); }
+    void add(const String &data) { add(data.c_str()); }
+    void calculate();
+    void getBytes(uint8_t *output) const { memcpy(output, _digest, sizeof(_digest)); }
+    void getChars(char *output) const;
+    String toString() const;
+
+private:
+    uint32_t _state[4];
+    uint8_t _block[64];
+    uint64_t _bytes = 0;
+    uint8_t _digest[16] = {};
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+/**
+ * @file Update.h
+ * @brief Shim do UpdateClass do ESP32 gravando em partição fake (arquivo)
+ *
+ * Cada alvo (U_FLASH/U_SPIFFS) grava em um arquivo do diretório definido
+ * por OTA_NATIVE_FLASH_DIR (padrão: ./.native_flash): app_next.bin ou
+ * spiffs.bin após o end(), *.partial durante a gravação.
+ *
+ * Como no ESP32, os dados são acumulados em setores de 4 KB e cada setor
+ * cheio passa pelo modelo de flash (HostFlash.h): apagamento, programação,
+ * cache desligado e desgaste. O MD5 de setMD5() é conferido no end(), e o
+ * end() de uma imagem de app a torna a de boot (esp_ota_ops.h).
+ */
+
+#include "Arduino.h"
+#include "MD5Builder.h"
+#include <cstdio>
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+
+#define U_FLASH 0
+#define U_SPIFFS 100
+#define U_AUTH 200
+
+#define UPDATE_ERROR_OK (0)
+#define UPDATE_ERROR_WRITE (1)
+#define UPDATE_ERROR_ERASE (2)
+#define UPDATE_ERROR_READ (3)
+#define UPDATE_ERROR_SPACE (4)
+#define UPDATE_ERROR_SIZE (5)
+#define UPDATE_ERROR_STREAM (6)
+#define UPDATE_ERROR_MD5 (7)
+#define UPDATE_ERROR_MAGIC_BYTE (8)
+#define UPDATE_ERROR_ACTIVATE (9)
+#define UPDATE_ERROR_NO_PARTITION (10)
+#define UPDATE_ERROR_BAD_ARGUMENT (11)
+#define UPDATE_ERROR_ABORT (12)
+
+class UpdateClass
+{
+public:
+    bool begin(size_t size = UPDATE_SIZE_UNKNOWN, int command = U_FLASH, int ledPin = -1,
+               uint8_t ledOn = 0, const char *label = nullptr);
+    size_t write(uint8_t *data, size_t len);
+    size_t writeStream(Stream &data);
+    bool end(bool evenIfRemaining = false);
+    void abort();
+
+    bool isRunning() const { return _running; }
+    bool isFinished() const { return _progress == _size; }
+    bool hasError() const { return _error != UPDATE_ERROR_OK; }
+    uint8_t getError() const { return _error; }
+    void clearError() { _error = UPDATE_ERROR_OK; }
+    const char *errorString();
+    size_t size() const { return _size; }
+    size_t progress() const { return _progress; }
+    size_t remaining() const { return _size - _progress; }
+    bool setMD5(const char *expectedMD5);
+
+private:
+    FILE *_file = nullptr;
+    bool _running = false;
+    int _command = U_FLASH;
+    size_t _size = 0;
+    size_t _progress = 0;
+    uint8_t _error = UPDATE_ERROR_OK;
+    uint8_t _buffer[4096];
+    size_t _bufferLen = 0;
+    size_t _written = 0; ///< Bytes já enviados à flash (setores completos)
+    char _targetMd5[33] = "";
+    MD5Builder _md5;
+
+    bool writeBuffer();
+    size_t partitionSize() const;
+    String partitionPath(bool staging) const;
+};
+
+extern UpdateClass Update;
@@ -0,0 +1,256 @@
+#pragma once
+
+/**
+ * @file WString.h
+ * @brief Shim da classe String do Arduino sobre std::string (build nativo)
+ */
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+class __FlashStringHelper;
+#define F(str) (reinterpret_cast<const __FlashStringHelper *>(str))
+
+class String
+{
+public:
+    String() = default;
+    String(const char *str) : _s(str ? str : "") {}
+    String(const char *str, size_t len) : _s(str ? std::string(str, len) : std::string()) {}
+    String(const std::string &str) : _s(str) {}
+    String(const __FlashStringHelper *str) : _s(reinterpret_cast<const char *>(str)) {}
+    explicit String(char c) : _s(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10) { fromUnsigned(value, base); }
+    explicit String(int value, unsigned char base = 10) { fromSigned(value, base); }
+    explicit String(unsigned int value, unsigned char base = 10) { fromUnsigned(value, base); }
+    explicit String(long value, unsigned char base = 10) { fromSigned(value, base); }
+    explicit String(unsigned long value, unsigned char base = 10) { fromUnsigned(value, base); }
+    explicit String(long long value, unsigned char base = 10) { fromSigned(value, base); }
+    explicit String(unsigned long long value, unsigned char base = 10) { fromUnsigned(value, base); }
+    explicit String(float value, unsigned int decimals = 2) { fromDouble(value, decimals); }
+    explicit String(double value, unsigned int decimals = 2) { fromDouble(value, decimals); }
+
+    bool reserve(unsigned int size)
+    {
+        _s.reserve(size);
+        return true;
+    }
+    unsigned int length() const { return _s.length(); }
+    bool isEmpty() const { return _s.empty(); }
+    const char *c_str() const { return _s.c_str(); }
+    char *begin() { return &_s[0]; }
+    char *end() { return &_s[0] + _s.size(); }
+    const std::string &std() const { return _s; }
+
+    String &operator=(const char *str)
+    {
+        _s = str ? str : "";
+        return *this;
+    }
+
+    bool concat(const String &str)
+    {
+        _s += str._s;
+        return true;
+    }
+    bool concat(const char *str)
+    {
+        if (str)
+            _s += str;
+        return true;
+    }
+    bool concat(const char *str, unsigned int len)
+    {
+        _s.append(str, len);
+        return true;
+    }
+    bool concat(char c)
+    {
+        _s += c;
+        return true;
+    }
+    bool concat(int v) { return concat(String(v)); }
+    bool concat(unsigned int v) { return concat(String(v)); }
+    bool concat(long v) { return concat(String(v)); }
+    bool concat(unsigned long v) { return concat(String(v)); }
+    bool concat(long long v) { return concat(String(v)); }
+    bool concat(unsigned long long v) { return concat(String(v)); }
+    bool concat(double v) { return concat(String(v)); }
+
+    template <typename T>
+    String &operator+=(const T &rhs)
+    {
+        concat(rhs);
+        return *this;
+    }
+
+    char operator[](unsigned int index) const { return index < _s.size() ? _s[index] : 0; }
+    char &operator[](unsigned int index) { return _s[index]; }
+    char charAt(unsigned int index) const { return (*this)[index]; }
+
+    bool equals(const String &s) const { return _s == s._s; }
+    bool equalsIgnoreCase(const String &s) const
+    {
+        if (_s.size() != s._s.size())
+            return false;
+        for (size_t i = 0; i < _s.size(); i++)
+        {
+            if (tolower((unsigned char)_s[i]) != tolower((unsigned char)s._s[i]))
+                return false;
+        }
+        return true;
+    }
+    bool operator==(const String &rhs) const { return _s == rhs._s; }
+    bool operator==(const char *rhs) const { return _s == (rhs ? rhs : ""); }
+    bool operator!=(const String &rhs) const { return !(*this == rhs); }
+    bool operator!=(const char *rhs) const { return !(*this == rhs); }
+    bool operator<(const String &rhs) const { return _s < rhs._s; }
+
+    bool startsWith(const String &prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0 && _s.size() >= prefix._s.size(); }
+    bool endsWith(const String &suffix) const
+    {
+        return _s.size() >= suffix._s.size() &&
+               _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+    }
+
+    int indexOf(char c, unsigned int from = 0) const { return toIndex(_s.find(c, from)); }
+    int indexOf(const String &str, unsigned int from = 0) const { return toIndex(_s.find(str._s, from)); }
+    int indexOf(const char *str, unsigned int from = 0) const { return toIndex(_s.find(str, from)); }
+    int lastIndexOf(char c) const { return toIndex(_s.rfind(c)); }
+    int lastIndexOf(const String &str) const { return toIndex(_s.rfind(str._s)); }
+
+    String substring(unsigned int from) const { return from >= _s.size() ? String() : String(_s.substr(from)); }
+    String substring(unsigned int from, unsigned int to) const
+    {
+        if (from > to)
+        {
+            unsigned int tmp = from;
+            from = to;
+            to = tmp;
+        }
+        if (from >= _s.size())
+            return String();
+        if (to > _s.size())
+            to = _s.size();
+        return String(_s.substr(from, to - from));
+    }
+
+    void replace(const String &find, const String &replace)
+    {
+        if (find._s.empty())
+            return;
+        size_t pos = 0;
+        while ((pos = _s.find(find._s, pos)) != std::string::npos)
+        {
+            _s.replace(pos, find._s.size(), replace._s);
+            pos += replace._s.size();
+        }
+    }
+    void replace(char find, char replace)
+    {
+        for (char &c : _s)
+        {
+            if (c == find)
+                c = replace;
+        }
+    }
+    void remove(unsigned int index) { remove(index, _s.size()); }
+    void remove(unsigned int index, unsigned int count)
+    {
+        if (index < _s.size())
+            _s.erase(index, count);
+    }
+    void toLowerCase()
+    {
+        for (char &c : _s)
+            c = tolower((unsigned char)c);
+    }
+    void toUpperCase()
+    {
+        for (char &c : _s)
+            c = toupper((unsigned char)c);
+    }
+    void trim()
+    {
+        size_t b = 0;
+        while (b < _s.size() && isspace((unsigned char)_s[b]))
+            b++;
+        size_t e = _s.size();
+        while (e > b && isspace((unsigned char)_s[e - 1]))
+            e--;
+        _s = _s.substr(b, e - b);
+    }
+
+    long toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(_s.c_str(), nullptr); }
+    double toDouble() const { return strtod(_s.c_str(), nullptr); }
+
+private:
+    std::string _s;
+
+    static int toIndex(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+
+    void fromSigned(long long value, unsigned char base)
+    {
+        if (base == 10)
+        {
+            _s = std::to_string(value);
+            return;
+        }
+        fromUnsigned((unsigned long long)value, base);
+    }
+    void fromUnsigned(unsigned long long value, unsigned char base)
+    {
+        char buf[72];
+        char *p = buf + sizeof(buf) - 1;
+        *p = '\0';
+        do
+        {
+            unsigned digit = value % base;
+            *--p = digit < 10 ? '0' + digit : 'a' + digit - 10;
+            value /= base;
+        } while (value);
+        _s = p;
+    }
+    void fromDouble(double value, unsigned int decimals)
+    {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+        _s = buf;
+    }
+};
+
+inline String operator+(const String &lhs, const String &rhs)
+{
+    String r(lhs);
+    r.concat(rhs);
+    return r;
+}
+inline String operator+(const String &lhs, const char *rhs)
+{
+    String r(lhs);
+    r.concat(rhs);
+    return r;
+}
+inline String operator+(const char *lhs, const String &rhs)
+{
+    String r(lhs);
+    r.concat(rhs);
+    return r;
+}
+inline String operator+(const String &lhs, char rhs)
+{
+    String r(lhs);
+    r.concat(rhs);
+    return r;
+}
+inline String operator+(const String &lhs, int rhs) { return lhs + String(rhs); }
+inline String operator+(const String &lhs, unsigned int rhs) { return lhs + String(rhs); }
+inline String operator+(const String &lhs, long rhs) { return lhs + String(rhs); }
+inline String operator+(const String &lhs, unsigned long rhs) { return lhs + String(rhs); }
+inline bool operator==(const char *lhs, const String &rhs) { return rhs == lhs; }
+inline bool operator!=(const char *lhs, const String &rhs) { return rhs != lhs; }
@@ -0,0 +1,177 @@
+#pragma once
+
+/**
+ * @file WebServer.h
+ * @brief Shim síncrono do WebServer do ESP32 sobre sockets POSIX (build nativo)
+ *
+ * Segue o comportamento do original: uma conexão por chamada de
+ * handleClient(), apenas os cabeçalhos registrados em collectHeaders()
+ * ficam disponíveis e uploads multipart/raw são entregues em blocos.
+ */
+
+#include "Arduino.h"
+#include "WiFi.h"
+#include <functional>
+#include <vector>
+
+#ifndef HTTP_UPLOAD_BUFLEN
+#define HTTP_UPLOAD_BUFLEN 1436
+#endif
+#ifndef HTTP_RAW_BUFLEN
+#define HTTP_RAW_BUFLEN 1436
+#endif
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+
+enum HTTPMethod
+{
+    HTTP_DELETE = 0,
+    HTTP_GET = 1,
+    HTTP_HEAD = 2,
+    HTTP_POST = 3,
+    HTTP_PUT = 4,
+    HTTP_OPTIONS = 6,
+    HTTP_PATCH = 28,
+    HTTP_ANY = 255
+};
+
+enum HTTPUploadStatus
+{
+    UPLOAD_FILE_START,
+    UPLOAD_FILE_WRITE,
+    UPLOAD_FILE_END,
+    UPLOAD_FILE_ABORTED
+};
+
+enum HTTPRawStatus
+{
+    RAW_START,
+    RAW_WRITE,
+    RAW_END,
+    RAW_ABORTED
+};
+
+enum HTTPAuthMethod
+{
+    BASIC_AUTH,
+    DIGEST_AUTH
+};
+
+struct HTTPUpload
+{
+    HTTPUploadStatus status;
+    String filename;
+    String name;
+    String type;
+    size_t totalSize;
+    size_t currentSize;
+    uint8_t buf[HTTP_UPLOAD_BUFLEN];
+};
+
+struct HTTPRaw
+{
+    HTTPRawStatus status;
+    size_t totalSize;
+    size_t currentSize;
+    uint8_t buf[HTTP_RAW_BUFLEN];
+};
+
+class WebServer
+{
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    explicit WebServer(int port = 80);
+    ~WebServer();
+
+    void begin();
+    void begin(uint16_t port);
+    void handleClient();
+    void close();
+    void stop() { close(); }
+
+    bool authenticate(const char *username, const char *password);
+    void requestAuthentication(HTTPAuthMethod mode = BASIC_AUTH, const char *realm = nullptr,
+                               const String &authFailMsg = String(""));
+
+    void on(const String &uri, THandlerFunction fn) { on(uri, HTTP_ANY, fn); }
+    void on(const String &uri, HTTPMethod method, THandlerFunction fn) { on(uri, method, fn, nullptr); }
+    void on(const String &uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn);
+    void onNotFound(THandlerFunction fn) { _notFoundHandler = fn; }
+
+    String uri() { return _currentUri; }
+    HTTPMethod method() { return _currentMethod; }
+    WiFiClient client() { return _currentClient; }
+    size_t clientContentLength() { return _clientContentLength; }
+    HTTPUpload &upload() { return *_currentUpload; }
+    HTTPRaw &raw() { return *_currentRaw; }
+
+    String arg(const String &name);
+    String arg(int i);
+    String argName(int i);
+    int args() { return (int)_args.size(); }
+    bool hasArg(const String &name);
+
+    void collectHeaders(const char *headerKeys[], const size_t headerKeysCount);
+    String header(const String &name);
+    int headers() { return (int)_headers.size(); }
+    bool hasHeader(const String &name);
+    String hostHeader() { return _hostHeader; }
+
+    void send(int code, const char *contentType = nullptr, const String &content = String(""));
+    void send(int code, const String &contentType, const String &content) { send(code, contentType.c_str(), content); }
+    void send(int code, const char *contentType, const char *content) { send(code, contentType, String(content)); }
+    void send_P(int code, PGM_P contentType, PGM_P content) { send(code, contentType, content); }
+    void send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength);
+
+    void setContentLength(const size_t contentLength) { _contentLength = contentLength; }
+    void sendHeader(const String &name, const String &value, bool first = false);
+    void sendContent(const String &content) { sendContent(content.c_str(), content.length()); }
+    void sendContent(const char *content, size_t contentLength);
+    void sendContent_P(PGM_P content) { sendContent(content, strlen(content)); }
+    void sendContent_P(PGM_P content, size_t size) { sendContent(content, size); }
+
+private:
+    struct Route
+    {
+        String uri;
+        HTTPMethod method;
+        THandlerFunction fn;
+        THandlerFunction ufn;
+    };
+    struct Arg
+    {
+        String key;
+        String value;
+    };
+
+    int _port;
+    int _listenFd = -1;
+    std::vector<Route> _routes;
+    THandlerFunction _notFoundHandler;
+
+    WiFiClient _currentClient;
+    String _currentUri;
+    HTTPMethod _currentMethod = HTTP_ANY;
+    std::vector<Arg> _args;
+    std::vector<Arg> _headers;
+    String _hostHeader;
+    String _responseHeaders;
+    size_t _contentLength = CONTENT_LENGTH_NOT_SET;
+    size_t _clientContentLength = 0;
+    bool _chunked = false;
+    bool _headersSent = false;
+    HTTPUpload *_currentUpload = nullptr;
+    HTTPRaw *_currentRaw = nullptr;
+
+    bool parseRequest(Route *&route, size_t &bodyLength, String &contentType);
+    void parseArguments(const String &data);
+    void handleMultipart(Route *route, const String &boundary, size_t bodyLength);
+    void handleRawBody(Route *route, size_t bodyLength);
+    void readBody(size_t bodyLength, String &body);
+    void sendResponseHeaders(int code, const char *contentType, size_t contentLength);
+    void finalizeResponse();
+    static String urlDecode(const String &text);
+    static const char *responseCodeToString(int code);
+};
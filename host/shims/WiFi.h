@@ -0,0 +1,47 @@
+#pragma once
+
+/**
+ * @file WiFi.h
+ * @brief Shim do WiFi do ESP32 para o build nativo
+ *
+ * A "rede" do host está sempre conectada. IP, SSID e RSSI podem ser
+ * ajustados pelo harness para simular condições de campo.
+ */
+
+#include "Arduino.h"
+#include "IPAddress.h"
+#include "WiFiClient.h"
+
+typedef enum
+{
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+class WiFiClass
+{
+public:
+    wl_status_t begin(const char *ssid, const char *passphrase = nullptr);
+    wl_status_t status() { return _status; }
+    IPAddress localIP() { return _ip; }
+    String SSID() { return _ssid; }
+    int8_t RSSI() { return _rssi; }
+    String macAddress() { return "02:00:00:00:00:01"; }
+
+    // Controle exclusivo do harness nativo
+    void setStatus(wl_status_t status) { _status = status; }
+    void setLocalIP(IPAddress ip) { _ip = ip; }
+    void setRSSI(int8_t rssi) { _rssi = rssi; }
+
+private:
+    wl_status_t _status = WL_CONNECTED;
+    IPAddress _ip = IPAddress(127, 0, 0, 1);
+    String _ssid = "native";
+    int8_t _rssi = -50;
+};
+
+extern WiFiClass WiFi;
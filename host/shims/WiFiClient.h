@@ -0,0 +1,48 @@
+#pragma once
+
+/**
+ * @file WiFiClient.h
+ * @brief Cliente TCP sobre sockets POSIX (build nativo)
+ */
+
+#include "Arduino.h"
+#include "IPAddress.h"
+#include <memory>
+
+class WiFiClient : public Stream
+{
+public:
+    WiFiClient() = default;
+    explicit WiFiClient(int fd);
+
+    int connect(const char *host, uint16_t port, int32_t timeoutMs = 3000);
+    int connect(IPAddress ip, uint16_t port) { return connect(ip.toString().c_str(), port); }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+
+    int available() override;
+    int read() override;
+    int read(uint8_t *buffer, size_t size);
+    int peek() override;
+    size_t readBytes(uint8_t *buffer, size_t length) override;
+    using Stream::readBytes;
+
+    uint8_t connected();
+    void stop();
+    int fd() const { return _socket ? _socket->fd : -1; }
+    IPAddress remoteIP() const;
+
+    operator bool() { return connected(); }
+
+private:
+    struct Socket
+    {
+        int fd;
+        explicit Socket(int f) : fd(f) {}
+        ~Socket();
+    };
+    std::shared_ptr<Socket> _socket;
+    int _peeked = -1;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+/**
+ * @file esp_ota_ops.h
+ * @brief Partições de app e de boot do ESP-IDF (build nativo)
+ *
+ * O processo roda sempre de app0 e o Update grava em app1 (app_next.bin).
+ * A partição de boot escolhida fica no arquivo otadata do diretório da
+ * flash (OTA_NATIVE_FLASH_DIR), como a partição otadata do ESP32.
+ */
+
+#include "esp_system.h"
+
+typedef struct
+{
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+} esp_partition_t;
+
+const esp_partition_t *esp_ota_get_running_partition();
+const esp_partition_t *esp_ota_get_next_update_partition(const esp_partition_t *start_from);
+const esp_partition_t *esp_ota_get_boot_partition();
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t *partition);
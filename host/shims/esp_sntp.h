@@ -0,0 +1,23 @@
+#pragma once
+
+/**
+ * @file esp_sntp.h
+ * @brief Cliente SNTP simulado: "sincroniza" com o relógio do host (build nativo)
+ *
+ * OTA_NATIVE_SNTP_DRIFT_PPM simula um cristal adiantado/atrasado.
+ */
+
+#include <cstdint>
+#include <sys/time.h>
+
+#define SNTP_OPMODE_POLL 0
+typedef void (*sntp_sync_time_cb_t)(struct timeval *tv);
+
+bool sntp_enabled();
+void sntp_stop();
+void sntp_setoperatingmode(int mode);
+void sntp_setservername(int index, const char *server);
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback);
+void sntp_set_sync_interval(uint32_t interval_ms);
+uint32_t sntp_get_sync_interval();
+void sntp_init();
@@ -0,0 +1,39 @@
+#pragma once
+
+/**
+ * @file FreeRTOS.h
+ * @brief Tipos básicos do FreeRTOS mapeados para pthreads (build nativo)
+ */
+
+#include <cstdint>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t configSTACK_DEPTH_TYPE;
+typedef uint8_t StackType_t;
+#define portNUM_PROCESSORS 2
+#ifndef configUSE_TRACE_FACILITY
+#define configUSE_TRACE_FACILITY 0
+#endif
+#ifndef configGENERATE_RUN_TIME_STATS
+#define configGENERATE_RUN_TIME_STATS 0
+#endif
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define configMAX_PRIORITIES 25
+
+// Seção crítica (portMUX): um mutex global basta no build nativo
+#include <mutex>
+typedef struct { int unused; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+inline std::recursive_mutex &hostCriticalMutex() { static std::recursive_mutex m; return m; }
+#define portENTER_CRITICAL(mux) hostCriticalMutex().lock()
+#define portEXIT_CRITICAL(mux) hostCriticalMutex().unlock()
@@ -0,0 +1,69 @@
+#pragma once
+
+/**
+ * @file ringbuf.h
+ * @brief Ring buffer do ESP-IDF (somente NOSPLIT) sobre std::deque (build nativo)
+ */
+
+#include "FreeRTOS.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+typedef enum { RINGBUF_TYPE_NOSPLIT = 0, RINGBUF_TYPE_ALLOWSPLIT, RINGBUF_TYPE_BYTEBUF } RingbufferType_t;
+
+struct HostRingbuf
+{
+    size_t capacity;
+    size_t used = 0;
+    std::deque<std::vector<uint8_t>> items;
+    std::mutex mutex;
+    std::condition_variable ready;
+};
+typedef HostRingbuf *RingbufHandle_t;
+
+inline RingbufHandle_t xRingbufferCreate(size_t size, RingbufferType_t)
+{
+    HostRingbuf *ring = new HostRingbuf();
+    ring->capacity = size;
+    return ring;
+}
+
+inline void vRingbufferDelete(RingbufHandle_t ring) { delete ring; }
+
+inline BaseType_t xRingbufferSend(RingbufHandle_t ring, const void *data, size_t size, TickType_t)
+{
+    // Cada item ocupa o tamanho alinhado a 4 mais um cabeçalho de 8 bytes, como no IDF
+    size_t cost = ((size + 3) & ~(size_t)3) + 8;
+    std::lock_guard<std::mutex> lock(ring->mutex);
+    if (ring->used + cost > ring->capacity)
+        return pdFALSE;
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    ring->items.emplace_back(bytes, bytes + size);
+    ring->used += cost;
+    ring->ready.notify_one();
+    return pdTRUE;
+}
+
+inline void *xRingbufferReceive(RingbufHandle_t ring, size_t *size, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(ring->mutex);
+    if (ticks == portMAX_DELAY)
+        ring->ready.wait(lock, [ring] { return !ring->items.empty(); });
+    else if (!ring->ready.wait_for(lock, std::chrono::milliseconds(ticks), [ring] { return !ring->items.empty(); }))
+        return nullptr;
+
+    std::vector<uint8_t> &front = ring->items.front();
+    *size = front.size();
+    uint8_t *item = new uint8_t[front.size() + 1];
+    memcpy(item, front.data(), front.size());
+    ring->used -= ((front.size() + 3) & ~(size_t)3) + 8;
+    ring->items.pop_front();
+    return item;
+}
+
+inline void vRingbufferReturnItem(RingbufHandle_t, void *item) { delete[] static_cast<uint8_t *>(item); }
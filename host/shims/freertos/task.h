@@ -0,0 +1,48 @@
+#pragma once
+
+/**
+ * @file task.h
+ * @brief API de tasks do FreeRTOS sobre pthreads (build nativo)
+ */
+
+#include "FreeRTOS.h"
+
+struct HostTask;
+typedef HostTask *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name,
+                                   uint32_t stackDepth, void *parameters,
+                                   UBaseType_t priority, TaskHandle_t *handle,
+                                   BaseType_t coreId);
+
+inline BaseType_t xTaskCreate(TaskFunction_t function, const char *name,
+                              uint32_t stackDepth, void *parameters,
+                              UBaseType_t priority, TaskHandle_t *handle)
+{
+    return xTaskCreatePinnedToCore(function, name, stackDepth, parameters,
+                                   priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+TickType_t xTaskGetTickCount();
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+BaseType_t xPortGetCoreID();
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task);
+BaseType_t xTaskGetAffinity(TaskHandle_t task);
+TaskHandle_t xTaskGetHandle(const char *name);
+
+// Estatísticas de execução: tempo de CPU real de cada thread (CLOCK_THREAD_CPUTIME_ID)
+typedef struct
+{
+    TaskHandle_t xHandle;
+    const char *pcTaskName;
+    uint32_t ulRunTimeCounter;
+} TaskStatus_t;
+
+UBaseType_t uxTaskGetNumberOfTasks();
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *states, UBaseType_t count, uint32_t *totalRunTime);
+TaskHandle_t xTaskGetIdleTaskHandleForCPU(UBaseType_t core);
+char *pcTaskGetName(TaskHandle_t task);
@@ -0,0 +1,4 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+int mbedtls_sha1_ret(const unsigned char *input, size_t ilen, unsigned char output[20]);
@@ -0,0 +1,223 @@
+/**
+ * @file VirtualClock.cpp
+ * @brief Fila de despertares, vez única e liberação por tempo real
+ */
+
+#include "VirtualClock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Participant
+{
+    std::condition_variable wake;
+    bool ready = false;
+    bool holding = false; // Está com a vez
+    bool placeholder = false; // Vez reservada para uma task ainda não iniciada
+    std::chrono::steady_clock::time_point since;
+};
+
+struct Wakeup
+{
+    uint64_t atMs;
+    uint64_t seq; // Mesmo instante: ordem de chegada
+    Participant *who;
+
+    bool operator>(const Wakeup &other) const
+    {
+        return atMs != other.atMs ? atMs > other.atMs : seq > other.seq;
+    }
+};
+
+std::mutex mutex;
+std::priority_queue<Wakeup, std::vector<Wakeup>, std::greater<Wakeup>> queue;
+std::vector<Participant *> holders;
+std::atomic<uint64_t> now{0};
+std::atomic<uint64_t> eventCount{0};
+std::atomic<bool> installed{false};
+uint64_t seq = 0;
+time_t epoch = 0;
+uint32_t graceMs = 200;
+std::thread watchdog;
+
+// Participantes nunca são liberados: uma thread pode terminar com a vez
+thread_local Participant *self = nullptr;
+
+void release(Participant *who)
+{
+    who->holding = false;
+    holders.erase(std::find(holders.begin(), holders.end(), who));
+}
+
+// Com o mutex: passa a vez ao próximo despertar se ninguém está rodando
+void dispatch()
+{
+    if (!holders.empty() || queue.empty())
+        return;
+
+    Wakeup next = queue.top();
+    queue.pop();
+    if (next.atMs > now)
+        now = next.atMs;
+    eventCount++;
+
+    next.who->ready = true;
+    next.who->holding = true;
+    next.who->since = std::chrono::steady_clock::now();
+    holders.push_back(next.who);
+    next.who->wake.notify_one();
+}
+
+void sleepFor(uint64_t ms)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!installed)
+    {
+        lock.unlock();
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+        return;
+    }
+
+    if (self == nullptr)
+    {
+        // Primeira espera de uma task nova: ocupa a vez reservada em taskCreating()
+        self = new Participant();
+        for (Participant *who : holders)
+        {
+            if (who->placeholder)
+            {
+                release(who);
+                delete who;
+                break;
+            }
+        }
+    }
+    Participant *me = self;
+    if (me->holding)
+        release(me);
+
+    me->ready = false;
+    queue.push({now + ms, seq++, me});
+    dispatch();
+    me->wake.wait(lock, [me] { return me->ready || !installed; });
+}
+
+void watch()
+{
+    while (installed)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(std::max<uint32_t>(graceMs / 4, 1)));
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto limit = std::chrono::steady_clock::now() - std::chrono::milliseconds(graceMs);
+        for (size_t i = holders.size(); i-- > 0;)
+        {
+            if (holders[i]->since < limit)
+            {
+                Participant *who = holders[i];
+                release(who);
+                if (who->placeholder)
+                    delete who;
+            }
+        }
+        dispatch();
+    }
+}
+} // namespace
+
+const OTAClock::Source VirtualClock::_source = {VirtualClock::millis, VirtualClock::delay, VirtualClock::time,
+                                                   VirtualClock::taskCreating};
+
+void VirtualClock::install(time_t startEpoch, uint32_t grace)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        epoch = startEpoch;
+        graceMs = grace;
+        now = 0;
+        eventCount = 0;
+        installed = true;
+
+        if (self == nullptr)
+            self = new Participant();
+        self->holding = true;
+        self->since = std::chrono::steady_clock::now();
+        holders.assign(1, self);
+    }
+    OTAClock::setSource(&_source);
+    watchdog = std::thread(watch);
+}
+
+void VirtualClock::uninstall()
+{
+    OTAClock::setSource(nullptr);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        installed = false;
+        while (!queue.empty())
+        {
+            queue.top().who->wake.notify_one();
+            queue.pop();
+        }
+        for (Participant *who : holders)
+        {
+            who->holding = false;
+            if (who->placeholder)
+                delete who;
+        }
+        holders.clear();
+    }
+    if (watchdog.joinable())
+        watchdog.join();
+}
+
+void VirtualClock::taskCreating()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!installed)
+        return;
+
+    Participant *reserved = new Participant();
+    reserved->placeholder = true;
+    reserved->holding = true;
+    reserved->since = std::chrono::steady_clock::now();
+    holders.push_back(reserved);
+}
+
+void VirtualClock::advance(uint64_t ms)
+{
+    sleepFor(ms);
+}
+
+uint64_t VirtualClock::nowMs()
+{
+    return now;
+}
+
+uint64_t VirtualClock::events()
+{
+    return eventCount;
+}
+
+uint32_t VirtualClock::millis()
+{
+    return (uint32_t)now;
+}
+
+void VirtualClock::delay(uint32_t ms)
+{
+    sleepFor(ms);
+}
+
+time_t VirtualClock::time()
+{
+    return epoch + (time_t)(now / 1000);
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+/**
+ * @file VirtualClock.h
+ * @brief Relógio virtual de eventos discretos para o build nativo
+ *
+ * Instalado como fonte do OTAClock, faz as tasks da biblioteca esperarem em
+ * tempo virtual: cada OTAClock::delay() agenda o despertar da thread e o
+ * relógio salta direto para o próximo despertar quando nenhuma thread
+ * participante está rodando. Só uma participante roda por vez, então a
+ * ordem dos eventos é determinística e um dia de verificações a cada hora
+ * custa milissegundos.
+ *
+ * Participa toda thread que chama OTAClock::delay(). Tasks criadas por
+ * OTATasks reservam a vez até a primeira espera, para que o relógio não
+ * salte antes de elas começarem. Uma participante que fica mais de graceMs
+ * (tempo real) sem voltar a esperar, presa em rede ou num mutex, é
+ * liberada: o relógio segue sem ela e ela volta à fila na próxima espera. Esperas fora do OTAClock (delay() do shim, timeouts de
+ * sockets) continuam em tempo real.
+ *
+ * Exemplo:
+ * @code
+ * VirtualClock::install();
+ * OTAPullUpdateManager::init(url);
+ * OTAPullUpdateManager::startUpdateThread(60);
+ * VirtualClock::advance(24 * 3600 * 1000ull); // um dia
+ * @endcode
+ */
+
+#include <OTAClock.h>
+
+#include <cstdint>
+#include <ctime>
+
+class VirtualClock
+{
+public:
+    /**
+     * @brief Instala o relógio como fonte do OTAClock
+     * A thread que chama passa a ser participante e segura a vez
+     * @param startEpoch Horário Unix no instante zero
+     * @param graceMs Tempo real máximo de uma participante sem esperar
+     */
+    static void install(time_t startEpoch = 1767225600, uint32_t graceMs = 200);
+
+    /**
+     * @brief Volta ao relógio do hardware e acorda todas as threads em espera
+     */
+    static void uninstall();
+
+    /**
+     * @brief Deixa o tempo virtual correr por ms (espera da thread atual)
+     */
+    static void advance(uint64_t ms);
+
+    static uint64_t nowMs();
+
+    /**
+     * @brief Despertares processados desde install()
+     */
+    static uint64_t events();
+
+private:
+    static const OTAClock::Source _source;
+
+    static uint32_t millis();
+    static void delay(uint32_t ms);
+    static time_t time();
+    static void taskCreating();
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+/**
+ * @file OTAAsset.h
+ * @brief Arquivo estático da interface web servido direto da flash
+ *
+ * Os arquivos são gerados por tools/build_assets.py em webPage/assets.h,
+ * já comprimidos e com ETag calculada pelo conteúdo.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct OTAAsset
+{
+    const char *path;        ///< Caminho da rota (ex: "/style.css")
+    const char *contentType; ///< Tipo MIME
+    const uint8_t *data;     ///< Conteúdo (comprimido se gzip = true)
+    uint32_t size;           ///< Tamanho de data
+    const char *etag;        ///< ETag (hash do conteúdo, entre aspas)
+    const char *version;     ///< Hash usado nas URLs (?v=) das páginas
+    bool gzip;               ///< Enviar com Content-Encoding: gzip
+};
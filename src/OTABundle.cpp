@@ -0,0 +1,361 @@
+#include "OTABundle.h"
+#include "OTAFileSync.h"
+
+#include <esp_ota_ops.h>
+
+// ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
+
+const uint8_t OTABundle::MAX_PARTS;
+size_t OTABundle::_size = 0;
+size_t OTABundle::_received = 0;
+bool OTABundle::_detected = false;
+bool OTABundle::_bundle = false;
+uint8_t OTABundle::_header[8 + 40 * OTABundle::MAX_PARTS];
+size_t OTABundle::_headerLength = 0;
+OTABundle::Part OTABundle::_parts[OTABundle::MAX_PARTS];
+uint8_t OTABundle::_count = 0;
+uint8_t OTABundle::_current = 0;
+size_t OTABundle::_partWritten = 0;
+bool OTABundle::_partRunning = false;
+bool OTABundle::_appStaged = false;
+bool OTABundle::_fsUnmounted = false;
+OTABundle::Error OTABundle::_error = OTABundle::ERROR_OK;
+char OTABundle::_message[64] = "";
+
+// ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
+
+namespace
+{
+    const uint8_t MAGIC[4] = {'O', 'T', 'A', 'B'};
+    const uint8_t FORMAT = 1;
+    const size_t FIXED_HEADER = 8;
+    const size_t PART_HEADER = 40;
+    const uint32_t FS_LOCK_TIMEOUT_MS = 10000; ///< Espera por um manifesto ou patch em outra task
+
+    uint32_t readLe32(const uint8_t *data)
+    {
+        return (uint32_t)data[0] | (uint32_t)data[1] << 8 | (uint32_t)data[2] << 16 | (uint32_t)data[3] << 24;
+    }
+
+    const char *partName(uint8_t type)
+    {
+        return type == OTABundle::PART_FS ? "LittleFS" : "app";
+    }
+}
+
+bool OTABundle::begin(size_t size)
+{
+    abort();
+    _size = size;
+    _error = ERROR_OK;
+    _message[0] = '\0';
+    return size > 0;
+}
+
+bool OTABundle::write(const uint8_t *data, size_t length)
+{
+    if (_error != ERROR_OK)
+    {
+        return false;
+    }
+    _received += length;
+    if (_received > _size)
+    {
+        return fail(ERROR_HEADER, "Body larger than announced");
+    }
+
+    // Os 4 primeiros bytes decidem: pacote ou imagem de app comum
+    if (!_detected)
+    {
+        size_t take = std::min(length, sizeof(MAGIC) - _headerLength);
+        memcpy(_header + _headerLength, data, take);
+        _headerLength += take;
+        data += take;
+        length -= take;
+        if (_headerLength < sizeof(MAGIC))
+        {
+            return true;
+        }
+
+        _detected = true;
+        _bundle = memcmp(_header, MAGIC, sizeof(MAGIC)) == 0;
+        if (!_bundle)
+        {
+            _count = 1;
+            _parts[0].type = PART_APP;
+            _parts[0].size = _size;
+            _parts[0].md5[0] = '\0';
+            if (!writeParts(_header, _headerLength))
+            {
+                return false;
+            }
+        }
+    }
+
+    // Cabeçalho do pacote: fixo, depois 40 bytes por parte
+    if (_bundle && _count == 0)
+    {
+        size_t needed = FIXED_HEADER;
+        if (_headerLength >= FIXED_HEADER)
+        {
+            needed += PART_HEADER * std::min<uint8_t>(_header[5], MAX_PARTS);
+        }
+
+        while (length > 0 && _headerLength < needed)
+        {
+            size_t take = std::min(length, needed - _headerLength);
+            memcpy(_header + _headerLength, data, take);
+            _headerLength += take;
+            data += take;
+            length -= take;
+            if (_headerLength == FIXED_HEADER)
+            {
+                needed += PART_HEADER * std::min<uint8_t>(_header[5], MAX_PARTS);
+            }
+        }
+
+        if (_headerLength < needed)
+        {
+            return true;
+        }
+        if (!parseHeader())
+        {
+            return false;
+        }
+    }
+
+    return writeParts(data, length);
+}
+
+bool OTABundle::end()
+{
+    if (_error != ERROR_OK)
+    {
+        return false;
+    }
+    if (!_detected || _current < _count)
+    {
+        return fail(ERROR_INCOMPLETE, "Body ended before the last part");
+    }
+
+    // Todas as partes conferidas: agora o app novo pode ser o de boot
+    if (_appStaged)
+    {
+        const esp_partition_t *next = esp_ota_get_next_update_partition(nullptr);
+        if (next == nullptr || esp_ota_set_boot_partition(next) != ESP_OK)
+        {
+            return fail(ERROR_ACTIVATE, "Could not activate the new app");
+        }
+        _appStaged = false;
+    }
+
+    if (_bundle)
+    {
+        LOG_INFO("📦 Pacote aplicado: %u parte(s)", _count);
+    }
+    return true;
+}
+
+void OTABundle::abort()
+{
+    if (_partRunning)
+    {
+        Update.abort();
+    }
+    remountFs();
+
+    // Um app já conferido não é de boot (endPart() devolveu o boot ao atual)
+    _appStaged = false;
+    _partRunning = false;
+    _received = 0;
+    _detected = false;
+    _bundle = false;
+    _headerLength = 0;
+    _count = 0;
+    _current = 0;
+    _partWritten = 0;
+}
+
+void OTABundle::remountFs()
+{
+    // Parte do LittleFS concluída ou descartada: monta a partição (nova ou incompleta) e a libera
+    if (_fsUnmounted)
+    {
+        _fsUnmounted = false;
+        OTAFileSync::remount();
+    }
+}
+
+const char *OTABundle::errorString()
+{
+    return _error == ERROR_OK ? "No Error" : _message;
+}
+
+bool OTABundle::fail(Error error, const char *message)
+{
+    LOG_ERROR("❌ Imagem recusada: %s", message);
+    snprintf(_message, sizeof(_message), "%s", message);
+    _error = error;
+    if (_partRunning)
+    {
+        Update.abort();
+        _partRunning = false;
+    }
+    return false;
+}
+
+bool OTABundle::parseHeader()
+{
+    uint8_t format = _header[4];
+    uint8_t count = _header[5];
+    if (format != FORMAT || count == 0 || count > MAX_PARTS)
+    {
+        return fail(ERROR_HEADER, "Unsupported bundle header");
+    }
+
+    size_t total = FIXED_HEADER + PART_HEADER * count;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const uint8_t *entry = _header + FIXED_HEADER + PART_HEADER * i;
+        Part &part = _parts[i];
+        part.type = entry[0];
+        part.size = readLe32(entry + 4);
+
+        if (part.type != PART_APP && part.type != PART_FS)
+        {
+            return fail(ERROR_HEADER, "Unknown bundle part type");
+        }
+        // O app vem primeiro: ele fica inativo enquanto o LittleFS é gravado
+        if (part.size == 0 || (part.type == PART_APP && i > 0) || (i > 0 && _parts[0].type == part.type))
+        {
+            return fail(ERROR_HEADER, "Invalid bundle part layout");
+        }
+
+        bool empty = true;
+        for (int c = 0; c < 32; c++)
+        {
+            char digit = (char)entry[8 + c];
+            if (digit != '0' && digit != '\0')
+            {
+                empty = false;
+            }
+            if (!isxdigit((unsigned char)digit) && digit != '\0')
+            {
+                return fail(ERROR_HEADER, "Invalid part MD5");
+            }
+        }
+        if (empty)
+        {
+            part.md5[0] = '\0';
+        }
+        else
+        {
+            memcpy(part.md5, entry + 8, 32);
+            part.md5[32] = '\0';
+        }
+        total += part.size;
+    }
+
+    if (total != _size)
+    {
+        return fail(ERROR_HEADER, "Bundle size does not match the body");
+    }
+
+    _count = count;
+    LOG_INFO("📦 Pacote com %u parte(s): %s %u bytes%s", count, partName(_parts[0].type), (unsigned)_parts[0].size,
+             count > 1 ? " + LittleFS" : "");
+    return true;
+}
+
+bool OTABundle::beginPart()
+{
+    const Part &part = _parts[_current];
+
+    // A imagem substitui a partição inteira: nada pode estar montado nela nem ser lido até o fim da parte
+    if (part.type == PART_FS)
+    {
+        if (!OTAFileSync::unmount(FS_LOCK_TIMEOUT_MS))
+        {
+            return fail(ERROR_BEGIN, "LittleFS busy");
+        }
+        _fsUnmounted = true;
+    }
+
+    if (!Update.begin(part.size, part.type == PART_FS ? U_SPIFFS : U_FLASH))
+    {
+        return fail(ERROR_BEGIN, Update.errorString());
+    }
+    _partRunning = true;
+    _partWritten = 0;
+
+    if (part.md5[0] != '\0' && !Update.setMD5(part.md5))
+    {
+        return fail(ERROR_HEADER, "Invalid part MD5");
+    }
+    if (_bundle)
+    {
+        LOG_INFO("📝 Gravando parte %u/%u (%s, %u bytes)", _current + 1, _count, partName(part.type),
+                 (unsigned)part.size);
+    }
+    return true;
+}
+
+bool OTABundle::endPart()
+{
+    const Part &part = _parts[_current];
+    bool ended = Update.end();
+    _partRunning = false;
+    remountFs();
+    if (!ended)
+    {
+        return fail(ERROR_VERIFY, Update.errorString());
+    }
+
+    // Update.end() já trocou o boot para o app novo: volta ao atual até o fim do pacote
+    if (part.type == PART_APP && _current + 1 < _count)
+    {
+        if (esp_ota_set_boot_partition(esp_ota_get_running_partition()) != ESP_OK)
+        {
+            return fail(ERROR_ACTIVATE, "Could not keep the running app");
+        }
+        _appStaged = true;
+    }
+
+    if (_bundle)
+    {
+        LOG_INFO("✅ Parte %u/%u conferida (%s)", _current + 1, _count, partName(part.type));
+    }
+    _current++;
+    return true;
+}
+
+bool OTABundle::writeParts(const uint8_t *data, size_t length)
+{
+    while (length > 0)
+    {
+        if (_current >= _count)
+        {
+            return fail(ERROR_HEADER, "Data after the last part");
+        }
+        if (!_partRunning && !beginPart())
+        {
+            return false;
+        }
+
+        const Part &part = _parts[_current];
+        size_t take = std::min(length, (size_t)(part.size - _partWritten));
+        if (Update.write(const_cast<uint8_t *>(data), take) != take)
+        {
+            return fail(ERROR_WRITE, Update.errorString());
+        }
+        _partWritten += take;
+        data += take;
+        length -= take;
+
+        if (_partWritten == part.size && !endPart())
+        {
+            return false;
+        }
+    }
+    return true;
+}
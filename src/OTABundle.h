@@ -0,0 +1,121 @@
+#pragma once
+
+/**
+ * @file OTABundle.h
+ * @brief Gravação de um pacote com a imagem do app e/ou do LittleFS
+ *
+ * Recebe o corpo de uma atualização em blocos e o encaminha ao Update. O
+ * corpo pode ser uma imagem de app comum (começa com 0xE9, como antes) ou
+ * um pacote, que começa com o cabeçalho abaixo (inteiros little-endian):
+ *
+ *   "OTAB"  formato (1)  partes (1-2)  reservado (2 bytes)
+ *   por parte, 40 bytes: tipo (0 = app, 1 = LittleFS)  reservado (3)
+ *                        tamanho (4)  MD5 em hex (32, zeros = sem MD5)
+ *
+ * seguido das partes, na ordem do cabeçalho; o app vem primeiro. Cada parte
+ * vai para o alvo certo do Update (U_FLASH ou U_SPIFFS) e é conferida pelo
+ * Update.end() (tamanho e MD5). A partição de boot só muda no end() deste
+ * pacote, depois que todas as partes foram conferidas: o app gravado antes
+ * do LittleFS volta a ficar inativo até lá.
+ *
+ * O LittleFS não tem partição reserva: se a parte dele falhar no meio, o
+ * app atual continua no boot, mas o sistema de arquivos fica incompleto até
+ * a próxima tentativa. tools/make_bundle.py gera o pacote.
+ *
+ * Exemplo:
+ * @code
+ * OTABundle::begin(contentLength);
+ * while (...)
+ *     if (!OTABundle::write(buffer, n))
+ *         break;
+ * if (OTABundle::end())
+ *     ESP.restart();
+ * @endcode
+ */
+
+#include "OTALog.h"
+
+#include <Arduino.h>
+#include <Update.h>
+
+class OTABundle
+{
+public:
+    enum PartType
+    {
+        PART_APP = 0, ///< Imagem do app (U_FLASH)
+        PART_FS = 1   ///< Imagem do LittleFS (U_SPIFFS)
+    };
+
+    enum Error
+    {
+        ERROR_OK = 0,
+        ERROR_HEADER,     ///< Cabeçalho inválido ou tamanhos que não fecham
+        ERROR_BEGIN,      ///< Update.begin() recusou uma parte
+        ERROR_WRITE,      ///< Update.write() falhou
+        ERROR_VERIFY,     ///< Update.end() recusou uma parte (tamanho, MD5)
+        ERROR_INCOMPLETE, ///< O corpo terminou antes das partes
+        ERROR_ACTIVATE    ///< Não foi possível trocar a partição de boot
+    };
+
+    static const uint8_t MAX_PARTS = 2;
+
+    /**
+     * @brief Começa a receber um corpo (imagem de app ou pacote)
+     * @param size Tamanho total do corpo
+     */
+    static bool begin(size_t size);
+
+    /**
+     * @brief Grava o próximo bloco, na ordem do corpo
+     * @return false em erro: chame abort() (ou end(), que informa o erro)
+     */
+    static bool write(const uint8_t *data, size_t length);
+
+    /**
+     * @brief Confere a última parte e ativa o pacote
+     * @return true se todas as partes foram gravadas e conferidas
+     */
+    static bool end();
+
+    /**
+     * @brief Descarta o que foi gravado; o app atual continua no boot
+     */
+    static void abort();
+
+    static bool isBundle() { return _bundle; }
+    static uint8_t partCount() { return _count; }
+    static Error getError() { return _error; }
+    static const char *errorString();
+
+private:
+    struct Part
+    {
+        uint8_t type;
+        uint32_t size;
+        char md5[33]; ///< Vazio: sem MD5
+    };
+
+    static size_t _size;
+    static size_t _received;
+    static bool _detected;
+    static bool _bundle;
+    static uint8_t _header[8 + 40 * MAX_PARTS];
+    static size_t _headerLength;
+    static Part _parts[MAX_PARTS];
+    static uint8_t _count;
+    static uint8_t _current;
+    static size_t _partWritten;
+    static bool _partRunning;
+    static bool _appStaged; ///< App conferido, aguardando as outras partes
+    static bool _fsUnmounted; ///< LittleFS desmontado pela parte em gravação (OTAFileSync::unmount)
+    static Error _error;
+    static char _message[64];
+
+    static bool fail(Error error, const char *message);
+    static bool parseHeader();
+    static bool beginPart();
+    static bool endPart();
+    static bool writeParts(const uint8_t *data, size_t length);
+    static void remountFs();
+};
@@ -0,0 +1,31 @@
+#include "OTAClock.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+namespace
+{
+    uint32_t hardwareMillis()
+    {
+        return ::millis();
+    }
+
+    void hardwareDelay(uint32_t ms)
+    {
+        vTaskDelay(pdMS_TO_TICKS(ms));
+    }
+
+    time_t hardwareTime()
+    {
+        return ::time(nullptr);
+    }
+
+    const OTAClock::Source hardware = {hardwareMillis, hardwareDelay, hardwareTime, nullptr};
+}
+
+const OTAClock::Source *OTAClock::_source = &hardware;
+
+void OTAClock::setSource(const Source *source)
+{
+    _source = source ? source : &hardware;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+/**
+ * @file OTAClock.h
+ * @brief Relógio e esperas da biblioteca, substituíveis
+ *
+ * Todo o código da biblioteca lê o tempo e espera por aqui: intervalos do
+ * Pull, timeouts de sessões e uploads, telemetria e loops das tasks. Por
+ * padrão a fonte é o hardware (millis(), vTaskDelay() e time()); uma fonte
+ * própria, instalada antes de iniciar a biblioteca, permite rodar o mesmo
+ * código num relógio virtual (ver host/sim/VirtualClock.h no build nativo),
+ * simulando dias de verificações em segundos.
+ *
+ * Durações medidas para métricas e trace (micros(), ciclos) continuam no
+ * relógio real: medem o custo do código, não o agendamento.
+ *
+ * Exemplo:
+ * @code
+ * uint32_t start = OTAClock::millis();
+ * while (OTAClock::millis() - start < 5000)
+ *     OTAClock::delay(100);
+ * @endcode
+ */
+
+#include <Arduino.h>
+#include <time.h>
+
+class OTAClock
+{
+public:
+    struct Source
+    {
+        uint32_t (*millis)();       ///< Milissegundos desde o boot
+        void (*delay)(uint32_t ms); ///< Bloqueia a task atual
+        time_t (*time)();           ///< Horário Unix (segundos)
+        void (*taskCreating)();     ///< Antes de criar uma task da biblioteca (opcional)
+    };
+
+    /**
+     * @brief Troca a fonte de tempo (antes de iniciar a biblioteca)
+     * @param source Fonte; nullptr volta ao hardware
+     */
+    static void setSource(const Source *source);
+
+    static uint32_t millis() { return _source->millis(); }
+    static void delay(uint32_t ms) { _source->delay(ms); }
+    static time_t time() { return _source->time(); }
+
+    /**
+     * @brief Avisa a fonte que uma task vai ser criada (chamado por OTATasks)
+     * Um relógio virtual espera a task chegar à primeira espera antes de avançar
+     */
+    static void taskCreating()
+    {
+        if (_source->taskCreating)
+            _source->taskCreating();
+    }
+
+private:
+    static const Source *_source;
+};
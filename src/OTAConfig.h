@@ -0,0 +1,349 @@
+#pragma once
+
+/**
+ * @file OTAConfig.h
+ * @brief Opções de compilação da biblioteca OTAUpdateManager
+ *
+ * Todas as opções podem ser sobrescritas via build_flags no platformio.ini,
+ * por exemplo: -D OTA_ASYNC_WEBSERVER=1
+ */
+
+// ============ SERVIDOR WEB ============
+
+/**
+ * @brief Seleciona o backend do servidor web do sistema Push
+ *
+ * 0 = WebServer síncrono processado por uma task FreeRTOS (padrão)
+ * 1 = ESPAsyncWebServer orientado a eventos (AsyncTCP), sem task de polling
+ */
+#ifndef OTA_ASYNC_WEBSERVER
+#define OTA_ASYNC_WEBSERVER 0
+#endif
+
+/**
+ * @brief Stack das tasks auxiliares de curta duração do backend assíncrono
+ * (verificação e instalação de atualizações disparadas pela página, manifesto
+ * e aplicação dos patches de /api/files)
+ */
+#ifndef OTA_DEFERRED_TASK_STACK
+#define OTA_DEFERRED_TASK_STACK 8192
+#endif
+
+// ============ TASKS ============
+
+/**
+ * @brief Núcleo da task do servidor web e da task de eventos (0, 1 ou tskNO_AFFINITY)
+ * Use o núcleo que não roda o código de tempo real da aplicação
+ */
+#ifndef OTA_WEB_TASK_CORE
+#define OTA_WEB_TASK_CORE tskNO_AFFINITY
+#endif
+
+/**
+ * @brief Núcleo da task de verificação periódica do Pull (0, 1 ou tskNO_AFFINITY)
+ */
+#ifndef OTA_PULL_TASK_CORE
+#define OTA_PULL_TASK_CORE tskNO_AFFINITY
+#endif
+
+/**
+ * @brief Stack da task de verificação periódica do Pull (download e Update incluídos)
+ */
+#ifndef OTA_PULL_TASK_STACK
+#define OTA_PULL_TASK_STACK 4096
+#endif
+
+/**
+ * @brief Buffer de leitura do download do Pull (bytes por Update.write())
+ * Alocado estaticamente (não ocupa a stack da task do Pull)
+ */
+#ifndef OTA_PULL_BUFFER
+#define OTA_PULL_BUFFER 1024
+#endif
+
+/**
+ * @brief Stack da task que publica a telemetria no backend assíncrono
+ */
+#ifndef OTA_EVENTS_TASK_STACK
+#define OTA_EVENTS_TASK_STACK 4096
+#endif
+
+/**
+ * @brief Máximo de tasks acompanhadas em /api/system (stack e CPU)
+ */
+#ifndef OTA_TASKS_MAX
+#define OTA_TASKS_MAX 8
+#endif
+
+// ============ MÉTRICAS ============
+
+/**
+ * @brief Bloco de envio de /metrics (as linhas são agrupadas até encher)
+ */
+#ifndef OTA_METRICS_BUFFER
+#define OTA_METRICS_BUFFER 512
+#endif
+
+// ============ RASTREAMENTO ============
+
+/**
+ * @brief Habilita os spans de OTA_TRACE_SCOPE() e a rota /api/trace
+ * Desabilitado, o rastreamento não gera código
+ */
+#ifndef OTA_TRACE_ENABLED
+#define OTA_TRACE_ENABLED 0
+#endif
+
+/**
+ * @brief Spans guardados por núcleo (os mais antigos são sobrescritos)
+ * Cada span ocupa 32 bytes
+ */
+#ifndef OTA_TRACE_EVENTS
+#define OTA_TRACE_EVENTS 256
+#endif
+
+// ============ HORÁRIO ============
+
+/**
+ * @brief Fuso horário no formato POSIX (padrão: UTC-3, Brasília)
+ */
+#ifndef OTA_TIME_TZ
+#define OTA_TIME_TZ "<-03>3"
+#endif
+
+/**
+ * @brief Servidores SNTP
+ */
+#ifndef OTA_TIME_SERVER1
+#define OTA_TIME_SERVER1 "pool.ntp.org"
+#endif
+
+#ifndef OTA_TIME_SERVER2
+#define OTA_TIME_SERVER2 "time.nist.gov"
+#endif
+
+/**
+ * @brief Intervalo entre consultas até o deslocamento do cristal ser estimado
+ */
+#ifndef OTA_TIME_INITIAL_INTERVAL_MS
+#define OTA_TIME_INITIAL_INTERVAL_MS 3600000
+#endif
+
+/**
+ * @brief Limites do intervalo adaptativo entre consultas
+ */
+#ifndef OTA_TIME_MIN_INTERVAL_MS
+#define OTA_TIME_MIN_INTERVAL_MS 900000
+#endif
+
+#ifndef OTA_TIME_MAX_INTERVAL_MS
+#define OTA_TIME_MAX_INTERVAL_MS 86400000
+#endif
+
+/**
+ * @brief Erro acumulado tolerado entre duas consultas (define o intervalo)
+ */
+#ifndef OTA_TIME_MAX_ERROR_MS
+#define OTA_TIME_MAX_ERROR_MS 500
+#endif
+
+// ============ LOG ============
+
+/**
+ * @brief Nível máximo dos logs da biblioteca mantidos no código
+ * 0 = nenhum, 1 = erro, 2 = aviso, 3 = info, 4 = debug; os demais viram no-op
+ */
+#ifndef OTA_LOG_LEVEL
+#define OTA_LOG_LEVEL 4
+#endif
+
+/**
+ * @brief Logs adiados: o chamador só grava um registro binário num ring
+ * buffer e uma task de baixa prioridade formata e imprime (ver OTALog.h)
+ */
+#ifndef OTA_LOG_DEFERRED
+#define OTA_LOG_DEFERRED 0
+#endif
+
+/**
+ * @brief Tamanho do ring buffer de registros (cheio, o registro é descartado)
+ */
+#ifndef OTA_LOG_BUFFER
+#define OTA_LOG_BUFFER 4096
+#endif
+
+/**
+ * @brief Bytes de argumentos por registro (strings incluídas)
+ */
+#ifndef OTA_LOG_RECORD_MAX
+#define OTA_LOG_RECORD_MAX 96
+#endif
+
+/**
+ * @brief Últimas linhas formatadas guardadas para GET /api/log
+ */
+#ifndef OTA_LOG_TAIL
+#define OTA_LOG_TAIL 2048
+#endif
+
+/**
+ * @brief Registros seguidos permitidos a cada ponto de log
+ */
+#ifndef OTA_LOG_SITE_BURST
+#define OTA_LOG_SITE_BURST 5
+#endif
+
+/**
+ * @brief Depois da rajada, um registro por ponto de log a cada intervalo
+ */
+#ifndef OTA_LOG_SITE_INTERVAL_MS
+#define OTA_LOG_SITE_INTERVAL_MS 1000
+#endif
+
+/**
+ * @brief Stack e prioridade da task que formata os registros
+ */
+#ifndef OTA_LOG_TASK_STACK
+#define OTA_LOG_TASK_STACK 3072
+#endif
+
+#ifndef OTA_LOG_TASK_PRIORITY
+#define OTA_LOG_TASK_PRIORITY 1
+#endif
+
+// ============ UPLOAD RETOMÁVEL ============
+
+/**
+ * @brief Tamanho máximo de um bloco do upload retomável (/api/upload)
+ *
+ * Cada bloco é recebido por inteiro na RAM e só é gravado no Update depois
+ * da verificação do CRC32; o buffer é alocado no primeiro bloco HTTP e
+ * liberado com a sessão (o upload por WebSocket não o usa).
+ * Múltiplo de 4096 (setor da flash): todo bloco, exceto o último, deve ter
+ * tamanho múltiplo de 4096, para que o offset da sessão fique num limite de setor.
+ */
+#ifndef OTA_UPLOAD_CHUNK_MAX
+#define OTA_UPLOAD_CHUNK_MAX 8192
+#endif
+
+/**
+ * @brief Tempo sem receber blocos após o qual a sessão é descartada
+ */
+#ifndef OTA_UPLOAD_SESSION_TIMEOUT_MS
+#define OTA_UPLOAD_SESSION_TIMEOUT_MS 600000
+#endif
+
+/**
+ * @brief Tamanho dos frames binários do upload por WebSocket (/api/ws/upload)
+ *
+ * Múltiplo de 4096 (setor da flash): quando um frame termina, o Update já
+ * gravou o setor e a confirmação enviada ao navegador corresponde a dados
+ * na flash.
+ */
+#ifndef OTA_WS_UPLOAD_FRAME
+#define OTA_WS_UPLOAD_FRAME 4096
+#endif
+
+/**
+ * @brief Frames enviados pelo navegador sem confirmação (janela deslizante)
+ */
+#ifndef OTA_WS_UPLOAD_WINDOW
+#define OTA_WS_UPLOAD_WINDOW 4
+#endif
+
+// ============ ESTADO ============
+
+/**
+ * @brief Tamanho máximo (com terminador) das versões guardadas no OTAStatus
+ */
+#ifndef OTA_STATUS_VERSION_MAX
+#define OTA_STATUS_VERSION_MAX 24
+#endif
+
+// ============ SESSÃO DE ATUALIZAÇÃO ============
+
+/**
+ * @brief Política padrão quando Push e Pull disputam o Update
+ * 1 = o upload pela página interrompe o download do Pull; 0 = o Pull interrompe o upload
+ */
+#ifndef OTA_SESSION_PUSH_WINS
+#define OTA_SESSION_PUSH_WINS 1
+#endif
+
+/**
+ * @brief Tempo máximo que o vencedor espera o perdedor abortar e liberar o Update
+ */
+#ifndef OTA_SESSION_PREEMPT_TIMEOUT_MS
+#define OTA_SESSION_PREEMPT_TIMEOUT_MS 3000
+#endif
+
+// ============ API JSON ============
+
+/**
+ * @brief Buffer do serializador JSON (os dados são enviados sempre que enche)
+ */
+#ifndef OTA_JSON_BUFFER
+#define OTA_JSON_BUFFER 256
+#endif
+
+// ============ EVENTOS ============
+
+/**
+ * @brief Intervalo mínimo entre eventos de progresso de uma mesma fase
+ */
+#ifndef OTA_EVENTS_PROGRESS_INTERVAL_MS
+#define OTA_EVENTS_PROGRESS_INTERVAL_MS 250
+#endif
+
+/**
+ * @brief Intervalo entre eventos de telemetria (heap, RSSI)
+ */
+#ifndef OTA_EVENTS_TELEMETRY_INTERVAL_MS
+#define OTA_EVENTS_TELEMETRY_INTERVAL_MS 2000
+#endif
+
+/**
+ * @brief Máximo de páginas inscritas em /api/events ao mesmo tempo
+ */
+#ifndef OTA_EVENTS_MAX_CLIENTS
+#define OTA_EVENTS_MAX_CLIENTS 4
+#endif
+
+/**
+ * @brief Buffer de serialização de um evento
+ */
+#ifndef OTA_EVENTS_BUFFER
+#define OTA_EVENTS_BUFFER 256
+#endif
+
+// ============ SINCRONIZAÇÃO DE ARQUIVOS ============
+
+/**
+ * @brief Caminho mais longo aceito num patch de arquivos (OTAFileSync)
+ * Mantenha dentro do limite de nomes do LittleFS (CONFIG_LITTLEFS_OBJ_NAME_LEN)
+ */
+#ifndef OTA_FILESYNC_PATH_MAX
+#define OTA_FILESYNC_PATH_MAX 64
+#endif
+
+/**
+ * @brief Tamanho máximo da revisão que acompanha um patch
+ */
+#ifndef OTA_FILESYNC_REVISION_MAX
+#define OTA_FILESYNC_REVISION_MAX 40
+#endif
+
+/**
+ * @brief Maior manifesto enviado pelo Pull (o corpo do POST fica na RAM)
+ */
+#ifndef OTA_FILESYNC_MANIFEST_MAX
+#define OTA_FILESYNC_MANIFEST_MAX 8192
+#endif
+
+/**
+ * @brief Espera máxima do servidor web pelo LittleFS ocupado por outra task
+ * Esgotada, o /api/files responde 503 e o cliente tenta de novo
+ */
+#ifndef OTA_FILESYNC_LOCK_TIMEOUT_MS
+#define OTA_FILESYNC_LOCK_TIMEOUT_MS 500
+#endif
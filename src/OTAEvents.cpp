@@ -0,0 +1,149 @@
+#include "OTAEvents.h"
+#include "OTAClock.h"
+#include "OTAJsonWriter.h"
+#include "OTAStatus.h"
+#include "OTATrace.h"
+
+#include <WiFi.h>
+
+// ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
+
+OTAEvents::Sink OTAEvents::_sink = nullptr;
+SemaphoreHandle_t OTAEvents::_mutex = nullptr;
+
+OTAEvents::Phase OTAEvents::_phase[SOURCE_COUNT] = {PHASE_DONE, PHASE_DONE};
+uint32_t OTAEvents::_startMs[SOURCE_COUNT] = {0, 0};
+uint32_t OTAEvents::_lastSentMs[SOURCE_COUNT] = {0, 0};
+
+uint32_t OTAEvents::_lastTelemetryMs = 0;
+
+char OTAEvents::_buffer[OTA_EVENTS_BUFFER];
+
+// ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
+
+void OTAEvents::setSink(Sink sink)
+{
+    if (_mutex == nullptr)
+    {
+        _mutex = xSemaphoreCreateMutex();
+    }
+
+    _sink = sink;
+}
+
+const char *OTAEvents::sourceName(Source source)
+{
+    return source == SOURCE_PUSH ? "push" : "pull";
+}
+
+const char *OTAEvents::phaseName(Phase phase)
+{
+    switch (phase)
+    {
+    case PHASE_START:
+        return "start";
+    case PHASE_TRANSFER:
+        return "transfer";
+    case PHASE_FINALIZE:
+        return "finalize";
+    case PHASE_DONE:
+        return "done";
+    case PHASE_ERROR:
+        return "error";
+    }
+    return "unknown";
+}
+
+void OTAEvents::progress(Source source, Phase phase, size_t bytes, size_t total, const char *message)
+{
+    if (_sink == nullptr || source >= SOURCE_COUNT)
+    {
+        return;
+    }
+
+    uint32_t now = OTAClock::millis();
+
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+
+    if (phase == PHASE_START)
+    {
+        _startMs[source] = now;
+    }
+
+    // Mesma fase: no máximo um evento por intervalo
+    bool phaseChanged = (phase != _phase[source]);
+    if (!phaseChanged && now - _lastSentMs[source] < OTA_EVENTS_PROGRESS_INTERVAL_MS)
+    {
+        xSemaphoreGive(_mutex);
+        return;
+    }
+
+    _phase[source] = phase;
+    _lastSentMs[source] = now;
+
+    // Vazão média desde o início e tempo restante estimado
+    uint32_t elapsedMs = now - _startMs[source];
+    uint32_t bytesPerSecond = elapsedMs > 0 ? (uint32_t)((uint64_t)bytes * 1000 / elapsedMs) : 0;
+
+    OTABufferPrint out(_buffer, sizeof(_buffer));
+    OTAJsonWriter json(out);
+
+    json.beginObject();
+    json.add("source", sourceName(source));
+    json.add("phase", phaseName(phase));
+    json.add("bytes", bytes);
+    if (total > 0)
+    {
+        json.add("total", total);
+        json.add("percent", bytes * 100.0 / total, 1);
+    }
+    json.add("bps", bytesPerSecond);
+    if (total > bytes && bytesPerSecond > 0 && phase == PHASE_TRANSFER)
+    {
+        json.add("eta", (double)(total - bytes) / bytesPerSecond, 1);
+    }
+    json.add("elapsed", elapsedMs);
+    if (message != nullptr)
+    {
+        json.add("message", message);
+    }
+    json.endObject();
+    json.flush();
+
+    _sink("progress", _buffer);
+
+    xSemaphoreGive(_mutex);
+}
+
+void OTAEvents::loop()
+{
+    if (_sink == nullptr || OTAClock::millis() - _lastTelemetryMs < OTA_EVENTS_TELEMETRY_INTERVAL_MS)
+    {
+        return;
+    }
+
+    _lastTelemetryMs = OTAClock::millis();
+    OTA_TRACE_SCOPE("events.telemetry");
+    publishTelemetry();
+}
+
+void OTAEvents::publishTelemetry()
+{
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+
+    OTABufferPrint out(_buffer, sizeof(_buffer));
+    OTAJsonWriter json(out);
+
+    json.beginObject();
+    json.add("heapFree", ESP.getFreeHeap());
+    json.add("heapMin", ESP.getMinFreeHeap());
+    json.add("rssi", WiFi.RSSI());
+    json.add("uptime", OTAClock::millis() / 1000);
+    json.add("updating", OTAStatus::get().updating());
+    json.endObject();
+    json.flush();
+
+    _sink("telemetry", _buffer);
+
+    xSemaphoreGive(_mutex);
+}
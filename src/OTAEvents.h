@@ -0,0 +1,94 @@
+#pragma once
+
+/**
+ * @file OTAEvents.h
+ * @brief Eventos de progresso e telemetria publicados para a interface web
+ *
+ * Os sistemas Push e Pull informam o andamento das atualizações por
+ * progress(); os eventos são limitados a um a cada
+ * OTA_EVENTS_PROGRESS_INTERVAL_MS (mudanças de fase são sempre enviadas) e
+ * incluem bytes, vazão e tempo restante estimado. loop() publica a
+ * telemetria do sistema (heap, RSSI) a cada OTA_EVENTS_TELEMETRY_INTERVAL_MS.
+ *
+ * O transporte (Server-Sent Events em /api/events) é fornecido pelo backend
+ * web através de setSink(). Sem sink, os eventos são descartados.
+ */
+
+#include "OTAConfig.h"
+#include "OTALog.h"
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+class OTAEvents
+{
+public:
+    /**
+     * @brief Origem de uma atualização
+     */
+    enum Source
+    {
+        SOURCE_PUSH = 0, ///< Upload pela página web
+        SOURCE_PULL,     ///< Download do servidor de atualizações
+        SOURCE_COUNT
+    };
+
+    /**
+     * @brief Fase de uma atualização
+     */
+    enum Phase
+    {
+        PHASE_START = 0, ///< Update iniciado
+        PHASE_TRANSFER,  ///< Recebendo e gravando dados
+        PHASE_FINALIZE,  ///< Verificando e ativando a nova imagem
+        PHASE_DONE,      ///< Concluída (o ESP32 vai reiniciar)
+        PHASE_ERROR      ///< Falhou ou foi interrompida
+    };
+
+    /**
+     * @brief Entrega um evento já serializado aos clientes conectados
+     * @param event Nome do evento ("progress" ou "telemetry")
+     * @param data Dados do evento em JSON
+     */
+    typedef void (*Sink)(const char *event, const char *data);
+
+    /**
+     * @brief Define o transporte dos eventos (chamado pelo backend web)
+     */
+    static void setSink(Sink sink);
+
+    /**
+     * @brief Informa o andamento de uma atualização
+     * @param source Origem da atualização
+     * @param phase Fase atual
+     * @param bytes Bytes gravados até agora
+     * @param total Tamanho total esperado (0 se desconhecido)
+     * @param message Texto opcional (ex: motivo do erro)
+     */
+    static void progress(Source source, Phase phase, size_t bytes, size_t total, const char *message = nullptr);
+
+    /**
+     * @brief Publica a telemetria quando o intervalo expira
+     * Deve ser chamado periodicamente pelo backend web
+     */
+    static void loop();
+
+    static const char *sourceName(Source source);
+    static const char *phaseName(Phase phase);
+
+private:
+    static Sink _sink;
+    static SemaphoreHandle_t _mutex;
+
+    // Estado por origem, para limitar a taxa e calcular vazão/ETA
+    static Phase _phase[SOURCE_COUNT];
+    static uint32_t _startMs[SOURCE_COUNT];
+    static uint32_t _lastSentMs[SOURCE_COUNT];
+
+    static uint32_t _lastTelemetryMs;
+
+    static char _buffer[OTA_EVENTS_BUFFER]; ///< Evento em serialização (protegido por _mutex)
+
+    static void publishTelemetry();
+};
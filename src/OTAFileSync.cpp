@@ -0,0 +1,767 @@
+#include "OTAFileSync.h"
+
+// ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
+
+bool OTAFileSync::_running = false;
+OTAFileSync::State OTAFileSync::_state = OTAFileSync::STATE_HEADER;
+size_t OTAFileSync::_size = 0;
+size_t OTAFileSync::_received = 0;
+uint8_t OTAFileSync::_buffer[2 + OTA_FILESYNC_PATH_MAX + 36];
+size_t OTAFileSync::_bufferLength = 0;
+size_t OTAFileSync::_needed = 0;
+uint16_t OTAFileSync::_entries = 0;
+uint16_t OTAFileSync::_entry = 0;
+char OTAFileSync::_revision[OTA_FILESYNC_REVISION_MAX + 1] = "";
+char OTAFileSync::_path[OTA_FILESYNC_PATH_MAX + 1] = "";
+char OTAFileSync::_md5[33] = "";
+uint32_t OTAFileSync::_fileSize = 0;
+uint32_t OTAFileSync::_fileWritten = 0;
+File OTAFileSync::_file;
+File OTAFileSync::_journal;
+size_t OTAFileSync::_journalSize = 0;
+MD5Builder OTAFileSync::_hash;
+uint16_t OTAFileSync::_written = 0;
+uint16_t OTAFileSync::_deleted = 0;
+size_t OTAFileSync::_dataWritten = 0;
+OTAFileSync::Error OTAFileSync::_error = OTAFileSync::ERROR_OK;
+char OTAFileSync::_message[64] = "";
+SemaphoreHandle_t OTAFileSync::_mutex = nullptr;
+portMUX_TYPE OTAFileSync::_mutexLock = portMUX_INITIALIZER_UNLOCKED;
+bool OTAFileSync::_unmounted = false;
+
+// ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
+
+namespace
+{
+    const uint8_t MAGIC[4] = {'O', 'T', 'A', 'S'};
+    const uint8_t FORMAT = 1;
+    const size_t FIXED_HEADER = 12;
+    const size_t FS_BLOCK = 4096; ///< Bloco do LittleFS: cada arquivo ocupa ao menos um
+
+    const char *STAGING_DIR = "/.ota_sync";
+    const char *JOURNAL = "/.ota_sync/journal";
+    const char *JOURNAL_TMP = "/.ota_sync/journal.tmp";
+    const char *REVISION_FILE = "/ota_files.txt";
+    const char *VERSION_FILE = "/ota_version.txt";
+
+    static_assert(FIXED_HEADER + OTA_FILESYNC_REVISION_MAX <= 2 + OTA_FILESYNC_PATH_MAX + 36,
+                  "OTA_FILESYNC_REVISION_MAX does not fit the header buffer");
+    static_assert(OTA_FILESYNC_PATH_MAX <= 255, "Patch paths are limited to 255 bytes");
+
+    uint16_t readLe16(const uint8_t *data)
+    {
+        return (uint16_t)(data[0] | data[1] << 8);
+    }
+
+    uint32_t readLe32(const uint8_t *data)
+    {
+        return (uint32_t)data[0] | (uint32_t)data[1] << 8 | (uint32_t)data[2] << 16 | (uint32_t)data[3] << 24;
+    }
+
+    bool printable(const char *text)
+    {
+        for (; *text; text++)
+        {
+            if ((unsigned char)*text < 0x20 || *text == 0x7F)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Segura o mutex do OTAFileSync até o fim do escopo (imediato se a task já tem o lock())
+    class Guard
+    {
+    public:
+        explicit Guard(SemaphoreHandle_t mutex) : _mutex(mutex) { xSemaphoreTakeRecursive(_mutex, portMAX_DELAY); }
+        ~Guard() { xSemaphoreGiveRecursive(_mutex); }
+
+    private:
+        SemaphoreHandle_t _mutex;
+    };
+
+    void hashFile(File &file, char md5[33])
+    {
+        MD5Builder hash;
+        uint8_t buffer[256];
+        size_t n;
+        hash.begin();
+        while ((n = file.read(buffer, sizeof(buffer))) > 0)
+        {
+            hash.add(buffer, n);
+        }
+        hash.calculate();
+        hash.getChars(md5);
+    }
+}
+
+SemaphoreHandle_t OTAFileSync::mutex()
+{
+    // Criado na primeira chamada, que pode vir de qualquer task (web, Pull ou a aplicação):
+    // o mutex é criado fora da seção crítica e só o primeiro a publicá-lo é mantido
+    if (_mutex == nullptr)
+    {
+        SemaphoreHandle_t created = xSemaphoreCreateRecursiveMutex();
+
+        portENTER_CRITICAL(&_mutexLock);
+        if (_mutex == nullptr)
+        {
+            _mutex = created;
+            created = nullptr;
+        }
+        portEXIT_CRITICAL(&_mutexLock);
+
+        if (created != nullptr)
+        {
+            vSemaphoreDelete(created);
+        }
+    }
+    return _mutex;
+}
+
+bool OTAFileSync::lock(uint32_t timeoutMs)
+{
+    return xSemaphoreTakeRecursive(mutex(), pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+}
+
+void OTAFileSync::unlock()
+{
+    xSemaphoreGiveRecursive(mutex());
+}
+
+bool OTAFileSync::unmount(uint32_t timeoutMs)
+{
+    if (!lock(timeoutMs))
+    {
+        return false;
+    }
+
+    // Arquivos abertos não sobrevivem à partição regravada
+    discard();
+    LittleFS.end();
+    _unmounted = true;
+    return true;
+}
+
+void OTAFileSync::remount()
+{
+    _unmounted = false;
+    mount();
+    unlock();
+}
+
+bool OTAFileSync::mount()
+{
+    // Partição em regravação pela task que segura o unmount()
+    if (_unmounted)
+    {
+        return false;
+    }
+
+    // Só o unmount() desmonta: a aplicação usa os mesmos arquivos. begin() de um LittleFS já montado só retorna true
+    if (!LittleFS.begin(true))
+    {
+        LOG_ERROR("Falha ao montar LittleFS");
+        return false;
+    }
+    return true;
+}
+
+size_t OTAFileSync::writeManifest(Print &out)
+{
+    // Um patch em aplicação na outra task termina antes da listagem
+    Guard guard(mutex());
+    if (!mount())
+    {
+        return 0;
+    }
+
+    File root = LittleFS.open("/");
+    size_t count = root ? listDirectory(out, root) : 0;
+    root.close();
+
+    LOG_DEBUG("📋 Manifesto do LittleFS: %u arquivo(s)", (unsigned)count);
+    return count;
+}
+
+size_t OTAFileSync::listDirectory(Print &out, File &dir)
+{
+    size_t count = 0;
+    File entry;
+    while ((entry = dir.openNextFile()))
+    {
+        String path = entry.path();
+        if (reserved(path.c_str()))
+        {
+            continue;
+        }
+
+        if (entry.isDirectory())
+        {
+            count += listDirectory(out, entry);
+            continue;
+        }
+
+        char md5[33];
+        hashFile(entry, md5);
+        out.printf("%s %u %s\n", md5, (unsigned)entry.size(), path.c_str());
+        count++;
+    }
+    return count;
+}
+
+bool OTAFileSync::begin(size_t size)
+{
+    Guard guard(mutex());
+    discard();
+    // Preparação deixada por um reinício no meio de outro patch
+    recoverStaging();
+
+    _size = size;
+    _received = 0;
+    _state = STATE_HEADER;
+    _bufferLength = 0;
+    _needed = FIXED_HEADER;
+    _entries = 0;
+    _entry = 0;
+    _revision[0] = '\0';
+    _written = 0;
+    _deleted = 0;
+    _dataWritten = 0;
+    _error = ERROR_OK;
+    _message[0] = '\0';
+
+    if (!mount())
+    {
+        return fail(ERROR_MOUNT, "LittleFS mount failed");
+    }
+    _running = true;
+
+    if (size < FIXED_HEADER)
+    {
+        return fail(ERROR_HEADER, "Patch too short");
+    }
+
+    LittleFS.mkdir(STAGING_DIR);
+    _journal = LittleFS.open(JOURNAL_TMP, "w");
+    _journalSize = 0;
+    if (!_journal)
+    {
+        return fail(ERROR_WRITE, "Could not create the journal");
+    }
+    return true;
+}
+
+bool OTAFileSync::write(const uint8_t *data, size_t length)
+{
+    Guard guard(mutex());
+    if (!_running || _error != ERROR_OK)
+    {
+        return false;
+    }
+    _received += length;
+    if (_received > _size)
+    {
+        return fail(ERROR_HEADER, "Body larger than announced");
+    }
+
+    while (length > 0)
+    {
+        if (_state == STATE_DATA)
+        {
+            size_t take = std::min(length, (size_t)(_fileSize - _fileWritten));
+            if (_file.write(data, take) != take)
+            {
+                return fail(ERROR_WRITE, "Could not write a staged file");
+            }
+            _hash.add(const_cast<uint8_t *>(data), take);
+            _fileWritten += take;
+            data += take;
+            length -= take;
+
+            if (_fileWritten == _fileSize && !finishFile())
+            {
+                return false;
+            }
+            continue;
+        }
+
+        if (_state == STATE_DONE)
+        {
+            return fail(ERROR_HEADER, "Data after the last entry");
+        }
+
+        // Cabeçalhos são montados em _buffer até completar a parte atual
+        size_t take = std::min(length, _needed - _bufferLength);
+        memcpy(_buffer + _bufferLength, data, take);
+        _bufferLength += take;
+        data += take;
+        length -= take;
+
+        if (_bufferLength == _needed && !(_state == STATE_HEADER ? parseHeader() : parseEntry()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool OTAFileSync::end()
+{
+    Guard guard(mutex());
+    if (!_running || _error != ERROR_OK)
+    {
+        return false;
+    }
+    if (_state != STATE_DONE || _received != _size)
+    {
+        return fail(ERROR_INCOMPLETE, "Body ended before the last entry");
+    }
+
+    if (_revision[0] != '\0' && !journalWrite("R %s\n", _revision))
+    {
+        return false;
+    }
+    if (!closeJournal())
+    {
+        return false;
+    }
+
+    // Ponto de confirmação: com o diário no lugar, o patch é aplicado mesmo após um reinício
+    if (!LittleFS.rename(JOURNAL_TMP, JOURNAL))
+    {
+        return fail(ERROR_WRITE, "Could not commit the journal");
+    }
+
+    bool applied = apply();
+    _running = false;
+
+    if (!applied)
+    {
+        // O diário continua confirmado: recover() termina no próximo boot ou patch
+        LOG_ERROR("❌ Falha ao aplicar os arquivos sincronizados");
+        snprintf(_message, sizeof(_message), "%s", "Could not apply the journal");
+        _error = ERROR_APPLY;
+        return false;
+    }
+
+    LOG_INFO("✅ Arquivos sincronizados: %u gravado(s), %u apagado(s), %u bytes", _written, _deleted,
+             (unsigned)_dataWritten);
+    return true;
+}
+
+void OTAFileSync::abort()
+{
+    Guard guard(mutex());
+    discard();
+}
+
+void OTAFileSync::discard()
+{
+    if (!_running)
+    {
+        return;
+    }
+
+    _file.close();
+    _journal.close();
+    clearStaging();
+    _running = false;
+}
+
+void OTAFileSync::recover()
+{
+    Guard guard(mutex());
+    if (!_running)
+    {
+        recoverStaging();
+    }
+}
+
+void OTAFileSync::recoverStaging()
+{
+    if (!mount())
+    {
+        return;
+    }
+
+    if (LittleFS.exists(JOURNAL))
+    {
+        LOG_WARN("🗂️ Concluindo sincronização de arquivos interrompida");
+        if (!apply())
+        {
+            LOG_ERROR("❌ Falha ao aplicar os arquivos sincronizados");
+        }
+    }
+    else if (LittleFS.exists(STAGING_DIR))
+    {
+        LOG_WARN("🧹 Descartando sincronização de arquivos incompleta");
+        clearStaging();
+    }
+}
+
+String OTAFileSync::getRevision()
+{
+    Guard guard(mutex());
+    if (!mount())
+    {
+        return "";
+    }
+
+    String revision;
+    File file = LittleFS.open(REVISION_FILE, "r");
+    if (file)
+    {
+        revision = file.readString();
+        revision.trim();
+        file.close();
+    }
+    return revision;
+}
+
+const char *OTAFileSync::errorString()
+{
+    return _error == ERROR_OK ? "No Error" : _message;
+}
+
+bool OTAFileSync::fail(Error error, const char *message)
+{
+    LOG_ERROR("❌ Patch de arquivos recusado: %s", message);
+    snprintf(_message, sizeof(_message), "%s", message);
+    _error = error;
+    _file.close();
+    return false;
+}
+
+bool OTAFileSync::parseHeader()
+{
+    if (memcmp(_buffer, MAGIC, sizeof(MAGIC)) != 0 || _buffer[4] != FORMAT)
+    {
+        return fail(ERROR_HEADER, "Unsupported patch header");
+    }
+
+    uint8_t revisionLength = _buffer[5];
+    if (revisionLength > OTA_FILESYNC_REVISION_MAX)
+    {
+        return fail(ERROR_HEADER, "Revision too long");
+    }
+    // A revisão vem logo depois do cabeçalho fixo
+    if (_bufferLength < FIXED_HEADER + revisionLength)
+    {
+        _needed = FIXED_HEADER + revisionLength;
+        return true;
+    }
+
+    memcpy(_revision, _buffer + FIXED_HEADER, revisionLength);
+    _revision[revisionLength] = '\0';
+    if (!printable(_revision) || strchr(_revision, ' ') != nullptr)
+    {
+        return fail(ERROR_HEADER, "Invalid revision");
+    }
+
+    _entries = readLe16(_buffer + 6);
+    uint32_t dataBytes = readLe32(_buffer + 8);
+
+    // Os arquivos preparados convivem com os atuais até o patch ser aplicado
+    size_t total = LittleFS.totalBytes();
+    size_t used = LittleFS.usedBytes();
+    size_t needed = dataBytes + (size_t)(_entries + 1) * FS_BLOCK;
+    if (used > total || needed > total - used)
+    {
+        LOG_ERROR("❌ Espaço insuficiente: %u bytes necessários, %u livres", (unsigned)needed,
+                  (unsigned)(used > total ? 0 : total - used));
+        return fail(ERROR_SPACE, "Not enough free space for the staged files");
+    }
+
+    LOG_INFO("🗂️ Patch de arquivos: %u entrada(s), %u bytes%s%s", _entries, (unsigned)dataBytes,
+             _revision[0] ? ", revisão " : "", _revision);
+
+    _bufferLength = 0;
+    _needed = 2;
+    _state = _entries > 0 ? STATE_ENTRY : STATE_DONE;
+    return true;
+}
+
+bool OTAFileSync::parseEntry()
+{
+    char op = (char)_buffer[0];
+    uint8_t pathLength = _buffer[1];
+
+    // Operação e tamanho do caminho: agora se sabe quanto falta do cabeçalho da entrada
+    if (_bufferLength == 2)
+    {
+        if ((op != 'F' && op != 'D') || pathLength == 0 || pathLength > OTA_FILESYNC_PATH_MAX)
+        {
+            return fail(ERROR_HEADER, "Invalid patch entry");
+        }
+        _needed = 2 + pathLength + (op == 'F' ? 36 : 0);
+        return true;
+    }
+
+    memcpy(_path, _buffer + 2, pathLength);
+    _path[pathLength] = '\0';
+    if (!validPath(_path))
+    {
+        LOG_ERROR("❌ Caminho inválido no patch: %s", _path);
+        return fail(ERROR_HEADER, "Invalid path in patch");
+    }
+
+    if (op == 'D')
+    {
+        if (!journalWrite("D %s\n", _path))
+        {
+            return false;
+        }
+        _deleted++;
+        nextEntry();
+        return true;
+    }
+
+    _fileSize = readLe32(_buffer + 2 + pathLength);
+    memcpy(_md5, _buffer + 6 + pathLength, 32);
+    _md5[32] = '\0';
+    for (int i = 0; i < 32; i++)
+    {
+        if (!isxdigit((unsigned char)_md5[i]))
+        {
+            return fail(ERROR_HEADER, "Invalid file MD5");
+        }
+    }
+
+    _file = LittleFS.open(stagedPath(_entry), "w");
+    if (!_file)
+    {
+        return fail(ERROR_WRITE, "Could not create a staged file");
+    }
+    _hash.begin();
+    _fileWritten = 0;
+    _state = STATE_DATA;
+
+    // Arquivo vazio: não há conteúdo a esperar
+    return _fileSize > 0 || finishFile();
+}
+
+bool OTAFileSync::finishFile()
+{
+    _file.close();
+
+    char md5[33];
+    _hash.calculate();
+    _hash.getChars(md5);
+    if (strcasecmp(md5, _md5) != 0)
+    {
+        LOG_ERROR("❌ MD5 de %s não confere: %s, esperado %s", _path, md5, _md5);
+        return fail(ERROR_VERIFY, "File MD5 mismatch");
+    }
+
+    if (!journalWrite("F %u %s\n", _entry, _path))
+    {
+        return false;
+    }
+    _written++;
+    _dataWritten += _fileSize;
+    LOG_DEBUG("📄 Arquivo preparado: %s (%u bytes)", _path, (unsigned)_fileSize);
+    nextEntry();
+    return true;
+}
+
+bool OTAFileSync::journalWrite(const char *format, ...)
+{
+    // Uma linha cortada no diário apagaria ou trocaria o arquivo errado na aplicação
+    char line[OTA_FILESYNC_PATH_MAX + OTA_FILESYNC_REVISION_MAX + 16];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+
+    if (length < 0 || (size_t)length >= sizeof(line) ||
+        _journal.write(reinterpret_cast<const uint8_t *>(line), length) != (size_t)length)
+    {
+        return fail(ERROR_WRITE, "Could not write the journal");
+    }
+    _journalSize += length;
+    return true;
+}
+
+bool OTAFileSync::closeJournal()
+{
+    // close() não informa erro: o tamanho relido confirma que o diário inteiro chegou à flash
+    _journal.close();
+
+    File journal = LittleFS.open(JOURNAL_TMP, "r");
+    bool complete = journal && journal.size() == _journalSize;
+    journal.close();
+
+    if (!complete)
+    {
+        return fail(ERROR_WRITE, "Could not write the journal");
+    }
+    return true;
+}
+
+void OTAFileSync::nextEntry()
+{
+    _entry++;
+    _bufferLength = 0;
+    _needed = 2;
+    _state = _entry < _entries ? STATE_ENTRY : STATE_DONE;
+}
+
+bool OTAFileSync::validPath(const char *path)
+{
+    size_t length = strlen(path);
+    if (length < 2 || path[0] != '/' || path[length - 1] == '/' || !printable(path) || reserved(path))
+    {
+        return false;
+    }
+
+    // Nada de componentes vazios, "." ou "..": o caminho não pode sair da raiz
+    for (const char *part = path; part != nullptr && *part; part = strchr(part + 1, '/'))
+    {
+        const char *next = part + 1;
+        if (*next == '/' || (next[0] == '.' && (next[1] == '/' || next[1] == '\0')) ||
+            (next[0] == '.' && next[1] == '.' && (next[2] == '/' || next[2] == '\0')))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool OTAFileSync::reserved(const char *path)
+{
+    size_t staging = strlen(STAGING_DIR);
+    return strcmp(path, VERSION_FILE) == 0 || strcmp(path, REVISION_FILE) == 0 ||
+           (strncmp(path, STAGING_DIR, staging) == 0 && (path[staging] == '\0' || path[staging] == '/'));
+}
+
+String OTAFileSync::stagedPath(uint16_t index)
+{
+    return String(STAGING_DIR) + "/" + String(index);
+}
+
+bool OTAFileSync::apply()
+{
+    File journal = LittleFS.open(JOURNAL, "r");
+    if (!journal)
+    {
+        return false;
+    }
+
+    // Cada operação pode ser repetida: um diário aplicado pela metade é retomado do início
+    bool ok = true;
+    while (journal.available())
+    {
+        String line = journal.readStringUntil('\n');
+        if (line.length() < 3 || line[1] != ' ')
+        {
+            continue;
+        }
+
+        if (line[0] == 'F')
+        {
+            int space = line.indexOf(' ', 2);
+            if (space < 0)
+            {
+                continue;
+            }
+            String staged = stagedPath((uint16_t)line.substring(2, space).toInt());
+            String path = line.substring(space + 1);
+            if (!LittleFS.exists(staged))
+            {
+                continue; // Já aplicado
+            }
+
+            makeParents(path.c_str());
+            if (!LittleFS.rename(staged, path))
+            {
+                LittleFS.remove(path);
+                if (!LittleFS.rename(staged, path))
+                {
+                    LOG_ERROR("❌ Falha ao substituir %s", path.c_str());
+                    ok = false;
+                }
+            }
+        }
+        else if (line[0] == 'D')
+        {
+            String path = line.substring(2);
+            if (LittleFS.exists(path))
+            {
+                LittleFS.remove(path);
+                pruneParents(path.c_str());
+            }
+        }
+        else if (line[0] == 'R')
+        {
+            File revision = LittleFS.open(REVISION_FILE, "w");
+            if (!revision)
+            {
+                ok = false;
+                continue;
+            }
+            revision.print(line.substring(2));
+            revision.close();
+        }
+    }
+    journal.close();
+
+    if (ok)
+    {
+        clearStaging();
+    }
+    return ok;
+}
+
+void OTAFileSync::clearStaging()
+{
+    // O diário sai primeiro: sem ele, o que sobrar é só preparação descartável
+    LittleFS.remove(JOURNAL);
+    LittleFS.remove(JOURNAL_TMP);
+
+    while (true)
+    {
+        File dir = LittleFS.open(STAGING_DIR);
+        if (!dir || !dir.isDirectory())
+        {
+            break;
+        }
+        File entry = dir.openNextFile();
+        if (!entry)
+        {
+            break;
+        }
+        String path = entry.path();
+        entry.close();
+        dir.close();
+        if (!LittleFS.remove(path))
+        {
+            break;
+        }
+    }
+    LittleFS.rmdir(STAGING_DIR);
+}
+
+void OTAFileSync::makeParents(const char *path)
+{
+    String parent = path;
+    for (int slash = parent.indexOf('/', 1); slash > 0; slash = parent.indexOf('/', slash + 1))
+    {
+        LittleFS.mkdir(parent.substring(0, slash));
+    }
+}
+
+void OTAFileSync::pruneParents(const char *path)
+{
+    // Diretórios que ficaram vazios saem junto (rmdir falha se ainda houver algo)
+    String parent = path;
+    for (int slash = parent.lastIndexOf('/'); slash > 0; slash = parent.lastIndexOf('/'))
+    {
+        parent = parent.substring(0, slash);
+        if (!LittleFS.rmdir(parent))
+        {
+            break;
+        }
+    }
+}
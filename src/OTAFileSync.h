@@ -0,0 +1,207 @@
+#pragma once
+
+/**
+ * @file OTAFileSync.h
+ * @brief Sincronização do LittleFS arquivo a arquivo (só o que mudou)
+ *
+ * Em vez de regravar a imagem inteira do LittleFS, o dispositivo informa o
+ * que tem (manifesto) e recebe apenas os arquivos novos ou alterados e a
+ * lista dos que devem ser apagados (patch). Nada é reiniciado.
+ *
+ * Manifesto (texto, uma linha por arquivo): "<md5 hex> <tamanho> <caminho>\n"
+ *
+ * Patch (inteiros little-endian):
+ *
+ *   "OTAS"  formato (1)  tamanho da revisão (1)  entradas (2)  bytes de dados (4)
+ *   revisão (texto, até OTA_FILESYNC_REVISION_MAX bytes)
+ *   por entrada: operação ('F' = grava, 'D' = apaga)  tamanho do caminho (1)  caminho
+ *                'F': tamanho (4)  MD5 em hex (32)  conteúdo
+ *
+ * Os arquivos recebidos vão para um diretório de preparação e são
+ * conferidos (tamanho e MD5) um a um. Só depois do último o diário com as
+ * operações é confirmado (rename) e aplicado: cada arquivo preparado
+ * substitui o atual por rename e os apagados são removidos. Se o ESP32
+ * reiniciar no meio, recover() conclui um diário confirmado ou descarta uma
+ * preparação incompleta, então após o boot o LittleFS está na versão
+ * anterior ou na nova por inteiro. A troca em si é arquivo a arquivo: quem
+ * lê o LittleFS fora do OTAFileSync durante a aplicação pode ver parte dos
+ * arquivos já novos.
+ *
+ * Os arquivos da biblioteca (versão, revisão e a preparação) ficam fora do
+ * manifesto e não podem ser alterados por um patch.
+ *
+ * O LittleFS é montado na primeira chamada e fica montado (a aplicação usa
+ * os mesmos arquivos); só unmount() o desmonta, durante a gravação da
+ * imagem inteira por um OTABundle. Cada chamada segura um mutex: o manifesto e a revisão
+ * lidos por outra task esperam a aplicação de um patch terminar. Quem não
+ * pode esperar indefinidamente (as tasks do servidor web) reserva o mutex
+ * antes com lock(), que desiste após um tempo.
+ *
+ * Exemplo:
+ * @code
+ * OTAFileSync::writeManifest(out); // enviado ao servidor
+ * OTAFileSync::begin(patchLength);
+ * while (...)
+ *     if (!OTAFileSync::write(buffer, n))
+ *         break;
+ * if (!OTAFileSync::end())
+ *     OTAFileSync::abort();
+ * @endcode
+ */
+
+#include "OTAConfig.h"
+#include "OTALog.h"
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <MD5Builder.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+class OTAFileSync
+{
+public:
+    enum Error
+    {
+        ERROR_OK = 0,
+        ERROR_MOUNT,      ///< LittleFS não montou
+        ERROR_HEADER,     ///< Patch malformado (cabeçalho, entrada, caminho)
+        ERROR_SPACE,      ///< Espaço livre insuficiente para a preparação
+        ERROR_WRITE,      ///< Falha ao gravar um arquivo preparado ou o diário
+        ERROR_VERIFY,     ///< Tamanho ou MD5 de um arquivo não confere
+        ERROR_INCOMPLETE, ///< O corpo terminou antes da última entrada
+        ERROR_APPLY       ///< Falha ao aplicar o diário (concluído no próximo recover())
+    };
+
+    /**
+     * @brief Gera o manifesto dos arquivos do LittleFS
+     * @return Quantidade de arquivos listados
+     */
+    static size_t writeManifest(Print &out);
+
+    /**
+     * @brief Começa a receber um patch
+     * @param size Tamanho total do corpo
+     */
+    static bool begin(size_t size);
+
+    /**
+     * @brief Prepara o próximo bloco do patch, na ordem do corpo
+     * @return false em erro: chame abort()
+     */
+    static bool write(const uint8_t *data, size_t length);
+
+    /**
+     * @brief Confirma e aplica o patch recebido
+     * @return true se todos os arquivos foram gravados e apagados
+     */
+    static bool end();
+
+    /**
+     * @brief Descarta a preparação; os arquivos atuais não mudam
+     */
+    static void abort();
+
+    /**
+     * @brief Conclui um patch confirmado ou descarta uma preparação
+     * interrompida por um reinício (chamado pelo OTAManager no boot)
+     */
+    static void recover();
+
+    /**
+     * @brief Revisão do último patch aplicado ("" se nenhum)
+     */
+    static String getRevision();
+
+    static bool isRunning() { return _running; }
+    static uint16_t filesWritten() { return _written; }
+    static uint16_t filesDeleted() { return _deleted; }
+    static size_t bytesWritten() { return _dataWritten; }
+    static Error getError() { return _error; }
+    static const char *errorString();
+
+    /**
+     * @brief Reserva o OTAFileSync para a task atual, esperando no máximo timeoutMs
+     *
+     * Enquanto reservado, as chamadas da mesma task não esperam e as das
+     * outras aguardam unlock().
+     * @return false se outra task não o liberou a tempo
+     */
+    static bool lock(uint32_t timeoutMs);
+
+    /**
+     * @brief Libera a reserva feita por lock(), na mesma task
+     */
+    static void unlock();
+
+    /**
+     * @brief Desmonta o LittleFS para regravar a partição inteira (parte LittleFS de um OTABundle)
+     *
+     * Segura o mutex até remount(), na mesma task: as outras tasks esperam e
+     * nesta as chamadas falham como se o LittleFS não montasse.
+     * @return false se outra task não liberou o LittleFS a tempo
+     */
+    static bool unmount(uint32_t timeoutMs);
+
+    /**
+     * @brief Monta de novo o LittleFS (com a imagem nova, se gravada) e libera o mutex
+     */
+    static void remount();
+
+private:
+    enum State
+    {
+        STATE_HEADER = 0, ///< Cabeçalho e revisão
+        STATE_ENTRY,      ///< Cabeçalho de uma entrada
+        STATE_DATA,       ///< Conteúdo de um arquivo
+        STATE_DONE        ///< Todas as entradas recebidas
+    };
+
+    static bool _running;
+    static State _state;
+    static size_t _size;
+    static size_t _received;
+    static uint8_t _buffer[2 + OTA_FILESYNC_PATH_MAX + 36]; ///< Cabeçalho em montagem
+    static size_t _bufferLength;
+    static size_t _needed;          ///< Bytes de _buffer que completam a parte atual
+    static uint16_t _entries;       ///< Entradas anunciadas
+    static uint16_t _entry;         ///< Entradas concluídas
+    static char _revision[OTA_FILESYNC_REVISION_MAX + 1];
+    static char _path[OTA_FILESYNC_PATH_MAX + 1];
+    static char _md5[33];
+    static uint32_t _fileSize;
+    static uint32_t _fileWritten;
+    static File _file;              ///< Arquivo preparado em gravação
+    static File _journal;           ///< Diário em montagem
+    static size_t _journalSize;     ///< Bytes gravados no diário
+    static MD5Builder _hash;        ///< MD5 do arquivo em gravação
+    static uint16_t _written;
+    static uint16_t _deleted;
+    static size_t _dataWritten;
+    static Error _error;
+    static char _message[64];
+    static SemaphoreHandle_t _mutex; ///< Serializa manifesto, revisão e patch entre tasks (recursivo)
+    static portMUX_TYPE _mutexLock;  ///< Protege a criação de _mutex
+    static bool _unmounted;          ///< Entre unmount() e remount()
+
+    static SemaphoreHandle_t mutex();
+    static bool mount();
+    static void discard();        ///< abort() sem o mutex
+    static void recoverStaging(); ///< recover() sem o mutex
+
+    static bool fail(Error error, const char *message);
+    static bool parseHeader();
+    static bool parseEntry();
+    static bool finishFile();
+    static bool journalWrite(const char *format, ...);
+    static bool closeJournal();
+    static void nextEntry();
+    static bool validPath(const char *path);
+    static bool reserved(const char *path);
+    static String stagedPath(uint16_t index);
+    static bool apply();
+    static void clearStaging();
+    static void makeParents(const char *path);
+    static void pruneParents(const char *path);
+    static size_t listDirectory(Print &out, File &dir);
+};
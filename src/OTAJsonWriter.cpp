@@ -0,0 +1,247 @@
+#include "OTAJsonWriter.h"
+
+#include <math.h>
+#include <stdarg.h>
+
+OTAJsonWriter::OTAJsonWriter(Print &out)
+    : _out(out), _length(0), _total(0), _hasItems(0), _depth(0)
+{
+}
+
+// ============ ESTRUTURA ============
+
+OTAJsonWriter &OTAJsonWriter::beginObject(const char *key)
+{
+    open(key, '{');
+    return *this;
+}
+
+OTAJsonWriter &OTAJsonWriter::endObject()
+{
+    close('}');
+    return *this;
+}
+
+OTAJsonWriter &OTAJsonWriter::beginArray(const char *key)
+{
+    open(key, '[');
+    return *this;
+}
+
+OTAJsonWriter &OTAJsonWriter::endArray()
+{
+    close(']');
+    return *this;
+}
+
+void OTAJsonWriter::open(const char *key, char bracket)
+{
+    separator(key);
+    write(bracket);
+
+    if (_depth < 31)
+    {
+        _depth++;
+        _hasItems &= ~(1UL << _depth);
+    }
+}
+
+void OTAJsonWriter::close(char bracket)
+{
+    if (_depth > 0)
+    {
+        _depth--;
+    }
+    write(bracket);
+}
+
+void OTAJsonWriter::separator(const char *key)
+{
+    if (_hasItems & (1UL << _depth))
+    {
+        write(',');
+    }
+    _hasItems |= (1UL << _depth);
+
+    if (key != nullptr)
+    {
+        writeString(key);
+        write(':');
+    }
+}
+
+// ============ VALORES ============
+
+OTAJsonWriter &OTAJsonWriter::add(const char *key, const char *value)
+{
+    if (value == nullptr)
+    {
+        return addNull(key);
+    }
+
+    separator(key);
+    writeString(value);
+    return *this;
+}
+
+OTAJsonWriter &OTAJsonWriter::add(const char *key, const String &value)
+{
+    return add(key, value.c_str());
+}
+
+OTAJsonWriter &OTAJsonWriter::add(const char *key, bool value)
+{
+    separator(key);
+    write(value ? "true" : "false", value ? 4 : 5);
+    return *this;
+}
+
+OTAJsonWriter &OTAJsonWriter::add(const char *key, int value)
+{
+    return add(key, (long long)value);
+}
+
+OTAJsonWriter &OTAJsonWriter::add(const char *key, unsigned int value)
+{
+    return add(key, (unsigned long long)value);
+}
+
+OTAJsonWriter &OTAJsonWriter::add(const char *key, long value)
+{
+    return add(key, (long long)value);
+}
+
+OTAJsonWriter &OTAJsonWriter::add(const char *key, unsigned long value)
+{
+    return add(key, (unsigned long long)value);
+}
+
+OTAJsonWriter &OTAJsonWriter::add(const char *key, long long value)
+{
+    separator(key);
+    writeNumber("%lld", value);
+    return *this;
+}
+
+OTAJsonWriter &OTAJsonWriter::add(const char *key, unsigned long long value)
+{
+    separator(key);
+    writeNumber("%llu", value);
+    return *this;
+}
+
+OTAJsonWriter &OTAJsonWriter::add(const char *key, double value, uint8_t decimals)
+{
+    // JSON não representa NaN/Infinito
+    if (isnan(value) || isinf(value))
+    {
+        return addNull(key);
+    }
+
+    separator(key);
+    writeNumber("%.*f", (int)decimals, value);
+    return *this;
+}
+
+OTAJsonWriter &OTAJsonWriter::addNull(const char *key)
+{
+    separator(key);
+    write("null", 4);
+    return *this;
+}
+
+// ============ SAÍDA ============
+
+void OTAJsonWriter::writeString(const char *text)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    write('"');
+    for (const char *p = text; *p; p++)
+    {
+        char c = *p;
+        switch (c)
+        {
+        case '"':
+            write("\\\"", 2);
+            break;
+        case '\\':
+            write("\\\\", 2);
+            break;
+        case '\n':
+            write("\\n", 2);
+            break;
+        case '\r':
+            write("\\r", 2);
+            break;
+        case '\t':
+            write("\\t", 2);
+            break;
+        default:
+            if ((uint8_t)c < 0x20)
+            {
+                char escaped[6] = {'\\', 'u', '0', '0', hex[(c >> 4) & 0x0F], hex[c & 0x0F]};
+                write(escaped, sizeof(escaped));
+            }
+            else
+            {
+                write(c); // UTF-8 passa sem alteração
+            }
+            break;
+        }
+    }
+    write('"');
+}
+
+void OTAJsonWriter::writeNumber(const char *format, ...)
+{
+    char number[32];
+
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(number, sizeof(number), format, args);
+    va_end(args);
+
+    if (length > 0)
+    {
+        write(number, min((size_t)length, sizeof(number) - 1));
+    }
+}
+
+void OTAJsonWriter::write(char c)
+{
+    if (_length >= sizeof(_buffer))
+    {
+        flush();
+    }
+
+    _buffer[_length++] = c;
+    _total++;
+}
+
+void OTAJsonWriter::write(const char *text, size_t length)
+{
+    while (length > 0)
+    {
+        if (_length >= sizeof(_buffer))
+        {
+            flush();
+        }
+
+        size_t copied = min(length, sizeof(_buffer) - _length);
+        memcpy(_buffer + _length, text, copied);
+        _length += copied;
+        _total += copied;
+        text += copied;
+        length -= copied;
+    }
+}
+
+void OTAJsonWriter::flush()
+{
+    if (_length > 0)
+    {
+        _out.write(reinterpret_cast<const uint8_t *>(_buffer), _length);
+        _length = 0;
+    }
+}
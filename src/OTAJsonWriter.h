@@ -0,0 +1,111 @@
+#pragma once
+
+/**
+ * @file OTAJsonWriter.h
+ * @brief Serializador JSON em streaming com buffer fixo
+ *
+ * Os valores são escritos em um buffer de OTA_JSON_BUFFER bytes, repassado
+ * ao Print de destino sempre que enche. O documento nunca é montado por
+ * inteiro na memória e nenhuma alocação é feita durante a serialização.
+ *
+ * Exemplo:
+ * @code
+ * OTAJsonWriter json(out);
+ * json.beginObject();
+ * json.add("version", "1.2.3");
+ * json.beginObject("memory").add("heapFree", ESP.getFreeHeap()).endObject();
+ * json.endObject();
+ * json.flush();
+ * @endcode
+ */
+
+#include "OTAConfig.h"
+
+#include <Arduino.h>
+
+class OTAJsonWriter
+{
+public:
+    /**
+     * @param out Destino dos dados (resposta HTTP, Serial, etc.)
+     */
+    explicit OTAJsonWriter(Print &out);
+
+    // ============ ESTRUTURA ============
+    // key = nullptr para elementos de array e para o objeto raiz
+
+    OTAJsonWriter &beginObject(const char *key = nullptr);
+    OTAJsonWriter &endObject();
+    OTAJsonWriter &beginArray(const char *key = nullptr);
+    OTAJsonWriter &endArray();
+
+    // ============ VALORES ============
+
+    OTAJsonWriter &add(const char *key, const char *value); ///< nullptr = null
+    OTAJsonWriter &add(const char *key, const String &value);
+    OTAJsonWriter &add(const char *key, bool value);
+    OTAJsonWriter &add(const char *key, int value);
+    OTAJsonWriter &add(const char *key, unsigned int value);
+    OTAJsonWriter &add(const char *key, long value);
+    OTAJsonWriter &add(const char *key, unsigned long value);
+    OTAJsonWriter &add(const char *key, long long value);
+    OTAJsonWriter &add(const char *key, unsigned long long value);
+    OTAJsonWriter &add(const char *key, double value, uint8_t decimals = 2);
+    OTAJsonWriter &addNull(const char *key);
+
+    /**
+     * @brief Envia ao destino o que estiver no buffer
+     */
+    void flush();
+
+    /**
+     * @brief Total de bytes produzidos até agora
+     */
+    size_t size() const { return _total; }
+
+private:
+    Print &_out;
+    char _buffer[OTA_JSON_BUFFER];
+    size_t _length;
+    size_t _total;
+    uint32_t _hasItems; ///< Bit n = nível n já tem elementos (vírgula antes do próximo)
+    uint8_t _depth;
+
+    void separator(const char *key);
+    void open(const char *key, char bracket);
+    void close(char bracket);
+    void writeString(const char *text);
+    void writeNumber(const char *format, ...) __attribute__((format(printf, 2, 3)));
+    void write(char c);
+    void write(const char *text, size_t length);
+};
+
+/**
+ * @brief Print sobre um buffer fixo terminado em '\0' (o excesso é descartado)
+ *
+ * Usado para montar mensagens curtas (eventos, respostas do WebSocket) sem
+ * alocação.
+ */
+class OTABufferPrint : public Print
+{
+public:
+    OTABufferPrint(char *buffer, size_t size) : _buffer(buffer), _size(size), _length(0) { _buffer[0] = '\0'; }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+
+    size_t write(const uint8_t *data, size_t length) override
+    {
+        size_t copied = min(length, _size - 1 - _length);
+        memcpy(_buffer + _length, data, copied);
+        _length += copied;
+        _buffer[_length] = '\0';
+        return copied;
+    }
+
+    size_t length() const { return _length; }
+
+private:
+    char *_buffer;
+    size_t _size;
+    size_t _length;
+};
@@ -0,0 +1,429 @@
+#include "OTALog.h"
+
+#if OTA_LOG_DEFERRED
+
+#include "OTAClock.h"
+#include "OTATasks.h"
+
+#include <freertos/ringbuf.h>
+#include <memory>
+
+// ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
+
+void *OTALog::_ring = nullptr;
+uint32_t OTALog::_dropped = 0;
+char OTALog::_tail[OTA_LOG_TAIL] = {};
+size_t OTALog::_tailLength = 0;
+
+namespace
+{
+    portMUX_TYPE siteLock = portMUX_INITIALIZER_UNLOCKED;
+    portMUX_TYPE tailLock = portMUX_INITIALIZER_UNLOCKED;
+
+    /**
+     * Lê os argumentos na ordem em que o Encoder os gravou
+     */
+    class Reader
+    {
+    public:
+        Reader(const uint8_t *data, size_t length) : _data(data), _length(length), _offset(0) {}
+
+        bool word(int64_t &value) { return bytes(&value, sizeof(value)); }
+        bool number(double &value) { return bytes(&value, sizeof(value)); }
+
+        bool text(const char *&value, size_t &length)
+        {
+            if (_offset >= _length)
+            {
+                return false;
+            }
+            length = _data[_offset++];
+            if (_offset + length > _length)
+            {
+                return false;
+            }
+            value = reinterpret_cast<const char *>(_data + _offset);
+            _offset += length;
+            return true;
+        }
+
+    private:
+        bool bytes(void *value, size_t size)
+        {
+            if (_offset + size > _length)
+            {
+                return false;
+            }
+            memcpy(value, _data + _offset, size);
+            _offset += size;
+            return true;
+        }
+
+        const uint8_t *_data;
+        size_t _length;
+        size_t _offset;
+    };
+
+    /**
+     * Formata um registro percorrendo as conversões do formato; cada
+     * conversão é repassada ao snprintf com o argumento no tipo certo
+     */
+    size_t formatRecord(const char *format, Reader &reader, char *out, size_t size)
+    {
+        size_t length = 0;
+        const char *p = format;
+
+        while (*p != '\0' && length < size - 1)
+        {
+            if (*p != '%')
+            {
+                out[length++] = *p++;
+                continue;
+            }
+            if (p[1] == '%')
+            {
+                out[length++] = '%';
+                p += 2;
+                continue;
+            }
+
+            // %[flags][largura][.precisão][tamanho]conversão
+            const char *start = p++;
+            while (*p != '\0' && strchr("-+ #0123456789.", *p) != nullptr)
+            {
+                p++;
+            }
+            const char *modifier = p;
+            while (*p != '\0' && strchr("hlLqjzt", *p) != nullptr)
+            {
+                p++;
+            }
+            char conversion = *p;
+            if (conversion == '\0')
+            {
+                break;
+            }
+            p++;
+
+            char spec[24];
+            size_t flags = min((size_t)(modifier - start), sizeof(spec) - 4);
+            memcpy(spec, start, flags);
+            size_t modifierLength = p - 1 - modifier;
+
+            int written = 0;
+            char *target = out + length;
+            size_t available = size - length;
+
+            if (conversion == 's')
+            {
+                const char *text;
+                size_t textLength;
+                if (!reader.text(text, textLength))
+                {
+                    written = snprintf(target, available, "?");
+                }
+                else
+                {
+                    // A string gravada não tem terminador
+                    char copy[256];
+                    memcpy(copy, text, textLength);
+                    copy[textLength] = '\0';
+                    spec[flags] = 's';
+                    spec[flags + 1] = '\0';
+                    written = snprintf(target, available, spec, copy);
+                }
+            }
+            else if (strchr("fFeEgGaA", conversion) != nullptr)
+            {
+                double value;
+                spec[flags] = conversion;
+                spec[flags + 1] = '\0';
+                written = reader.number(value) ? snprintf(target, available, spec, value)
+                                               : snprintf(target, available, "?");
+            }
+            else if (strchr("diuxXoc", conversion) != nullptr)
+            {
+                int64_t value;
+                if (!reader.word(value))
+                {
+                    written = snprintf(target, available, "?");
+                }
+                else
+                {
+                    // Sem "ll" (ou long/size_t de 64 bits) o argumento original tinha 32 bits
+                    bool wide = (modifierLength >= 2 && modifier[0] == 'l' && modifier[1] == 'l') ||
+                                (modifierLength == 1 && strchr("jq", modifier[0]) != nullptr) ||
+                                (modifierLength == 1 && modifier[0] == 'l' && sizeof(long) == 8) ||
+                                (modifierLength == 1 && strchr("zt", modifier[0]) != nullptr && sizeof(size_t) == 8);
+                    if (!wide)
+                    {
+                        value = (conversion == 'd' || conversion == 'i') ? (int64_t)(int32_t)value
+                                                                         : (int64_t)(uint32_t)value;
+                    }
+
+                    if (conversion == 'c')
+                    {
+                        spec[flags] = 'c';
+                        spec[flags + 1] = '\0';
+                        written = snprintf(target, available, spec, (int)value);
+                    }
+                    else
+                    {
+                        spec[flags] = 'l';
+                        spec[flags + 1] = 'l';
+                        spec[flags + 2] = conversion;
+                        spec[flags + 3] = '\0';
+                        written = snprintf(target, available, spec, (long long)value);
+                    }
+                }
+            }
+            else if (conversion == 'p')
+            {
+                int64_t value;
+                written = reader.word(value) ? snprintf(target, available, "%p", (void *)(uintptr_t)value)
+                                             : snprintf(target, available, "?");
+            }
+            else
+            {
+                // Conversão desconhecida: copia como está
+                written = snprintf(target, available, "%.*s", (int)(p - start), start);
+            }
+
+            if (written > 0)
+            {
+                length = min(length + written, size - 1);
+            }
+        }
+
+        out[length] = '\0';
+        return length;
+    }
+
+    char levelLetter(uint8_t level)
+    {
+        switch (level)
+        {
+        case OTA_LOG_LEVEL_ERROR:
+            return 'E';
+        case OTA_LOG_LEVEL_WARN:
+            return 'W';
+        case OTA_LOG_LEVEL_INFO:
+            return 'I';
+        default:
+            return 'D';
+        }
+    }
+}
+
+// ============ CODIFICAÇÃO ============
+
+void OTALog::Encoder::add(const char *text)
+{
+    if (text == nullptr)
+    {
+        text = "(null)";
+    }
+
+    // [tamanho][bytes], truncado ao espaço restante
+    if (_length >= _size)
+    {
+        return;
+    }
+    size_t length = min(strlen(text), min((size_t)255, _size - _length - 1));
+    _data[_length++] = (uint8_t)length;
+    memcpy(_data + _length, text, length);
+    _length += length;
+}
+
+void OTALog::Encoder::addBytes(const void *data, size_t length)
+{
+    // Sem espaço o argumento é omitido e aparece como "?"
+    if (_length + length > _size)
+    {
+        _length = _size;
+        return;
+    }
+    memcpy(_data + _length, data, length);
+    _length += length;
+}
+
+// ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
+
+void OTALog::begin()
+{
+    if (_ring != nullptr)
+    {
+        return;
+    }
+
+    RingbufHandle_t ring = xRingbufferCreate(OTA_LOG_BUFFER, RINGBUF_TYPE_NOSPLIT);
+    if (ring == nullptr)
+    {
+        Serial.println("[E] ❌ OTALog: falha ao criar o ring buffer, logs seguem síncronos");
+        return;
+    }
+
+    if (OTATasks::create(drainTask, "OTALogTask", OTA_LOG_TASK_STACK, ring, OTA_LOG_TASK_PRIORITY, nullptr,
+                         OTA_WEB_TASK_CORE) != pdPASS)
+    {
+        vRingbufferDelete(ring);
+        Serial.println("[E] ❌ OTALog: falha ao criar a task, logs seguem síncronos");
+        return;
+    }
+
+    __atomic_store_n(&_ring, (void *)ring, __ATOMIC_RELEASE);
+}
+
+bool OTALog::admit(Site &site, uint16_t &suppressed)
+{
+    uint32_t now = OTAClock::millis();
+    bool allowed;
+
+    portENTER_CRITICAL(&siteLock);
+    uint32_t refill = (now - site.lastMs) / OTA_LOG_SITE_INTERVAL_MS;
+    if (refill > 0)
+    {
+        site.tokens = min((uint32_t)OTA_LOG_SITE_BURST, site.tokens + refill);
+        site.lastMs = now;
+    }
+
+    allowed = site.tokens > 0;
+    if (allowed)
+    {
+        site.tokens--;
+        suppressed = site.suppressed;
+        site.suppressed = 0;
+    }
+    else if (site.suppressed < UINT16_MAX)
+    {
+        site.suppressed++;
+    }
+    portEXIT_CRITICAL(&siteLock);
+
+    return allowed;
+}
+
+void OTALog::push(const Site &site, uint16_t suppressed, uint8_t *record, size_t length)
+{
+    Header header = {};
+    header.ms = OTAClock::millis();
+    header.format = site.format;
+    header.level = site.level;
+    header.suppressed = suppressed;
+    memcpy(record, &header, sizeof(header));
+
+    RingbufHandle_t ring = (RingbufHandle_t)__atomic_load_n(&_ring, __ATOMIC_ACQUIRE);
+    if (ring == nullptr)
+    {
+        // Antes do begin(): formata na hora
+        emit(record, length);
+        return;
+    }
+
+    // Nunca bloqueia o chamador: sem espaço, o registro é perdido
+    if (xRingbufferSend(ring, record, length, 0) != pdTRUE)
+    {
+        __atomic_fetch_add(&_dropped, 1, __ATOMIC_RELAXED);
+    }
+}
+
+void OTALog::emit(const uint8_t *record, size_t length)
+{
+    Header header;
+    memcpy(&header, record, sizeof(header));
+    Reader reader(record + sizeof(header), length - sizeof(header));
+
+    char line[256];
+    int prefix = snprintf(line, sizeof(line), "%lu [%c] ", (unsigned long)header.ms, levelLetter(header.level));
+    size_t used = prefix + formatRecord(header.format, reader, line + prefix, sizeof(line) - prefix);
+
+    if (header.suppressed > 0 && used < sizeof(line) - 1)
+    {
+        used += snprintf(line + used, sizeof(line) - used, " (+%u suppressed)", header.suppressed);
+        used = min(used, sizeof(line) - 1);
+    }
+
+    // A serial recebe a linha sem o tempo; o tail mantém o tempo do registro
+    Serial.printf("%s\n", strchr(line, '['));
+
+    line[used] = '\n';
+    appendTail(line, used + 1);
+}
+
+void OTALog::appendTail(const char *line, size_t length)
+{
+    portENTER_CRITICAL(&tailLock);
+    for (size_t i = 0; i < length; i++)
+    {
+        _tail[(_tailLength + i) % OTA_LOG_TAIL] = line[i];
+    }
+    _tailLength += length;
+    portEXIT_CRITICAL(&tailLock);
+}
+
+void OTALog::writeTail(Print &out)
+{
+    std::unique_ptr<char[]> copy(new (std::nothrow) char[OTA_LOG_TAIL]);
+    if (!copy)
+    {
+        return;
+    }
+
+    // Cópia sob o lock; a escrita na rede acontece depois
+    portENTER_CRITICAL(&tailLock);
+    size_t total = _tailLength;
+    size_t length = min(total, (size_t)OTA_LOG_TAIL);
+    size_t first = total - length;
+    for (size_t i = 0; i < length; i++)
+    {
+        copy[i] = _tail[(first + i) % OTA_LOG_TAIL];
+    }
+    portEXIT_CRITICAL(&tailLock);
+
+    // Se o início foi sobrescrito, começa na primeira linha completa
+    size_t offset = 0;
+    if (first > 0)
+    {
+        while (offset < length && copy[offset] != '\n')
+        {
+            offset++;
+        }
+        offset = min(offset + 1, length);
+    }
+
+    out.write(reinterpret_cast<const uint8_t *>(copy.get() + offset), length - offset);
+
+    uint32_t lost = dropped();
+    if (lost > 0)
+    {
+        out.printf("(%u records dropped: log buffer full)\n", lost);
+    }
+}
+
+uint32_t OTALog::dropped()
+{
+    return __atomic_load_n(&_dropped, __ATOMIC_RELAXED);
+}
+
+void OTALog::drainTask(void *parameter)
+{
+    RingbufHandle_t ring = (RingbufHandle_t)parameter;
+
+    for (;;)
+    {
+        size_t length = 0;
+        uint8_t *record = (uint8_t *)xRingbufferReceive(ring, &length, portMAX_DELAY);
+        if (record == nullptr)
+        {
+            continue;
+        }
+
+        if (length >= sizeof(Header))
+        {
+            emit(record, length);
+        }
+        vRingbufferReturnItem(ring, record);
+    }
+}
+
+#endif
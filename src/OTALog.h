@@ -0,0 +1,187 @@
+#pragma once
+
+/**
+ * @file OTALog.h
+ * @brief Logs da biblioteca: LogLibrary direto ou registros binários adiados
+ *
+ * Os arquivos da biblioteca incluem este header no lugar do LogLibrary.h.
+ * As macros LOG_ERROR/WARN/INFO/DEBUG continuam as mesmas, com duas
+ * opções de compilação:
+ *
+ * - OTA_LOG_LEVEL remove do código os níveis acima dele (nos dois modos)
+ * - OTA_LOG_DEFERRED=1 troca a escrita síncrona na serial por um registro
+ *   binário (ponteiro do formato + argumentos) num ring buffer; uma task de
+ *   baixa prioridade formata, imprime e guarda as linhas num tail em
+ *   memória (GET /api/log). Cada ponto de log tem um limite de taxa
+ *   (OTA_LOG_SITE_BURST registros, depois um por OTA_LOG_SITE_INTERVAL_MS);
+ *   os descartados são informados na próxima linha do mesmo ponto.
+ *
+ * No modo adiado strings (%s) são copiadas para o registro (truncadas em
+ * OTA_LOG_RECORD_MAX bytes no total); os demais argumentos ocupam 8 bytes.
+ */
+
+#include "LogLibrary.h"
+#include "OTAConfig.h"
+
+#define OTA_LOG_LEVEL_NONE 0
+#define OTA_LOG_LEVEL_ERROR 1
+#define OTA_LOG_LEVEL_WARN 2
+#define OTA_LOG_LEVEL_INFO 3
+#define OTA_LOG_LEVEL_DEBUG 4
+
+#if OTA_LOG_DEFERRED
+
+#include <Arduino.h>
+#include <type_traits>
+
+class OTALog
+{
+public:
+    /**
+     * @brief Estado de um ponto de log (um por chamada, estático)
+     */
+    struct Site
+    {
+        const char *format;
+        uint8_t level;
+        uint8_t tokens;      ///< Registros ainda permitidos na rajada
+        uint16_t suppressed; ///< Descartados desde o último registro
+        uint32_t lastMs;     ///< Última reposição de tokens
+    };
+
+    /**
+     * @brief Cria o ring buffer e a task que o esvazia
+     * Antes disso os registros são impressos na hora
+     */
+    static void begin();
+
+    /**
+     * @brief Enfileira um registro (use as macros LOG_*)
+     */
+    template <typename... Args>
+    static void write(Site &site, const Args &...args)
+    {
+        uint16_t suppressed;
+        if (!admit(site, suppressed))
+        {
+            return;
+        }
+
+        uint8_t record[sizeof(Header) + OTA_LOG_RECORD_MAX];
+        Encoder encoder(record + sizeof(Header), OTA_LOG_RECORD_MAX);
+        int expand[] = {0, (encoder.add(args), 0)...};
+        (void)expand;
+
+        push(site, suppressed, record, sizeof(Header) + encoder.length());
+    }
+
+    /**
+     * @brief Escreve as últimas linhas formatadas (até OTA_LOG_TAIL bytes)
+     */
+    static void writeTail(Print &out);
+
+    /**
+     * @brief Registros perdidos por falta de espaço no ring buffer
+     */
+    static uint32_t dropped();
+
+private:
+    struct Header
+    {
+        uint32_t ms;
+        const char *format;
+        uint8_t level;
+        uint8_t reserved;
+        uint16_t suppressed;
+    };
+
+    /**
+     * @brief Serializa os argumentos: inteiros e ponteiros em int64, números
+     * em double e strings como [tamanho][bytes]
+     */
+    class Encoder
+    {
+    public:
+        Encoder(uint8_t *data, size_t size) : _data(data), _size(size), _length(0) {}
+
+        void add(const char *text);
+        void add(char *text) { add(static_cast<const char *>(text)); }
+        void add(const String &text) { add(text.c_str()); }
+        void add(double value) { addBytes(&value, sizeof(value)); }
+        void add(float value) { add(static_cast<double>(value)); }
+
+        template <typename T>
+        typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type add(T value)
+        {
+            int64_t word = static_cast<int64_t>(value);
+            addBytes(&word, sizeof(word));
+        }
+
+        template <typename T>
+        void add(T *pointer)
+        {
+            int64_t word = static_cast<int64_t>(reinterpret_cast<uintptr_t>(pointer));
+            addBytes(&word, sizeof(word));
+        }
+
+        size_t length() const { return _length; }
+
+    private:
+        void addBytes(const void *data, size_t length);
+
+        uint8_t *_data;
+        size_t _size;
+        size_t _length;
+    };
+
+    static bool admit(Site &site, uint16_t &suppressed);
+    static void push(const Site &site, uint16_t suppressed, uint8_t *record, size_t length);
+    static void emit(const uint8_t *record, size_t length);
+    static void appendTail(const char *line, size_t length);
+    static void drainTask(void *parameter);
+
+    static void *_ring; ///< RingbufHandle_t
+    static uint32_t _dropped;
+    static char _tail[OTA_LOG_TAIL];
+    static size_t _tailLength; ///< Bytes já escritos (a posição é _tailLength % OTA_LOG_TAIL)
+};
+
+#define OTA_LOG_WRITE(level, format, ...)                                                        \
+    do                                                                                           \
+    {                                                                                            \
+        static OTALog::Site _otaLogSite = {format, level, OTA_LOG_SITE_BURST, 0, 0};            \
+        OTALog::write(_otaLogSite, ##__VA_ARGS__);                                               \
+    } while (0)
+
+#undef LOG_ERROR
+#undef LOG_WARN
+#undef LOG_INFO
+#undef LOG_DEBUG
+#define LOG_ERROR(format, ...) OTA_LOG_WRITE(OTA_LOG_LEVEL_ERROR, format, ##__VA_ARGS__)
+#define LOG_WARN(format, ...) OTA_LOG_WRITE(OTA_LOG_LEVEL_WARN, format, ##__VA_ARGS__)
+#define LOG_INFO(format, ...) OTA_LOG_WRITE(OTA_LOG_LEVEL_INFO, format, ##__VA_ARGS__)
+#define LOG_DEBUG(format, ...) OTA_LOG_WRITE(OTA_LOG_LEVEL_DEBUG, format, ##__VA_ARGS__)
+
+#endif
+
+// ============ FILTRO EM TEMPO DE COMPILAÇÃO ============
+
+#if OTA_LOG_LEVEL < OTA_LOG_LEVEL_DEBUG
+#undef LOG_DEBUG
+#define LOG_DEBUG(format, ...) ((void)0)
+#endif
+
+#if OTA_LOG_LEVEL < OTA_LOG_LEVEL_INFO
+#undef LOG_INFO
+#define LOG_INFO(format, ...) ((void)0)
+#endif
+
+#if OTA_LOG_LEVEL < OTA_LOG_LEVEL_WARN
+#undef LOG_WARN
+#define LOG_WARN(format, ...) ((void)0)
+#endif
+
+#if OTA_LOG_LEVEL < OTA_LOG_LEVEL_ERROR
+#undef LOG_ERROR
+#define LOG_ERROR(format, ...) ((void)0)
+#endif
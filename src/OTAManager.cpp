@@ -1,17 +1,16 @@
 #include "OTAManager.h"
+#include "OTAFileSync.h"
+#include "OTAStatus.h"
 
 // Inicialização de variáveis estáticas
-OTAManager::UpdateMode OTAManager::_currentMode = OTAManager::HYBRID;
+// (modo, versões e disponibilidade ficam no OTAStatus, lido por várias tasks)
 String OTAManager::_serverUrl = "";
-bool OTAManager::_updateAvailable = false;
-String OTAManager::_latestVersion = "";
-String OTAManager::_currentVersion = FIRMWARE_VERSION;
 
 void OTAManager::begin(const String &serverUrl, uint16_t webPort, UpdateMode mode)
 {
     init();
     _serverUrl = serverUrl;
-    _currentMode = mode;
+    OTAStatus::setMode(mode);
 
     // Sempre inicia o sistema Push (web)
     OTAPushUpdateManager::begin(webPort);
@@ -50,7 +49,7 @@ void OTAManager::end()
 
 void OTAManager::setUpdateMode(UpdateMode mode)
 {
-    _currentMode = mode;
+    OTAStatus::setMode(mode);
 
     if (mode == AUTOMATIC && !_serverUrl.isEmpty())
     {
@@ -69,7 +68,7 @@ void OTAManager::setUpdateMode(UpdateMode mode)
 void OTAManager::setServerUrl(const String &serverUrl)
 {
     _serverUrl = serverUrl;
-    if (!serverUrl.isEmpty() && _currentMode != MANUAL)
+    if (!serverUrl.isEmpty() && getCurrentMode() != MANUAL)
     {
         OTAPullUpdateManager::init(serverUrl);
     }
@@ -87,7 +86,7 @@ void OTAManager::setMDNS(const String &hostname)
 
 void OTAManager::setPullInterval(uint16_t minutes)
 {
-    if (_currentMode != MANUAL)
+    if (getCurrentMode() != MANUAL)
     {
         OTAPullUpdateManager::stopUpdateThread();
         OTAPullUpdateManager::startUpdateThread(minutes);
@@ -101,31 +100,33 @@ void OTAManager::handleClient()
 
 void OTAManager::checkForUpdates()
 {
-    if (_serverUrl.isEmpty() || _currentMode == MANUAL)
+    if (_serverUrl.isEmpty() || getCurrentMode() == MANUAL)
     {
         return;
     }
 
-    _latestVersion = OTAPullUpdateManager::getLatestVersion();
+    // Consulta o servidor fora do snapshot; só o resultado é publicado
+    String latestVersion = OTAPullUpdateManager::getLatestVersion();
     String currentVersion = OTAPullUpdateManager::getCurrentVersion();
 
     // Verifica se a versão do servidor é válida
-    if (_latestVersion == "unknown" || _latestVersion.isEmpty())
+    if (latestVersion == "unknown" || latestVersion.isEmpty())
     {
-        _updateAvailable = false;
-        LOG_WARN("⚠️  Versão do servidor inválida: %s", _latestVersion.c_str());
+        OTAStatus::setLatestVersion(latestVersion.c_str(), false);
+        LOG_WARN("⚠️  Versão do servidor inválida: %s", latestVersion.c_str());
         return;
     }
 
     // Usa comparação semântica em vez de simples string comparison
-    VersionComparison comparison = compareVersions(_latestVersion, currentVersion);
+    VersionComparison comparison = compareVersions(latestVersion, currentVersion);
 
-    _updateAvailable = (comparison == VERSION_NEWER);
+    bool updateAvailable = (comparison == VERSION_NEWER);
+    OTAStatus::setLatestVersion(latestVersion.c_str(), updateAvailable);
 
-    if (_updateAvailable)
+    if (updateAvailable)
     {
         LOG_INFO("🎯 ATUALIZAÇÃO DISPONÍVEL! Servidor: v%s (Atual: v%s) ↗",
-                 _latestVersion.c_str(), currentVersion.c_str());
+                 latestVersion.c_str(), currentVersion.c_str());
     }
     else
     {
@@ -133,11 +134,11 @@ void OTAManager::checkForUpdates()
         {
         case VERSION_EQUAL:
             LOG_DEBUG("📋 Versões iguais: v%s ≡ v%s",
-                      currentVersion.c_str(), _latestVersion.c_str());
+                      currentVersion.c_str(), latestVersion.c_str());
             break;
         case VERSION_OLDER:
             LOG_WARN("⚠️  Versão do servidor é MAIS ANTIGA: v%s ↘ v%s",
-                     _latestVersion.c_str(), currentVersion.c_str());
+                     latestVersion.c_str(), currentVersion.c_str());
             break;
         case VERSION_NEWER:
             // Já tratado acima, mas mantido para completude
@@ -148,12 +149,13 @@ void OTAManager::checkForUpdates()
 
 bool OTAManager::isUpdateAvailable()
 {
-    return _updateAvailable;
+    return OTAStatus::get().updateAvailable;
 }
 
 void OTAManager::performUpdate()
 {
-    if (_updateAvailable && _currentMode != MANUAL)
+    OTAStatusSnapshot status = OTAStatus::get();
+    if (status.updateAvailable && status.mode != MANUAL)
     {
         LOG_INFO("🚀 Iniciando atualização pull...");
         OTAPullUpdateManager::checkForUpdates();
@@ -219,42 +221,45 @@ OTAManager::VersionComparison OTAManager::compareVersions(const String &v1, cons
 
 OTAManager::UpdateMode OTAManager::getCurrentMode()
 {
-    return _currentMode;
+    return static_cast<UpdateMode>(OTAStatus::get().mode);
 }
 
 String OTAManager::getLatestVersion()
 {
-    return _latestVersion;
+    return OTAStatus::get().latestVersion;
 }
 
 String OTAManager::getUpdateStatus()
 {
-    String currentVersion = OTAPullUpdateManager::getCurrentVersion();
+    // Um único snapshot: o texto nunca mistura estados de momentos diferentes
+    OTAStatusSnapshot snapshot = OTAStatus::get();
+    String currentVersion = snapshot.currentVersion;
+    String latestVersion = snapshot.latestVersion;
 
     String status = "OTA - Modo: ";
-    status += (_currentMode == MANUAL ? "Manual" : _currentMode == AUTOMATIC ? "Automático"
-                                                                             : "Híbrido");
+    status += (snapshot.mode == MANUAL ? "Manual" : snapshot.mode == AUTOMATIC ? "Automático"
+                                                                               : "Híbrido");
     status += " | Versão: v" + currentVersion;
 
     if (!_serverUrl.isEmpty())
     {
         status += " | Servidor: " + _serverUrl;
 
-        if (_updateAvailable && !_latestVersion.isEmpty())
+        if (snapshot.updateAvailable && !latestVersion.isEmpty())
         {
-            VersionComparison comp = compareVersions(_latestVersion, currentVersion);
+            VersionComparison comp = compareVersions(latestVersion, currentVersion);
             String statusText;
 
             switch (comp)
             {
             case VERSION_NEWER:
-                statusText = "ATUALIZAR ↗ v" + _latestVersion;
+                statusText = "ATUALIZAR ↗ v" + latestVersion;
                 break;
             case VERSION_OLDER:
-                statusText = "REGREDIR ↘ v" + _latestVersion;
+                statusText = "REGREDIR ↘ v" + latestVersion;
                 break;
             case VERSION_EQUAL:
-                statusText = "IGUAL ≡ v" + _latestVersion;
+                statusText = "IGUAL ≡ v" + latestVersion;
                 break;
             }
 
@@ -271,7 +276,7 @@ String OTAManager::getUpdateStatus()
 
 String OTAManager::getFirmwareVersion()
 {
-    return _currentVersion;
+    return OTAStatus::get().currentVersion;
 }
 
 void OTAManager::setFirmwareVersion(const String &version)
@@ -281,12 +286,16 @@ void OTAManager::setFirmwareVersion(const String &version)
         LOG_ERROR("Falha ao atualizar versão salva");
         return;
     }
-    _currentVersion = version;
+    OTAStatus::setCurrentVersion(version.c_str());
     LOG_INFO("✅ Versão do firmware atualizada para: %s", version.c_str());
 }
 
 esp_err_t OTAManager::init()
 {
+    // Uma sincronização de arquivos interrompida é concluída ou descartada antes de tudo
+    OTAFileSync::recover();
+
+    // O LittleFS fica montado: a aplicação usa os mesmos arquivos
     if (!LittleFS.begin(true))
     {
         LOG_ERROR("Falha ao montar LittleFS");
@@ -296,7 +305,6 @@ esp_err_t OTAManager::init()
     if (!LittleFS.exists("/ota_version.txt"))
     {
         LOG_WARN("Nenhuma versão armazenada encontrada, usando padrão");
-        LittleFS.end();
         return ESP_ERR_NOT_FOUND;
     }
 
@@ -304,12 +312,10 @@ esp_err_t OTAManager::init()
     if (!file)
     {
         LOG_ERROR("Falha ao abrir arquivo de versão");
-        LittleFS.end();
         return ESP_ERR_NOT_SUPPORTED;
     }
     String fileVersion = file.readString();
     file.close();
-    LittleFS.end();
 
     VersionComparison result = compareVersions(FIRMWARE_VERSION, fileVersion);
 
@@ -323,13 +329,13 @@ esp_err_t OTAManager::init()
     else if (result == VERSION_OLDER)
     {
         LOG_INFO("Versão no LittleFS é mais nova, mantendo...");
-        _currentVersion = fileVersion;
+        OTAStatus::setCurrentVersion(fileVersion.c_str());
         return ESP_OK;
     }
     else
     {
         LOG_INFO("Versão armazenada igual ao atual");
-        _currentVersion = fileVersion;
+        OTAStatus::setCurrentVersion(fileVersion.c_str());
         return ESP_OK;
     }
 }
@@ -346,15 +352,13 @@ esp_err_t OTAManager::writeVersion(const String &version)
     if (!file)
     {
         LOG_ERROR("Falha ao criar arquivo de versão");
-        LittleFS.end();
         return ESP_ERR_NOT_SUPPORTED;
     }
 
     file.print(version);
     file.close();
-    LittleFS.end();
 
     LOG_INFO("Versão atual salva: %s", version.c_str());
-    _currentVersion = version;
+    OTAStatus::setCurrentVersion(version.c_str());
     return ESP_OK;
 }
\ No newline at end of file
@@ -41,11 +41,7 @@ public:
     static void setFirmwareVersion(const String &version);
 
 private:
-    static UpdateMode _currentMode;
     static String _serverUrl;
-    static bool _updateAvailable;
-    static String _latestVersion;
-    static String _currentVersion;
 
     static esp_err_t init();
     static esp_err_t writeVersion(const String &version);
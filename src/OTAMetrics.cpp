@@ -0,0 +1,333 @@
+#include "OTAMetrics.h"
+#include "OTAClock.h"
+
+#include <stdarg.h>
+
+// ============ BUCKETS ============
+
+namespace
+{
+    const uint32_t CHECK_BOUNDS_MS[] = {50, 100, 250, 500, 1000, 2500, 5000, 10000};
+    const uint32_t FLASH_BOUNDS_US[] = {250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000};
+    const uint32_t UPLOAD_BOUNDS_MS[] = {1000, 2500, 5000, 10000, 20000, 30000, 60000, 120000, 300000};
+    const uint32_t REQUEST_BOUNDS_US[] = {1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000};
+
+    template <size_t N>
+    constexpr uint8_t countOf(const uint32_t (&)[N]) { return N; }
+
+    inline void increment(uint32_t &counter, uint32_t amount = 1)
+    {
+        __atomic_fetch_add(&counter, amount, __ATOMIC_RELAXED);
+    }
+
+    inline uint32_t load(const uint32_t &counter)
+    {
+        return __atomic_load_n(&counter, __ATOMIC_RELAXED);
+    }
+}
+
+// ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
+
+const OTAMetrics::Buckets OTAMetrics::_checkBuckets = {CHECK_BOUNDS_MS, countOf(CHECK_BOUNDS_MS), 1000};
+const OTAMetrics::Buckets OTAMetrics::_flashBuckets = {FLASH_BOUNDS_US, countOf(FLASH_BOUNDS_US), 1000000};
+const OTAMetrics::Buckets OTAMetrics::_uploadBuckets = {UPLOAD_BOUNDS_MS, countOf(UPLOAD_BOUNDS_MS), 1000};
+const OTAMetrics::Buckets OTAMetrics::_requestBuckets = {REQUEST_BOUNDS_US, countOf(REQUEST_BOUNDS_US), 1000000};
+
+OTAMetrics::Histogram OTAMetrics::_pullCheck = {};
+OTAMetrics::Histogram OTAMetrics::_flashWrite = {};
+OTAMetrics::Histogram OTAMetrics::_pushUpload = {};
+OTAMetrics::Histogram OTAMetrics::_requests[ROUTE_COUNT] = {};
+
+uint32_t OTAMetrics::_pullResponses[6] = {};
+uint32_t OTAMetrics::_pullBytes = 0;
+uint32_t OTAMetrics::_pullThroughput = 0;
+uint32_t OTAMetrics::_successes[OTAEvents::SOURCE_COUNT] = {};
+uint32_t OTAMetrics::_failures[OTAEvents::SOURCE_COUNT][FAIL_COUNT] = {};
+
+// ============ SAÍDA ============
+
+/**
+ * Formata cada linha e envia ao destino em blocos de OTA_METRICS_BUFFER
+ * bytes (uma escrita por linha geraria um chunk HTTP por linha)
+ */
+class OTAMetrics::Writer
+{
+public:
+    explicit Writer(Print &out) : _out(out), _length(0) {}
+
+    void printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char line[256];
+        va_list args;
+        va_start(args, format);
+        int length = vsnprintf(line, sizeof(line), format, args);
+        va_end(args);
+
+        if (length <= 0)
+        {
+            return;
+        }
+        length = min((size_t)length, sizeof(line) - 1);
+
+        if (_length + length > sizeof(_buffer))
+        {
+            flush();
+        }
+        memcpy(_buffer + _length, line, length);
+        _length += length;
+    }
+
+    void flush()
+    {
+        if (_length > 0)
+        {
+            _out.write(reinterpret_cast<const uint8_t *>(_buffer), _length);
+            _length = 0;
+        }
+    }
+
+private:
+    Print &_out;
+    char _buffer[OTA_METRICS_BUFFER];
+    size_t _length;
+};
+
+// ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
+
+void OTAMetrics::Histogram::observe(const Buckets &buckets, uint32_t value)
+{
+    uint8_t index = 0;
+    while (index < buckets.size && value > buckets.bounds[index])
+    {
+        index++;
+    }
+
+    increment(counts[index]);
+    increment(sum, value);
+}
+
+void OTAMetrics::pullCheck(uint32_t durationMs, int httpCode)
+{
+    _pullCheck.observe(_checkBuckets, durationMs);
+    pullResponse(httpCode);
+}
+
+void OTAMetrics::pullResponse(int httpCode)
+{
+    // Erros de conexão (negativos) ficam na classe 0
+    int index = (httpCode >= 100 && httpCode < 600) ? httpCode / 100 : 0;
+    increment(_pullResponses[index]);
+}
+
+void OTAMetrics::pullBytes(size_t bytes)
+{
+    increment(_pullBytes, bytes);
+}
+
+void OTAMetrics::pullDownload(size_t bytes, uint32_t durationMs)
+{
+    uint32_t throughput = durationMs > 0 ? (uint32_t)((uint64_t)bytes * 1000 / durationMs) : 0;
+    __atomic_store_n(&_pullThroughput, throughput, __ATOMIC_RELAXED);
+}
+
+void OTAMetrics::flashWrite(uint32_t durationUs)
+{
+    _flashWrite.observe(_flashBuckets, durationUs);
+}
+
+void OTAMetrics::pushUpload(uint32_t durationMs)
+{
+    _pushUpload.observe(_uploadBuckets, durationMs);
+}
+
+void OTAMetrics::success(OTAEvents::Source source)
+{
+    if (source < OTAEvents::SOURCE_COUNT)
+    {
+        increment(_successes[source]);
+    }
+}
+
+void OTAMetrics::failure(OTAEvents::Source source, Failure reason)
+{
+    if (source < OTAEvents::SOURCE_COUNT && reason < FAIL_COUNT)
+    {
+        increment(_failures[source][reason]);
+    }
+}
+
+void OTAMetrics::request(Route route, uint32_t durationUs)
+{
+    if (route < ROUTE_COUNT)
+    {
+        _requests[route].observe(_requestBuckets, durationUs);
+    }
+}
+
+void OTAMetrics::writeHistogram(Writer &out, const char *name, const char *help, const Buckets &buckets,
+                                const Histogram *histograms, size_t count)
+{
+    out.printf("# HELP %s %s\n# TYPE %s histogram\n", name, help, name);
+
+    for (size_t h = 0; h < count; h++)
+    {
+        // Rótulo da rota quando há um histograma por rota
+        char label[40] = "";
+        if (count > 1)
+        {
+            snprintf(label, sizeof(label), "route=\"%s\",", routeName((Route)h));
+        }
+
+        uint32_t cumulative = 0;
+        for (uint8_t i = 0; i <= buckets.size; i++)
+        {
+            cumulative += load(histograms[h].counts[i]);
+            if (i < buckets.size)
+            {
+                out.printf("%s_bucket{%sle=\"%g\"} %u\n", name, label,
+                           (double)buckets.bounds[i] / buckets.unitsPerSecond, cumulative);
+            }
+            else
+            {
+                out.printf("%s_bucket{%sle=\"+Inf\"} %u\n", name, label, cumulative);
+            }
+        }
+
+        if (count > 1)
+        {
+            label[strlen(label) - 1] = '\0'; // Sem a vírgula final
+            out.printf("%s_sum{%s} %.6f\n%s_count{%s} %u\n", name, label,
+                       (double)load(histograms[h].sum) / buckets.unitsPerSecond, name, label, cumulative);
+        }
+        else
+        {
+            out.printf("%s_sum %.6f\n%s_count %u\n", name,
+                       (double)load(histograms[h].sum) / buckets.unitsPerSecond, name, cumulative);
+        }
+    }
+}
+
+void OTAMetrics::write(Print &output)
+{
+    static const char *const CLASSES[] = {"error", "1xx", "2xx", "3xx", "4xx", "5xx"};
+    Writer out(output);
+
+    writeHistogram(out, "ota_pull_check_duration_seconds", "Version checks (checkVersion) against the update server",
+                   _checkBuckets, &_pullCheck, 1);
+
+    out.printf("# HELP ota_pull_http_responses_total Update server responses by status class\n"
+               "# TYPE ota_pull_http_responses_total counter\n");
+    for (int i = 0; i < 6; i++)
+    {
+        out.printf("ota_pull_http_responses_total{code=\"%s\"} %u\n", CLASSES[i], load(_pullResponses[i]));
+    }
+
+    out.printf("# HELP ota_pull_download_bytes_total Firmware bytes downloaded by the pull system\n"
+               "# TYPE ota_pull_download_bytes_total counter\nota_pull_download_bytes_total %u\n",
+               load(_pullBytes));
+    out.printf("# HELP ota_pull_download_throughput_bytes_per_second Throughput of the last firmware download\n"
+               "# TYPE ota_pull_download_throughput_bytes_per_second gauge\n"
+               "ota_pull_download_throughput_bytes_per_second %u\n",
+               load(_pullThroughput));
+
+    writeHistogram(out, "ota_flash_write_duration_seconds", "Duration of each Update.write() chunk",
+                   _flashBuckets, &_flashWrite, 1);
+    writeHistogram(out, "ota_push_upload_duration_seconds", "Push uploads, from the first byte to Update.end()",
+                   _uploadBuckets, &_pushUpload, 1);
+
+    out.printf("# HELP ota_updates_total Updates written and activated\n# TYPE ota_updates_total counter\n");
+    for (int source = 0; source < OTAEvents::SOURCE_COUNT; source++)
+    {
+        out.printf("ota_updates_total{source=\"%s\"} %u\n", OTAEvents::sourceName((OTAEvents::Source)source),
+                   load(_successes[source]));
+    }
+
+    out.printf("# HELP ota_failures_total Failed updates by reason\n# TYPE ota_failures_total counter\n");
+    for (int source = 0; source < OTAEvents::SOURCE_COUNT; source++)
+    {
+        for (int reason = 0; reason < FAIL_COUNT; reason++)
+        {
+            out.printf("ota_failures_total{source=\"%s\",reason=\"%s\"} %u\n",
+                       OTAEvents::sourceName((OTAEvents::Source)source), failureName((Failure)reason),
+                       load(_failures[source][reason]));
+        }
+    }
+
+    writeHistogram(out, "ota_http_request_duration_seconds", "Web server handler duration by route",
+                   _requestBuckets, _requests, ROUTE_COUNT);
+
+    // Memória: lida na hora da coleta
+    out.printf("# HELP ota_heap_free_bytes Free heap\n# TYPE ota_heap_free_bytes gauge\nota_heap_free_bytes %u\n",
+               ESP.getFreeHeap());
+    out.printf("# HELP ota_heap_min_free_bytes Lowest free heap since boot\n"
+               "# TYPE ota_heap_min_free_bytes gauge\nota_heap_min_free_bytes %u\n",
+               ESP.getMinFreeHeap());
+    out.printf("# HELP ota_heap_largest_free_block_bytes Largest allocatable heap block\n"
+               "# TYPE ota_heap_largest_free_block_bytes gauge\nota_heap_largest_free_block_bytes %u\n",
+               ESP.getMaxAllocHeap());
+    out.printf("# HELP ota_uptime_seconds Time since boot\n# TYPE ota_uptime_seconds counter\n"
+               "ota_uptime_seconds %lu\n",
+               (unsigned long)(OTAClock::millis() / 1000));
+
+    out.flush();
+}
+
+const char *OTAMetrics::failureName(Failure reason)
+{
+    switch (reason)
+    {
+    case FAIL_NETWORK:
+        return "network";
+    case FAIL_HTTP_STATUS:
+        return "http_status";
+    case FAIL_INVALID:
+        return "invalid";
+    case FAIL_BUSY:
+        return "busy";
+    case FAIL_NO_SPACE:
+        return "no_space";
+    case FAIL_WRITE:
+        return "write";
+    case FAIL_VERIFY:
+        return "verify";
+    case FAIL_PREEMPTED:
+        return "preempted";
+    case FAIL_ABORTED:
+        return "aborted";
+    default:
+        return "unknown";
+    }
+}
+
+const char *OTAMetrics::routeName(Route route)
+{
+    switch (route)
+    {
+    case ROUTE_PAGE:
+        return "page";
+    case ROUTE_ASSET:
+        return "asset";
+    case ROUTE_API_STATUS:
+        return "/api/status";
+    case ROUTE_API_SYSTEM:
+        return "/api/system";
+    case ROUTE_API_OTA:
+        return "/api/ota";
+    case ROUTE_API_FIRMWARE:
+        return "/api/firmware";
+    case ROUTE_API_UPLOAD:
+        return "/api/upload";
+    case ROUTE_API_FILES:
+        return "/api/files";
+    case ROUTE_DO_UPDATE:
+        return "/doUpdate";
+    case ROUTE_CHECK_UPDATES:
+        return "/check-updates";
+    case ROUTE_PERFORM_UPDATE:
+        return "/perform-update";
+    case ROUTE_METRICS:
+        return "/metrics";
+    default:
+        return "unknown";
+    }
+}
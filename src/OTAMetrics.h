@@ -0,0 +1,168 @@
+#pragma once
+
+/**
+ * @file OTAMetrics.h
+ * @brief Contadores e histogramas das atualizações e do servidor web
+ *
+ * Os caminhos quentes (gravação na flash, bytes baixados, rotas web)
+ * registram amostras em contadores de tamanho fixo, atualizados com
+ * operações atômicas: nada de locks nem alocação. write() exporta tudo no
+ * formato texto do Prometheus, servido em /metrics.
+ *
+ * Exemplo (prometheus.yml):
+ * - job_name: ota
+ *   static_configs: [{targets: ['esp32-ota.local:80']}]
+ */
+
+#include "OTAConfig.h"
+#include "OTAEvents.h"
+
+#include <Arduino.h>
+
+class OTAMetrics
+{
+public:
+    /**
+     * @brief Motivo de uma atualização que falhou
+     */
+    enum Failure
+    {
+        FAIL_NETWORK = 0, ///< Conexão recusada ou encerrada no meio
+        FAIL_HTTP_STATUS, ///< Servidor respondeu com código diferente de 200
+        FAIL_INVALID,     ///< Arquivo, tamanho ou MD5 inválido
+        FAIL_BUSY,        ///< Outra atualização já tinha a sessão
+        FAIL_NO_SPACE,    ///< Update.begin() recusou o tamanho
+        FAIL_WRITE,       ///< Erro ao gravar na flash
+        FAIL_VERIFY,      ///< Update.end() recusou a imagem (MD5, cabeçalho)
+        FAIL_PREEMPTED,   ///< Interrompida pelo outro lado (OTASession)
+        FAIL_ABORTED,     ///< Cliente desistiu ou a sessão expirou
+        FAIL_COUNT
+    };
+
+    /**
+     * @brief Rotas web com latência medida
+     */
+    enum Route
+    {
+        ROUTE_PAGE = 0, ///< /, /update e /system
+        ROUTE_ASSET,    ///< CSS, JS e ícones
+        ROUTE_API_STATUS,
+        ROUTE_API_SYSTEM,
+        ROUTE_API_OTA,
+        ROUTE_API_FIRMWARE,
+        ROUTE_API_UPLOAD,
+        ROUTE_API_FILES,
+        ROUTE_DO_UPDATE,
+        ROUTE_CHECK_UPDATES,
+        ROUTE_PERFORM_UPDATE,
+        ROUTE_METRICS,
+        ROUTE_COUNT
+    };
+
+    // ============ PULL ============
+
+    /**
+     * @brief Registra uma verificação de versão (checkVersion)
+     * @param httpCode Código HTTP, ou negativo para erro de conexão
+     */
+    static void pullCheck(uint32_t durationMs, int httpCode);
+
+    /**
+     * @brief Registra a resposta ao download do firmware
+     */
+    static void pullResponse(int httpCode);
+
+    /**
+     * @brief Soma bytes baixados (chamado a cada bloco)
+     */
+    static void pullBytes(size_t bytes);
+
+    /**
+     * @brief Registra o fim de um download, para a vazão
+     */
+    static void pullDownload(size_t bytes, uint32_t durationMs);
+
+    // ============ COMUM ============
+
+    /**
+     * @brief Registra a duração de um Update.write()
+     */
+    static void flashWrite(uint32_t durationUs);
+
+    /**
+     * @brief Registra a duração de um upload pela página ou pela API
+     */
+    static void pushUpload(uint32_t durationMs);
+
+    /**
+     * @brief Conta uma atualização concluída
+     */
+    static void success(OTAEvents::Source source);
+
+    /**
+     * @brief Conta uma atualização que falhou
+     */
+    static void failure(OTAEvents::Source source, Failure reason);
+
+    /**
+     * @brief Registra a duração de um handler web
+     *
+     * No backend síncrono a medida inclui o envio da resposta; no assíncrono,
+     * só a montagem (o envio é feito depois pelo AsyncTCP). Nas rotas de
+     * upload mede só a resposta final: o upload tem histograma próprio.
+     */
+    static void request(Route route, uint32_t durationUs);
+
+    /**
+     * @brief Escreve todas as métricas no formato texto do Prometheus
+     */
+    static void write(Print &out);
+
+    static const char *failureName(Failure reason);
+    static const char *routeName(Route route);
+
+private:
+    static constexpr uint8_t MAX_BOUNDS = 10;
+
+    class Writer; ///< Agrupa as linhas em blocos antes de enviar (OTAMetrics.cpp)
+
+    /**
+     * @brief Limites dos buckets de um histograma
+     */
+    struct Buckets
+    {
+        const uint32_t *bounds;  ///< Limites superiores, na unidade das amostras
+        uint8_t size;            ///< Quantidade de limites (até MAX_BOUNDS)
+        uint32_t unitsPerSecond; ///< 1000 (ms) ou 1000000 (us)
+    };
+
+    /**
+     * @brief Contagens de um histograma (não cumulativas; a última é +Inf)
+     */
+    struct Histogram
+    {
+        uint32_t counts[MAX_BOUNDS + 1];
+        uint32_t sum;
+
+        void observe(const Buckets &buckets, uint32_t value);
+    };
+
+    static const Buckets _checkBuckets;   ///< checkVersion(), em ms
+    static const Buckets _flashBuckets;   ///< Update.write(), em us
+    static const Buckets _uploadBuckets;  ///< Uploads do Push, em ms
+    static const Buckets _requestBuckets; ///< Handlers web, em us
+
+    static Histogram _pullCheck;
+    static Histogram _flashWrite;
+    static Histogram _pushUpload;
+    static Histogram _requests[ROUTE_COUNT];
+
+    static uint32_t _pullResponses[6]; ///< Por classe: erro de conexão, 1xx .. 5xx
+    static uint32_t _pullBytes;
+    static uint32_t _pullThroughput; ///< Bytes/s do último download
+    static uint32_t _successes[OTAEvents::SOURCE_COUNT];
+    static uint32_t _failures[OTAEvents::SOURCE_COUNT][FAIL_COUNT];
+
+    static void writeHistogram(Writer &out, const char *name, const char *help, const Buckets &buckets,
+                               const Histogram *histograms, size_t count);
+};
@@ -1,22 +1,72 @@
 #include "OTAPullUpdateManager.h"
+#include "OTABundle.h"
+#include "OTAClock.h"
+#include "OTAEvents.h"
+#include "OTAFileSync.h"
 #include "OTAManager.h"
+#include "OTAMetrics.h"
+#include "OTASession.h"
+#include "OTAStatus.h"
+#include "OTATasks.h"
+#include "OTATrace.h"
 #include "WiFi.h"
 
 // ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
 
 String OTAPullUpdateManager::_firmwareUrl = "";
 String OTAPullUpdateManager::_versionUrl = "";
-bool OTAPullUpdateManager::_updating = false;
+String OTAPullUpdateManager::_filesUrl = "";
+String OTAPullUpdateManager::_baseUrl = "";
 uint16_t OTAPullUpdateManager::_serverPort = 8000;
 String OTAPullUpdateManager::_versionPath = "/version";
 String OTAPullUpdateManager::_firmwarePath = "/firmware";
+String OTAPullUpdateManager::_filesPath = "";
+uint8_t OTAPullUpdateManager::_buffer[OTA_PULL_BUFFER];
 
 TaskHandle_t OTAPullUpdateManager::_updateTaskHandle = nullptr;
-bool OTAPullUpdateManager::_threadRunning = false;
 uint32_t OTAPullUpdateManager::_checkIntervalMs = 60000;
 
 // ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
 
+namespace
+{
+    // Motivo da falha de um download recusado pelo OTABundle
+    OTAMetrics::Failure bundleFailure(size_t totalRead, size_t contentLength)
+    {
+        switch (OTABundle::getError())
+        {
+        case OTABundle::ERROR_HEADER:
+            return OTAMetrics::FAIL_INVALID;
+        case OTABundle::ERROR_BEGIN:
+            return OTAMetrics::FAIL_NO_SPACE;
+        case OTABundle::ERROR_WRITE:
+            return OTAMetrics::FAIL_WRITE;
+        case OTABundle::ERROR_INCOMPLETE:
+            // Conexão encerrada antes do fim: a imagem incompleta não é culpa da flash
+            return totalRead < contentLength ? OTAMetrics::FAIL_NETWORK : OTAMetrics::FAIL_VERIFY;
+        default:
+            return OTAMetrics::FAIL_VERIFY;
+        }
+    }
+
+    // Acumula o manifesto do OTAFileSync no corpo do POST
+    class StringPrint : public Print
+    {
+    public:
+        explicit StringPrint(String &out) : _out(out) {}
+
+        size_t write(uint8_t c) override { return _out.concat((char)c) ? 1 : 0; }
+        size_t write(const uint8_t *buffer, size_t size) override
+        {
+            return _out.concat(reinterpret_cast<const char *>(buffer), size) ? size : 0;
+        }
+        using Print::write;
+
+    private:
+        String &_out;
+    };
+}
+
 bool OTAPullUpdateManager::buildUrls(const String &serverUrl)
 {
     String baseUrl = serverUrl;
@@ -41,8 +91,10 @@ bool OTAPullUpdateManager::buildUrls(const String &serverUrl)
     }
 
     // Constrói URLs completas
-    _versionUrl = baseUrl + ":" + String(_serverPort) + _versionPath;
-    _firmwareUrl = baseUrl + ":" + String(_serverPort) + _firmwarePath;
+    _baseUrl = baseUrl + ":" + String(_serverPort);
+    _versionUrl = _baseUrl + _versionPath;
+    _firmwareUrl = _baseUrl + _firmwarePath;
+    _filesUrl = _filesPath.isEmpty() ? "" : _baseUrl + _filesPath;
 
     LOG_DEBUG("URLs construídas - Versão: %s, Firmware: %s",
               _versionUrl.c_str(), _firmwareUrl.c_str());
@@ -62,7 +114,6 @@ bool OTAPullUpdateManager::loadStoredVersion()
     if (!LittleFS.exists("/ota_version.txt"))
     {
         LOG_WARN("Nenhuma versão armazenada encontrada, usando padrão");
-        LittleFS.end();
         return false;
     }
 
@@ -70,12 +121,10 @@ bool OTAPullUpdateManager::loadStoredVersion()
     if (!file)
     {
         LOG_ERROR("Falha ao abrir arquivo de versão");
-        LittleFS.end();
         return false;
     }
 
     file.close();
-    LittleFS.end();
 
     LOG_INFO("Versão armazenada carregada: %s", OTAManager::getFirmwareVersion().c_str());
     return true;
@@ -137,9 +186,21 @@ void OTAPullUpdateManager::setFirmwarePath(const String &path)
     LOG_INFO("Caminho do firmware definido para: %s", _firmwarePath.c_str());
 }
 
+void OTAPullUpdateManager::setFilesPath(const String &path)
+{
+    _filesPath = path;
+    if (!_filesPath.isEmpty() && !_filesPath.startsWith("/"))
+    {
+        _filesPath = "/" + _filesPath;
+    }
+    _filesUrl = (_filesPath.isEmpty() || _baseUrl.isEmpty()) ? "" : _baseUrl + _filesPath;
+    LOG_INFO("Caminho da sincronização de arquivos definido para: %s",
+             _filesPath.isEmpty() ? "(desabilitada)" : _filesPath.c_str());
+}
+
 void OTAPullUpdateManager::checkForUpdates()
 {
-    if (_updating || WiFi.status() != WL_CONNECTED)
+    if (isUpdating() || WiFi.status() != WL_CONNECTED)
     {
         LOG_DEBUG("Verificação de atualizações ignorada: atualização em "
                   "andamento ou WiFi desconectado");
@@ -154,18 +215,21 @@ void OTAPullUpdateManager::checkForUpdates()
         if (downloadFirmware())
         {
             LOG_INFO("🔄 Firmware atualizado com sucesso. Reiniciando...");
-            delay(500);
+            OTAClock::delay(500);
             ESP.restart();
         }
     }
     else
     {
         LOG_DEBUG("✅ Firmware está atualizado");
+        syncFiles();
     }
 }
 
 bool OTAPullUpdateManager::checkVersion()
 {
+    OTA_TRACE_SCOPE("pull.checkVersion");
+
     // Validações iniciais
     if (_versionUrl.length() == 0)
     {
@@ -189,12 +253,14 @@ bool OTAPullUpdateManager::checkVersion()
     http.setUserAgent("ESP32-OTA-Client");
     http.addHeader("Cache-Control", "no-cache");
 
+    uint32_t startMs = OTAClock::millis();
     int httpCode = http.GET();
 
     if (httpCode == HTTP_CODE_OK)
     {
         String serverVersion = http.getString();
         serverVersion.trim();
+        OTAMetrics::pullCheck(OTAClock::millis() - startMs, httpCode);
 
         // Compare servidor vs atual (mais intuitivo)
         OTAManager::VersionComparison comparisonResult = OTAManager::compareVersions(serverVersion, OTAManager::getFirmwareVersion());
@@ -223,6 +289,7 @@ bool OTAPullUpdateManager::checkVersion()
     }
     else
     {
+        OTAMetrics::pullCheck(OTAClock::millis() - startMs, httpCode);
         LOG_ERROR("Falha ao verificar versão. Código HTTP: %d, URL: %s",
                   httpCode, versionUrlCopy.c_str());
 
@@ -239,7 +306,16 @@ bool OTAPullUpdateManager::checkVersion()
 
 bool OTAPullUpdateManager::downloadFirmware()
 {
-    _updating = true;
+    OTA_TRACE_SCOPE("pull.download");
+
+    // O Update é compartilhado com o Push: só grava quem tem a sessão
+    OTASession::Token token = OTASession::acquire(OTASession::OWNER_PULL);
+    if (token == 0)
+    {
+        LOG_WARN("⏳ Download do firmware adiado: outra atualização em andamento");
+        OTAMetrics::failure(OTAEvents::SOURCE_PULL, OTAMetrics::FAIL_BUSY);
+        return false;
+    }
 
     HTTPClient http;
     http.begin(_firmwareUrl);
@@ -247,7 +323,13 @@ bool OTAPullUpdateManager::downloadFirmware()
 
     LOG_INFO("🚀 Iniciando download do firmware de: %s", _firmwareUrl.c_str());
 
-    int httpCode = http.GET();
+    uint32_t startMs = OTAClock::millis();
+    int httpCode;
+    {
+        OTA_TRACE_SCOPE("http.GET"); // DNS, conexão (TLS) e cabeçalhos
+        httpCode = http.GET();
+    }
+    OTAMetrics::pullResponse(httpCode);
     if (httpCode == HTTP_CODE_OK)
     {
         int contentLength = http.getSize();
@@ -256,58 +338,100 @@ bool OTAPullUpdateManager::downloadFirmware()
         if (contentLength <= 0)
         {
             LOG_ERROR("❌ Tamanho do firmware inválido");
-            _updating = false;
+            OTAEvents::progress(OTAEvents::SOURCE_PULL, OTAEvents::PHASE_ERROR, 0, 0, "Invalid firmware size");
+            OTAMetrics::failure(OTAEvents::SOURCE_PULL, OTAMetrics::FAIL_INVALID);
+            OTASession::release(token);
             return false;
         }
 
-        if (!Update.begin(contentLength))
-        {
-            LOG_ERROR("❌ Espaço insuficiente para atualização OTA");
-            _updating = false;
-            return false;
-        }
+        // Imagem do app ou pacote app + LittleFS: o OTABundle decide pelos primeiros bytes
+        OTABundle::begin(contentLength);
 
-        // Limpar área do terminal para progresso
-        for (int i = 0; i < 3; i++)
-            Serial.println();
+        OTAEvents::progress(OTAEvents::SOURCE_PULL, OTAEvents::PHASE_START, 0, contentLength);
 
         WiFiClient *stream = http.getStreamPtr();
-        uint8_t buffer[1024];
         size_t totalRead = 0;
         int lastProgress = -1;
 
         while (http.connected() && totalRead < contentLength)
         {
-            size_t bytesRead = stream->readBytes(buffer, sizeof(buffer));
+            // O upload pela página tem prioridade: aborta e devolve o Update
+            if (!OTASession::isValid(token))
+            {
+                LOG_WARN("⚡ Download do firmware interrompido: o Push tem prioridade");
+                OTABundle::abort();
+                OTAEvents::progress(OTAEvents::SOURCE_PULL, OTAEvents::PHASE_ERROR, totalRead, contentLength,
+                                    "Update preempted by push");
+                OTAMetrics::failure(OTAEvents::SOURCE_PULL, OTAMetrics::FAIL_PREEMPTED);
+                OTASession::release(token);
+                return false;
+            }
+
+            size_t bytesRead;
+            {
+                OTA_TRACE_SCOPE("stream.read");
+                bytesRead = stream->readBytes(_buffer, sizeof(_buffer));
+            }
             if (bytesRead > 0)
             {
-                Update.write(buffer, bytesRead);
+                uint32_t writeStartUs = micros();
+                bool written;
+                {
+                    OTA_TRACE_SCOPE("Update.write");
+                    written = OTABundle::write(_buffer, bytesRead);
+                }
+                OTAMetrics::flashWrite(micros() - writeStartUs);
+                OTAMetrics::pullBytes(bytesRead);
                 totalRead += bytesRead;
+                OTAEvents::progress(OTAEvents::SOURCE_PULL, OTAEvents::PHASE_TRANSFER, totalRead, contentLength);
 
                 if (contentLength > 0)
                 {
-                    int progress = (totalRead * 100) / contentLength;
+                    // Um log a cada 10%: a serial não deve pautar o download
+                    int progress = (totalRead * 100) / contentLength / 10 * 10;
                     if (progress != lastProgress)
                     {
-                        Serial.print("\r🔄 Progresso do download: ");
-                        Serial.print(progress);
-                        Serial.print("%");
+                        LOG_DEBUG("🔄 Progresso do download: %d%%", progress);
                         lastProgress = progress;
                     }
                 }
+
+                // Imagem recusada (espaço, cabeçalho, gravação): não adianta baixar o resto
+                if (!written)
+                {
+                    break;
+                }
             }
             else
             {
-                delay(10);
+                OTAClock::delay(10);
             }
         }
 
-        // Finalizar visualização do progresso
-        Serial.println("\r✅ Download concluído: 100%");
-        for (int i = 0; i < 2; i++)
-            Serial.println();
+        if (OTABundle::getError() != OTABundle::ERROR_OK)
+        {
+            LOG_ERROR("❌ Download interrompido em %u de %d bytes: %s", (unsigned)totalRead, contentLength,
+                      OTABundle::errorString());
+        }
+        else if (totalRead == (size_t)contentLength)
+        {
+            LOG_INFO("✅ Download concluído: %u bytes em %lu ms", (unsigned)totalRead, (unsigned long)(OTAClock::millis() - startMs));
+        }
+        else
+        {
+            LOG_WARN("⚠️  Conexão encerrada em %u de %d bytes", (unsigned)totalRead, contentLength);
+        }
 
-        if (Update.end())
+        OTAEvents::progress(OTAEvents::SOURCE_PULL, OTAEvents::PHASE_FINALIZE, totalRead, contentLength);
+        OTAMetrics::pullDownload(totalRead, OTAClock::millis() - startMs);
+
+        bool ended;
+        {
+            OTA_TRACE_SCOPE("Update.end");
+            ended = OTABundle::end();
+        }
+
+        if (ended)
         {
             // ✅ CORREÇÃO GARANTIDA: Sempre atualizar a versão no LittleFS após atualização bem-sucedida
 
@@ -354,21 +478,30 @@ bool OTAPullUpdateManager::downloadFirmware()
             LOG_INFO("💾 Versão salva no LittleFS: %s", serverVersion.c_str());
 
             LOG_INFO("✨ Atualização de firmware concluída com sucesso");
-            _updating = false;
+            OTAEvents::progress(OTAEvents::SOURCE_PULL, OTAEvents::PHASE_DONE, totalRead, contentLength,
+                                serverVersion.c_str());
+            OTAMetrics::success(OTAEvents::SOURCE_PULL);
+            // A sessão não é devolvida: a nova imagem já é a de boot e o ESP32 vai reiniciar
             return true;
         }
         else
         {
             LOG_ERROR("💥 Falha na atualização do firmware: %s",
-                      Update.errorString());
-            _updating = false;
+                      OTABundle::errorString());
+            OTAEvents::progress(OTAEvents::SOURCE_PULL, OTAEvents::PHASE_ERROR, totalRead, contentLength,
+                                OTABundle::errorString());
+            OTAMetrics::failure(OTAEvents::SOURCE_PULL, bundleFailure(totalRead, contentLength));
+            OTABundle::abort();
+            OTASession::release(token);
             return false;
         }
     }
     else
     {
         LOG_ERROR("❌ Download do firmware falhou. Código HTTP: %d", httpCode);
-        _updating = false;
+        OTAEvents::progress(OTAEvents::SOURCE_PULL, OTAEvents::PHASE_ERROR, 0, 0, "Firmware download failed");
+        OTAMetrics::failure(OTAEvents::SOURCE_PULL, httpCode < 0 ? OTAMetrics::FAIL_NETWORK : OTAMetrics::FAIL_HTTP_STATUS);
+        OTASession::release(token);
         return false;
     }
 
@@ -376,7 +509,122 @@ bool OTAPullUpdateManager::downloadFirmware()
     return false;
 }
 
-bool OTAPullUpdateManager::isUpdating() { return _updating; }
+bool OTAPullUpdateManager::syncFiles()
+{
+    if (_filesUrl.length() == 0 || WiFi.status() != WL_CONNECTED)
+    {
+        return false;
+    }
+
+    OTA_TRACE_SCOPE("pull.syncFiles");
+
+    // A revisão evita montar o manifesto (ler e calcular o MD5 de todo o LittleFS) a cada verificação
+    HTTPClient http;
+    http.begin(_filesUrl);
+    http.setTimeout(10000);
+    http.setUserAgent("ESP32-OTA-Client");
+    http.addHeader("Cache-Control", "no-cache");
+
+    int httpCode = http.GET();
+    if (httpCode != HTTP_CODE_OK)
+    {
+        LOG_ERROR("Falha ao consultar a revisão dos arquivos. Código HTTP: %d", httpCode);
+        http.end();
+        return false;
+    }
+    String serverRevision = http.getString();
+    serverRevision.trim();
+    http.end();
+
+    String revision = OTAFileSync::getRevision();
+    if (!serverRevision.isEmpty() && serverRevision == revision)
+    {
+        LOG_DEBUG("✅ Arquivos em dia (revisão %s)", revision.c_str());
+        return false;
+    }
+
+    // O LittleFS também é gravado pelos pacotes do Update: um de cada vez
+    OTASession::Token token = OTASession::acquire(OTASession::OWNER_PULL);
+    if (token == 0)
+    {
+        LOG_WARN("⏳ Sincronização de arquivos adiada: outra atualização em andamento");
+        return false;
+    }
+
+    String manifest;
+    StringPrint out(manifest);
+    size_t files = OTAFileSync::writeManifest(out);
+    if (manifest.length() > OTA_FILESYNC_MANIFEST_MAX)
+    {
+        LOG_ERROR("❌ Manifesto com %u bytes excede OTA_FILESYNC_MANIFEST_MAX", manifest.length());
+        OTASession::release(token);
+        return false;
+    }
+
+    LOG_INFO("🗂️ Sincronizando arquivos: revisão %s → %s (%u arquivo(s) no dispositivo)",
+             revision.isEmpty() ? "-" : revision.c_str(), serverRevision.c_str(), (unsigned)files);
+
+    uint32_t startMs = OTAClock::millis();
+    http.begin(_filesUrl);
+    http.setTimeout(60000);
+    http.setUserAgent("ESP32-OTA-Client");
+    http.addHeader("Content-Type", "text/plain");
+    httpCode = http.POST(manifest);
+    manifest = String(); // O corpo não é mais necessário durante o download
+
+    int contentLength = http.getSize();
+    if (httpCode != HTTP_CODE_OK || contentLength <= 0)
+    {
+        LOG_ERROR("❌ Patch de arquivos indisponível. Código HTTP: %d, tamanho: %d", httpCode, contentLength);
+        http.end();
+        OTASession::release(token);
+        return false;
+    }
+
+    bool ok = OTAFileSync::begin(contentLength);
+    WiFiClient *stream = http.getStreamPtr();
+    size_t totalRead = 0;
+
+    while (ok && http.connected() && totalRead < (size_t)contentLength)
+    {
+        if (!OTASession::isValid(token))
+        {
+            LOG_WARN("⚡ Sincronização de arquivos interrompida: o Push tem prioridade");
+            ok = false;
+            break;
+        }
+
+        size_t bytesRead = stream->readBytes(_buffer, sizeof(_buffer));
+        if (bytesRead > 0)
+        {
+            totalRead += bytesRead;
+            ok = OTAFileSync::write(_buffer, bytesRead);
+        }
+        else
+        {
+            OTAClock::delay(10);
+        }
+    }
+
+    ok = ok && OTAFileSync::end();
+    if (ok)
+    {
+        LOG_INFO("✨ Arquivos sincronizados em %lu ms: %u gravado(s), %u apagado(s)",
+                 (unsigned long)(OTAClock::millis() - startMs), OTAFileSync::filesWritten(),
+                 OTAFileSync::filesDeleted());
+    }
+    else
+    {
+        LOG_ERROR("💥 Falha na sincronização de arquivos: %s", OTAFileSync::errorString());
+        OTAFileSync::abort();
+    }
+
+    http.end();
+    OTASession::release(token);
+    return ok;
+}
+
+bool OTAPullUpdateManager::isUpdating() { return OTAStatus::get().pullUpdating; }
 
 String OTAPullUpdateManager::getCurrentVersion() { return OTAManager::getFirmwareVersion(); }
 
@@ -412,14 +660,15 @@ void OTAPullUpdateManager::updateTask(void *parameter)
     ThreadParams *params = static_cast<ThreadParams *>(parameter);
     uint32_t checkIntervalMs = params->checkIntervalMs;
     delete params; // Liberar memória alocada
-    vTaskDelay(pdMS_TO_TICKS(5000));
+    OTAClock::delay(5000);
     LOG_INFO("🔄 Thread de verificação de atualizações iniciada");
 
-    while (_threadRunning)
+    while (isThreadRunning())
     {
-        if (WiFi.status() == WL_CONNECTED && !_updating)
+        if (WiFi.status() == WL_CONNECTED && !isUpdating())
         {
             LOG_DEBUG("Thread: Verificando atualizações...");
+            OTA_TRACE_SCOPE("pull.checkForUpdates");
             checkForUpdates();
         }
         else
@@ -430,37 +679,38 @@ void OTAPullUpdateManager::updateTask(void *parameter)
 
         // Aguardar intervalo especificado
         uint32_t waitSeconds = checkIntervalMs / 1000;
-        for (uint32_t i = 0; i < waitSeconds && _threadRunning; i++)
+        for (uint32_t i = 0; i < waitSeconds && isThreadRunning(); i++)
         {
-            vTaskDelay(pdMS_TO_TICKS(1000));
+            OTAClock::delay(1000);
         }
     }
 
     LOG_INFO("🛑 Thread de verificação de atualizações finalizada");
-    vTaskDelete(nullptr);
+    OTATasks::exitCurrent();
 }
 
-void OTAPullUpdateManager::startUpdateThread(uint16_t checkIntervalMinutes)
+void OTAPullUpdateManager::startUpdateThread(uint16_t checkIntervalMinutes, uint32_t stackSize, BaseType_t core)
 {
-    if (_threadRunning)
+    if (isThreadRunning())
     {
         LOG_WARN("Thread de atualização já está em execução");
         return;
     }
 
     _checkIntervalMs = checkIntervalMinutes * 60 * 1000;
-    _threadRunning = true;
+    OTAStatus::setPullThreadRunning(true);
 
     // Preparar parâmetros para a thread
     ThreadParams *params = new ThreadParams();
     params->checkIntervalMs = _checkIntervalMs;
 
-    BaseType_t result = xTaskCreate(updateTask,          // Função da task
-                                    "HTTPUpdateChecker", // Nome da task
-                                    4096,                // Stack size
-                                    params,              // Parâmetros
-                                    1,                   // Prioridade (baixa)
-                                    &_updateTaskHandle   // Handle da task
+    BaseType_t result = OTATasks::create(updateTask,          // Função da task
+                                         "HTTPUpdateChecker", // Nome da task
+                                         stackSize,           // Stack size
+                                         params,              // Parâmetros
+                                         1,                   // Prioridade (baixa)
+                                         &_updateTaskHandle,  // Handle da task
+                                         core                 // Núcleo
     );
 
     if (result == pdPASS && _updateTaskHandle != nullptr)
@@ -471,26 +721,26 @@ void OTAPullUpdateManager::startUpdateThread(uint16_t checkIntervalMinutes)
     else
     {
         LOG_ERROR("❌ Falha ao criar thread de verificação");
-        _threadRunning = false;
+        OTAStatus::setPullThreadRunning(false);
         delete params;
     }
 }
 
 void OTAPullUpdateManager::stopUpdateThread()
 {
-    if (!_threadRunning)
+    if (!isThreadRunning())
         return;
 
     LOG_INFO("Parando thread de verificação de atualizações...");
-    _threadRunning = false;
+    OTAStatus::setPullThreadRunning(false);
 
     if (_updateTaskHandle != nullptr)
     {
-        vTaskDelay(pdMS_TO_TICKS(100));
+        OTAClock::delay(100);
         _updateTaskHandle = nullptr;
     }
 
     LOG_INFO("Thread de verificação de atualizações parada");
 }
 
-bool OTAPullUpdateManager::isThreadRunning() { return _threadRunning; }
\ No newline at end of file
+bool OTAPullUpdateManager::isThreadRunning() { return OTAStatus::get().pullThreadRunning; }
\ No newline at end of file
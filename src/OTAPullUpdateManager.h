@@ -9,7 +9,8 @@
  */
 
 #include "ESPmDNS.h"
-#include "LogLibrary.h"
+#include "OTAConfig.h"
+#include "OTALog.h"
 #include <HTTPClient.h>
 #include <LittleFS.h>
 #include <Update.h>
@@ -41,6 +42,17 @@ public:
     static void setVersionPath(const String &path);
     static void setFirmwarePath(const String &path);
 
+    /**
+     * @brief Habilita a sincronização dos arquivos do LittleFS (OTAFileSync)
+     *
+     * A cada verificação sem firmware novo, GET no caminho devolve a revisão
+     * dos arquivos do servidor; se ela mudou, o manifesto vai num POST ao
+     * mesmo caminho e a resposta é o patch, aplicado sem reiniciar.
+     *
+     * @param path Caminho do endpoint (ex: "/files"); vazio desabilita (padrão)
+     */
+    static void setFilesPath(const String &path);
+
     // Controle de atualizações
     static void checkForUpdates();
     static bool isUpdating();
@@ -48,24 +60,36 @@ public:
     static String getLatestVersion();
     static void setCurrentVersion(const String &version);
 
+    /**
+     * @brief Sincroniza os arquivos do LittleFS com o servidor, se habilitado
+     * @return true se um patch foi aplicado
+     */
+    static bool syncFiles();
+
     // Gerenciamento de thread
-    static void startUpdateThread(uint16_t checkIntervalMinutes = 1);
+    static void startUpdateThread(uint16_t checkIntervalMinutes = 1, uint32_t stackSize = OTA_PULL_TASK_STACK,
+                                  BaseType_t core = OTA_PULL_TASK_CORE);
     static void stopUpdateThread();
     static bool isThreadRunning();
 
 private:
     // ============ VARIÁVEIS DE ESTADO ============
+    // Flags de atualização e da thread ficam no OTAStatus (snapshot entre tasks)
     static String _firmwareUrl; ///< URL completa para download do firmware
     static String _versionUrl;  ///< URL completa para verificação de versão
+    static String _filesUrl;    ///< URL completa da sincronização de arquivos (vazia = desabilitada)
+    static String _baseUrl;     ///< Protocolo, host e porta, para recompor as URLs
 
-    static bool _updating;       ///< Flag indicando se atualização está em progresso
     static uint16_t _serverPort; ///< Porta do servidor de atualizações
     static String _versionPath;  ///< Caminho do endpoint de versão
     static String _firmwarePath; ///< Caminho do endpoint do firmware
+    static String _filesPath;    ///< Caminho do endpoint de arquivos
+
+    /// Buffer de leitura dos downloads (fora da stack da task); usado só por quem tem a sessão OWNER_PULL
+    static uint8_t _buffer[OTA_PULL_BUFFER];
 
     // ============ GERENCIAMENTO DE THREAD ============
     static TaskHandle_t _updateTaskHandle; ///< Handle da task FreeRTOS
-    static bool _threadRunning;            ///< Flag de controle da thread
     static uint32_t
         _checkIntervalMs; ///< Intervalo de verificação em milissegundos
 
@@ -0,0 +1,970 @@
+/**
+ * @file OTAPushAsyncWebServer.cpp
+ * @brief Backend assíncrono (ESPAsyncWebServer) do OTAPushUpdateManager
+ *
+ * As requisições são atendidas pela task do AsyncTCP conforme os eventos de
+ * rede chegam: não há polling, vários clientes são servidos ao mesmo tempo e
+ * o upload é gravado no Update bloco a bloco, conforme é recebido.
+ * Operações bloqueantes (HTTP do sistema Pull, reinício, manifesto e
+ * aplicação de patches do LittleFS) são executadas em tasks próprias para
+ * não travar a task do AsyncTCP.
+ */
+
+#include "OTAPushUpdateManager.h"
+
+#if OTA_ASYNC_WEBSERVER
+
+#include "OTAClock.h"
+#include "OTAEvents.h"
+#include "OTAFileSync.h"
+#include "OTAManager.h"
+#include "OTAMetrics.h"
+#include "OTATrace.h"
+
+AsyncWebServer *OTAPushUpdateManager::_server = nullptr;
+AsyncWebServerRequest *OTAPushUpdateManager::_uploadRequest = nullptr;
+AsyncEventSource *OTAPushUpdateManager::_events = nullptr;
+AsyncWebServerRequest *OTAPushUpdateManager::_chunkRequest = nullptr;
+AsyncWebServerRequest *OTAPushUpdateManager::_filesRequest = nullptr;
+AsyncWebSocket *OTAPushUpdateManager::_ws = nullptr;
+uint32_t OTAPushUpdateManager::_wsClientId = 0;
+
+namespace
+{
+    // Mede a montagem da resposta (o envio fica com o AsyncTCP) para /metrics
+    ArRequestHandlerFunction timed(OTAMetrics::Route route, ArRequestHandlerFunction handler)
+    {
+        return [route, handler](AsyncWebServerRequest *request)
+        {
+            uint32_t start = micros();
+            handler(request);
+            OTAMetrics::request(route, micros() - start);
+        };
+    }
+
+    // Resposta JSON montada num stream, na task que chamar (AsyncTCP ou uma task de runDeferred())
+    AsyncResponseStream *jsonResponse(void (*writer)(OTAJsonWriter &json), int code)
+    {
+        // O stream da resposta recebe o JSON em blocos de OTA_JSON_BUFFER bytes
+        AsyncResponseStream *response = new AsyncResponseStream("application/json", OTA_JSON_BUFFER);
+        response->setCode(code);
+        response->addHeader("Cache-Control", "no-store");
+
+        OTAJsonWriter json(*response);
+        writer(json);
+        json.flush();
+        return response;
+    }
+
+    void writeFilesBusy(OTAJsonWriter &json)
+    {
+        json.beginObject().add("status", "error").add("message", "File system busy, retry").endObject();
+    }
+
+    portMUX_TYPE jobLock = portMUX_INITIALIZER_UNLOCKED;
+
+    /**
+     * Trabalho de /api/files executado por runDeferred(), um de cada tipo por vez
+     *
+     * A task monta a resposta e a entrega com finish(); a DeferredResponse da
+     * requisição a recolhe com take(). Se a conexão cair antes, release()
+     * descarta a resposta (ou a task o faz ao terminar).
+     */
+    class DeferredJob
+    {
+    public:
+        bool busy() const { return _state != IDLE; }
+
+        // Reserva o trabalho antes do runDeferred(); cancel() o devolve se a task não foi criada
+        bool claim()
+        {
+            portENTER_CRITICAL(&jobLock);
+            bool idle = _state == IDLE;
+            if (idle)
+            {
+                _state = RUNNING;
+            }
+            portEXIT_CRITICAL(&jobLock);
+            return idle;
+        }
+
+        void cancel() { _state = IDLE; }
+
+        void finish(AsyncWebServerResponse *response)
+        {
+            portENTER_CRITICAL(&jobLock);
+            bool orphaned = _state == ORPHANED;
+            _response = orphaned ? nullptr : response;
+            _state = orphaned ? IDLE : READY;
+            portEXIT_CRITICAL(&jobLock);
+
+            if (orphaned)
+            {
+                delete response;
+            }
+        }
+
+        AsyncWebServerResponse *take()
+        {
+            AsyncWebServerResponse *response = nullptr;
+            portENTER_CRITICAL(&jobLock);
+            if (_state == READY)
+            {
+                response = _response;
+                _response = nullptr;
+                _state = IDLE;
+            }
+            portEXIT_CRITICAL(&jobLock);
+            return response;
+        }
+
+        void release()
+        {
+            AsyncWebServerResponse *response = nullptr;
+            portENTER_CRITICAL(&jobLock);
+            if (_state == RUNNING)
+            {
+                _state = ORPHANED;
+            }
+            else if (_state == READY)
+            {
+                response = _response;
+                _response = nullptr;
+                _state = IDLE;
+            }
+            portEXIT_CRITICAL(&jobLock);
+            delete response;
+        }
+
+    private:
+        enum State
+        {
+            IDLE,    ///< Livre
+            RUNNING, ///< Task em execução, requisição aguardando
+            READY,   ///< Resposta pronta para take()
+            ORPHANED ///< Task em execução, requisição encerrada
+        };
+
+        volatile State _state = IDLE;
+        AsyncWebServerResponse *_response = nullptr;
+    };
+
+    DeferredJob manifestJob;
+    DeferredJob applyJob;
+    bool filesApplying = false; ///< O patch de _filesRequest está em applyJob
+
+    /**
+     * Resposta que só começa quando o DeferredJob termina: o AsyncTCP chama
+     * _ack() a cada poll da conexão e a resposta real, com o código final, é
+     * enviada a partir daí
+     */
+    class DeferredResponse : public AsyncWebServerResponse
+    {
+    public:
+        explicit DeferredResponse(DeferredJob &job) : _job(job), _response(nullptr) {}
+
+        ~DeferredResponse() override
+        {
+            if (_response == nullptr)
+            {
+                _job.release();
+            }
+            delete _response;
+        }
+
+        bool _started() const override { return true; }
+        bool _finished() const override { return _response != nullptr && _response->_finished(); }
+        bool _failed() const override { return _response != nullptr && _response->_failed(); }
+        bool _sourceValid() const override { return true; }
+
+        void _respond(AsyncWebServerRequest *request) override { _ack(request, 0, 0); }
+
+        size_t _ack(AsyncWebServerRequest *request, size_t len, uint32_t time) override
+        {
+            if (_response == nullptr)
+            {
+                _response = _job.take();
+                if (_response != nullptr)
+                {
+                    _response->_respond(request);
+                }
+                return 0;
+            }
+            return _response->_ack(request, len, time);
+        }
+
+    private:
+        DeferredJob &_job;
+        AsyncWebServerResponse *_response;
+    };
+}
+
+// ============ CICLO DE VIDA ============
+
+void OTAPushUpdateManager::run(uint32_t stackSize, UBaseType_t priority, BaseType_t)
+{
+    _taskStackSize = stackSize;
+    _taskPriority = priority;
+
+    // O relógio é sincronizado pelo OTATime (SNTP do sistema, iniciado em begin())
+    LOG_INFO("✅ Servidor assíncrono ativo - requisições atendidas pela task do AsyncTCP");
+}
+
+void OTAPushUpdateManager::stop()
+{
+    if (_server && _running)
+    {
+        // Os clientes de eventos e do WebSocket não passam pelo socket de escuta: fecha-os aqui
+        _events->close();
+        _ws->closeAll();
+        _server->end();
+        _running = false;
+        LOG_INFO("🛑 Servidor assíncrono parado");
+    }
+}
+
+void OTAPushUpdateManager::handleClient()
+{
+    // Nada a fazer: o AsyncTCP entrega as requisições por eventos
+}
+
+void OTAPushUpdateManager::startServer(uint16_t port)
+{
+    if (_server != nullptr)
+    {
+        // Reinício após stop(): as rotas, o AsyncEventSource e o AsyncWebSocket da primeira
+        // inicialização continuam registrados e são reaproveitados, como no backend síncrono
+        if (_username != "" && _password != "")
+        {
+            _events->setAuthentication(_username.c_str(), _password.c_str());
+            _ws->setAuthentication(_username.c_str(), _password.c_str());
+        }
+        _wsClientId = 0;
+        _server->begin();
+        return;
+    }
+
+    _server = new AsyncWebServer(port);
+
+    // Eventos de progresso e telemetria
+    _events = new AsyncEventSource("/api/events");
+    if (_username != "" && _password != "")
+    {
+        _events->setAuthentication(_username.c_str(), _password.c_str());
+    }
+    _events->onConnect([](AsyncEventSourceClient *client)
+                       {
+        if (_events->count() > OTA_EVENTS_MAX_CLIENTS)
+        {
+            LOG_WARN("⚠️  Limite de %d clientes de eventos atingido", OTA_EVENTS_MAX_CLIENTS);
+            client->close();
+            return;
+        }
+        client->send("", nullptr, OTAClock::millis(), 3000); // Intervalo de reconexão do navegador
+    });
+    _server->addHandler(_events);
+
+    // Upload por WebSocket (protocolo em OTAPushUploadSession.cpp)
+    _ws = new AsyncWebSocket("/api/ws/upload");
+    _wsClientId = 0;
+    if (_username != "" && _password != "")
+    {
+        _ws->setAuthentication(_username.c_str(), _password.c_str());
+    }
+    _ws->onEvent(handleWsEvent);
+    _server->addHandler(_ws);
+
+    // Configura endpoints
+    for (size_t i = 0; i < _assetCount; i++)
+    {
+        const OTAAsset *asset = _assets[i];
+        _server->on(asset->path, HTTP_GET, timed(OTAMetrics::ROUTE_ASSET, [asset](AsyncWebServerRequest *request)
+                                                 { handleAsset(request, *asset); }));
+    }
+
+    // Página única: as rotas das telas entregam o mesmo documento
+    _server->on("/", HTTP_GET, timed(OTAMetrics::ROUTE_PAGE, handleApp));
+    _server->on("/update", HTTP_GET, timed(OTAMetrics::ROUTE_PAGE, handleApp));
+    _server->on("/system", HTTP_GET, timed(OTAMetrics::ROUTE_PAGE, handleApp));
+
+    _server->on("/api/status", HTTP_GET, timed(OTAMetrics::ROUTE_API_STATUS, [](AsyncWebServerRequest *request)
+                                               { if (checkAuthentication(request)) sendJson(request, writeStatusJson); }));
+    _server->on("/api/system", HTTP_GET, timed(OTAMetrics::ROUTE_API_SYSTEM, [](AsyncWebServerRequest *request)
+                                               { if (checkAuthentication(request)) sendJson(request, writeSystemJson); }));
+    _server->on("/api/ota", HTTP_GET, timed(OTAMetrics::ROUTE_API_OTA, [](AsyncWebServerRequest *request)
+                                            { if (checkAuthentication(request)) sendJson(request, writeOtaJson); }));
+    _server->on("/metrics", HTTP_GET, timed(OTAMetrics::ROUTE_METRICS, handleMetrics));
+#if OTA_TRACE_ENABLED
+    _server->on("/api/trace", HTTP_GET, [](AsyncWebServerRequest *request)
+                { if (checkAuthentication(request)) sendJson(request, OTATrace::writeJson); });
+    _server->on("/api/trace", HTTP_DELETE, [](AsyncWebServerRequest *request)
+                { if (checkAuthentication(request)) { OTATrace::clear(); request->send(204); } });
+#endif
+#if OTA_LOG_DEFERRED
+    _server->on("/api/log", HTTP_GET, handleLog);
+#endif
+
+    _server->on("/doUpdate", HTTP_POST, timed(OTAMetrics::ROUTE_DO_UPDATE, handleDoUpdate), handleDoUpload);
+    _server->on("/api/firmware", HTTP_PUT, timed(OTAMetrics::ROUTE_API_FIRMWARE, handleFirmware), nullptr,
+                handleFirmwareBody);
+
+    // Upload retomável (OTAPushUploadSession.cpp)
+    _server->on("/api/upload", HTTP_POST, timed(OTAMetrics::ROUTE_API_UPLOAD, [](AsyncWebServerRequest *request)
+                                                {
+        if (!checkAuthentication(request))
+            return;
+        sessionCreate(strtoul(request->arg("size").c_str(), nullptr, 10), request->arg("md5"));
+        sendJson(request, writeSessionJson, _sessionStatusCode);
+        sessionResponseReset(); }));
+    _server->on("/api/upload", HTTP_GET, timed(OTAMetrics::ROUTE_API_UPLOAD, [](AsyncWebServerRequest *request)
+                                               {
+        if (!checkAuthentication(request))
+            return;
+        sessionQuery(request->arg("session"));
+        sendJson(request, writeSessionJson, _sessionStatusCode);
+        sessionResponseReset(); }));
+    _server->on("/api/upload", HTTP_DELETE, timed(OTAMetrics::ROUTE_API_UPLOAD, [](AsyncWebServerRequest *request)
+                                                  {
+        if (!checkAuthentication(request))
+            return;
+        sessionCancel(request->arg("session"));
+        sendJson(request, writeSessionJson, _sessionStatusCode);
+        sessionResponseReset(); }));
+    _server->on("/api/upload", HTTP_PUT, timed(OTAMetrics::ROUTE_API_UPLOAD, handleSessionChunk), nullptr,
+                handleSessionChunkBody);
+
+    // Sincronização de arquivos do LittleFS (OTAPushFileSync.cpp)
+    _server->on("/api/files", HTTP_GET, timed(OTAMetrics::ROUTE_API_FILES, handleFilesManifest));
+    _server->on("/api/files", HTTP_PUT, timed(OTAMetrics::ROUTE_API_FILES, handleFiles), nullptr, handleFilesBody);
+    _server->on("/check-updates", HTTP_GET, timed(OTAMetrics::ROUTE_CHECK_UPDATES, handleCheckUpdates));
+    _server->on("/perform-update", HTTP_GET, timed(OTAMetrics::ROUTE_PERFORM_UPDATE, handlePerformUpdate));
+
+    _server->onNotFound([](AsyncWebServerRequest *request)
+                        { request->send(404, "text/plain", "Not found"); });
+
+    OTAEvents::setSink(sendEvent);
+
+    // A telemetria é periódica: uma task leve a publica enquanto houver páginas inscritas
+    static TaskHandle_t eventsTask = nullptr;
+    if (eventsTask == nullptr)
+    {
+        OTATasks::create(eventsTaskFunction, "OTAEventsTask", OTA_EVENTS_TASK_STACK, nullptr, 1, &eventsTask,
+                         OTA_WEB_TASK_CORE);
+    }
+
+    // Inicia servidor
+    _server->begin();
+
+    // A task do AsyncTCP (criada no begin) atende as requisições: acompanha também
+    OTATasks::track("async_tcp", xTaskGetHandle("async_tcp"), 0);
+}
+
+void OTAPushUpdateManager::eventsTaskFunction(void *)
+{
+    while (true)
+    {
+        OTAEvents::loop();
+        OTAClock::delay(OTA_EVENTS_TELEMETRY_INTERVAL_MS);
+    }
+}
+
+void OTAPushUpdateManager::sendEvent(const char *event, const char *data)
+{
+    if (_events == nullptr || _events->count() == 0)
+    {
+        return;
+    }
+
+    _events->send(data, event, OTAClock::millis());
+}
+
+void OTAPushUpdateManager::handleWsEvent(AsyncWebSocket *, AsyncWebSocketClient *client, AwsEventType type,
+                                         void *arg, uint8_t *data, size_t len)
+{
+    if (type == WS_EVT_CONNECT)
+    {
+        // Um upload por vez: o primeiro cliente é o dono
+        if (_wsClientId != 0)
+        {
+            client->close(1008, "Another WebSocket upload is active");
+            return;
+        }
+        _wsClientId = client->id();
+        _wsSession = false;
+        LOG_INFO("🔌 Cliente WebSocket de upload conectado");
+        return;
+    }
+
+    if (client->id() != _wsClientId)
+    {
+        return;
+    }
+
+    if (type == WS_EVT_DISCONNECT)
+    {
+        // A sessão continua válida: o cliente pode retomá-la
+        _wsClientId = 0;
+        _wsSession = false;
+        return;
+    }
+
+    if (type != WS_EVT_DATA)
+    {
+        return;
+    }
+
+    AwsFrameInfo *info = static_cast<AwsFrameInfo *>(arg);
+
+    if (info->opcode == WS_TEXT || (info->opcode == WS_CONTINUATION && info->message_opcode == WS_TEXT))
+    {
+        // Comandos são curtos: fecha com 1009 (mensagem grande demais) em vez de cortar
+        if (info->len > 64)
+        {
+            LOG_WARN("⚠️  Comando WebSocket maior que 64 bytes");
+            client->close(1009, "Message too big");
+            return;
+        }
+
+        // Chegam num único frame
+        if (info->final && info->index == 0 && info->len == len)
+        {
+            client->text(wsCommand(reinterpret_cast<const char *>(data), len));
+        }
+        return;
+    }
+
+    wsBinary(data, len);
+
+    // Confirma só depois que o frame inteiro foi gravado na flash
+    if (info->final && info->index + len == info->len)
+    {
+        bool restart = (_wsSession && _sessionState == SESSION_DONE);
+        client->text(wsBinaryEnd());
+
+        if (restart)
+        {
+            runDeferred([]()
+                        {
+                OTAClock::delay(2000); // Tempo para a resposta chegar ao cliente
+                ESP.restart(); }, "OTARestart");
+        }
+    }
+}
+
+bool OTAPushUpdateManager::runDeferred(void (*job)(), const char *name)
+{
+    BaseType_t result = OTATasks::create(
+        [](void *parameter)
+        {
+            reinterpret_cast<void (*)()>(parameter)();
+            OTATasks::exitCurrent();
+        },
+        name,                          // Nome da task
+        OTA_DEFERRED_TASK_STACK,       // Stack size
+        reinterpret_cast<void *>(job), // Parâmetros
+        1,                             // Prioridade (baixa)
+        nullptr,
+        OTA_WEB_TASK_CORE);
+
+    if (result != pdPASS)
+    {
+        LOG_ERROR("❌ Falha ao criar task %s", name);
+        return false;
+    }
+    return true;
+}
+
+// ============ HANDLERS DO SERVIDOR WEB ============
+
+bool OTAPushUpdateManager::checkAuthentication(AsyncWebServerRequest *request)
+{
+    if (_username == "" || _password == "")
+    {
+        return true;
+    }
+
+    if (request->authenticate(_username.c_str(), _password.c_str()))
+    {
+        _authenticated = true;
+        return true;
+    }
+
+    request->requestAuthentication(nullptr, false); // Basic, como no backend síncrono
+    return false;
+}
+
+void OTAPushUpdateManager::sendJson(AsyncWebServerRequest *request, void (*writer)(OTAJsonWriter &json), int code)
+{
+    OTA_TRACE_SCOPE("web.sendJson");
+    request->send(jsonResponse(writer, code));
+}
+
+void OTAPushUpdateManager::handleMetrics(AsyncWebServerRequest *request)
+{
+    if (!checkAuthentication(request))
+        return;
+
+    AsyncResponseStream *response = request->beginResponseStream("text/plain; version=0.0.4", OTA_METRICS_BUFFER);
+    response->addHeader("Cache-Control", "no-store");
+    OTAMetrics::write(*response);
+    request->send(response);
+}
+
+#if OTA_LOG_DEFERRED
+void OTAPushUpdateManager::handleLog(AsyncWebServerRequest *request)
+{
+    if (!checkAuthentication(request))
+        return;
+
+    AsyncResponseStream *response = request->beginResponseStream("text/plain; charset=utf-8", OTA_LOG_TAIL);
+    response->addHeader("Cache-Control", "no-store");
+    OTALog::writeTail(*response);
+    request->send(response);
+}
+#endif
+
+void OTAPushUpdateManager::handleAsset(AsyncWebServerRequest *request, const OTAAsset &asset)
+{
+    OTA_TRACE_SCOPE("web.asset");
+
+    bool versioned = request->hasParam("v") && request->getParam("v")->value() == asset.version;
+    AsyncWebServerResponse *response;
+
+    // O navegador já tem esta versão: responde sem corpo
+    if (request->hasHeader("If-None-Match") &&
+        request->getHeader("If-None-Match")->value().indexOf(asset.etag) >= 0)
+    {
+        LOG_DEBUG("Arquivo %s não modificado (304)", asset.path);
+        response = request->beginResponse(304);
+    }
+    else
+    {
+        LOG_DEBUG("Enviando %s (%u bytes)", asset.path, (unsigned)asset.size);
+        response = request->beginResponse_P(200, asset.contentType, asset.data, asset.size);
+        if (asset.gzip)
+        {
+            response->addHeader("Content-Encoding", "gzip");
+        }
+    }
+
+    response->addHeader("ETag", asset.etag);
+    response->addHeader("Cache-Control", assetCacheControl(versioned));
+    request->send(response);
+}
+
+void OTAPushUpdateManager::handleApp(AsyncWebServerRequest *request)
+{
+    if (!checkAuthentication(request))
+        return;
+
+    handleAsset(request, _appAsset);
+}
+
+void OTAPushUpdateManager::handleDoUpload(AsyncWebServerRequest *request, const String &filename,
+                                          size_t index, uint8_t *data, size_t len, bool final)
+{
+    OTA_TRACE_SCOPE("push.doUpload");
+
+    if (index == 0)
+    {
+        // Sem credenciais válidas os dados são descartados; handleDoUpdate responde 401
+        if (_username != "" && _password != "" &&
+            !request->authenticate(_username.c_str(), _password.c_str()))
+        {
+            return;
+        }
+
+        if (_uploadRequest != nullptr)
+        {
+            LOG_WARN("⚠️  Upload recusado: outro upload já está em andamento");
+            return;
+        }
+
+        _uploadRequest = request;
+        request->onDisconnect([request]()
+                              {
+            // Conexão caiu antes da resposta final: descarta o que foi gravado
+            if (_uploadRequest == request)
+            {
+                uploadAbort();
+                _uploadRequest = nullptr;
+            } });
+
+        uploadBegin(filename, UPDATE_SIZE_UNKNOWN, request->contentLength());
+    }
+
+    if (_uploadRequest != request)
+    {
+        return;
+    }
+
+    if (len > 0)
+    {
+        uploadWrite(data, len);
+    }
+
+    if (final)
+    {
+        uploadEnd();
+    }
+}
+
+void OTAPushUpdateManager::handleDoUpdate(AsyncWebServerRequest *request)
+{
+    if (!checkAuthentication(request))
+        return;
+
+    if (_uploadRequest != nullptr && _uploadRequest != request)
+    {
+        request->send(409, "text/plain", "Error: Another upload is in progress");
+        return;
+    }
+
+    // Resposta final do upload, preparada por uploadBegin()/uploadEnd()
+    _uploadRequest = nullptr;
+    bool restart = (_uploadStatusCode == 200);
+    request->send(_uploadStatusCode, "text/plain", _uploadMessage);
+    uploadReset();
+
+    if (restart)
+    {
+        runDeferred([]()
+                    {
+            OTAClock::delay(2000); // Tempo para a resposta chegar ao navegador
+            ESP.restart(); }, "OTARestart");
+    }
+}
+
+void OTAPushUpdateManager::handleFirmwareBody(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+                                              size_t index, size_t total)
+{
+    OTA_TRACE_SCOPE("push.firmwareBody");
+
+    if (index == 0)
+    {
+        // Sem credenciais válidas os dados são descartados; handleFirmware responde 401
+        if (_username != "" && _password != "" &&
+            !request->authenticate(_username.c_str(), _password.c_str()))
+        {
+            return;
+        }
+
+        if (_uploadRequest != nullptr)
+        {
+            LOG_WARN("⚠️  Upload recusado: outro upload já está em andamento");
+            return;
+        }
+
+        _uploadRequest = request;
+        request->onDisconnect([request]()
+                              {
+            // Conexão caiu antes da resposta final: descarta o que foi gravado
+            if (_uploadRequest == request)
+            {
+                uploadAbort();
+                _uploadRequest = nullptr;
+            } });
+
+        // Content-Length conhecido: o Update já reserva e valida o tamanho da imagem
+        if (uploadBegin("", total) && request->hasHeader("X-MD5"))
+        {
+            uploadExpectMD5(request->getHeader("X-MD5")->value());
+        }
+    }
+
+    if (_uploadRequest != request)
+    {
+        return;
+    }
+
+    // Cada segmento TCP recebido é gravado diretamente, sem cópia intermediária
+    if (len > 0)
+    {
+        uploadWrite(data, len);
+    }
+
+    if (index + len >= total)
+    {
+        uploadEnd();
+    }
+}
+
+void OTAPushUpdateManager::handleFirmware(AsyncWebServerRequest *request)
+{
+    if (!checkAuthentication(request))
+        return;
+
+    if (_uploadRequest != nullptr && _uploadRequest != request)
+    {
+        sendJson(request, [](OTAJsonWriter &json)
+                 { json.beginObject().add("status", "error").add("message", "Another upload is in progress").endObject(); },
+                 409);
+        return;
+    }
+
+    // Resposta final do upload, preparada por uploadBegin()/uploadEnd()
+    _uploadRequest = nullptr;
+    bool restart = (_uploadStatusCode == 200);
+    sendJson(request, writeUploadJson, _uploadStatusCode);
+    uploadReset();
+
+    if (restart)
+    {
+        runDeferred([]()
+                    {
+            OTAClock::delay(2000); // Tempo para a resposta chegar ao navegador
+            ESP.restart(); }, "OTARestart");
+    }
+}
+
+void OTAPushUpdateManager::handleSessionChunkBody(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+                                                  size_t index, size_t total)
+{
+    OTA_TRACE_SCOPE("push.chunkBody");
+
+    if (index == 0)
+    {
+        // Sem credenciais válidas os dados são descartados; handleSessionChunk responde 401
+        if (_username != "" && _password != "" &&
+            !request->authenticate(_username.c_str(), _password.c_str()))
+        {
+            return;
+        }
+
+        // Um bloco por vez; handleSessionChunk responde 409 às demais requisições
+        if (_chunkRequest != nullptr)
+        {
+            return;
+        }
+
+        String crc = request->hasHeader("X-CRC32") ? request->getHeader("X-CRC32")->value() : String();
+        if (!sessionChunkBegin(request->arg("session"), strtoul(request->arg("offset").c_str(), nullptr, 10),
+                               total, crc))
+        {
+            return;
+        }
+
+        _chunkRequest = request;
+        request->onDisconnect([request]()
+                              {
+            // Conexão caiu no meio do bloco: descarta só o bloco, a sessão continua
+            if (_chunkRequest == request)
+            {
+                sessionChunkAbort();
+                _chunkRequest = nullptr;
+            } });
+    }
+
+    if (_chunkRequest != request)
+    {
+        return;
+    }
+
+    sessionChunkData(data, len);
+
+    if (index + len >= total)
+    {
+        sessionChunkEnd();
+    }
+}
+
+void OTAPushUpdateManager::handleSessionChunk(AsyncWebServerRequest *request)
+{
+    if (!checkAuthentication(request))
+        return;
+
+    if (_chunkRequest != nullptr && _chunkRequest != request)
+    {
+        sendJson(request, [](OTAJsonWriter &json)
+                 { json.beginObject().add("state", "receiving").add("message", "Another chunk is in progress").endObject(); },
+                 409);
+        return;
+    }
+
+    _chunkRequest = nullptr;
+    bool restart = (_sessionState == SESSION_DONE && _sessionStatusCode == 200);
+    sendJson(request, writeSessionJson, _sessionStatusCode);
+    sessionResponseReset();
+
+    if (restart)
+    {
+        runDeferred([]()
+                    {
+            OTAClock::delay(2000); // Tempo para a resposta chegar ao cliente
+            ESP.restart(); }, "OTARestart");
+    }
+}
+
+void OTAPushUpdateManager::handleFilesManifest(AsyncWebServerRequest *request)
+{
+    if (!checkAuthentication(request))
+        return;
+
+    // O manifesto lê e calcula o MD5 de cada arquivo: roda numa task própria e a resposta sai quando termina
+    if (!manifestJob.claim())
+    {
+        sendJson(request, writeFilesBusy, 503);
+        return;
+    }
+    if (!runDeferred([]()
+                     {
+        AsyncWebServerResponse *response;
+        if (OTAFileSync::lock(OTA_FILESYNC_LOCK_TIMEOUT_MS))
+        {
+            AsyncResponseStream *stream = new AsyncResponseStream("text/plain", 1460);
+            stream->addHeader("Cache-Control", "no-store");
+            stream->addHeader("X-Files-Revision", OTAFileSync::getRevision());
+            OTAFileSync::writeManifest(*stream);
+            OTAFileSync::unlock();
+            response = stream;
+        }
+        else
+        {
+            response = jsonResponse(writeFilesBusy, 503);
+        }
+        manifestJob.finish(response); }, "OTAManifest"))
+    {
+        manifestJob.cancel();
+        sendJson(request, writeFilesBusy, 503);
+        return;
+    }
+    request->send(new DeferredResponse(manifestJob));
+}
+
+void OTAPushUpdateManager::handleFilesBody(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+                                           size_t index, size_t total)
+{
+    OTA_TRACE_SCOPE("push.filesBody");
+
+    if (index == 0)
+    {
+        // Sem credenciais válidas os dados são descartados; handleFiles responde 401
+        if (_username != "" && _password != "" &&
+            !request->authenticate(_username.c_str(), _password.c_str()))
+        {
+            return;
+        }
+
+        // Um patch por vez; handleFiles responde 409 às demais requisições
+        if (_filesRequest != nullptr || applyJob.busy())
+        {
+            return;
+        }
+
+        _filesRequest = request;
+        request->onDisconnect([request]()
+                              {
+            // Conexão caiu antes da resposta final: descarta a preparação (ou a resposta da aplicação)
+            if (_filesRequest == request)
+            {
+                if (filesApplying)
+                {
+                    applyJob.release();
+                    filesApplying = false;
+                }
+                else
+                {
+                    filesAbort();
+                }
+                _filesRequest = nullptr;
+            } });
+
+        filesBegin(total);
+    }
+
+    if (_filesRequest != request)
+    {
+        return;
+    }
+
+    if (len > 0)
+    {
+        filesWrite(data, len);
+    }
+
+    // Aplicar o patch troca os arquivos um a um: roda numa task própria e handleFiles responde quando termina
+    if (index + len >= total && !_filesFailed)
+    {
+        if (!applyJob.claim())
+        {
+            filesFail(503, "File system busy, retry");
+            return;
+        }
+        if (!runDeferred([]()
+                         {
+            filesEnd();
+            AsyncWebServerResponse *response = jsonResponse(writeFilesJson, _filesStatusCode);
+            filesReset();
+            applyJob.finish(response); }, "OTAFilesApply"))
+        {
+            applyJob.cancel();
+            filesFail(503, "File system busy, retry");
+            return;
+        }
+        filesApplying = true;
+    }
+}
+
+void OTAPushUpdateManager::handleFiles(AsyncWebServerRequest *request)
+{
+    if (!checkAuthentication(request))
+        return;
+
+    if (_filesRequest != request && (_filesRequest != nullptr || applyJob.busy()))
+    {
+        sendJson(request, [](OTAJsonWriter &json)
+                 { json.beginObject().add("status", "error").add("message", "Another patch is in progress").endObject(); },
+                 409);
+        return;
+    }
+
+    _filesRequest = nullptr;
+    if (filesApplying)
+    {
+        // A resposta sai quando a task da aplicação terminar; os arquivos valem sem reiniciar
+        filesApplying = false;
+        request->send(new DeferredResponse(applyJob));
+        return;
+    }
+
+    // Resposta preparada por filesBegin()/filesWrite() (erro antes da aplicação)
+    sendJson(request, writeFilesJson, _filesStatusCode);
+    filesReset();
+}
+
+void OTAPushUpdateManager::handleCheckUpdates(AsyncWebServerRequest *request)
+{
+    if (!checkAuthentication(request))
+        return;
+
+    // A consulta ao servidor é bloqueante: roda fora da task do AsyncTCP
+    runDeferred([]()
+                { OTAManager::checkForUpdates(); }, "OTACheck");
+
+    request->send(202, "application/json",
+                  "{\"status\":\"pending\", \"message\":\"🔍 Verificação de atualizações iniciada\"}");
+}
+
+void OTAPushUpdateManager::handlePerformUpdate(AsyncWebServerRequest *request)
+{
+    if (!checkAuthentication(request))
+        return;
+
+    if (OTAManager::isUpdateAvailable())
+    {
+        request->send(200, "application/json",
+                      "{\"status\":\"success\", \"message\":\"Iniciando atualização...\"}");
+
+        runDeferred([]()
+                    {
+            OTAClock::delay(1000); // Pequeno delay para enviar a resposta antes de reiniciar
+            OTAManager::performUpdate(); }, "OTAPerform");
+    }
+    else
+    {
+        request->send(400, "application/json",
+                      "{\"status\":\"error\", \"message\":\"Nenhuma atualização disponível\"}");
+    }
+}
+
+#endif // OTA_ASYNC_WEBSERVER
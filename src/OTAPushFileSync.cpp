@@ -0,0 +1,165 @@
+/**
+ * @file OTAPushFileSync.cpp
+ * @brief Sincronização de arquivos do LittleFS (/api/files), comum aos dois backends
+ *
+ * Protocolo (formatos em OTAFileSync.h):
+ *  1. GET /api/files  -> manifesto dos arquivos (X-Files-Revision: revisão atual)
+ *  2. PUT /api/files  -> patch com os arquivos novos ou alterados e os apagados
+ *
+ * O cliente (tools/ota_push.py sync) compara o manifesto com a pasta
+ * local e envia só a diferença. O patch é aplicado sem reiniciar.
+ */
+
+#include "OTAPushUpdateManager.h"
+#include "OTAFileSync.h"
+#include "OTASession.h"
+
+// ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
+
+int OTAPushUpdateManager::_filesStatusCode = 400;
+const char *OTAPushUpdateManager::_filesMessage = "No patch received";
+OTASession::Token OTAPushUpdateManager::_filesToken = 0;
+bool OTAPushUpdateManager::_filesFailed = false;
+
+// ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
+
+bool OTAPushUpdateManager::filesBegin(size_t size)
+{
+    filesReset();
+    LOG_INFO("🗂️ Recebendo patch de arquivos: %u bytes", (unsigned)size);
+
+    // O LittleFS também é gravado pelos pacotes do Pull: um de cada vez
+    bool pending;
+    _filesToken = pushAcquire(pending);
+    if (_filesToken == 0)
+    {
+        filesFail(pending ? 503 : 409, pending ? "Preempting the running update, retry" : "Another update is in progress");
+        return false;
+    }
+
+    // O servidor web não espera indefinidamente por um manifesto ou revisão lidos em outra task
+    if (!OTAFileSync::lock(OTA_FILESYNC_LOCK_TIMEOUT_MS))
+    {
+        filesFail(503, "File system busy, retry");
+        return false;
+    }
+    bool begun = OTAFileSync::begin(size);
+    OTAFileSync::unlock();
+
+    if (!begun)
+    {
+        filesFail(OTAFileSync::getError() == OTAFileSync::ERROR_SPACE ? 507 : 400, OTAFileSync::errorString());
+        return false;
+    }
+    return true;
+}
+
+bool OTAPushUpdateManager::filesWrite(const uint8_t *data, size_t length)
+{
+    if (_filesFailed)
+    {
+        return false;
+    }
+
+    if (!OTASession::isValid(_filesToken))
+    {
+        LOG_WARN("⚡ Patch de arquivos interrompido: o Pull tem prioridade");
+        filesFail(409, "Update preempted by pull");
+        return false;
+    }
+
+    if (!OTAFileSync::lock(OTA_FILESYNC_LOCK_TIMEOUT_MS))
+    {
+        filesFail(503, "File system busy, retry");
+        return false;
+    }
+    bool written = OTAFileSync::write(data, length);
+    OTAFileSync::unlock();
+
+    if (!written)
+    {
+        filesFail(OTAFileSync::getError() == OTAFileSync::ERROR_WRITE ? 500 : 400, OTAFileSync::errorString());
+        return false;
+    }
+    return true;
+}
+
+bool OTAPushUpdateManager::filesEnd()
+{
+    if (_filesFailed)
+    {
+        return false;
+    }
+
+    if (!OTAFileSync::lock(OTA_FILESYNC_LOCK_TIMEOUT_MS))
+    {
+        filesFail(503, "File system busy, retry");
+        return false;
+    }
+    bool ended = OTAFileSync::end();
+    OTAFileSync::unlock();
+
+    if (!ended)
+    {
+        OTAFileSync::Error error = OTAFileSync::getError();
+        filesFail(error == OTAFileSync::ERROR_APPLY || error == OTAFileSync::ERROR_WRITE ? 500 : 400,
+                  OTAFileSync::errorString());
+        return false;
+    }
+
+    _filesStatusCode = 200;
+    _filesMessage = "Files synchronized";
+    OTASession::release(_filesToken);
+    _filesToken = 0;
+    return true;
+}
+
+void OTAPushUpdateManager::filesAbort()
+{
+    if (_filesFailed || _filesToken == 0)
+    {
+        return;
+    }
+
+    LOG_WARN("⚠️  Patch de arquivos interrompido");
+    filesFail(500, "Upload aborted");
+}
+
+void OTAPushUpdateManager::filesFail(int code, const char *message)
+{
+    _filesStatusCode = code;
+    _filesMessage = message;
+    _filesFailed = true;
+
+    // Só descarta a preparação enquanto o LittleFS é nosso: revogada a sessão, o patch do Pull
+    // descarta a nossa. Sem o LittleFS a tempo, ela fica para o próximo patch ou o boot
+    if (OTASession::isValid(_filesToken) && OTAFileSync::lock(OTA_FILESYNC_LOCK_TIMEOUT_MS))
+    {
+        OTAFileSync::abort();
+        OTAFileSync::unlock();
+    }
+    OTASession::release(_filesToken);
+    _filesToken = 0;
+}
+
+void OTAPushUpdateManager::filesReset()
+{
+    _filesFailed = false;
+    _filesStatusCode = 400;
+    _filesMessage = "No patch received";
+}
+
+void OTAPushUpdateManager::writeFilesJson(OTAJsonWriter &json)
+{
+    json.beginObject();
+    json.add("status", _filesStatusCode == 200 ? "success" : "error");
+    json.add("message", _filesMessage);
+    if (_filesStatusCode == 200)
+    {
+        json.add("written", (unsigned int)OTAFileSync::filesWritten());
+        json.add("deleted", (unsigned int)OTAFileSync::filesDeleted());
+        json.add("bytes", (unsigned long)OTAFileSync::bytesWritten());
+        json.add("revision", OTAFileSync::getRevision());
+    }
+    json.endObject();
+}
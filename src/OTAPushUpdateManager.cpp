@@ -1,17 +1,20 @@
 #include "OTAPushUpdateManager.h"
+#include "OTAClock.h"
+#include "OTAEvents.h"
 #include "OTAManager.h"
-#include "webPage/css.h"
-#include "webPage/favicon.h"
-#include "webPage/index.h"
-#include "webPage/scripts.h"
-#include "webPage/system.h"
-#include "webPage/update.h"
+#include "OTAMetrics.h"
+#include "OTASession.h"
+#include "OTAStatus.h"
+#include "OTATime.h"
+#include "OTATrace.h"
+#include "webPage/assets.h"
 #include "webPage/updateSection.h"
 
+// Página única, CSS, JS e favicon são servidos a partir de webPage/assets.h,
+// gerado por tools/build_assets.py
+
 // ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
 
-WebServer *OTAPushUpdateManager::_server = nullptr;
-bool OTAPushUpdateManager::_updating = false;
 String OTAPushUpdateManager::_username = "";
 String OTAPushUpdateManager::_password = "";
 bool OTAPushUpdateManager::_authenticated = false;
@@ -28,10 +31,20 @@ bool OTAPushUpdateManager::_taskRunning = false;
 uint32_t OTAPushUpdateManager::_taskStackSize = 8192;
 UBaseType_t OTAPushUpdateManager::_taskPriority = 1;
 
-// NTP Client
-WiFiUDP *OTAPushUpdateManager::_ntpUDP = nullptr;
-NTPClient *OTAPushUpdateManager::_timeClient = nullptr;
-bool OTAPushUpdateManager::_timeSynced = false;
+// Upload
+String OTAPushUpdateManager::_detectedVersion = "";
+String OTAPushUpdateManager::_uploadVersion = "";
+bool OTAPushUpdateManager::_uploadFailed = false;
+int OTAPushUpdateManager::_uploadStatusCode = 400;
+String OTAPushUpdateManager::_uploadMessage = "Error: No firmware received";
+size_t OTAPushUpdateManager::_uploadExpected = 0;
+uint32_t OTAPushUpdateManager::_uploadToken = 0;
+uint32_t OTAPushUpdateManager::_uploadStartMs = 0;
+
+// Arquivos estáticos
+const OTAAsset *const OTAPushUpdateManager::_assets[] = {&assetStyleCss, &assetScriptJs, &assetFaviconIco};
+const size_t OTAPushUpdateManager::_assetCount = sizeof(_assets) / sizeof(_assets[0]);
+const OTAAsset &OTAPushUpdateManager::_appAsset = assetAppHtml;
 
 // static bool (*_pullUpdateAvailableCallback)() = nullptr;
 // static void (*_performUpdateCallback)() = nullptr;
@@ -55,188 +68,23 @@ String OTAPushUpdateManager::getPullUpdateStatus()
     return "disabled";
 }
 
-// ============ IMPLEMENTAÇÃO DOS MÉTODOS FREERTOS ============
-
-void OTAPushUpdateManager::run(uint32_t stackSize, UBaseType_t priority)
-{
-    if (_taskRunning)
-    {
-        LOG_WARN("Thread FreeRTOS já está em execução");
-        return;
-    }
-
-    _taskStackSize = stackSize;
-    _taskPriority = priority;
-
-    // Cria a task FreeRTOS
-    BaseType_t result = xTaskCreate(
-        taskFunction,       // Função da task
-        "WebPageTask",      // Nome da task
-        _taskStackSize,     // Stack size
-        nullptr,            // Parâmetros
-        _taskPriority,      // Prioridade
-        &_webPageTaskHandle // Handle da task
-    );
-
-    if (result == pdPASS)
-    {
-        _taskRunning = true;
-        LOG_INFO("✅ Thread FreeRTOS iniciada (Stack: %u, Priority: %u, Core: %d)",
-                 _taskStackSize, _taskPriority);
-    }
-    else
-    {
-        LOG_ERROR("❌ Falha ao criar thread FreeRTOS");
-        _taskRunning = false;
-    }
-}
-
-void OTAPushUpdateManager::stop()
-{
-    stopTask();
-}
-
-void OTAPushUpdateManager::stopTask()
-{
-    if (!_taskRunning)
-    {
-        return;
-    }
-
-    if (_webPageTaskHandle != nullptr)
-    {
-        _taskRunning = false;
-
-        // Aguarda a task terminar (timeout de 2 segundos)
-        if (xTaskGetCurrentTaskHandle() != _webPageTaskHandle)
-        {
-            // Só deleta se não for a própria task chamando
-            vTaskDelete(_webPageTaskHandle);
-        }
-
-        _webPageTaskHandle = nullptr;
-        LOG_INFO("🛑 Thread FreeRTOS parada");
-    }
-}
-
-void OTAPushUpdateManager::taskFunction(void *parameter)
-{
-    LOG_INFO("🔄 Thread FreeRTOS iniciada");
-
-    while (_taskRunning)
-    {
-        // Processa requisições web
-        if (_server && _running)
-        {
-            _server->handleClient();
-        }
-
-        // Atualiza tempo NTP periodicamente
-        static unsigned long lastTimeUpdate = 0;
-        if (millis() - lastTimeUpdate >= 60000)
-        { // A cada 60 segundos
-            updateTime();
-            lastTimeUpdate = millis();
-        }
-
-        // Pequena pausa para não sobrecarregar a CPU
-        vTaskDelay(pdMS_TO_TICKS(10));
-    }
-
-    LOG_INFO("🔄 Thread FreeRTOS finalizada");
-    vTaskDelete(nullptr);
-}
-
 // ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
 
 void OTAPushUpdateManager::begin(uint16_t port)
 {
-    if (_server == nullptr)
-    {
-        _server = new WebServer(port);
-    }
-
-    // Configura o timezone e servidor NTP do sistema
-    configTime(-3 * 3600, 0, "pool.ntp.org", "time.nist.gov"); // UTC-3 (Brasília)
-
-    // Inicializa NTP Client para uso interno
-    if (_ntpUDP == nullptr)
-    {
-        _ntpUDP = new WiFiUDP();
-        _timeClient = new NTPClient(*_ntpUDP, "pool.ntp.org", -3 * 3600, 60000);
-        _timeClient->begin();
+#if OTA_LOG_DEFERRED
+    OTALog::begin(); // Antes de tudo: os próximos logs já saem pela task
+#endif
 
-        // Força uma atualização inicial
-        if (_timeClient->forceUpdate())
-        {
-            _timeSynced = true;
-            LOG_INFO("NTP Client sincronizado com sucesso");
-        }
-        else
-        {
-            LOG_ERROR("Falha na sincronização NTP inicial");
-        }
-    }
+    // Horário pelo SNTP do sistema (não bloqueia; sincroniza em segundo plano)
+    OTATime::begin();
 
-    // REMOVIDO COMPLETAMENTE: Inicialização do LittleFS e carregamento de templates
-
-    // Configura endpoints
-    _server->on("/favicon.ico", HTTP_GET, []()
-                {
-    LOG_INFO("✅ Favicon solicitado - Enviando imagem PNG (%d bytes)", favicon_ico_size);
-    _server->setContentLength(favicon_ico_size);
-    _server->send(200, "image/png");
-    _server->sendContent_P((const char*)favicon_ico, favicon_ico_size); });
-
-    _server->on("/", HTTP_GET, handleRoot);
-    _server->on("/update", HTTP_GET, handleUpdate);
-    _server->on("/doUpdate", HTTP_POST, []()
-                { OTAPushUpdateManager::_server->send(200, "text/plain", "Upload processed"); }, handleDoUpload);
-    _server->on("/system", HTTP_GET, handleSystemInfo);
-    _server->on("/toggle-theme", HTTP_GET, handleToggleTheme);
-    _server->on("/check-updates", HTTP_GET, []()
-                {
-    if (!checkAuthentication()) {
-        return;
-    }
-    
-    OTAManager::checkForUpdates();
-    String status = "";
-    
-    if (OTAManager::isUpdateAvailable()) {
-        String latestVersion = OTAManager::getLatestVersion();
-        String currentVersion = OTAPullUpdateManager::getCurrentVersion();
-        status = "🎯 Nova versão disponível: v" + latestVersion + " (atual: v" + currentVersion + ")";
-    } else {
-        status = "✅ Firmware está atualizado (v" + OTAPullUpdateManager::getCurrentVersion() + ")";
-    }
-    
-    _server->send(200, "application/json", 
-        "{\"status\":\"success\", \"message\":\"" + status + "\"}"); });
-
-    _server->on("/perform-update", HTTP_GET, []()
-                {
-    if (!checkAuthentication()) {
-        return;
-    }
-    
-    if (OTAManager::isUpdateAvailable()) {
-        _server->send(200, "application/json", 
-            "{\"status\":\"success\", \"message\":\"Iniciando atualização...\"}");
-        
-        // Pequeno delay para enviar a resposta antes de reiniciar
-        delay(1000);
-        OTAManager::performUpdate();
-    } else {
-        _server->send(400, "application/json", 
-            "{\"status\":\"error\", \"message\":\"Nenhuma atualização disponível\"}");
-    } });
-
-    // Inicia servidor
-    _server->begin();
+    // Cria o servidor do backend configurado e registra os endpoints
+    startServer(port);
     _running = true;
 
-    LOG_INFO("Servidor OTA Push inicializado na porta: %d", port);
+    LOG_INFO("Servidor OTA Push inicializado na porta: %d (%s)", port,
+             OTA_ASYNC_WEBSERVER ? "assíncrono" : "síncrono");
 
     if (_mdnsHostname != "")
     {
@@ -250,57 +98,31 @@ void OTAPushUpdateManager::begin(uint16_t port)
 
 void OTAPushUpdateManager::updateTime()
 {
-    if (_timeClient)
-    {
-        _timeClient->update();
-
-        // Sincroniza o tempo interno do sistema quando o NTP estiver atualizado
-        if (!_timeSynced && _timeClient->getEpochTime() > 1600000000)
-        { // Tempo válido (após 2020)
-            timeval tv;
-            tv.tv_sec = _timeClient->getEpochTime();
-            tv.tv_usec = 0;
-            settimeofday(&tv, nullptr);
-            _timeSynced = true;
-            LOG_INFO("Tempo interno do sistema sincronizado com NTP");
-        }
-    }
+    // O OTATime sincroniza sozinho; mantido por compatibilidade
 }
 
 String OTAPushUpdateManager::getCurrentDateTime()
 {
-    // Usa o tempo interno do sistema (que deve estar sincronizado com NTP)
-    time_t now;
+    // Data/hora decomposta em cache: no máximo um localtime_r() por segundo
     struct tm timeinfo;
-
-    time(&now);
-    localtime_r(&now, &timeinfo);
+    OTATime::localTime(timeinfo);
 
     // Mapeamento de meses em português
-    const char *months_Pt_BR[] = {"Jan", "Fev", "Mar", "Abr", "Mai", "Jun",
-                                  "Jul", "Ago", "Set", "Out", "Nov", "Dez"};
-
-    // Extrair componentes da data
-    int day = timeinfo.tm_mday;
-    int month = timeinfo.tm_mon; // 0-11
-    int year = timeinfo.tm_year + 1900;
-    int hour = timeinfo.tm_hour;
-    int min = timeinfo.tm_min;
-    int sec = timeinfo.tm_sec;
+    static const char *const months_Pt_BR[] = {"Jan", "Fev", "Mar", "Abr", "Mai", "Jun",
+                                               "Jul", "Ago", "Set", "Out", "Nov", "Dez"};
 
     // Formatar no estilo DD/MMM/AAAA HH:MM:SS
-    char timeStr[64];
-    snprintf(timeStr, sizeof(timeStr), "%02d/%03s/%04d %02d:%02d:%02d",
-             day, months_Pt_BR[month], year, hour, min, sec);
+    char timeStr[32];
+    snprintf(timeStr, sizeof(timeStr), "%02d/%s/%04d %02d:%02d:%02d",
+             timeinfo.tm_mday, months_Pt_BR[timeinfo.tm_mon], timeinfo.tm_year + 1900,
+             timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
 
     return String(timeStr);
 }
 
 unsigned long OTAPushUpdateManager::getCurrentTimestamp()
 {
-    time_t now;
-    time(&now);
-    return now;
+    return OTAClock::time();
 }
 
 String OTAPushUpdateManager::formatTime(unsigned long rawTime)
@@ -331,31 +153,6 @@ String OTAPushUpdateManager::formatTime(unsigned long rawTime)
     return String(timeStr);
 }
 
-String OTAPushUpdateManager::formatUptime(unsigned long milliseconds)
-{
-    unsigned long seconds = milliseconds / 1000;
-    unsigned long days = seconds / 86400;
-    unsigned long hours = (seconds % 86400) / 3600;
-    unsigned long minutes = (seconds % 3600) / 60;
-    unsigned long secs = seconds % 60;
-
-    char uptimeStr[32];
-    if (days > 0)
-    {
-        snprintf(uptimeStr, sizeof(uptimeStr), "%lud %02luh %02lum %02lus", days, hours, minutes, secs);
-    }
-    else if (hours > 0)
-    {
-        snprintf(uptimeStr, sizeof(uptimeStr), "%02luh %02lum %02lus", hours, minutes, secs);
-    }
-    else
-    {
-        snprintf(uptimeStr, sizeof(uptimeStr), "%02lum %02lus", minutes, secs);
-    }
-
-    return String(uptimeStr);
-}
-
 String OTAPushUpdateManager::formatBuildDate()
 {
     String buildDate = __DATE__; // Formato: "MMM DD YYYY" (ex: "Dec 15 2023")
@@ -413,24 +210,26 @@ void OTAPushUpdateManager::setCredentials(const String &username, const String &
 {
     _username = username;
     _password = password;
-    LOG_DEBUG("Credenciais OTA definidas");
-}
 
-void OTAPushUpdateManager::handleClient()
-{
-    if (_taskRunning)
+#if OTA_ASYNC_WEBSERVER
+    // AsyncEventSource e AsyncWebSocket verificam as credenciais por conta própria
+    if (_events != nullptr)
     {
-        return;
+        _events->setAuthentication(_username.c_str(), _password.c_str());
     }
-    if (_server && _running)
+    if (_ws != nullptr)
     {
-        _server->handleClient();
+        _ws->setAuthentication(_username.c_str(), _password.c_str());
     }
+#endif
+
+    LOG_DEBUG("Credenciais OTA definidas");
 }
 
+
 bool OTAPushUpdateManager::isUpdating()
 {
-    return _updating;
+    return OTAStatus::get().pushUpdating;
 }
 
 bool OTAPushUpdateManager::isRunning()
@@ -450,211 +249,308 @@ String OTAPushUpdateManager::getAccessURL()
     }
 }
 
-// ============ HANDLERS DO SERVIDOR WEB ============
+// ============ UPLOAD DE FIRMWARE (COMUM AOS BACKENDS) ============
 
-bool OTAPushUpdateManager::checkAuthentication()
+bool OTAPushUpdateManager::uploadBegin(const String &filename, size_t size, size_t expected)
 {
-    if (_username == "" || _password == "")
+    uploadReset();
+    _detectedVersion = ""; // Reseta para novo upload
+    _uploadVersion = OTAPullUpdateManager::getCurrentVersion();
+    _uploadExpected = (size != UPDATE_SIZE_UNKNOWN) ? size : expected;
+    _uploadStartMs = OTAClock::millis();
+
+    OTAEvents::progress(OTAEvents::SOURCE_PUSH, OTAEvents::PHASE_START, 0, _uploadExpected);
+
+    LOG_INFO("📤 Iniciando upload OTA: %s", filename.isEmpty() ? "corpo binário (API)" : filename.c_str());
+    if (size != UPDATE_SIZE_UNKNOWN)
     {
-        return true;
+        LOG_INFO("📦 Tamanho do arquivo: %u bytes", size);
     }
 
-    if (_server->authenticate(_username.c_str(), _password.c_str()))
+    // Verifica se é um arquivo .bin (envio direto pela API não tem nome de arquivo)
+    if (!filename.isEmpty() && !filename.endsWith(".bin"))
     {
-        _authenticated = true;
-        return true;
+        LOG_ERROR("❌ Arquivo não é .bin: %s", filename.c_str());
+        _uploadStatusCode = 400;
+        _uploadMessage = "Error: Only .bin files are allowed";
+        _uploadFailed = true;
+        OTAMetrics::failure(OTAEvents::SOURCE_PUSH, OTAMetrics::FAIL_INVALID);
+        OTAEvents::progress(OTAEvents::SOURCE_PUSH, OTAEvents::PHASE_ERROR, 0, 0, _uploadMessage.c_str());
+        return false;
     }
 
-    _server->requestAuthentication();
-    return false;
-}
-
-void OTAPushUpdateManager::handleRoot()
-{
-    if (!checkAuthentication())
-        return;
-
-    // ✅ ALTERADO: Padrão dark quando não há parâmetro
-    String theme = _server->hasArg("theme") ? _server->arg("theme") : "dark";
-    bool darkMode = (theme == "dark");
+    // O Update é compartilhado com o Pull: só grava quem tem a sessão
+    bool pending;
+    _uploadToken = pushAcquire(pending, uploadRevoked);
+    if (_uploadToken == 0)
+    {
+        _uploadStatusCode = pending ? 503 : 409;
+        _uploadMessage = pending ? "Error: Preempting the running update, retry" : "Error: Another update is in progress";
+        _uploadFailed = true;
+        OTAMetrics::failure(OTAEvents::SOURCE_PUSH, OTAMetrics::FAIL_BUSY);
+        OTAEvents::progress(OTAEvents::SOURCE_PUSH, OTAEvents::PHASE_ERROR, 0, 0, _uploadMessage.c_str());
+        return false;
+    }
 
-    String content = getSystemInfoContent();
-    String html = processTemplate(htmlIndex, "ESP32 OTA Update", content, darkMode);
+    if (!Update.begin(size))
+    {
+        LOG_ERROR("❌ Falha ao iniciar update: %s", Update.errorString());
+        _uploadStatusCode = 500;
+        _uploadMessage = "Update begin failed: " + String(Update.errorString());
+        _uploadFailed = true;
+        OTAMetrics::failure(OTAEvents::SOURCE_PUSH, OTAMetrics::FAIL_NO_SPACE);
+        uploadRelease();
+        OTAEvents::progress(OTAEvents::SOURCE_PUSH, OTAEvents::PHASE_ERROR, 0, 0, _uploadMessage.c_str());
+        return false;
+    }
 
-    _server->send(200, "text/html", html);
+    return true;
 }
 
-void OTAPushUpdateManager::handleUpdate()
+bool OTAPushUpdateManager::uploadExpectMD5(const String &md5)
 {
-    if (!checkAuthentication())
-        return;
+    if (_uploadFailed)
+    {
+        return false;
+    }
 
-    // ✅ ALTERADO: Padrão dark quando não há parâmetro
-    String theme = _server->hasArg("theme") ? _server->arg("theme") : "dark";
-    bool darkMode = (theme == "dark");
+    if (md5.length() == 32 && Update.setMD5(md5.c_str()))
+    {
+        LOG_INFO("🔐 MD5 esperado: %s", md5.c_str());
+        return true;
+    }
 
-    String html = processTemplate(htmlUpdate, "Firmware Upload", "", darkMode);
-    _server->send(200, "text/html", html);
+    LOG_ERROR("❌ MD5 inválido: %s", md5.c_str());
+    Update.abort();
+    _uploadStatusCode = 400;
+    _uploadMessage = "Error: Invalid MD5";
+    _uploadFailed = true;
+    OTAMetrics::failure(OTAEvents::SOURCE_PUSH, OTAMetrics::FAIL_INVALID);
+    uploadRelease();
+    OTAEvents::progress(OTAEvents::SOURCE_PUSH, OTAEvents::PHASE_ERROR, 0, 0, _uploadMessage.c_str());
+    return false;
 }
 
-void OTAPushUpdateManager::handleSystemInfo()
+bool OTAPushUpdateManager::uploadWrite(uint8_t *data, size_t length)
 {
-    if (!checkAuthentication())
-        return;
+    if (_uploadFailed || uploadPreempted())
+    {
+        return false;
+    }
 
-    // ✅ ALTERADO: Padrão dark quando não há parâmetro
-    String theme = _server->hasArg("theme") ? _server->arg("theme") : "dark";
-    bool darkMode = (theme == "dark");
+    // Tenta detectar versão durante o upload (apenas uma vez)
+    if (_detectedVersion == "" && Update.progress() + length > 1024)
+    { // Aguarda pelo menos 1KB
+        _detectedVersion = extractVersionFromBinary(data, length);
 
-    String content = getFullSystemInfoContent();
-    String html = processTemplate(htmlSystem, "System Information", content, darkMode);
+        if (_detectedVersion != "unknown")
+        {
+            LOG_INFO("🔍 Versão detectada no upload: %s", _detectedVersion.c_str());
 
-    _server->send(200, "text/html", html);
-}
+            // Compara com versão atual
+            OTAManager::VersionComparison comp = OTAManager::compareVersions(_detectedVersion, _uploadVersion);
 
-void OTAPushUpdateManager::handleToggleTheme()
-{
-    if (!checkAuthentication())
-        return;
+            switch (comp)
+            {
+            case OTAManager::VERSION_NEWER:
+                LOG_INFO("✅ Nova versão mais recente: %s → %s",
+                         _uploadVersion.c_str(), _detectedVersion.c_str());
+                break;
+            case OTAManager::VERSION_EQUAL:
+                LOG_WARN("⚠️  Mesma versão: %s", _uploadVersion.c_str());
+                break;
+            case OTAManager::VERSION_OLDER:
+                LOG_WARN("⚠️  Versão mais antiga: %s ← %s",
+                         _uploadVersion.c_str(), _detectedVersion.c_str());
+                break;
+            }
+        }
+    }
+
+    uint32_t writeStartUs = micros();
+    size_t written;
+    {
+        OTA_TRACE_SCOPE("Update.write");
+        written = Update.write(data, length);
+    }
+    OTAMetrics::flashWrite(micros() - writeStartUs);
 
-    String currentTheme = _server->hasArg("theme") ? _server->arg("theme") : "light";
-    String newTheme = (currentTheme == "light") ? "dark" : "light";
-    String currentPath = _server->hasArg("path") ? _server->arg("path") : "/";
+    if (written != length)
+    {
+        LOG_ERROR("❌ Erro na escrita: %s", Update.errorString());
+        _uploadStatusCode = 500;
+        _uploadMessage = "Update write failed: " + String(Update.errorString());
+        _uploadFailed = true;
+        OTAMetrics::failure(OTAEvents::SOURCE_PUSH, OTAMetrics::FAIL_WRITE);
+        Update.abort();
+        uploadRelease();
+        OTAEvents::progress(OTAEvents::SOURCE_PUSH, OTAEvents::PHASE_ERROR, Update.progress(), _uploadExpected,
+                            _uploadMessage.c_str());
+        return false;
+    }
 
-    _server->sendHeader("Location", currentPath + "?theme=" + newTheme, true);
-    _server->send(302, "text/plain", "");
+    OTAEvents::progress(OTAEvents::SOURCE_PUSH, OTAEvents::PHASE_TRANSFER, Update.progress(), _uploadExpected);
+    return true;
 }
 
-void OTAPushUpdateManager::handleDoUpload()
+bool OTAPushUpdateManager::uploadEnd()
 {
-    if (!checkAuthentication())
-        return;
+    if (_uploadFailed || uploadPreempted())
+    {
+        return false;
+    }
+
+    size_t received = Update.progress();
+    LOG_INFO("📋 Upload finalizado, total: %u bytes", received);
+    OTAEvents::progress(OTAEvents::SOURCE_PUSH, OTAEvents::PHASE_FINALIZE, received, received);
 
-    HTTPUpload &upload = _server->upload();
-    static String detectedVersion = "";
-    static String currentVersion = OTAPullUpdateManager::getCurrentVersion();
+    // Verificação final da versão antes de instalar
+    String versionMessage = "";
 
-    if (upload.status == UPLOAD_FILE_START)
+    if (_detectedVersion != "" && _detectedVersion != "unknown")
     {
-        _updating = true;
-        detectedVersion = ""; // Reseta para novo upload
-        LOG_INFO("📤 Iniciando upload OTA: %s", upload.filename.c_str());
-        LOG_INFO("📦 Tamanho do arquivo: %u bytes", upload.totalSize);
+        OTAManager::VersionComparison comp = OTAManager::compareVersions(_detectedVersion, _uploadVersion);
 
-        // ✅ NOVO: Verifica se é um arquivo .bin
-        if (!upload.filename.endsWith(".bin"))
+        switch (comp)
         {
-            LOG_ERROR("❌ Arquivo não é .bin: %s", upload.filename.c_str());
-            _server->send(400, "text/plain", "Error: Only .bin files are allowed");
-            _updating = false;
-            return;
+        case OTAManager::VERSION_NEWER:
+            versionMessage = "📈 Atualizando para versão MAIS NOVA: " + _detectedVersion;
+            break;
+        case OTAManager::VERSION_EQUAL:
+            versionMessage = "🔄 Mesma versão: " + _detectedVersion + " - Continuando...";
+            break;
+        case OTAManager::VERSION_OLDER:
+            versionMessage = "⚠️  AVISO: Versão MAIS ANTIGA detectada: " + _detectedVersion;
+            // Não bloqueia, apenas alerta
+            break;
         }
 
-        if (!Update.begin(UPDATE_SIZE_UNKNOWN))
-        {
-            LOG_ERROR("❌ Falha ao iniciar update: %s", Update.errorString());
-            _server->send(500, "text/plain", "Update begin failed: " + String(Update.errorString()));
-            _updating = false;
-        }
+        LOG_INFO("%s", versionMessage.c_str());
     }
-    else if (upload.status == UPLOAD_FILE_WRITE)
+    else
     {
-        // ✅ NOVO: Tenta detectar versão durante o upload (apenas uma vez)
-        if (detectedVersion == "" && upload.totalSize > 1024)
-        { // Aguarda pelo menos 1KB
-            detectedVersion = extractVersionFromBinary(upload.buf, upload.currentSize);
+        versionMessage = "🔍 Versão não detectada no firmware - Instalando...";
+        LOG_WARN("%s", versionMessage.c_str());
+    }
 
-            if (detectedVersion != "unknown")
-            {
-                LOG_INFO("🔍 Versão detectada no upload: %s", detectedVersion.c_str());
-
-                // Compara com versão atual
-                OTAManager::VersionComparison comp = OTAManager::compareVersions(detectedVersion, currentVersion);
-
-                switch (comp)
-                {
-                case OTAManager::VERSION_NEWER:
-                    LOG_INFO("✅ Nova versão mais recente: %s → %s",
-                             currentVersion.c_str(), detectedVersion.c_str());
-                    break;
-                case OTAManager::VERSION_EQUAL:
-                    LOG_WARN("⚠️  Mesma versão: %s", currentVersion.c_str());
-                    break;
-                case OTAManager::VERSION_OLDER:
-                    LOG_WARN("⚠️  Versão mais antiga: %s ← %s",
-                             currentVersion.c_str(), detectedVersion.c_str());
-                    break;
-                }
-            }
-        }
+    _detectedVersion = ""; // Limpar memória
 
-        if (Update.write(upload.buf, upload.currentSize) != upload.currentSize)
-        {
-            LOG_ERROR("❌ Erro na escrita: %s", Update.errorString());
-        }
+    // Com sucesso a sessão não é devolvida: a nova imagem já é a de boot e o
+    // ESP32 vai reiniciar (o Pull não pode iniciar outro Update na mesma partição)
+    bool ended;
+    {
+        OTA_TRACE_SCOPE("Update.end");
+        ended = Update.end(true);
     }
-    else if (upload.status == UPLOAD_FILE_END)
+
+    if (ended)
     {
-        LOG_INFO("📋 Upload finalizado, total: %u bytes", upload.totalSize);
+        LOG_INFO("🎉 Update aplicado com sucesso! %s", versionMessage.c_str());
 
-        // ✅ NOVO: Verificação final da versão antes de instalar
-        bool shouldProceed = true;
-        String versionMessage = "";
+        _uploadStatusCode = 200;
+        _uploadMessage = "Update successful! ";
+        _uploadMessage += versionMessage;
+        _uploadMessage += " Restarting...";
+        OTAEvents::progress(OTAEvents::SOURCE_PUSH, OTAEvents::PHASE_DONE, received, received, _uploadMessage.c_str());
+        OTAMetrics::pushUpload(OTAClock::millis() - _uploadStartMs);
+        OTAMetrics::success(OTAEvents::SOURCE_PUSH);
+        return true;
+    }
 
-        if (detectedVersion != "unknown")
-        {
-            OTAManager::VersionComparison comp = OTAManager::compareVersions(detectedVersion, currentVersion);
+    LOG_ERROR("💥 Falha ao finalizar update: %s", Update.errorString());
+    _uploadStatusCode = 500;
+    _uploadMessage = "Update failed: " + String(Update.errorString());
+    _uploadFailed = true;
+    OTAMetrics::failure(OTAEvents::SOURCE_PUSH, OTAMetrics::FAIL_VERIFY);
+    uploadRelease();
+    OTAEvents::progress(OTAEvents::SOURCE_PUSH, OTAEvents::PHASE_ERROR, received, received, _uploadMessage.c_str());
+    return false;
+}
 
-            switch (comp)
-            {
-            case OTAManager::VERSION_NEWER:
-                versionMessage = "📈 Atualizando para versão MAIS NOVA: " + detectedVersion;
-                break;
-            case OTAManager::VERSION_EQUAL:
-                versionMessage = "🔄 Mesma versão: " + detectedVersion + " - Continuando...";
-                break;
-            case OTAManager::VERSION_OLDER:
-                versionMessage = "⚠️  AVISO: Versão MAIS ANTIGA detectada: " + detectedVersion;
-                // Não bloqueia, apenas alerta
-                break;
-            }
+void OTAPushUpdateManager::uploadAbort()
+{
+    // Sem a sessão o Update pode ser do Pull: não mexe nele
+    if (_uploadToken != 0 && Update.isRunning())
+    {
+        Update.abort();
+    }
 
-            LOG_INFO("%s", versionMessage.c_str());
-        }
-        else
-        {
-            versionMessage = "🔍 Versão não detectada no firmware - Instalando...";
-            LOG_WARN("%s", versionMessage.c_str());
-        }
+    LOG_WARN("⚠️  Upload OTA interrompido");
+    _uploadStatusCode = 500;
+    _uploadMessage = "Upload aborted";
+    _uploadFailed = true;
+    OTAMetrics::failure(OTAEvents::SOURCE_PUSH, OTAMetrics::FAIL_ABORTED);
+    _detectedVersion = "";
+    uploadRelease();
+    OTAEvents::progress(OTAEvents::SOURCE_PUSH, OTAEvents::PHASE_ERROR, Update.progress(), _uploadExpected,
+                        _uploadMessage.c_str());
+}
 
-        if (Update.end(true))
-        {
-            LOG_INFO("🎉 Update aplicado com sucesso! %s", versionMessage.c_str());
-            _updating = false;
+OTASession::Token OTAPushUpdateManager::pushAcquire(bool &pending, OTASession::RevokeHandler onRevoke)
+{
+#if OTA_ASYNC_WEBSERVER
+    // A task do AsyncTCP atende todas as conexões: não espera o dono anterior abortar
+    return OTASession::tryAcquire(OTASession::OWNER_PUSH, pending, onRevoke);
+#else
+    pending = false;
+    return OTASession::acquire(OTASession::OWNER_PUSH, onRevoke);
+#endif
+}
 
-            // ✅ NOVO: Mensagem mais informativa
-            String successMessage = "Update successful! ";
-            successMessage += versionMessage;
-            successMessage += " Restarting...";
+void OTAPushUpdateManager::uploadRelease()
+{
+    OTASession::release(_uploadToken);
+    _uploadToken = 0;
+}
 
-            _server->send(200, "text/plain", successMessage);
+void OTAPushUpdateManager::uploadRevoked()
+{
+    // Outra task: a sessão retomável é marcada como falha pelo sessionExpire() da próxima requisição
+    LOG_WARN("⚡ Sessão de upload parada interrompida: o Pull tem prioridade");
+    Update.abort();
+    OTAMetrics::failure(OTAEvents::SOURCE_PUSH, OTAMetrics::FAIL_PREEMPTED);
+    uploadRelease();
+}
 
-            delay(2000);
-            ESP.restart();
-        }
-        else
-        {
-            LOG_ERROR("💥 Falha ao finalizar update: %s", Update.errorString());
-            _server->send(500, "text/plain", "Update failed: " + String(Update.errorString()));
-            _updating = false;
-        }
+bool OTAPushUpdateManager::uploadPreempted()
+{
+    if (_uploadToken == 0 || OTASession::isValid(_uploadToken))
+    {
+        return false;
     }
-    if (upload.status == UPLOAD_FILE_END || upload.status == UPLOAD_FILE_ABORTED)
+
+    LOG_WARN("⚡ Upload OTA interrompido: o Pull tem prioridade");
+    Update.abort();
+    _uploadStatusCode = 409;
+    _uploadMessage = "Update preempted by pull";
+    _uploadFailed = true;
+    OTAMetrics::failure(OTAEvents::SOURCE_PUSH, OTAMetrics::FAIL_PREEMPTED);
+    _detectedVersion = "";
+    uploadRelease();
+    OTAEvents::progress(OTAEvents::SOURCE_PUSH, OTAEvents::PHASE_ERROR, Update.progress(), _uploadExpected,
+                        _uploadMessage.c_str());
+    return true;
+}
+
+void OTAPushUpdateManager::uploadReset()
+{
+    _uploadFailed = false;
+    _uploadStatusCode = 400;
+    _uploadMessage = "Error: No firmware received";
+}
+
+String OTAPushUpdateManager::getCheckUpdatesMessage()
+{
+    OTAStatusSnapshot status = OTAStatus::get();
+
+    if (status.updateAvailable)
     {
-        detectedVersion = ""; // Limpar memória
-        currentVersion = "";
+        return "🎯 Nova versão disponível: v" + String(status.latestVersion) + " (atual: v" + status.currentVersion + ")";
     }
+
+    return "✅ Firmware está atualizado (v" + String(status.currentVersion) + ")";
 }
+
 // ✅ ADICIONAR: Função para validar formato de versão
 bool OTAPushUpdateManager::isValidVersion(const String &version)
 {
@@ -753,137 +649,13 @@ String OTAPushUpdateManager::extractVersionFromBinary(const uint8_t *data, size_
     return "unknown";
 }
 
-// ============ CONTEÚDO DAS PÁGINAS ============
-
-String OTAPushUpdateManager::getSystemInfoContent()
-{
-    String content = "";
-    content += "<div class=\"info-grid\">";
-
-    // Card WiFi
-    content += "<div class=\"info-card\">";
-    content += "<h3>WiFi</h3>";
-    content += "<p><strong>IP:</strong> " + WiFi.localIP().toString() + "</p>";
-    if (_mdnsHostname != "")
-    {
-        content += "<p><strong>mDNS:</strong> " + _mdnsHostname + ".local</p>";
-    }
-    content += "<p><strong>SSID:</strong> " + WiFi.SSID() + "</p>";
-    content += "</div>";
-
-    // Card System
-    content += "<div class=\"info-card\">";
-    content += "<h3>System</h3>";
-    content += "<p><strong>Version:</strong> " + String(OTAManager::getFirmwareVersion().c_str()) + "</p>";
-    content += "<p><strong>Heap Free:</strong> " + String(ESP.getFreeHeap()) + " bytes</p>";
-    content += "<p><strong>CPU:</strong> " + String(ESP.getCpuFreqMHz()) + " MHz</p>";
-    content += "</div>";
-
-    // ============ SEÇÃO DE ATUALIZAÇÃO PULL ============
-    String pullStatus = getPullUpdateStatus();
-    if (pullStatus != "disabled")
-    {
-        content += "<div class=\"info-card\" style=\"display: flex; flex-direction: column; justify-content: center;\">";
-        content += "<h3>🔄 OTA Remoto</h3>";
-
-        if (pullStatus == "available")
-        {
-            String currentVersion = OTAPullUpdateManager::getCurrentVersion();
-            String latestVersion = OTAManager::getLatestVersion();
-
-            content += "<div style=\"background: var(--success); color: white; padding: 0.5rem; border-radius: 0.375rem; margin: 0.25rem 0; text-align: center;\">";
-            content += "<p style=\"margin: 0; font-weight: bold; font-size: 0.85rem;\">📦 Atualização Disponível</p>";
-            content += "</div>";
-
-            content += "<div style=\"display: flex; gap: 0.5rem; margin: 0.75rem 0;\">";
-            content += "<button class=\"btn\" style=\"background: var(--success); padding: 0.4rem 0.8rem; font-size: 0.8rem; flex: 1;\" onclick=\"performPullUpdate()\">";
-            content += "🔄 Instalar v" + latestVersion;
-            content += "</button>";
-            content += "<button class=\"btn\" style=\"background: var(--accent-primary); padding: 0.4rem 0.8rem; font-size: 0.8rem; flex: 1;\" onclick=\"checkForUpdates()\">";
-            content += "Verificar";
-            content += "</button>";
-            content += "</div>";
-        }
-        else
-        {
-            content += "<p style=\"text-align: center; color: var(--success); font-size: 0.9rem; margin: 0.5rem 0;\">✅ Atualizado</p>";
-            content += "<div style=\"text-align: center; margin: 0.5rem 0;\">";
-            content += "<button class=\"btn\" style=\"background: var(--accent-primary); padding: 0.4rem 0.8rem; font-size: 0.8rem;\" onclick=\"checkForUpdates()\">";
-            content += "🔍 Verificar";
-            content += "</button>";
-            content += "</div>";
-        }
-
-        content += "</div>";
-    }
-
-    content += "</div>"; // ✅ FECHAR O info-grid
-
-    content += "<div class=\"action-grid\">";
-    content += "<a href=\"/update\" class=\"action-card\">";
-    content += "<div class=\"action-icon\">📤</div>";
-    content += "<h3>Firmware Upload</h3>";
-    content += "<p>Send new .bin firmware</p>";
-    content += "</a>";
-    content += "<a href=\"/system\" class=\"action-card\">";
-    content += "<div class=\"action-icon\">ℹ️</div>";
-    content += "<h3>System Info</h3>";
-    content += "<p>Complete ESP32 details</p>";
-    content += "</a>";
-    content += "</div>";
-
-    return content;
-}
+// ============ ARQUIVOS ESTÁTICOS ============
 
-// ============ PROCESSAMENTO DE TEMPLATES ============
-String OTAPushUpdateManager::processTemplate(const String &templateHTML, const String &title, const String &content, bool darkMode)
+const char *OTAPushUpdateManager::assetCacheControl(bool versioned)
 {
-    String html = templateHTML;
-
-    // DEBUG: Log para verificar substituição
-    LOG_DEBUG("Processando template - Título: %s", title.c_str());
-
-    // ✅ ALTERADO: Padrão agora é dark (true) em vez de light (false)
-    bool isDarkMode = darkMode;
-
-    // Se não foi especificado um tema, usa dark como padrão
-    if (!_server->hasArg("theme"))
-    {
-        isDarkMode = true; // ✅ PADRÃO DARK
-    }
-
-    // Substitui placeholders PRINCIPAIS
-    html.replace("{{TITLE}}", title);
-    html.replace("{{CONTENT}}", content);
-    html.replace("{{THEME}}", isDarkMode ? "dark" : "light"); // ✅ USA VARIÁVEL CORRIGIDA
-    html.replace("{{THEME_BUTTON}}", isDarkMode ? "☀️" : "🌙");
-    html.replace("{{HOST_INFO}}", _mdnsHostname != "" ? _mdnsHostname + ".local" : WiFi.localIP().toString());
-
-    // CORREÇÃO CRÍTICA: Substituir {{CSS}} e {{JS}} pelos conteúdos reais
-    html.replace("{{CSS}}", cssStyles);
-    html.replace("{{JS}}", jsScript);
-
-    // Placeholders adicionais
-    html.replace("{{MDNS_HOSTNAME}}", _mdnsHostname);
-    html.replace("{{IP_ADDRESS}}", WiFi.localIP().toString());
-    html.replace("{{SSID}}", WiFi.SSID());
-    html.replace("{{HEAP_FREE}}", String(ESP.getFreeHeap()));
-    html.replace("{{CPU_FREQ}}", String(ESP.getCpuFreqMHz()));
-
-    html.replace("{{ESP32_TIME}}", getCurrentDateTime());
-    html.replace("{{UPTIME}}", formatUptime(millis()));
-
-    // DEBUG: Verificar se substituição funcionou
-    if (html.indexOf("{{CSS}}") != -1)
-    {
-        LOG_ERROR("❌ Placeholder {{CSS}} NÃO foi substituído!");
-    }
-    else
-    {
-        LOG_DEBUG("✅ Placeholder {{CSS}} substituído com sucesso");
-    }
-
-    return html;
+    // A URL com ?v= muda junto com o conteúdo, então pode ficar em cache para sempre;
+    // sem ela o navegador revalida pela ETag a cada uso
+    return versioned ? "public, max-age=31536000, immutable" : "no-cache";
 }
 
 String OTAPushUpdateManager::resetReason(esp_reset_reason_t reset)
@@ -917,63 +689,112 @@ String OTAPushUpdateManager::resetReason(esp_reset_reason_t reset)
     };
 }
 
-String OTAPushUpdateManager::getFullSystemInfoContent()
-{
-    String content = "";
-    content += "<div class=\"info-grid\">";
-
-    // Network Card
-    content += "<div class=\"info-card\">";
-    content += "<h3>Network</h3>";
-    content += "<p><strong>Local IP:</strong> " + WiFi.localIP().toString() + "</p>";
-    if (_mdnsHostname != "")
-    {
-        content += "<p><strong>mDNS:</strong> " + _mdnsHostname + ".local</p>";
-    }
-    content += "<p><strong>SSID:</strong> " + WiFi.SSID() + "</p>";
-    content += "<p><strong>RSSI:</strong> " + String(WiFi.RSSI()) + " dBm</p>";
-    content += "<p><strong>MAC:</strong> " + WiFi.macAddress() + "</p>";
-    content += "</div>";
-
-    // Memory Card
-    content += "<div class=\"info-card\">";
-    content += "<h3>Memory</h3>";
-    content += "<p><strong>Heap Free:</strong> " + String(ESP.getFreeHeap()) + " bytes</p>";
-    content += "<p><strong>Heap Size:</strong> " + String(ESP.getHeapSize()) + " bytes</p>";
-    content += "<p><strong>PSRAM Size:</strong> " + String(ESP.getPsramSize()) + " bytes</p>";
-    content += "<p><strong>PSRAM Free:</strong> " + String(ESP.getFreePsram()) + " bytes</p>";
-    content += "</div>";
-
-    // Hardware Card
-    content += "<div class=\"info-card\">";
-    content += "<h3>Hardware</h3>";
-    content += "<p><strong>CPU Frequency:</strong> " + String(ESP.getCpuFreqMHz()) + " MHz</p>";
-    content += "<p><strong>Flash Size:</strong> " + String(ESP.getFlashChipSize() / 1024 / 1024) + " MB</p>";
-    content += "<p><strong>SDK Version:</strong> " + String(ESP.getSdkVersion()) + "</p>";
-    content += "<p><strong>Chip Model:</strong> ESP32-S3</p>";
-    content += "</div>";
-
-    // System Card
-    content += "<div class=\"info-card\">";
-    content += "<h3>System</h3>";
+// ============ API JSON ============
+
+void OTAPushUpdateManager::writeStatusJson(OTAJsonWriter &json)
+{
+    json.beginObject();
+    json.add("version", OTAManager::getFirmwareVersion());
+    json.add("host", _mdnsHostname != "" ? _mdnsHostname + ".local" : WiFi.localIP().toString());
+    json.add("ip", WiFi.localIP().toString());
+    json.add("mdns", _mdnsHostname);
+    json.add("ssid", WiFi.SSID());
+    json.add("heapFree", ESP.getFreeHeap());
+    json.add("cpuFreq", ESP.getCpuFreqMHz());
+    json.add("uptime", OTAClock::millis() / 1000);
+    json.add("time", getCurrentDateTime());
+    json.add("updating", OTAStatus::get().updating());
+    json.add("pull", getPullUpdateStatus());
+    json.endObject();
+}
 
+void OTAPushUpdateManager::writeSystemJson(OTAJsonWriter &json)
+{
+    json.beginObject();
+
+    json.beginObject("network");
+    json.add("ip", WiFi.localIP().toString());
+    json.add("mdns", _mdnsHostname);
+    json.add("ssid", WiFi.SSID());
+    json.add("rssi", WiFi.RSSI());
+    json.add("mac", WiFi.macAddress());
+    json.endObject();
+
+    json.beginObject("memory");
+    json.add("heapFree", ESP.getFreeHeap());
+    json.add("heapMin", ESP.getMinFreeHeap());
+    json.add("heapSize", ESP.getHeapSize());
+    json.add("psramSize", ESP.getPsramSize());
+    json.add("psramFree", ESP.getFreePsram());
+    json.endObject();
+
+    json.beginObject("hardware");
+    json.add("cpuFreq", ESP.getCpuFreqMHz());
+    json.add("flashSize", ESP.getFlashChipSize() / 1024 / 1024);
+    json.add("sdkVersion", ESP.getSdkVersion());
+    json.add("chipModel", "ESP32-S3");
+    json.endObject();
+
+    json.beginObject("system");
 #ifdef FIRMWARE_VERSION
-    content += "<p><strong>Version:</strong> " + String(OTAManager::getFirmwareVersion().c_str()) + "</p>";
+    json.add("version", OTAManager::getFirmwareVersion());
 #else
-    content += "<p><strong>Version:</strong> 1.0.0</p>"; // Fallback
+    json.add("version", "1.0.0"); // Fallback
 #endif
+    json.add("uptime", OTAClock::millis() / 1000);
+    json.add("built", formatBuildDate() + "  " + __TIME__);
+    json.add("resetReason", resetReason(esp_reset_reason()));
+    json.add("cycleCount", ESP.getCycleCount());
+    json.add("time", getCurrentDateTime());
+    json.endObject();
 
-    // Uptime formatado
-    String uptimeStr = formatUptime(millis());
-    content += "<p><strong>Uptime:</strong> " + uptimeStr + "</p>";
+    // Sincronização do relógio (SNTP)
+    OTATime::writeJson(json);
 
-    content += "<p><strong>Firmware built:</strong> " + formatBuildDate() + "  " + String(__TIME__) + "</p>";
+    // Tasks FreeRTOS: núcleo, prioridade, high-water mark da stack e CPU
+    OTATasks::writeJson(json);
 
-    content += "<p><strong>Reset Reason:</strong> " + resetReason(esp_reset_reason()) + "</p>";
-    content += "<p><strong>Cycle Count:</strong> " + String(ESP.getCycleCount()) + "</p>";
-    content += "</div>";
+    json.endObject();
+}
 
-    content += "</div>";
+void OTAPushUpdateManager::writeOtaJson(OTAJsonWriter &json)
+{
+    // Um único snapshot: modo, flags e versões são consistentes entre si
+    OTAStatusSnapshot status = OTAStatus::get();
+
+    json.beginObject();
+    json.add("mode", status.mode == OTAManager::MANUAL ? "manual" : status.mode == OTAManager::AUTOMATIC ? "automatic"
+                                                                                                        : "hybrid");
+    json.add("updating", status.updating());
+
+    json.beginObject("pull");
+    json.add("status", getPullUpdateStatus());
+    json.add("currentVersion", status.currentVersion);
+    json.add("latestVersion", status.latestVersion);
+    json.endObject();
+
+    // Quem está gravando o Update e quem aguarda (OTASession)
+    OTASession::Info session = OTASession::info();
+    uint32_t now = OTAClock::millis();
+
+    json.beginObject("session");
+    json.add("active", OTASession::ownerName(session.active));
+    json.add("elapsed", session.active != OTASession::OWNER_NONE ? (now - session.activeSinceMs) / 1000 : 0);
+    json.add("preempting", session.preempting);
+    json.add("queued", OTASession::ownerName(session.queued));
+    json.add("queuedFor", session.queued != OTASession::OWNER_NONE ? (now - session.queuedSinceMs) / 1000 : 0);
+    json.add("policy", session.policy == OTASession::POLICY_PUSH_WINS ? "push-wins" : "pull-wins");
+    json.add("preemptions", session.preemptions);
+    json.add("denials", session.denials);
+    json.endObject();
+
+    json.endObject();
+}
 
-    return content;
-}
\ No newline at end of file
+void OTAPushUpdateManager::writeUploadJson(OTAJsonWriter &json)
+{
+    json.beginObject();
+    json.add("status", _uploadStatusCode == 200 ? "success" : "error");
+    json.add("message", _uploadMessage);
+    json.endObject();
+}
@@ -8,16 +8,26 @@
  * Complementa o OTAPullUpdateManager
  */
 
-#include "LogLibrary.h"
+#include "OTAAsset.h"
+#include "OTAConfig.h"
+#include "OTAJsonWriter.h"
+#include "OTALog.h"
+#include "OTASession.h"
+#include "OTATasks.h"
 
 #include <ESPmDNS.h>
-#include <NTPClient.h>
 #include <Update.h>
-#include <WebServer.h>
-#include <WiFiUdp.h>
 #include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #include <freertos/task.h>
 
+#if OTA_ASYNC_WEBSERVER
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#else
+#include <WebServer.h>
+#endif
+
 class OTAPushUpdateManager
 {
 public:
@@ -31,11 +41,15 @@ public:
 
     /**
      * @brief Inicia thread FreeRTOS para processamento automático
+     *
+     * No backend assíncrono (OTA_ASYNC_WEBSERVER=1) as requisições são
+     * atendidas pela task do AsyncTCP e nenhuma thread é criada.
+     *
      * @param stackSize Tamanho da stack da thread (padrão: 8192)
      * @param priority Prioridade da thread (padrão: 1)
-     * @param core Núcleo do processador (padrão: 1)
+     * @param core Núcleo do processador (padrão: OTA_WEB_TASK_CORE)
      */
-    static void run(uint32_t stackSize = 8192, UBaseType_t priority = 1);
+    static void run(uint32_t stackSize = 8192, UBaseType_t priority = 1, BaseType_t core = OTA_WEB_TASK_CORE);
 
     /**
      * @brief Para a thread FreeRTOS
@@ -58,6 +72,7 @@ public:
     /**
      * @brief Processa requisições do servidor web
      * Deve ser chamado no loop() principal se não usar run()
+     * (sem efeito no backend assíncrono)
      */
     static void handleClient();
 
@@ -77,7 +92,8 @@ public:
     static String getAccessURL();
 
     /**
-     * @brief Atualiza o NTP client (deve ser chamado no loop)
+     * @brief Sem efeito: o horário é mantido pelo OTATime (SNTP em segundo plano)
+     * @deprecated Mantido por compatibilidade
      */
     static void updateTime();
 
@@ -101,9 +117,23 @@ public:
     static String getPullUpdateStatus();
 
 private:
+    friend class OTAMicroBench; ///< bench/micro mede os helpers internos
+
     // ============ VARIÁVEIS DE ESTADO ============
+#if OTA_ASYNC_WEBSERVER
+    static AsyncWebServer *_server;
+    static AsyncWebServerRequest *_uploadRequest; ///< Requisição dona do upload em andamento
+    static AsyncEventSource *_events;             ///< Server-Sent Events em /api/events
+    static AsyncWebServerRequest *_chunkRequest;  ///< Requisição dona do bloco em recepção
+    static AsyncWebServerRequest *_filesRequest;  ///< Requisição dona do patch de arquivos
+    static AsyncWebSocket *_ws;                   ///< Upload por WebSocket em /api/ws/upload
+    static uint32_t _wsClientId;                  ///< Cliente dono do upload (0 = nenhum)
+#else
     static WebServer *_server;
-    static bool _updating;
+    static WiFiClient _eventClients[OTA_EVENTS_MAX_CLIENTS]; ///< Conexões abertas de /api/events
+    static SemaphoreHandle_t _eventMutex;                    ///< Protege _eventClients
+    static WiFiClient _wsClient;                             ///< Conexão do upload por WebSocket
+#endif
     static String _username;
     static String _password;
     static bool _authenticated;
@@ -119,28 +149,360 @@ private:
     static uint32_t _taskStackSize;
     static UBaseType_t _taskPriority;
 
-    // ============ NTP CLIENT ============
-    static WiFiUDP *_ntpUDP;
-    static NTPClient *_timeClient;
-    static bool _timeSynced;
+    // ============ UPLOAD (COMUM AOS BACKENDS) ============
+    static String _detectedVersion; ///< Versão detectada no binário recebido
+    static String _uploadVersion;   ///< Versão em execução no início do upload
+    static bool _uploadFailed;      ///< Upload atual falhou e deve ser descartado
+    static int _uploadStatusCode;   ///< Código HTTP da resposta final do upload
+    static String _uploadMessage;   ///< Mensagem da resposta final do upload
+    static size_t _uploadExpected;  ///< Tamanho esperado, para o progresso (0 se desconhecido)
+    static uint32_t _uploadToken;   ///< Sessão do OTASession enquanto o Update é nosso (0 = nenhuma)
+    static uint32_t _uploadStartMs; ///< Início do upload, para OTAMetrics
+
+    // ============ UPLOAD RETOMÁVEL (/api/upload) ============
+    enum SessionState
+    {
+        SESSION_NONE = 0,  ///< Nenhuma sessão
+        SESSION_RECEIVING, ///< Aguardando blocos
+        SESSION_DONE,      ///< Firmware completo e aplicado
+        SESSION_FAILED     ///< Update falhou; a sessão não aceita mais blocos
+    };
+
+    static SessionState _sessionState;
+    static char _sessionId[17];         ///< Identificador da sessão (16 dígitos hex)
+    static size_t _sessionSize;         ///< Tamanho total do firmware
+    static size_t _sessionOffset;       ///< Bytes confirmados (gravados no Update)
+    static uint32_t _sessionLastMs;     ///< Último bloco recebido, para expirar a sessão
+    static int _sessionStatusCode;      ///< Código HTTP da resposta atual
+    static const char *_sessionMessage; ///< Mensagem da resposta atual
+    static bool _sessionOwner;          ///< A requisição atual informou o ID da sessão
+    static uint8_t *_chunkBuffer;       ///< Bloco em recepção (OTA_UPLOAD_CHUNK_MAX bytes, alocado no primeiro bloco HTTP)
+    static size_t _chunkLength;         ///< Bytes recebidos do bloco atual
+    static size_t _chunkExpected;       ///< Tamanho declarado do bloco atual
+    static uint32_t _chunkCrc;          ///< CRC32 calculado do bloco atual
+    static uint32_t _chunkExpectedCrc;  ///< CRC32 informado pelo cliente (X-CRC32)
+    static bool _chunkActive;           ///< Há um bloco em recepção
+
+    // ============ SINCRONIZAÇÃO DE ARQUIVOS (/api/files) ============
+    static int _filesStatusCode;      ///< Código HTTP da resposta do PUT /api/files
+    static const char *_filesMessage; ///< Mensagem da resposta do PUT /api/files
+    static OTASession::Token _filesToken; ///< Sessão do OTASession durante o patch (0 = nenhuma)
+    static bool _filesFailed;         ///< Patch atual falhou e deve ser descartado
+
+    // ============ UPLOAD POR WEBSOCKET (/api/ws/upload) ============
+    static bool _wsSession;     ///< O cliente WebSocket iniciou ou retomou a sessão
+    static char _wsReply[160];  ///< Última resposta (JSON) ao cliente WebSocket
+
+    // ============ ARQUIVOS ESTÁTICOS ============
+    static const OTAAsset *const _assets[]; ///< CSS, JS e favicon (webPage/assets.h)
+    static const OTAAsset &_appAsset;       ///< Página única, servida em /, /update e /system
+    static const size_t _assetCount;
 
     // ============ MÉTODOS PRIVADOS ============
-    static void handleRoot();
-    static void handleUpdate();
+
+    /**
+     * @brief Cria o servidor do backend selecionado, registra as rotas e o inicia
+     * Implementado em OTAPushWebServer.cpp ou OTAPushAsyncWebServer.cpp
+     */
+    static void startServer(uint16_t port);
+
+#if OTA_ASYNC_WEBSERVER
+    static void handleApp(AsyncWebServerRequest *request);
+    static void handleDoUpdate(AsyncWebServerRequest *request);
+    static void handleDoUpload(AsyncWebServerRequest *request, const String &filename,
+                               size_t index, uint8_t *data, size_t len, bool final);
+    static void handleCheckUpdates(AsyncWebServerRequest *request);
+    static void handlePerformUpdate(AsyncWebServerRequest *request);
+    static void handleFirmware(AsyncWebServerRequest *request);
+    static void handleFirmwareBody(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+                                   size_t index, size_t total);
+    static void handleSessionChunk(AsyncWebServerRequest *request);
+    static void handleSessionChunkBody(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+                                       size_t index, size_t total);
+    static void handleFilesManifest(AsyncWebServerRequest *request);
+    static void handleFiles(AsyncWebServerRequest *request);
+    static void handleFilesBody(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+                                size_t index, size_t total);
+    static void handleWsEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type,
+                              void *arg, uint8_t *data, size_t len);
+    static bool checkAuthentication(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Envia um documento JSON gerado por writer
+     */
+    static void sendJson(AsyncWebServerRequest *request, void (*writer)(OTAJsonWriter &json), int code = 200);
+
+    /**
+     * @brief Envia um arquivo estático com ETag e Cache-Control (304 se inalterado)
+     */
+    static void handleAsset(AsyncWebServerRequest *request, const OTAAsset &asset);
+
+    /**
+     * @brief Métricas no formato do Prometheus (OTAMetrics)
+     */
+    static void handleMetrics(AsyncWebServerRequest *request);
+
+#if OTA_LOG_DEFERRED
+    /**
+     * @brief Últimas linhas do log adiado (OTALog), em texto
+     */
+    static void handleLog(AsyncWebServerRequest *request);
+#endif
+
+    /**
+     * @brief Executa uma operação bloqueante fora da task do AsyncTCP
+     * @param job Função a executar em uma task própria de curta duração
+     * @param name Nome da task
+     * @return false se a task não pôde ser criada
+     */
+    static bool runDeferred(void (*job)(), const char *name);
+
+    /**
+     * @brief Task de baixa prioridade que publica a telemetria em /api/events
+     */
+    static void eventsTaskFunction(void *parameter);
+#else
+    static void handleApp();
+    static void handleDoUpdate();
     static void handleDoUpload();
-    static void handleSystemInfo();
-    static void handleToggleTheme();
+    static void handleCheckUpdates();
+    static void handlePerformUpdate();
+    static void handleFirmware();
+    static void handleFirmwareBody();
+    static void handleSessionChunk();
+    static void handleSessionChunkBody();
+    static void handleFilesManifest();
+    static void handleFiles();
+    static void handleFilesBody();
+
+    /**
+     * @brief Aceita o handshake do WebSocket (GET /api/ws/upload)
+     *
+     * O WebServer não suporta WebSocket: a conexão é guardada em _wsClient e
+     * os frames são lidos por wsPoll() no mesmo laço de handleClient().
+     */
+    static void handleWsUpgrade();
+    static void wsPoll();
+    static void wsSend(uint8_t opcode, const uint8_t *payload, size_t length);
+    static void wsClose();
     static bool checkAuthentication();
 
+    /**
+     * @brief Envia um documento JSON gerado por writer como resposta chunked
+     */
+    static void sendJson(void (*writer)(OTAJsonWriter &json), int code = 200);
+
+    /**
+     * @brief Envia um arquivo estático com ETag e Cache-Control (304 se inalterado)
+     */
+    static void handleAsset(const OTAAsset &asset);
+
+    /**
+     * @brief Métricas no formato do Prometheus (OTAMetrics)
+     */
+    static void handleMetrics();
+
+#if OTA_LOG_DEFERRED
+    /**
+     * @brief Últimas linhas do log adiado (OTALog), em texto
+     */
+    static void handleLog();
+#endif
+
+    /**
+     * @brief Abre um stream de Server-Sent Events (GET /api/events)
+     *
+     * A conexão é guardada em _eventClients e continua aberta depois que o
+     * WebServer passa para a próxima requisição.
+     */
+    static void handleEvents();
+
     // Thread FreeRTOS
     static void taskFunction(void *parameter);
     static void stopTask();
+#endif
+
+    /**
+     * @brief Inicia a gravação de um firmware recebido pela página ou pela API
+     * @param filename Nome do arquivo enviado (vazio no PUT /api/firmware, sem nome de arquivo)
+     * @param size Tamanho total, se conhecido (UPDATE_SIZE_UNKNOWN caso contrário)
+     * @param expected Estimativa do tamanho para os eventos de progresso quando
+     *                 size é desconhecido (ex: Content-Length do multipart)
+     * @return true se o Update foi iniciado
+     */
+    static bool uploadBegin(const String &filename, size_t size, size_t expected = 0);
+
+    /**
+     * @brief Define o MD5 esperado do firmware, verificado por uploadEnd()
+     * @param md5 Hash em hexadecimal (32 caracteres)
+     * @return false se o hash for inválido (o upload é descartado)
+     */
+    static bool uploadExpectMD5(const String &md5);
+
+    /**
+     * @brief Grava um bloco recebido no Update
+     * @param data Dados do bloco
+     * @param length Tamanho do bloco
+     * @return true se o bloco foi gravado integralmente
+     */
+    static bool uploadWrite(uint8_t *data, size_t length);
+
+    /**
+     * @brief Finaliza a gravação e prepara _uploadStatusCode/_uploadMessage
+     * @return true se o firmware foi aplicado e o ESP32 deve reiniciar
+     */
+    static bool uploadEnd();
+
+    /**
+     * @brief Descarta um upload interrompido
+     */
+    static void uploadAbort();
+
+    /**
+     * @brief Restaura o estado de resposta para o próximo upload
+     */
+    static void uploadReset();
+
+    /**
+     * @brief Pede a sessão do Update para o Push
+     * No backend assíncrono não espera o dono anterior (tryAcquire): com
+     * pending = true o cliente recebe 503 e tenta de novo
+     */
+    static OTASession::Token pushAcquire(bool &pending, OTASession::RevokeHandler onRevoke = nullptr);
+
+    /**
+     * @brief Devolve a sessão do Update ao OTASession
+     */
+    static void uploadRelease();
+
+    /**
+     * @brief Aborta uma sessão de upload parada entre blocos (RevokeHandler,
+     * executado pela task do Pull)
+     */
+    static void uploadRevoked();
+
+    /**
+     * @brief Aborta o upload se o Pull tomou a sessão do Update
+     * @return true se o upload foi interrompido
+     */
+    static bool uploadPreempted();
+
+    // ============ UPLOAD RETOMÁVEL ============
+    // Implementado em OTAPushUploadSession.cpp; cada operação define
+    // _sessionStatusCode/_sessionMessage para a resposta (writeSessionJson)
+
+    /**
+     * @brief Cria uma sessão e inicia o Update (POST /api/upload?size=N[&md5=...])
+     */
+    static void sessionCreate(size_t size, const String &md5);
+
+    /**
+     * @brief Valida o início de um bloco (PUT /api/upload?session=ID&offset=N)
+     * @param id Sessão informada pelo cliente
+     * @param offset Posição do bloco no firmware (deve ser igual a _sessionOffset)
+     * @param length Tamanho do bloco (Content-Length)
+     * @param crc CRC32 do bloco em hexadecimal (cabeçalho X-CRC32)
+     * @return true se os dados do bloco devem ser aceitos
+     */
+    static bool sessionChunkBegin(const String &id, size_t offset, size_t length, const String &crc);
+    static void sessionChunkData(const uint8_t *data, size_t length);
+
+    /**
+     * @brief Verifica tamanho e CRC do bloco e o grava no Update
+     * O último bloco também finaliza o Update (SESSION_DONE)
+     */
+    static void sessionChunkEnd();
+
+    /**
+     * @brief Descarta o bloco em recepção (conexão caiu); a sessão continua
+     */
+    static void sessionChunkAbort();
+
+    /**
+     * @brief Grava dados na sessão a partir de _sessionOffset
+     * Os últimos bytes finalizam o Update (SESSION_DONE)
+     * @return false se a sessão falhou ou não está recebendo
+     */
+    static bool sessionWrite(const uint8_t *data, size_t length);
+    static void sessionFail(int code, const char *message);
+
+    static void sessionQuery(const String &id);  ///< GET /api/upload?session=ID
+    static void sessionCancel(const String &id); ///< DELETE /api/upload?session=ID
+
+    /**
+     * @brief Prepara a resposta padrão da próxima requisição
+     */
+    static void sessionResponseReset();
+    static void sessionRelease();
+    static void sessionExpire();
+    static const char *sessionStateName(SessionState state);
+
+    // ============ SINCRONIZAÇÃO DE ARQUIVOS ============
+    // Implementado em OTAPushFileSync.cpp; cada operação define
+    // _filesStatusCode/_filesMessage para a resposta (writeFilesJson)
+
+    /**
+     * @brief Inicia a recepção de um patch (PUT /api/files)
+     * @param size Tamanho do corpo (Content-Length)
+     */
+    static bool filesBegin(size_t size);
+    static bool filesWrite(const uint8_t *data, size_t length);
+
+    /**
+     * @brief Aplica o patch recebido (os arquivos mudam sem reiniciar)
+     */
+    static bool filesEnd();
+
+    /**
+     * @brief Descarta um patch interrompido (conexão caiu)
+     */
+    static void filesAbort();
+    static void filesFail(int code, const char *message);
+    static void filesReset();
+
+    // ============ UPLOAD POR WEBSOCKET ============
+    // Protocolo comum aos backends (OTAPushUploadSession.cpp); o transporte
+    // (frames, envio das respostas) fica em cada backend
+
+    /**
+     * @brief Processa um comando de texto ("begin <tamanho>" ou "resume <sessão>")
+     * @return Resposta JSON ("ready" ou "error") em _wsReply
+     */
+    static const char *wsCommand(const char *text, size_t length);
+
+    /**
+     * @brief Grava um trecho de frame binário na sessão
+     */
+    static void wsBinary(const uint8_t *data, size_t length);
+
+    /**
+     * @brief Fim de um frame binário (dados já gravados)
+     * @return Resposta JSON ("ack", "done" ou "error") em _wsReply
+     */
+    static const char *wsBinaryEnd();
+
+    static String getCheckUpdatesMessage();
 
     static String resetReason(esp_reset_reason_t reset);
-    static String getSystemInfoContent();
-    static String getFullSystemInfoContent();
-    static String processTemplate(const String &templateHTML, const String &title, const String &content, bool darkMode);
-    static String formatUptime(unsigned long milliseconds);
+
+    /**
+     * @brief Entrega um evento de OTAEvents aos clientes de /api/events
+     */
+    static void sendEvent(const char *event, const char *data);
+
+    // ============ API JSON ============
+    static void writeStatusJson(OTAJsonWriter &json); ///< GET /api/status
+    static void writeSystemJson(OTAJsonWriter &json); ///< GET /api/system
+    static void writeOtaJson(OTAJsonWriter &json);    ///< GET /api/ota
+    static void writeUploadJson(OTAJsonWriter &json); ///< Resposta do PUT /api/firmware
+    static void writeSessionJson(OTAJsonWriter &json); ///< Respostas de /api/upload
+    static void writeFilesJson(OTAJsonWriter &json);   ///< Resposta do PUT /api/files
+
+    /**
+     * @brief Cache-Control de um arquivo estático
+     * @param versioned Requisição feita pela URL com ?v= igual ao hash atual
+     */
+    static const char *assetCacheControl(bool versioned);
     static String formatBuildDate();
 
     static String extractVersionFromBinary(const uint8_t *data, size_t length);
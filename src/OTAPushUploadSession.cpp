@@ -0,0 +1,503 @@
+/**
+ * @file OTAPushUploadSession.cpp
+ * @brief Upload retomável em blocos (/api/upload), comum aos dois backends
+ *
+ * Protocolo:
+ *  1. POST   /api/upload?size=N[&md5=H]          -> cria a sessão e inicia o Update
+ *  2. PUT    /api/upload?session=ID&offset=O     -> envia um bloco (X-CRC32: crc do bloco)
+ *  3. GET    /api/upload?session=ID              -> consulta o offset confirmado
+ *  4. DELETE /api/upload?session=ID              -> cancela a sessão
+ *
+ * Cada bloco é recebido inteiro no buffer da sessão e só é gravado no Update
+ * depois de conferidos o tamanho e o CRC32; um bloco interrompido é descartado
+ * sem alterar o offset. Se a conexão cair, o cliente consulta a sessão e
+ * continua a partir do último offset confirmado.
+ *
+ * Upload por WebSocket (/api/ws/upload), sobre a mesma sessão:
+ *  - cliente envia "begin <tamanho>" ou "resume <sessão>" -> {"type":"ready",...}
+ *  - cliente envia frames binários de até OTA_WS_UPLOAD_FRAME bytes, com no
+ *    máximo OTA_WS_UPLOAD_WINDOW frames sem confirmação
+ *  - cada frame gravado na flash é confirmado com {"type":"ack","offset":N};
+ *    o último com {"type":"done"} (ou {"type":"error"} em caso de falha)
+ */
+
+#include "OTAPushUpdateManager.h"
+#include "OTAClock.h"
+
+#include <esp_rom_crc.h>
+
+namespace
+{
+    const size_t FLASH_SECTOR = 4096; ///< Setor da flash: o Update grava a cada setor completo
+
+    static_assert(OTA_UPLOAD_CHUNK_MAX % FLASH_SECTOR == 0, "OTA_UPLOAD_CHUNK_MAX must be a multiple of 4096");
+    static_assert(OTA_WS_UPLOAD_FRAME % FLASH_SECTOR == 0, "OTA_WS_UPLOAD_FRAME must be a multiple of 4096");
+}
+
+// ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
+
+OTAPushUpdateManager::SessionState OTAPushUpdateManager::_sessionState = SESSION_NONE;
+char OTAPushUpdateManager::_sessionId[17] = "";
+size_t OTAPushUpdateManager::_sessionSize = 0;
+size_t OTAPushUpdateManager::_sessionOffset = 0;
+uint32_t OTAPushUpdateManager::_sessionLastMs = 0;
+int OTAPushUpdateManager::_sessionStatusCode = 400;
+const char *OTAPushUpdateManager::_sessionMessage = "No chunk received";
+bool OTAPushUpdateManager::_sessionOwner = false;
+
+uint8_t *OTAPushUpdateManager::_chunkBuffer = nullptr;
+size_t OTAPushUpdateManager::_chunkLength = 0;
+size_t OTAPushUpdateManager::_chunkExpected = 0;
+uint32_t OTAPushUpdateManager::_chunkCrc = 0;
+uint32_t OTAPushUpdateManager::_chunkExpectedCrc = 0;
+bool OTAPushUpdateManager::_chunkActive = false;
+
+bool OTAPushUpdateManager::_wsSession = false;
+char OTAPushUpdateManager::_wsReply[160] = "";
+
+// ============ SESSÃO ============
+
+const char *OTAPushUpdateManager::sessionStateName(SessionState state)
+{
+    switch (state)
+    {
+    case SESSION_RECEIVING:
+        return "receiving";
+    case SESSION_DONE:
+        return "done";
+    case SESSION_FAILED:
+        return "failed";
+    default:
+        return "none";
+    }
+}
+
+void OTAPushUpdateManager::sessionResponseReset()
+{
+    _sessionStatusCode = 400;
+    _sessionMessage = "No chunk received";
+    _sessionOwner = false;
+}
+
+void OTAPushUpdateManager::sessionRelease()
+{
+    free(_chunkBuffer);
+    _chunkBuffer = nullptr;
+    _chunkActive = false;
+}
+
+void OTAPushUpdateManager::sessionExpire()
+{
+    if (_sessionState != SESSION_RECEIVING)
+    {
+        return;
+    }
+
+    // Parada entre blocos, a sessão só volta a mexer no Update se o Pull não a revogou
+    // (nesse caso o OTASession já abortou o Update com uploadRevoked())
+    if (!OTASession::resume(_uploadToken))
+    {
+        sessionFail(409, "Update preempted by pull");
+        return;
+    }
+
+    if (OTAClock::millis() - _sessionLastMs < OTA_UPLOAD_SESSION_TIMEOUT_MS)
+    {
+        OTASession::idle(_uploadToken);
+        return;
+    }
+
+    LOG_WARN("⌛ Sessão de upload %s expirada em %u/%u bytes", _sessionId, _sessionOffset, _sessionSize);
+    uploadAbort();
+    uploadReset();
+    sessionRelease();
+    _sessionState = SESSION_NONE;
+}
+
+void OTAPushUpdateManager::sessionCreate(size_t size, const String &md5)
+{
+    sessionExpire();
+
+    if (_sessionState == SESSION_RECEIVING)
+    {
+        _sessionStatusCode = 409;
+        _sessionMessage = "Another upload session is active";
+        return;
+    }
+
+    if (size == 0)
+    {
+        _sessionStatusCode = 411;
+        _sessionMessage = "Firmware size required";
+        return;
+    }
+
+    // O tamanho é conhecido: o Update reserva e valida a partição desde o início
+    if (!uploadBegin("", size) || (md5.length() > 0 && !uploadExpectMD5(md5)))
+    {
+        _sessionStatusCode = _uploadStatusCode;
+        _sessionMessage = "Update begin failed";
+        uploadReset();
+        sessionRelease();
+        _sessionState = SESSION_NONE;
+        return;
+    }
+
+    snprintf(_sessionId, sizeof(_sessionId), "%08lx%08lx", (unsigned long)esp_random(), (unsigned long)esp_random());
+    _sessionState = SESSION_RECEIVING;
+    _sessionSize = size;
+    _sessionOffset = 0;
+    _sessionLastMs = OTAClock::millis();
+    _sessionOwner = true;
+    _sessionStatusCode = 201;
+    _sessionMessage = "Session created";
+
+    LOG_INFO("📦 Sessão de upload %s criada (%u bytes)", _sessionId, size);
+    OTASession::idle(_uploadToken);
+}
+
+void OTAPushUpdateManager::sessionQuery(const String &id)
+{
+    sessionExpire();
+
+    if (_sessionState == SESSION_NONE || id != _sessionId)
+    {
+        _sessionStatusCode = 404;
+        _sessionMessage = "Unknown upload session";
+        return;
+    }
+
+    _sessionOwner = true;
+    _sessionStatusCode = 200;
+    _sessionMessage = _sessionState == SESSION_FAILED ? "Update failed" : "OK";
+}
+
+void OTAPushUpdateManager::sessionCancel(const String &id)
+{
+    if (_sessionState == SESSION_NONE || id != _sessionId)
+    {
+        _sessionStatusCode = 404;
+        _sessionMessage = "Unknown upload session";
+        return;
+    }
+
+    _sessionOwner = true;
+
+    if (_sessionState == SESSION_RECEIVING)
+    {
+        LOG_WARN("🛑 Sessão de upload %s cancelada", _sessionId);
+        if (OTASession::resume(_uploadToken))
+        {
+            uploadAbort();
+        }
+        uploadReset();
+    }
+
+    sessionRelease();
+    _sessionState = SESSION_NONE;
+    _sessionStatusCode = 200;
+    _sessionMessage = "Session cancelled";
+}
+
+// ============ BLOCOS ============
+
+bool OTAPushUpdateManager::sessionChunkBegin(const String &id, size_t offset, size_t length, const String &crc)
+{
+    sessionExpire();
+
+    if (_sessionState == SESSION_NONE || id != _sessionId)
+    {
+        _sessionStatusCode = 404;
+        _sessionMessage = "Unknown upload session";
+        return false;
+    }
+
+    _sessionOwner = true;
+
+    if (_sessionState != SESSION_RECEIVING)
+    {
+        _sessionStatusCode = 410;
+        _sessionMessage = "Session is closed";
+        return false;
+    }
+
+    // Bloco repetido ou fora de ordem: a resposta traz o offset correto
+    if (offset != _sessionOffset)
+    {
+        _sessionStatusCode = 409;
+        _sessionMessage = "Offset mismatch";
+        return false;
+    }
+
+    if (length == 0 || length > OTA_UPLOAD_CHUNK_MAX || offset + length > _sessionSize)
+    {
+        _sessionStatusCode = 413;
+        _sessionMessage = "Invalid chunk length";
+        return false;
+    }
+
+    // O offset fica sempre num limite de setor: a sessão pode seguir pelo WebSocket, cuja
+    // confirmação de cada frame só corresponde a dados na flash nesse caso
+    if (offset + length < _sessionSize && length % FLASH_SECTOR != 0)
+    {
+        _sessionStatusCode = 413;
+        _sessionMessage = "Chunk length must be a multiple of 4096";
+        return false;
+    }
+
+    char *end = nullptr;
+    _chunkExpectedCrc = strtoul(crc.c_str(), &end, 16);
+    if (crc.length() == 0 || crc.length() > 8 || *end != '\0')
+    {
+        _sessionStatusCode = 400;
+        _sessionMessage = "Missing or invalid X-CRC32";
+        return false;
+    }
+
+    // Só o upload HTTP usa o buffer: uma sessão pelo WebSocket grava os frames direto no Update
+    if (_chunkBuffer == nullptr)
+    {
+        _chunkBuffer = static_cast<uint8_t *>(malloc(OTA_UPLOAD_CHUNK_MAX));
+        if (_chunkBuffer == nullptr)
+        {
+            LOG_ERROR("❌ Sem memória para o buffer do upload (%u bytes)", OTA_UPLOAD_CHUNK_MAX);
+            _sessionStatusCode = 503;
+            _sessionMessage = "Out of memory";
+            return false;
+        }
+    }
+
+    _chunkActive = true;
+    _chunkLength = 0;
+    _chunkExpected = length;
+    _chunkCrc = 0;
+    _sessionLastMs = OTAClock::millis();
+
+    // Resposta caso o bloco não chegue inteiro
+    _sessionStatusCode = 400;
+    _sessionMessage = "Incomplete chunk";
+    return true;
+}
+
+void OTAPushUpdateManager::sessionChunkData(const uint8_t *data, size_t length)
+{
+    if (!_chunkActive)
+    {
+        return;
+    }
+
+    size_t copied = min(length, _chunkExpected - _chunkLength);
+    memcpy(_chunkBuffer + _chunkLength, data, copied);
+    _chunkCrc = esp_rom_crc32_le(_chunkCrc, data, copied);
+    _chunkLength += copied;
+}
+
+void OTAPushUpdateManager::sessionChunkEnd()
+{
+    if (!_chunkActive)
+    {
+        return;
+    }
+    _chunkActive = false;
+
+    if (_chunkLength != _chunkExpected)
+    {
+        return; // "Incomplete chunk"; o offset não muda
+    }
+
+    if (_chunkCrc != _chunkExpectedCrc)
+    {
+        LOG_WARN("⚠️  CRC do bloco em %u não confere (%08lx != %08lx)", _sessionOffset,
+                 (unsigned long)_chunkCrc, (unsigned long)_chunkExpectedCrc);
+        _sessionStatusCode = 422;
+        _sessionMessage = "CRC mismatch";
+        return;
+    }
+
+    if (sessionWrite(_chunkBuffer, _chunkLength) && _sessionState == SESSION_RECEIVING)
+    {
+        _sessionStatusCode = 200;
+        _sessionMessage = "Chunk stored";
+    }
+}
+
+bool OTAPushUpdateManager::sessionWrite(const uint8_t *data, size_t length)
+{
+    if (_sessionState != SESSION_RECEIVING)
+    {
+        return false;
+    }
+
+    if (!OTASession::resume(_uploadToken))
+    {
+        sessionFail(409, "Update preempted by pull");
+        return false;
+    }
+
+    if (_sessionOffset + length > _sessionSize)
+    {
+        uploadAbort();
+        sessionFail(413, "Data beyond firmware size");
+        return false;
+    }
+
+    if (!uploadWrite(const_cast<uint8_t *>(data), length))
+    {
+        sessionFail(_uploadStatusCode, "Update write failed");
+        return false;
+    }
+
+    _sessionOffset += length;
+    _sessionLastMs = OTAClock::millis();
+
+    if (_sessionOffset < _sessionSize)
+    {
+        OTASession::idle(_uploadToken); // Até o próximo bloco
+        return true;
+    }
+
+    // Último bloco: verifica e ativa a nova imagem
+    if (!uploadEnd())
+    {
+        sessionFail(_uploadStatusCode, "Update failed");
+        return false;
+    }
+
+    uploadReset();
+    sessionRelease();
+    _sessionState = SESSION_DONE;
+    _sessionStatusCode = 200;
+    _sessionMessage = "Update successful! Restarting...";
+    return true;
+}
+
+void OTAPushUpdateManager::sessionFail(int code, const char *message)
+{
+    _sessionState = SESSION_FAILED;
+    _sessionStatusCode = code;
+    _sessionMessage = message;
+    uploadReset();
+    sessionRelease();
+}
+
+void OTAPushUpdateManager::sessionChunkAbort()
+{
+    if (_chunkActive)
+    {
+        LOG_WARN("⚠️  Bloco em %u interrompido; a sessão %s aguarda o reenvio", _sessionOffset, _sessionId);
+        _chunkActive = false;
+    }
+}
+
+// ============ WEBSOCKET ============
+
+const char *OTAPushUpdateManager::wsCommand(const char *text, size_t length)
+{
+    char command[64];
+    bool tooLong = length >= sizeof(command);
+    length = min(length, sizeof(command) - 1);
+    memcpy(command, text, length);
+    command[length] = '\0';
+
+    if (tooLong)
+    {
+        // Um comando cortado poderia ser lido como outro: recusa inteiro
+        _sessionStatusCode = 413;
+        _sessionMessage = "Command too long";
+    }
+    else if (strncmp(command, "begin ", 6) == 0)
+    {
+        sessionCreate(strtoul(command + 6, nullptr, 10), "");
+    }
+    else if (strncmp(command, "resume ", 7) == 0)
+    {
+        sessionQuery(command + 7);
+    }
+    else
+    {
+        _sessionStatusCode = 400;
+        _sessionMessage = "Unknown command";
+    }
+
+    _wsSession = (_sessionStatusCode == 200 || _sessionStatusCode == 201) && _sessionState == SESSION_RECEIVING;
+
+    OTABufferPrint out(_wsReply, sizeof(_wsReply));
+    OTAJsonWriter json(out);
+    json.beginObject();
+    if (_wsSession)
+    {
+        json.add("type", "ready");
+        json.add("session", _sessionId);
+        json.add("offset", _sessionOffset);
+        json.add("size", _sessionSize);
+        json.add("frame", (unsigned)OTA_WS_UPLOAD_FRAME);
+        json.add("window", (unsigned)OTA_WS_UPLOAD_WINDOW);
+    }
+    else
+    {
+        json.add("type", "error");
+        json.add("message", _sessionState == SESSION_FAILED && _sessionOwner ? "Update failed" : _sessionMessage);
+    }
+    json.endObject();
+    json.flush();
+
+    sessionResponseReset();
+    return _wsReply;
+}
+
+void OTAPushUpdateManager::wsBinary(const uint8_t *data, size_t length)
+{
+    // Um bloco HTTP em andamento tem prioridade sobre a posição da sessão
+    if (_wsSession && !_chunkActive && length > 0)
+    {
+        sessionWrite(data, length);
+    }
+}
+
+const char *OTAPushUpdateManager::wsBinaryEnd()
+{
+    OTABufferPrint out(_wsReply, sizeof(_wsReply));
+    OTAJsonWriter json(out);
+    json.beginObject();
+
+    if (_wsSession && _sessionState == SESSION_RECEIVING)
+    {
+        json.add("type", "ack");
+        json.add("offset", _sessionOffset);
+    }
+    else if (_wsSession && _sessionState == SESSION_DONE)
+    {
+        json.add("type", "done");
+        json.add("message", _sessionMessage);
+    }
+    else
+    {
+        json.add("type", "error");
+        json.add("message", _wsSession ? _sessionMessage : "No upload session");
+        _wsSession = false;
+    }
+
+    json.endObject();
+    json.flush();
+    return _wsReply;
+}
+
+// ============ RESPOSTA ============
+
+void OTAPushUpdateManager::writeSessionJson(OTAJsonWriter &json)
+{
+    json.beginObject();
+    json.add("state", sessionStateName(_sessionState));
+
+    // Detalhes da sessão só para quem informou (ou acabou de receber) o ID
+    if (_sessionOwner)
+    {
+        json.add("session", _sessionId);
+        json.add("offset", _sessionOffset);
+        json.add("size", _sessionSize);
+    }
+
+    json.add("chunkMax", (unsigned)OTA_UPLOAD_CHUNK_MAX);
+    json.add("message", _sessionMessage);
+    json.endObject();
+}
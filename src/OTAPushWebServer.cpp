@@ -0,0 +1,966 @@
+/**
+ * @file OTAPushWebServer.cpp
+ * @brief Backend síncrono (WebServer) do OTAPushUpdateManager
+ *
+ * As requisições são processadas por handleClient(), chamado pela task
+ * FreeRTOS criada em run() ou pelo loop() da aplicação.
+ */
+
+#include "OTAPushUpdateManager.h"
+
+#if !OTA_ASYNC_WEBSERVER
+
+#include "OTAClock.h"
+#include "OTAEvents.h"
+#include "OTAFileSync.h"
+#include "OTAManager.h"
+#include "OTAMetrics.h"
+#include "OTATrace.h"
+
+#include <mbedtls/base64.h>
+#include <mbedtls/sha1.h>
+#include <mbedtls/version.h>
+
+WebServer *OTAPushUpdateManager::_server = nullptr;
+WiFiClient OTAPushUpdateManager::_eventClients[OTA_EVENTS_MAX_CLIENTS];
+SemaphoreHandle_t OTAPushUpdateManager::_eventMutex = nullptr;
+WiFiClient OTAPushUpdateManager::_wsClient;
+
+namespace
+{
+    // Mede o handler (incluindo o envio da resposta) para /metrics
+    WebServer::THandlerFunction timed(OTAMetrics::Route route, WebServer::THandlerFunction handler)
+    {
+        return [route, handler]()
+        {
+            uint32_t start = micros();
+            handler();
+            OTAMetrics::request(route, micros() - start);
+        };
+    }
+}
+
+// ============ IMPLEMENTAÇÃO DOS MÉTODOS FREERTOS ============
+
+void OTAPushUpdateManager::run(uint32_t stackSize, UBaseType_t priority, BaseType_t core)
+{
+    if (_taskRunning)
+    {
+        LOG_WARN("Thread FreeRTOS já está em execução");
+        return;
+    }
+
+    _taskStackSize = stackSize;
+    _taskPriority = priority;
+    _taskRunning = true; // Antes de criar: a task pode iniciar imediatamente
+
+    // Cria a task FreeRTOS
+    BaseType_t result = OTATasks::create(
+        taskFunction,        // Função da task
+        "WebPageTask",       // Nome da task
+        _taskStackSize,      // Stack size
+        nullptr,             // Parâmetros
+        _taskPriority,       // Prioridade
+        &_webPageTaskHandle, // Handle da task
+        core                 // Núcleo (tskNO_AFFINITY = qualquer)
+    );
+
+    if (result == pdPASS)
+    {
+        LOG_INFO("✅ Thread FreeRTOS iniciada (Stack: %u, Priority: %u, Core: %d)",
+                 _taskStackSize, _taskPriority, core == tskNO_AFFINITY ? -1 : (int)core);
+    }
+    else
+    {
+        LOG_ERROR("❌ Falha ao criar thread FreeRTOS");
+        _taskRunning = false;
+    }
+}
+
+void OTAPushUpdateManager::stop()
+{
+    stopTask();
+}
+
+void OTAPushUpdateManager::stopTask()
+{
+    if (!_taskRunning)
+    {
+        return;
+    }
+
+    if (_webPageTaskHandle != nullptr)
+    {
+        _taskRunning = false;
+
+        // Aguarda a task terminar (timeout de 2 segundos)
+        if (xTaskGetCurrentTaskHandle() != _webPageTaskHandle)
+        {
+            // Só deleta se não for a própria task chamando
+            OTATasks::untrack(_webPageTaskHandle);
+            vTaskDelete(_webPageTaskHandle);
+        }
+
+        _webPageTaskHandle = nullptr;
+        LOG_INFO("🛑 Thread FreeRTOS parada");
+    }
+}
+
+void OTAPushUpdateManager::taskFunction(void *)
+{
+    LOG_INFO("🔄 Thread FreeRTOS iniciada");
+
+    while (_taskRunning)
+    {
+        // Processa requisições web
+        if (_server && _running)
+        {
+            _server->handleClient();
+        }
+
+        wsPoll();
+        OTAEvents::loop();
+
+        // Pequena pausa para não sobrecarregar a CPU
+        OTAClock::delay(10);
+    }
+
+    LOG_INFO("🔄 Thread FreeRTOS finalizada");
+    OTATasks::exitCurrent();
+}
+
+void OTAPushUpdateManager::startServer(uint16_t port)
+{
+    if (_server == nullptr)
+    {
+        _server = new WebServer(port);
+    }
+
+    // Cabeçalhos usados pelos handlers (o WebServer descarta os demais)
+    static const char *headerKeys[] = {"If-None-Match", "X-MD5", "X-CRC32", "Upgrade", "Sec-WebSocket-Key"};
+    _server->collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
+
+    // Configura endpoints
+    for (size_t i = 0; i < _assetCount; i++)
+    {
+        const OTAAsset *asset = _assets[i];
+        _server->on(asset->path, HTTP_GET, timed(OTAMetrics::ROUTE_ASSET, [asset]()
+                                                 { handleAsset(*asset); }));
+    }
+
+    // Página única: as rotas das telas entregam o mesmo documento
+    _server->on("/", HTTP_GET, timed(OTAMetrics::ROUTE_PAGE, handleApp));
+    _server->on("/update", HTTP_GET, timed(OTAMetrics::ROUTE_PAGE, handleApp));
+    _server->on("/system", HTTP_GET, timed(OTAMetrics::ROUTE_PAGE, handleApp));
+
+    _server->on("/api/status", HTTP_GET, timed(OTAMetrics::ROUTE_API_STATUS, []()
+                                               { if (checkAuthentication()) sendJson(writeStatusJson); }));
+    _server->on("/api/system", HTTP_GET, timed(OTAMetrics::ROUTE_API_SYSTEM, []()
+                                               { if (checkAuthentication()) sendJson(writeSystemJson); }));
+    _server->on("/api/ota", HTTP_GET, timed(OTAMetrics::ROUTE_API_OTA, []()
+                                            { if (checkAuthentication()) sendJson(writeOtaJson); }));
+    _server->on("/api/events", HTTP_GET, handleEvents);
+    _server->on("/api/firmware", HTTP_PUT, timed(OTAMetrics::ROUTE_API_FIRMWARE, handleFirmware), handleFirmwareBody);
+    _server->on("/metrics", HTTP_GET, timed(OTAMetrics::ROUTE_METRICS, handleMetrics));
+#if OTA_TRACE_ENABLED
+    _server->on("/api/trace", HTTP_GET, []()
+                { if (checkAuthentication()) sendJson(OTATrace::writeJson); });
+    _server->on("/api/trace", HTTP_DELETE, []()
+                { if (checkAuthentication()) { OTATrace::clear(); _server->send(204); } });
+#endif
+#if OTA_LOG_DEFERRED
+    _server->on("/api/log", HTTP_GET, handleLog);
+#endif
+
+    // Upload retomável (OTAPushUploadSession.cpp)
+    _server->on("/api/upload", HTTP_POST, timed(OTAMetrics::ROUTE_API_UPLOAD, []()
+                                                {
+        if (!checkAuthentication())
+            return;
+        sessionCreate(strtoul(_server->arg("size").c_str(), nullptr, 10), _server->arg("md5"));
+        sendJson(writeSessionJson, _sessionStatusCode);
+        sessionResponseReset(); }));
+    _server->on("/api/upload", HTTP_GET, timed(OTAMetrics::ROUTE_API_UPLOAD, []()
+                                               {
+        if (!checkAuthentication())
+            return;
+        sessionQuery(_server->arg("session"));
+        sendJson(writeSessionJson, _sessionStatusCode);
+        sessionResponseReset(); }));
+    _server->on("/api/upload", HTTP_DELETE, timed(OTAMetrics::ROUTE_API_UPLOAD, []()
+                                                  {
+        if (!checkAuthentication())
+            return;
+        sessionCancel(_server->arg("session"));
+        sendJson(writeSessionJson, _sessionStatusCode);
+        sessionResponseReset(); }));
+    _server->on("/api/upload", HTTP_PUT, timed(OTAMetrics::ROUTE_API_UPLOAD, handleSessionChunk), handleSessionChunkBody);
+    _server->on("/api/ws/upload", HTTP_GET, handleWsUpgrade);
+
+    // Sincronização de arquivos do LittleFS (OTAPushFileSync.cpp)
+    _server->on("/api/files", HTTP_GET, timed(OTAMetrics::ROUTE_API_FILES, handleFilesManifest));
+    _server->on("/api/files", HTTP_PUT, timed(OTAMetrics::ROUTE_API_FILES, handleFiles), handleFilesBody);
+
+    _server->on("/doUpdate", HTTP_POST, timed(OTAMetrics::ROUTE_DO_UPDATE, handleDoUpdate), handleDoUpload);
+    _server->on("/check-updates", HTTP_GET, timed(OTAMetrics::ROUTE_CHECK_UPDATES, handleCheckUpdates));
+    _server->on("/perform-update", HTTP_GET, timed(OTAMetrics::ROUTE_PERFORM_UPDATE, handlePerformUpdate));
+
+    if (_eventMutex == nullptr)
+    {
+        _eventMutex = xSemaphoreCreateMutex();
+    }
+    OTAEvents::setSink(sendEvent);
+
+    // Inicia servidor
+    _server->begin();
+}
+
+void OTAPushUpdateManager::handleClient()
+{
+    if (_taskRunning)
+    {
+        return;
+    }
+    if (_server && _running)
+    {
+        _server->handleClient();
+        wsPoll();
+        OTAEvents::loop();
+    }
+}
+
+// ============ HANDLERS DO SERVIDOR WEB ============
+
+bool OTAPushUpdateManager::checkAuthentication()
+{
+    if (_username == "" || _password == "")
+    {
+        return true;
+    }
+
+    if (_server->authenticate(_username.c_str(), _password.c_str()))
+    {
+        _authenticated = true;
+        return true;
+    }
+
+    _server->requestAuthentication();
+    return false;
+}
+
+namespace
+{
+    // Repassa cada bloco do OTAJsonWriter como um chunk da resposta
+    class ChunkedContent : public Print
+    {
+    public:
+        explicit ChunkedContent(WebServer &server) : _server(server) {}
+
+        size_t write(uint8_t c) override { return write(&c, 1); }
+
+        size_t write(const uint8_t *buffer, size_t size) override
+        {
+            _server.sendContent(reinterpret_cast<const char *>(buffer), size);
+            return size;
+        }
+
+    private:
+        WebServer &_server;
+    };
+}
+
+void OTAPushUpdateManager::sendJson(void (*writer)(OTAJsonWriter &json), int code)
+{
+    OTA_TRACE_SCOPE("web.sendJson");
+
+    ChunkedContent content(*_server);
+    OTAJsonWriter json(content);
+
+    _server->sendHeader("Cache-Control", "no-store");
+    _server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server->send(code, "application/json", "");
+
+    writer(json);
+    json.flush();
+
+    _server->sendContent(""); // Finaliza a resposta chunked
+}
+
+void OTAPushUpdateManager::handleMetrics()
+{
+    if (!checkAuthentication())
+        return;
+
+    ChunkedContent content(*_server);
+
+    _server->sendHeader("Cache-Control", "no-store");
+    _server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server->send(200, "text/plain; version=0.0.4", "");
+
+    OTAMetrics::write(content);
+
+    _server->sendContent(""); // Finaliza a resposta chunked
+}
+
+#if OTA_LOG_DEFERRED
+void OTAPushUpdateManager::handleLog()
+{
+    if (!checkAuthentication())
+        return;
+
+    ChunkedContent content(*_server);
+
+    _server->sendHeader("Cache-Control", "no-store");
+    _server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server->send(200, "text/plain; charset=utf-8", "");
+
+    OTALog::writeTail(content);
+
+    _server->sendContent(""); // Finaliza a resposta chunked
+}
+#endif
+
+void OTAPushUpdateManager::handleAsset(const OTAAsset &asset)
+{
+    OTA_TRACE_SCOPE("web.asset");
+
+    bool versioned = _server->hasArg("v") && _server->arg("v") == asset.version;
+
+    _server->sendHeader("ETag", asset.etag);
+    _server->sendHeader("Cache-Control", assetCacheControl(versioned));
+
+    // O navegador já tem esta versão: responde sem corpo
+    if (_server->header("If-None-Match").indexOf(asset.etag) >= 0)
+    {
+        LOG_DEBUG("Arquivo %s não modificado (304)", asset.path);
+        _server->send(304);
+        return;
+    }
+
+    if (asset.gzip)
+    {
+        _server->sendHeader("Content-Encoding", "gzip");
+    }
+
+    LOG_DEBUG("Enviando %s (%u bytes)", asset.path, (unsigned)asset.size);
+    _server->send_P(200, asset.contentType, reinterpret_cast<const char *>(asset.data), asset.size);
+}
+
+void OTAPushUpdateManager::handleEvents()
+{
+    if (!checkAuthentication())
+        return;
+
+    WiFiClient client = _server->client();
+
+    xSemaphoreTake(_eventMutex, portMAX_DELAY);
+
+    // Procura um espaço livre (conexões encerradas são reaproveitadas)
+    int slot = -1;
+    for (int i = 0; i < OTA_EVENTS_MAX_CLIENTS; i++)
+    {
+        if (!_eventClients[i].connected())
+        {
+            _eventClients[i].stop();
+            slot = i;
+            break;
+        }
+    }
+
+    if (slot < 0)
+    {
+        xSemaphoreGive(_eventMutex);
+        LOG_WARN("⚠️  Limite de %d clientes de eventos atingido", OTA_EVENTS_MAX_CLIENTS);
+        _server->send(503, "text/plain", "Too many event clients");
+        return;
+    }
+
+    // Cabeçalhos escritos diretamente: a resposta não tem fim
+    client.print("HTTP/1.1 200 OK\r\n"
+                 "Content-Type: text/event-stream\r\n"
+                 "Cache-Control: no-cache\r\n"
+                 "Connection: keep-alive\r\n"
+                 "\r\n"
+                 "retry: 3000\n\n");
+    _eventClients[slot] = client;
+
+    xSemaphoreGive(_eventMutex);
+
+    LOG_DEBUG("Cliente de eventos conectado (%d)", slot);
+}
+
+void OTAPushUpdateManager::sendEvent(const char *event, const char *data)
+{
+    if (_eventMutex == nullptr)
+    {
+        return;
+    }
+
+    xSemaphoreTake(_eventMutex, portMAX_DELAY);
+
+    for (int i = 0; i < OTA_EVENTS_MAX_CLIENTS; i++)
+    {
+        WiFiClient &client = _eventClients[i];
+        if (!client.connected())
+        {
+            continue;
+        }
+
+        // Falha de escrita: a página foi fechada
+        size_t expected = strlen(event) + strlen(data) + 16;
+        size_t written = client.printf("event: %s\ndata: %s\n\n", event, data);
+        if (written != expected)
+        {
+            LOG_DEBUG("Cliente de eventos desconectado (%d)", i);
+            client.stop();
+        }
+    }
+
+    xSemaphoreGive(_eventMutex);
+}
+
+// ============ WEBSOCKET (RFC 6455) ============
+
+namespace
+{
+    // Estado do frame em leitura: o cabeçalho pode chegar em partes
+    struct WsFrameState
+    {
+        uint8_t header[14];  ///< Cabeçalho recebido até agora
+        uint8_t headerLength;
+        uint8_t opcode;      ///< Opcode da mensagem (continuações herdam o do primeiro frame)
+        bool final;          ///< Último frame da mensagem (FIN)
+        bool inPayload;
+        uint64_t remaining;  ///< Bytes do payload ainda não lidos
+        uint8_t mask[4];
+        uint8_t maskIndex;
+        char text[64];       ///< Mensagem de texto (comandos)
+        size_t textLength;
+        uint8_t control[125]; ///< Payload de ping/close
+        size_t controlLength;
+    };
+
+    WsFrameState wsFrame;
+    uint8_t wsBuffer[1460];
+
+    // Tamanho total do cabeçalho, ou 0 se ainda não é possível saber
+    uint8_t wsHeaderSize(const WsFrameState &frame)
+    {
+        if (frame.headerLength < 2)
+            return 0;
+        uint8_t length = frame.header[1] & 0x7F;
+        uint8_t size = 2 + (length == 126 ? 2 : length == 127 ? 8 : 0);
+        return (frame.header[1] & 0x80) ? size + 4 : size;
+    }
+}
+
+void OTAPushUpdateManager::handleWsUpgrade()
+{
+    if (!checkAuthentication())
+        return;
+
+    String key = _server->header("Sec-WebSocket-Key");
+    if (!_server->header("Upgrade").equalsIgnoreCase("websocket") || key.length() == 0)
+    {
+        _server->send(400, "text/plain", "WebSocket upgrade required");
+        return;
+    }
+
+    if (_wsClient.connected())
+    {
+        _server->send(409, "text/plain", "Another WebSocket upload is active");
+        return;
+    }
+
+    // Sec-WebSocket-Accept = base64(SHA-1(chave + GUID))
+    key += "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+    uint8_t digest[20];
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000
+    mbedtls_sha1(reinterpret_cast<const uint8_t *>(key.c_str()), key.length(), digest);
+#else
+    mbedtls_sha1_ret(reinterpret_cast<const uint8_t *>(key.c_str()), key.length(), digest);
+#endif
+    unsigned char accept[32];
+    size_t acceptLength = 0;
+    mbedtls_base64_encode(accept, sizeof(accept), &acceptLength, digest, sizeof(digest));
+
+    // A conexão deixa de ser HTTP: a resposta é escrita diretamente
+    WiFiClient client = _server->client();
+    client.printf("HTTP/1.1 101 Switching Protocols\r\n"
+                  "Upgrade: websocket\r\n"
+                  "Connection: Upgrade\r\n"
+                  "Sec-WebSocket-Accept: %.*s\r\n"
+                  "\r\n",
+                  (int)acceptLength, accept);
+
+    _wsClient.stop();
+    _wsClient = client;
+    _wsSession = false;
+    memset(&wsFrame, 0, sizeof(wsFrame));
+
+    LOG_INFO("🔌 Cliente WebSocket de upload conectado");
+}
+
+void OTAPushUpdateManager::wsPoll()
+{
+    if (!_wsClient.connected())
+    {
+        if (_wsSession)
+        {
+            // A sessão continua válida: o cliente pode retomá-la
+            LOG_WARN("⚠️  Cliente WebSocket de upload desconectado");
+            wsClose();
+        }
+        return;
+    }
+
+    // Limita o trabalho por chamada para não atrasar as requisições HTTP
+    size_t budget = OTA_WS_UPLOAD_FRAME * OTA_WS_UPLOAD_WINDOW;
+
+    while (budget > 0 && _wsClient.available() > 0)
+    {
+        WsFrameState &frame = wsFrame;
+
+        if (!frame.inPayload)
+        {
+            // Cabeçalho: lê byte a byte até conhecer o tamanho completo
+            int c = _wsClient.read();
+            if (c < 0)
+                break;
+            frame.header[frame.headerLength++] = (uint8_t)c;
+            budget--;
+
+            uint8_t size = wsHeaderSize(frame);
+            if (size == 0 || frame.headerLength < size)
+            {
+                continue;
+            }
+
+            uint8_t opcode = frame.header[0] & 0x0F;
+            uint8_t length = frame.header[1] & 0x7F;
+            uint8_t pos = 2;
+
+            if (length == 126)
+            {
+                frame.remaining = ((uint16_t)frame.header[2] << 8) | frame.header[3];
+                pos = 4;
+            }
+            else if (length == 127)
+            {
+                frame.remaining = 0;
+                for (int i = 0; i < 8; i++)
+                    frame.remaining = (frame.remaining << 8) | frame.header[2 + i];
+                pos = 10;
+            }
+            else
+            {
+                frame.remaining = length;
+            }
+
+            // Frames do cliente são sempre mascarados (RFC 6455, 5.1)
+            if (!(frame.header[1] & 0x80))
+            {
+                LOG_WARN("⚠️  Frame WebSocket sem máscara");
+                wsClose();
+                return;
+            }
+            memcpy(frame.mask, frame.header + pos, 4);
+
+            if (opcode >= 0x8 && frame.remaining > sizeof(frame.control))
+            {
+                wsClose();
+                return;
+            }
+
+            if (opcode < 0x8)
+            {
+                // Frames de controle podem chegar entre fragmentos de uma mensagem
+                if (opcode != 0x0)
+                {
+                    frame.opcode = opcode;
+                    frame.textLength = 0;
+                }
+                frame.final = (frame.header[0] & 0x80) != 0;
+            }
+
+            frame.controlLength = 0;
+            frame.maskIndex = 0;
+            frame.inPayload = true;
+            frame.headerLength = 0; // header[0] segue válido até o próximo frame
+        }
+
+        uint8_t opcode = frame.header[0] & 0x0F;
+
+        if (frame.remaining > 0)
+        {
+            size_t wanted = (size_t)min<uint64_t>(frame.remaining, min(sizeof(wsBuffer), budget));
+            int length = _wsClient.read(wsBuffer, wanted);
+            if (length <= 0)
+                break;
+
+            for (int i = 0; i < length; i++)
+            {
+                wsBuffer[i] ^= frame.mask[frame.maskIndex];
+                frame.maskIndex = (frame.maskIndex + 1) & 3;
+            }
+            frame.remaining -= length;
+            budget -= min((size_t)length, budget);
+
+            if (opcode >= 0x8)
+            {
+                memcpy(frame.control + frame.controlLength, wsBuffer, length);
+                frame.controlLength += length;
+            }
+            else if (frame.opcode == 0x2)
+            {
+                wsBinary(wsBuffer, length);
+            }
+            else if (frame.opcode == 0x1)
+            {
+                if ((size_t)length > sizeof(frame.text) - frame.textLength)
+                {
+                    // Comandos são curtos: fecha com 1009 (mensagem grande demais) em vez de cortar
+                    LOG_WARN("⚠️  Comando WebSocket maior que %u bytes", (unsigned)sizeof(frame.text));
+                    static const uint8_t tooBig[2] = {1009 >> 8, 1009 & 0xFF};
+                    wsSend(0x8, tooBig, sizeof(tooBig));
+                    wsClose();
+                    return;
+                }
+                memcpy(frame.text + frame.textLength, wsBuffer, length);
+                frame.textLength += length;
+            }
+        }
+
+        if (frame.remaining > 0)
+        {
+            continue;
+        }
+
+        // Frame completo
+        frame.inPayload = false;
+
+        if (opcode == 0x8)
+        {
+            // Close: devolve o mesmo código e encerra
+            wsSend(0x8, frame.control, min(frame.controlLength, (size_t)2));
+            wsClose();
+            return;
+        }
+        if (opcode == 0x9)
+        {
+            wsSend(0xA, frame.control, frame.controlLength);
+            continue;
+        }
+        if (opcode == 0xA || !frame.final)
+        {
+            continue;
+        }
+
+        if (frame.opcode == 0x1)
+        {
+            const char *reply = wsCommand(frame.text, frame.textLength);
+            wsSend(0x1, reinterpret_cast<const uint8_t *>(reply), strlen(reply));
+        }
+        else if (frame.opcode == 0x2)
+        {
+            // Confirma só depois que o frame foi gravado na flash
+            bool restart = (_wsSession && _sessionState == SESSION_DONE);
+            const char *reply = wsBinaryEnd();
+            wsSend(0x1, reinterpret_cast<const uint8_t *>(reply), strlen(reply));
+
+            if (restart)
+            {
+                _wsClient.stop();
+                OTAClock::delay(2000);
+                ESP.restart();
+            }
+        }
+    }
+}
+
+void OTAPushUpdateManager::wsSend(uint8_t opcode, const uint8_t *payload, size_t length)
+{
+    // Frames do servidor não são mascarados; as respostas cabem em 16 bits
+    uint8_t header[4] = {(uint8_t)(0x80 | opcode)};
+    size_t headerLength = 2;
+
+    if (length < 126)
+    {
+        header[1] = length;
+    }
+    else
+    {
+        header[1] = 126;
+        header[2] = length >> 8;
+        header[3] = length & 0xFF;
+        headerLength = 4;
+    }
+
+    _wsClient.write(header, headerLength);
+    if (length > 0)
+    {
+        _wsClient.write(payload, length);
+    }
+}
+
+void OTAPushUpdateManager::wsClose()
+{
+    _wsClient.stop();
+    _wsSession = false;
+    memset(&wsFrame, 0, sizeof(wsFrame));
+}
+
+void OTAPushUpdateManager::handleApp()
+{
+    if (!checkAuthentication())
+        return;
+
+    handleAsset(_appAsset);
+}
+
+void OTAPushUpdateManager::handleDoUpload()
+{
+    OTA_TRACE_SCOPE("push.doUpload");
+
+    if (!checkAuthentication())
+        return;
+
+    HTTPUpload &upload = _server->upload();
+
+    if (upload.status == UPLOAD_FILE_START)
+    {
+        uploadBegin(upload.filename, UPDATE_SIZE_UNKNOWN, _server->clientContentLength());
+    }
+    else if (upload.status == UPLOAD_FILE_WRITE)
+    {
+        uploadWrite(upload.buf, upload.currentSize);
+    }
+    else if (upload.status == UPLOAD_FILE_END)
+    {
+        uploadEnd();
+    }
+    else if (upload.status == UPLOAD_FILE_ABORTED)
+    {
+        uploadAbort();
+    }
+}
+
+void OTAPushUpdateManager::handleDoUpdate()
+{
+    if (!checkAuthentication())
+        return;
+
+    // Resposta final do upload, preparada por uploadBegin()/uploadEnd()
+    bool restart = (_uploadStatusCode == 200);
+    _server->send(_uploadStatusCode, "text/plain", _uploadMessage);
+    uploadReset();
+
+    if (restart)
+    {
+        OTAClock::delay(2000);
+        ESP.restart();
+    }
+}
+
+void OTAPushUpdateManager::handleFirmwareBody()
+{
+    OTA_TRACE_SCOPE("push.firmwareBody");
+
+    // Sem credenciais válidas os dados são descartados; handleFirmware responde 401
+    if (_username != "" && _password != "" &&
+        !_server->authenticate(_username.c_str(), _password.c_str()))
+    {
+        return;
+    }
+
+    // O corpo chega em blocos de HTTP_RAW_BUFLEN bytes, sem parsing de multipart
+    HTTPRaw &raw = _server->raw();
+
+    if (raw.status == RAW_START)
+    {
+        // Content-Length conhecido: o Update já reserva e valida o tamanho da imagem
+        if (uploadBegin("", _server->clientContentLength()) && _server->hasHeader("X-MD5"))
+        {
+            uploadExpectMD5(_server->header("X-MD5"));
+        }
+    }
+    else if (raw.status == RAW_WRITE)
+    {
+        uploadWrite(raw.buf, raw.currentSize);
+    }
+    else if (raw.status == RAW_END)
+    {
+        uploadEnd();
+    }
+    else if (raw.status == RAW_ABORTED)
+    {
+        uploadAbort();
+    }
+}
+
+void OTAPushUpdateManager::handleFirmware()
+{
+    if (!checkAuthentication())
+        return;
+
+    // Resposta final do upload, preparada por uploadBegin()/uploadEnd()
+    bool restart = (_uploadStatusCode == 200);
+    sendJson(writeUploadJson, _uploadStatusCode);
+    uploadReset();
+
+    if (restart)
+    {
+        OTAClock::delay(2000);
+        ESP.restart();
+    }
+}
+
+void OTAPushUpdateManager::handleSessionChunkBody()
+{
+    OTA_TRACE_SCOPE("push.chunkBody");
+
+    // Sem credenciais válidas os dados são descartados; handleSessionChunk responde 401
+    if (_username != "" && _password != "" &&
+        !_server->authenticate(_username.c_str(), _password.c_str()))
+    {
+        return;
+    }
+
+    HTTPRaw &raw = _server->raw();
+
+    if (raw.status == RAW_START)
+    {
+        sessionChunkBegin(_server->arg("session"), strtoul(_server->arg("offset").c_str(), nullptr, 10),
+                          _server->clientContentLength(), _server->header("X-CRC32"));
+    }
+    else if (raw.status == RAW_WRITE)
+    {
+        sessionChunkData(raw.buf, raw.currentSize);
+    }
+    else if (raw.status == RAW_END)
+    {
+        sessionChunkEnd();
+    }
+    else if (raw.status == RAW_ABORTED)
+    {
+        sessionChunkAbort();
+    }
+}
+
+void OTAPushUpdateManager::handleSessionChunk()
+{
+    if (!checkAuthentication())
+        return;
+
+    bool restart = (_sessionState == SESSION_DONE && _sessionStatusCode == 200);
+    sendJson(writeSessionJson, _sessionStatusCode);
+    sessionResponseReset();
+
+    if (restart)
+    {
+        OTAClock::delay(2000);
+        ESP.restart();
+    }
+}
+
+void OTAPushUpdateManager::handleFilesManifest()
+{
+    if (!checkAuthentication())
+        return;
+
+    // Um patch aplicado por outra task termina antes da listagem, mas sem travar o servidor
+    if (!OTAFileSync::lock(OTA_FILESYNC_LOCK_TIMEOUT_MS))
+    {
+        sendJson([](OTAJsonWriter &json)
+                 { json.beginObject().add("status", "error").add("message", "File system busy, retry").endObject(); },
+                 503);
+        return;
+    }
+
+    ChunkedContent content(*_server);
+
+    _server->sendHeader("Cache-Control", "no-store");
+    _server->sendHeader("X-Files-Revision", OTAFileSync::getRevision());
+    _server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server->send(200, "text/plain", "");
+
+    OTAFileSync::writeManifest(content);
+    OTAFileSync::unlock();
+
+    _server->sendContent(""); // Finaliza a resposta chunked
+}
+
+void OTAPushUpdateManager::handleFilesBody()
+{
+    OTA_TRACE_SCOPE("push.filesBody");
+
+    // Sem credenciais válidas os dados são descartados; handleFiles responde 401
+    if (_username != "" && _password != "" &&
+        !_server->authenticate(_username.c_str(), _password.c_str()))
+    {
+        return;
+    }
+
+    HTTPRaw &raw = _server->raw();
+
+    if (raw.status == RAW_START)
+    {
+        filesBegin(_server->clientContentLength());
+    }
+    else if (raw.status == RAW_WRITE)
+    {
+        filesWrite(raw.buf, raw.currentSize);
+    }
+    else if (raw.status == RAW_END)
+    {
+        filesEnd();
+    }
+    else if (raw.status == RAW_ABORTED)
+    {
+        filesAbort();
+    }
+}
+
+void OTAPushUpdateManager::handleFiles()
+{
+    if (!checkAuthentication())
+        return;
+
+    // Resposta preparada por filesBegin()/filesEnd(); os arquivos já valem, sem reiniciar
+    sendJson(writeFilesJson, _filesStatusCode);
+    filesReset();
+}
+
+void OTAPushUpdateManager::handleCheckUpdates()
+{
+    if (!checkAuthentication())
+        return;
+
+    OTAManager::checkForUpdates();
+
+    _server->send(200, "application/json",
+                  "{\"status\":\"success\", \"message\":\"" + getCheckUpdatesMessage() + "\"}");
+}
+
+void OTAPushUpdateManager::handlePerformUpdate()
+{
+    if (!checkAuthentication())
+        return;
+
+    if (OTAManager::isUpdateAvailable())
+    {
+        _server->send(200, "application/json",
+                      "{\"status\":\"success\", \"message\":\"Iniciando atualização...\"}");
+
+        // Pequeno delay para enviar a resposta antes de reiniciar
+        OTAClock::delay(1000);
+        OTAManager::performUpdate();
+    }
+    else
+    {
+        _server->send(400, "application/json",
+                      "{\"status\":\"error\", \"message\":\"Nenhuma atualização disponível\"}");
+    }
+}
+
+#endif // !OTA_ASYNC_WEBSERVER
@@ -0,0 +1,265 @@
+#include "OTASession.h"
+#include "OTAClock.h"
+#include "OTAStatus.h"
+
+#include <freertos/task.h>
+
+// ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
+
+OTASession::Owner OTASession::_active = OTASession::OWNER_NONE;
+OTASession::Token OTASession::_token = 0;
+OTASession::Token OTASession::_nextToken = 0;
+uint32_t OTASession::_activeSinceMs = 0;
+bool OTASession::_revoked = false;
+bool OTASession::_idle = false;
+OTASession::RevokeHandler OTASession::_onRevoke = nullptr;
+OTASession::Owner OTASession::_queued = OTASession::OWNER_NONE;
+uint32_t OTASession::_queuedSinceMs = 0;
+OTASession::Policy OTASession::_policy = OTA_SESSION_PUSH_WINS ? OTASession::POLICY_PUSH_WINS
+                                                               : OTASession::POLICY_PULL_WINS;
+uint32_t OTASession::_preemptions = 0;
+uint32_t OTASession::_denials = 0;
+portMUX_TYPE OTASession::_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
+
+namespace
+{
+    // Mantém as flags de atualização do OTAStatus em sincronia com o dono
+    void publishOwner(OTASession::Owner owner, bool updating)
+    {
+        if (owner == OTASession::OWNER_PUSH)
+        {
+            OTAStatus::setPushUpdating(updating);
+        }
+        else if (owner == OTASession::OWNER_PULL)
+        {
+            OTAStatus::setPullUpdating(updating);
+        }
+    }
+}
+
+OTASession::Token OTASession::grant(Owner owner, RevokeHandler onRevoke, bool &pending)
+{
+    pending = false;
+
+    // Segunda volta: o dono parado foi abortado pelo árbitro na primeira
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        portENTER_CRITICAL(&_lock);
+
+        // Livre: concede a sessão
+        if (_active == OWNER_NONE)
+        {
+            if (++_nextToken == 0)
+            {
+                _nextToken = 1; // 0 é reservado para "sem sessão"
+            }
+            _token = _nextToken;
+            _active = owner;
+            _activeSinceMs = OTAClock::millis();
+            _revoked = false;
+            _idle = false;
+            _onRevoke = onRevoke;
+            if (_queued == owner)
+            {
+                _queued = OWNER_NONE;
+            }
+            Token token = _token;
+            publishOwner(owner, true);
+            portEXIT_CRITICAL(&_lock);
+
+            LOG_DEBUG("Sessão OTA concedida ao %s (token %u)", ownerName(owner), token);
+            return token;
+        }
+
+        Owner active = _active;
+        bool wins = (active != owner) &&
+                    ((owner == OWNER_PUSH) == (_policy == POLICY_PUSH_WINS));
+
+        if (active != owner && _queued != owner)
+        {
+            _queued = owner;
+            _queuedSinceMs = OTAClock::millis();
+        }
+
+        if (!wins)
+        {
+            _denials++;
+            portEXIT_CRITICAL(&_lock);
+
+            LOG_WARN("⏳ Sessão OTA negada ao %s: %s em andamento", ownerName(owner), ownerName(active));
+            return 0;
+        }
+
+        // Vence pela política: revoga o dono atual
+        bool first = !_revoked;
+        _revoked = true;
+
+        // Parado entre requisições ele não perceberia: o árbitro o aborta aqui
+        RevokeHandler abortIdle = nullptr;
+        if (_idle)
+        {
+            _idle = false;
+            abortIdle = _onRevoke;
+        }
+
+        portEXIT_CRITICAL(&_lock);
+
+        if (first)
+        {
+            LOG_WARN("⚡ %s tem prioridade: interrompendo %s", ownerName(owner), ownerName(active));
+        }
+
+        if (abortIdle == nullptr)
+        {
+            break;
+        }
+        abortIdle();
+    }
+
+    pending = true;
+    return 0;
+}
+
+OTASession::Token OTASession::acquire(Owner owner, RevokeHandler onRevoke)
+{
+    uint32_t startMs = OTAClock::millis();
+
+    while (true)
+    {
+        bool pending;
+        Token token = grant(owner, onRevoke, pending);
+        if (!pending)
+        {
+            return token;
+        }
+
+        if (OTAClock::millis() - startMs >= OTA_SESSION_PREEMPT_TIMEOUT_MS)
+        {
+            // O dono não liberou a tempo: mantém a sessão dele
+            portENTER_CRITICAL(&_lock);
+            Owner active = _active;
+            _revoked = false;
+            _denials++;
+            portEXIT_CRITICAL(&_lock);
+
+            LOG_WARN("⏳ %s não liberou o Update em %u ms; sessão negada ao %s",
+                     ownerName(active), OTA_SESSION_PREEMPT_TIMEOUT_MS, ownerName(owner));
+            return 0;
+        }
+
+        OTAClock::delay(10);
+    }
+}
+
+OTASession::Token OTASession::tryAcquire(Owner owner, bool &pending, RevokeHandler onRevoke)
+{
+    return grant(owner, onRevoke, pending);
+}
+
+void OTASession::idle(Token token)
+{
+    RevokeHandler abortNow = nullptr;
+
+    portENTER_CRITICAL(&_lock);
+    if (token != 0 && token == _token)
+    {
+        if (_revoked)
+        {
+            abortNow = _onRevoke; // Revogado enquanto gravava: aborta antes de parar
+        }
+        else if (_onRevoke != nullptr)
+        {
+            _idle = true; // Sem RevokeHandler o dono continua responsável por conferir o token
+        }
+    }
+    portEXIT_CRITICAL(&_lock);
+
+    if (abortNow)
+    {
+        abortNow();
+    }
+}
+
+bool OTASession::resume(Token token)
+{
+    portENTER_CRITICAL(&_lock);
+    bool valid = (token != 0 && token == _token && !_revoked);
+    if (valid)
+    {
+        _idle = false;
+    }
+    portEXIT_CRITICAL(&_lock);
+    return valid;
+}
+
+bool OTASession::isValid(Token token)
+{
+    portENTER_CRITICAL(&_lock);
+    bool valid = (token != 0 && token == _token && !_revoked);
+    portEXIT_CRITICAL(&_lock);
+    return valid;
+}
+
+void OTASession::release(Token token)
+{
+    portENTER_CRITICAL(&_lock);
+
+    if (token == 0 || token != _token)
+    {
+        portEXIT_CRITICAL(&_lock);
+        return;
+    }
+
+    Owner owner = _active;
+    if (_revoked)
+    {
+        _preemptions++;
+    }
+    _active = OWNER_NONE;
+    _token = 0;
+    _revoked = false;
+    _idle = false;
+    _onRevoke = nullptr;
+    publishOwner(owner, false);
+
+    portEXIT_CRITICAL(&_lock);
+
+    LOG_DEBUG("Sessão OTA liberada pelo %s (token %u)", ownerName(owner), token);
+}
+
+void OTASession::setPolicy(Policy policy)
+{
+    portENTER_CRITICAL(&_lock);
+    _policy = policy;
+    portEXIT_CRITICAL(&_lock);
+
+    LOG_INFO("⚖️  Política de sessão OTA: %s tem prioridade", policy == POLICY_PUSH_WINS ? "Push" : "Pull");
+}
+
+OTASession::Policy OTASession::getPolicy()
+{
+    return _policy;
+}
+
+OTASession::Info OTASession::info()
+{
+    portENTER_CRITICAL(&_lock);
+    Info info = {_active, _activeSinceMs, _revoked, _queued, _queuedSinceMs, _policy, _preemptions, _denials};
+    portEXIT_CRITICAL(&_lock);
+    return info;
+}
+
+const char *OTASession::ownerName(Owner owner)
+{
+    switch (owner)
+    {
+    case OWNER_PUSH:
+        return "push";
+    case OWNER_PULL:
+        return "pull";
+    default:
+        return "none";
+    }
+}
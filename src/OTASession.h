@@ -0,0 +1,135 @@
+#pragma once
+
+/**
+ * @file OTASession.h
+ * @brief Árbitro do Update: um único escritor por vez (Push ou Pull)
+ *
+ * Push e Pull gravam pelo mesmo singleton Update. Antes de Update.begin()
+ * cada lado pede uma sessão com acquire() e recebe um token; o token é
+ * conferido com isValid() a cada bloco gravado e devolvido com release().
+ *
+ * Se o outro lado já tem a sessão, a política decide: o perdedor é negado
+ * (e fica registrado como na fila) ou o token ativo é revogado. O dono
+ * revogado percebe no próximo bloco, aborta o Update e libera a sessão.
+ * acquire() espera até OTA_SESSION_PREEMPT_TIMEOUT_MS por isso; tryAcquire()
+ * não espera (task do AsyncTCP) e o cliente tenta de novo.
+ *
+ * Um dono parado entre requisições (upload retomável) não confere o token:
+ * ele se declara com idle() e volta com resume(). Revogado nesse estado, o
+ * próprio árbitro o aborta com o RevokeHandler passado na concessão.
+ */
+
+#include "OTAConfig.h"
+#include "OTALog.h"
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+class OTASession
+{
+public:
+    /**
+     * @brief Quem está gravando o Update
+     */
+    enum Owner
+    {
+        OWNER_NONE = 0,
+        OWNER_PUSH, ///< Upload pela página web ou API
+        OWNER_PULL  ///< Download do servidor de atualizações
+    };
+
+    /**
+     * @brief Quem vence quando os dois lados disputam o Update
+     */
+    enum Policy
+    {
+        POLICY_PUSH_WINS = 0, ///< O upload interrompe o download em andamento
+        POLICY_PULL_WINS      ///< O download interrompe o upload em andamento
+    };
+
+    typedef uint32_t Token; ///< 0 = nenhuma sessão
+
+    /**
+     * @brief Aborta o Update de um dono parado e chama release() (executado
+     * pela task de quem venceu a disputa)
+     */
+    typedef void (*RevokeHandler)();
+
+    /**
+     * @brief Estado do árbitro (para a API e diagnóstico)
+     */
+    struct Info
+    {
+        Owner active;           ///< Dono atual
+        uint32_t activeSinceMs; ///< OTAClock::millis() da concessão
+        bool preempting;        ///< Token ativo revogado, aguardando o dono liberar
+        Owner queued;           ///< Último lado negado ou aguardando preempção
+        uint32_t queuedSinceMs;
+        Policy policy;
+        uint32_t preemptions; ///< Sessões interrompidas desde o boot
+        uint32_t denials;     ///< Pedidos negados desde o boot
+    };
+
+    /**
+     * @brief Pede a sessão do Update
+     * Pode bloquear até OTA_SESSION_PREEMPT_TIMEOUT_MS enquanto o dono anterior aborta
+     * @param onRevoke Aborta este dono se ele for revogado enquanto parado (ver idle())
+     * @return Token da sessão, ou 0 se negada
+     */
+    static Token acquire(Owner owner, RevokeHandler onRevoke = nullptr);
+
+    /**
+     * @brief Pede a sessão do Update sem bloquear
+     * @param pending true se a política deu a vez a este lado, mas o dono
+     * revogado ainda não liberou: tente de novo em instantes
+     * @return Token da sessão, ou 0 se negada ou pendente
+     */
+    static Token tryAcquire(Owner owner, bool &pending, RevokeHandler onRevoke = nullptr);
+
+    /**
+     * @brief Confere se o token ainda é o dono da sessão
+     * @return false se a sessão foi revogada: o dono deve abortar o Update e chamar release()
+     */
+    static bool isValid(Token token);
+
+    /**
+     * @brief O dono parou de gravar até a próxima requisição
+     * Se o token já foi revogado, o RevokeHandler é executado agora
+     */
+    static void idle(Token token);
+
+    /**
+     * @brief O dono parado volta a usar o Update
+     * @return false se a sessão foi revogada enquanto parada: o árbitro já
+     * abortou o Update e o dono não deve mais mexer nele
+     */
+    static bool resume(Token token);
+
+    /**
+     * @brief Devolve a sessão (tokens inválidos ou 0 são ignorados)
+     */
+    static void release(Token token);
+
+    static void setPolicy(Policy policy);
+    static Policy getPolicy();
+    static Info info();
+
+    static const char *ownerName(Owner owner);
+
+private:
+    static Token grant(Owner owner, RevokeHandler onRevoke, bool &pending);
+
+    static Owner _active;
+    static Token _token;
+    static Token _nextToken;
+    static uint32_t _activeSinceMs;
+    static bool _revoked;
+    static bool _idle;                ///< Dono parado entre requisições
+    static RevokeHandler _onRevoke;   ///< Aborta o dono parado
+    static Owner _queued;
+    static uint32_t _queuedSinceMs;
+    static Policy _policy;
+    static uint32_t _preemptions;
+    static uint32_t _denials;
+    static portMUX_TYPE _lock;
+};
@@ -0,0 +1,103 @@
+#include "OTAStatus.h"
+#include "OTAManager.h"
+
+// ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
+
+OTAStatus::Storage OTAStatus::_storage = {{false, false, false, false, OTAManager::HYBRID, FIRMWARE_VERSION, ""}};
+uint32_t OTAStatus::_sequence = 0;
+portMUX_TYPE OTAStatus::_writeLock = portMUX_INITIALIZER_UNLOCKED;
+
+// ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
+
+OTAStatusSnapshot OTAStatus::get()
+{
+    Storage copy;
+    uint32_t before;
+    uint32_t after;
+
+    // Sequência ímpar ou alterada durante a cópia: um escritor publicou, copia de novo
+    do
+    {
+        before = __atomic_load_n(&_sequence, __ATOMIC_ACQUIRE);
+        for (size_t i = 0; i < WORDS; i++)
+        {
+            copy.words[i] = __atomic_load_n(&_storage.words[i], __ATOMIC_RELAXED);
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        after = __atomic_load_n(&_sequence, __ATOMIC_RELAXED);
+    } while ((before & 1) || before != after);
+
+    return copy.snapshot;
+}
+
+template <typename Change>
+bool OTAStatus::update(Change change)
+{
+    // A seção crítica impede que o escritor seja interrompido no meio da
+    // publicação; leitores no outro núcleo esperam no máximo esta cópia
+    portENTER_CRITICAL(&_writeLock);
+
+    Storage next = _storage; // Só escritores alteram _storage, e eles estão serializados
+    bool changed = change(next.snapshot);
+
+    if (changed)
+    {
+        uint32_t sequence = _sequence;
+        __atomic_store_n(&_sequence, sequence + 1, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        for (size_t i = 0; i < WORDS; i++)
+        {
+            __atomic_store_n(&_storage.words[i], next.words[i], __ATOMIC_RELAXED);
+        }
+        __atomic_store_n(&_sequence, sequence + 2, __ATOMIC_RELEASE);
+    }
+
+    portEXIT_CRITICAL(&_writeLock);
+    return changed;
+}
+
+void OTAStatus::setPushUpdating(bool updating)
+{
+    update([updating](OTAStatusSnapshot &status)
+           { status.pushUpdating = updating; return true; });
+}
+
+void OTAStatus::setPullUpdating(bool updating)
+{
+    update([updating](OTAStatusSnapshot &status)
+           { status.pullUpdating = updating; return true; });
+}
+
+void OTAStatus::setPullThreadRunning(bool running)
+{
+    update([running](OTAStatusSnapshot &status)
+           { status.pullThreadRunning = running; return true; });
+}
+
+void OTAStatus::setMode(uint8_t mode)
+{
+    update([mode](OTAStatusSnapshot &status)
+           { status.mode = mode; return true; });
+}
+
+void OTAStatus::setCurrentVersion(const char *version)
+{
+    // Copiada antes da seção crítica: versões maiores são truncadas
+    char copy[OTA_STATUS_VERSION_MAX];
+    snprintf(copy, sizeof(copy), "%s", version);
+
+    update([&copy](OTAStatusSnapshot &status)
+           { memcpy(status.currentVersion, copy, sizeof(copy)); return true; });
+}
+
+void OTAStatus::setLatestVersion(const char *latestVersion, bool available)
+{
+    char copy[OTA_STATUS_VERSION_MAX];
+    snprintf(copy, sizeof(copy), "%s", latestVersion);
+
+    update([&copy, available](OTAStatusSnapshot &status)
+           {
+        memcpy(status.latestVersion, copy, sizeof(copy));
+        status.updateAvailable = available;
+        return true; });
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+/**
+ * @file OTAStatus.h
+ * @brief Estado das atualizações OTA compartilhado entre as tasks
+ *
+ * As flags e versões lidas pela task web, pela task do Pull e pelo loop()
+ * da aplicação ficam num único snapshot de tamanho fixo, publicado por um
+ * seqlock: get() copia o snapshot sem locks nem alocação e repete a cópia
+ * se um escritor publicou no meio dela. As escritas (raras) são
+ * serializadas por uma seção crítica curta.
+ *
+ * Exemplo:
+ * OTAStatusSnapshot status = OTAStatus::get();
+ * if (!status.pullUpdating) Serial.println(status.latestVersion);
+ */
+
+#include "OTAConfig.h"
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+/**
+ * @brief Cópia consistente do estado das atualizações
+ */
+struct OTAStatusSnapshot
+{
+    bool pushUpdating;      ///< Upload pela página web em andamento
+    bool pullUpdating;      ///< Download do servidor em andamento
+    bool pullThreadRunning; ///< Task de verificação periódica ativa
+    bool updateAvailable;   ///< O servidor tem uma versão mais nova
+    uint8_t mode;           ///< OTAManager::UpdateMode
+    char currentVersion[OTA_STATUS_VERSION_MAX];
+    char latestVersion[OTA_STATUS_VERSION_MAX]; ///< Vazio até a primeira verificação
+
+    /// true se qualquer atualização (Push ou Pull) está em andamento
+    bool updating() const { return pushUpdating || pullUpdating; }
+};
+
+class OTAStatus
+{
+public:
+    /**
+     * @brief Lê o estado atual (sem bloquear, pode ser chamado de qualquer task)
+     */
+    static OTAStatusSnapshot get();
+
+    static void setPushUpdating(bool updating);
+    static void setPullUpdating(bool updating);
+    static void setPullThreadRunning(bool running);
+    static void setMode(uint8_t mode);
+    static void setCurrentVersion(const char *version);
+
+    /**
+     * @brief Publica o resultado de uma verificação de versão
+     * @param latestVersion Versão informada pelo servidor
+     * @param available Se ela deve ser instalada
+     */
+    static void setLatestVersion(const char *latestVersion, bool available);
+
+private:
+    static constexpr size_t WORDS = (sizeof(OTAStatusSnapshot) + 3) / 4;
+
+    // O snapshot é copiado palavra a palavra com acessos atômicos
+    union Storage
+    {
+        OTAStatusSnapshot snapshot;
+        uint32_t words[WORDS];
+    };
+
+    static Storage _storage;
+    static uint32_t _sequence; ///< Ímpar durante uma escrita
+    static portMUX_TYPE _writeLock;
+
+    /**
+     * @brief Aplica uma alteração e publica o novo snapshot
+     * @return Valor retornado por change (false = nada a publicar)
+     */
+    template <typename Change>
+    static bool update(Change change);
+};
@@ -0,0 +1,195 @@
+#include "OTATasks.h"
+#include "OTAClock.h"
+
+// ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
+
+OTATasks::Entry OTATasks::_entries[OTA_TASKS_MAX] = {};
+portMUX_TYPE OTATasks::_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
+
+BaseType_t OTATasks::create(TaskFunction_t function, const char *name, uint32_t stackSize, void *parameter,
+                            UBaseType_t priority, TaskHandle_t *handle, BaseType_t core)
+{
+    TaskHandle_t created = nullptr;
+    OTAClock::taskCreating();
+    BaseType_t result = xTaskCreatePinnedToCore(function, name, stackSize, parameter, priority, &created, core);
+
+    if (result == pdPASS)
+    {
+        track(name, created, stackSize);
+        if (handle != nullptr)
+        {
+            *handle = created;
+        }
+    }
+
+    return result;
+}
+
+void OTATasks::track(const char *name, TaskHandle_t handle, uint32_t stackSize)
+{
+    if (handle == nullptr)
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&_lock);
+
+    int slot = -1;
+    for (int i = 0; i < OTA_TASKS_MAX; i++)
+    {
+        if (_entries[i].handle == handle)
+        {
+            slot = i; // Já acompanhada: atualiza
+            break;
+        }
+        if (slot < 0 && _entries[i].handle == nullptr)
+        {
+            slot = i;
+        }
+    }
+
+    if (slot >= 0)
+    {
+        _entries[slot] = {handle, name, stackSize, 0};
+    }
+
+    portEXIT_CRITICAL(&_lock);
+
+    if (slot < 0)
+    {
+        LOG_WARN("⚠️  Limite de %d tasks acompanhadas atingido (%s)", OTA_TASKS_MAX, name);
+    }
+}
+
+void OTATasks::untrack(TaskHandle_t handle)
+{
+    portENTER_CRITICAL(&_lock);
+
+    for (int i = 0; i < OTA_TASKS_MAX; i++)
+    {
+        if (_entries[i].handle == handle)
+        {
+            _entries[i] = {};
+        }
+    }
+
+    portEXIT_CRITICAL(&_lock);
+}
+
+void OTATasks::exitCurrent()
+{
+    untrack(xTaskGetCurrentTaskHandle());
+    vTaskDelete(nullptr);
+}
+
+void OTATasks::writeJson(OTAJsonWriter &json)
+{
+    // Cópia local: a resposta é escrita fora da seção crítica
+    Entry entries[OTA_TASKS_MAX];
+    portENTER_CRITICAL(&_lock);
+    memcpy(entries, _entries, sizeof(entries));
+    portEXIT_CRITICAL(&_lock);
+
+#if configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS
+    // Uma amostra de todas as tasks; as porcentagens comparam com a amostra anterior
+    static uint32_t lastTotal = 0;
+    static uint32_t lastIdle[portNUM_PROCESSORS] = {};
+
+    UBaseType_t count = uxTaskGetNumberOfTasks() + 2; // Folga para tasks criadas agora
+    TaskStatus_t *states = static_cast<TaskStatus_t *>(malloc(count * sizeof(TaskStatus_t)));
+    uint32_t total = 0;
+    count = states ? uxTaskGetSystemState(states, count, &total) : 0;
+    uint32_t elapsed = total - lastTotal;
+
+    auto runtimeOf = [&](TaskHandle_t handle) -> const TaskStatus_t *
+    {
+        for (UBaseType_t i = 0; i < count; i++)
+        {
+            if (states[i].xHandle == handle)
+                return &states[i];
+        }
+        return nullptr;
+    };
+#endif
+
+    json.beginArray("tasks");
+    for (int i = 0; i < OTA_TASKS_MAX; i++)
+    {
+        Entry &entry = entries[i];
+        if (entry.handle == nullptr)
+        {
+            continue;
+        }
+
+        // No ESP-IDF a stack é medida em bytes (StackType_t = uint8_t)
+        uint32_t stackFree = uxTaskGetStackHighWaterMark(entry.handle) * sizeof(StackType_t);
+        BaseType_t core = xTaskGetAffinity(entry.handle);
+
+        json.beginObject();
+        json.add("name", entry.name);
+        json.add("core", core == tskNO_AFFINITY ? -1 : (int)core);
+        json.add("priority", (unsigned)uxTaskPriorityGet(entry.handle));
+        if (entry.stackSize > 0)
+        {
+            json.add("stackSize", entry.stackSize);
+            json.add("stackUsedMax", entry.stackSize - min(stackFree, entry.stackSize));
+        }
+        json.add("stackFreeMin", stackFree);
+
+#if configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS
+        const TaskStatus_t *state = runtimeOf(entry.handle);
+        if (state != nullptr && elapsed > 0)
+        {
+            json.add("cpu", (state->ulRunTimeCounter - entry.lastRuntime) * 100.0 / elapsed, 1);
+            entry.lastRuntime = state->ulRunTimeCounter;
+        }
+        else
+        {
+            json.addNull("cpu");
+        }
+#else
+        json.addNull("cpu");
+#endif
+        json.endObject();
+    }
+    json.endArray();
+
+    // Carga de cada núcleo = tempo fora da task IDLE daquele núcleo
+    json.beginObject("cpu");
+#if configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS
+    for (int core = 0; core < portNUM_PROCESSORS; core++)
+    {
+        char key[8];
+        snprintf(key, sizeof(key), "core%d", core);
+
+        const TaskStatus_t *idle = runtimeOf(xTaskGetIdleTaskHandleForCPU(core));
+        if (idle != nullptr && elapsed > 0)
+        {
+            uint32_t idleTime = idle->ulRunTimeCounter - lastIdle[core];
+            json.add(key, 100.0 - min(idleTime * 100.0 / elapsed, 100.0), 1);
+            lastIdle[core] = idle->ulRunTimeCounter;
+        }
+        else
+        {
+            json.addNull(key);
+        }
+    }
+    lastTotal = total;
+    free(states);
+
+    // Guarda os contadores para a próxima amostra
+    portENTER_CRITICAL(&_lock);
+    for (int i = 0; i < OTA_TASKS_MAX; i++)
+    {
+        if (_entries[i].handle != nullptr && _entries[i].handle == entries[i].handle)
+        {
+            _entries[i].lastRuntime = entries[i].lastRuntime;
+        }
+    }
+    portEXIT_CRITICAL(&_lock);
+#endif
+    json.add("runtimeStats", (bool)(configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS));
+    json.endObject();
+}
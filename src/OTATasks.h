@@ -0,0 +1,69 @@
+#pragma once
+
+/**
+ * @file OTATasks.h
+ * @brief Criação e acompanhamento das tasks FreeRTOS da biblioteca
+ *
+ * As tasks são criadas por create() no núcleo configurado
+ * (OTA_WEB_TASK_CORE, OTA_PULL_TASK_CORE) e registradas para que
+ * /api/system mostre núcleo, prioridade, uso máximo de stack
+ * (high-water mark) e uso de CPU de cada uma.
+ *
+ * O uso de CPU depende das estatísticas de execução do FreeRTOS
+ * (CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS); sem elas o campo vale null.
+ * A porcentagem é relativa a um núcleo, medida desde a consulta anterior.
+ */
+
+#include "OTAConfig.h"
+#include "OTAJsonWriter.h"
+#include "OTALog.h"
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+class OTATasks
+{
+public:
+    /**
+     * @brief Cria uma task no núcleo indicado e passa a acompanhá-la
+     * @param name Nome da task (deve ser uma string estática)
+     * @param core 0, 1 ou tskNO_AFFINITY
+     * @return pdPASS se a task foi criada
+     */
+    static BaseType_t create(TaskFunction_t function, const char *name, uint32_t stackSize, void *parameter,
+                             UBaseType_t priority, TaskHandle_t *handle, BaseType_t core);
+
+    /**
+     * @brief Acompanha uma task criada por outro componente (ex: async_tcp)
+     * @param stackSize Tamanho da stack, ou 0 se desconhecido
+     */
+    static void track(const char *name, TaskHandle_t handle, uint32_t stackSize);
+
+    /**
+     * @brief Deixa de acompanhar uma task (antes de vTaskDelete)
+     */
+    static void untrack(TaskHandle_t handle);
+
+    /**
+     * @brief Encerra a task atual (substitui vTaskDelete(nullptr))
+     */
+    static void exitCurrent();
+
+    /**
+     * @brief Escreve o array "tasks" e o objeto "cpu" (carga por núcleo) no objeto atual
+     */
+    static void writeJson(OTAJsonWriter &json);
+
+private:
+    struct Entry
+    {
+        TaskHandle_t handle;
+        const char *name;
+        uint32_t stackSize;   ///< Bytes (0 = desconhecido)
+        uint32_t lastRuntime; ///< Contador de execução na consulta anterior
+    };
+
+    static Entry _entries[OTA_TASKS_MAX];
+    static portMUX_TYPE _lock;
+};
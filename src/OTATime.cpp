@@ -0,0 +1,162 @@
+#include "OTATime.h"
+#include "OTAClock.h"
+
+#include <esp_sntp.h>
+#include <sys/time.h>
+
+// ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
+
+bool OTATime::_started = false;
+OTATime::SyncCallback OTATime::_callback = nullptr;
+bool OTATime::_synced = false;
+uint32_t OTATime::_syncCount = 0;
+uint32_t OTATime::_lastSyncMs = 0;
+int64_t OTATime::_lastServerMs = 0;
+int32_t OTATime::_driftPpm = 0;
+uint32_t OTATime::_intervalMs = OTA_TIME_INITIAL_INTERVAL_MS;
+
+time_t OTATime::_cachedSecond = 0;
+struct tm OTATime::_cachedTime = {};
+portMUX_TYPE OTATime::_cacheLock = portMUX_INITIALIZER_UNLOCKED;
+
+// ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
+
+void OTATime::begin()
+{
+    if (_started)
+    {
+        return;
+    }
+    _started = true;
+
+    setenv("TZ", OTA_TIME_TZ, 1);
+    tzset();
+
+    // Mesmo cliente usado pelo configTime() do core, sem esperar a resposta
+    if (sntp_enabled())
+    {
+        sntp_stop();
+    }
+    sntp_setoperatingmode(SNTP_OPMODE_POLL);
+    sntp_setservername(0, (char *)OTA_TIME_SERVER1);
+    sntp_setservername(1, (char *)OTA_TIME_SERVER2);
+    sntp_set_time_sync_notification_cb(handleSync);
+    sntp_set_sync_interval(_intervalMs);
+    sntp_init();
+
+    LOG_INFO("🕒 SNTP iniciado (%s, %s) - TZ %s", OTA_TIME_SERVER1, OTA_TIME_SERVER2, OTA_TIME_TZ);
+}
+
+void OTATime::onSync(SyncCallback callback)
+{
+    _callback = callback;
+}
+
+bool OTATime::isSynced()
+{
+    return __atomic_load_n(&_synced, __ATOMIC_ACQUIRE);
+}
+
+void OTATime::handleSync(struct timeval *tv)
+{
+    uint32_t nowMs = OTAClock::millis();
+    int64_t serverMs = (int64_t)tv->tv_sec * 1000 + tv->tv_usec / 1000;
+
+    // Deslocamento do cristal: quanto o servidor andou a mais (ou a menos)
+    // que o relógio local desde a sincronização anterior
+    if (_syncCount > 0)
+    {
+        uint32_t localDeltaMs = nowMs - _lastSyncMs;
+        int64_t serverDeltaMs = serverMs - _lastServerMs;
+
+        if (localDeltaMs >= OTA_TIME_MIN_INTERVAL_MS / 2)
+        {
+            int32_t sample = (int32_t)((serverDeltaMs - (int64_t)localDeltaMs) * 1000000 / localDeltaMs);
+            int32_t drift = (_syncCount == 1) ? sample : (3 * _driftPpm + sample) / 4;
+            __atomic_store_n(&_driftPpm, drift, __ATOMIC_RELAXED);
+
+            // Intervalo em que o erro acumulado chega a OTA_TIME_MAX_ERROR_MS
+            uint32_t magnitude = drift < 0 ? -drift : drift;
+            uint64_t interval = magnitude > 0 ? (uint64_t)OTA_TIME_MAX_ERROR_MS * 1000000 / magnitude
+                                              : OTA_TIME_MAX_INTERVAL_MS;
+            interval = constrain(interval, (uint64_t)OTA_TIME_MIN_INTERVAL_MS, (uint64_t)OTA_TIME_MAX_INTERVAL_MS);
+
+            if (interval != _intervalMs)
+            {
+                __atomic_store_n(&_intervalMs, (uint32_t)interval, __ATOMIC_RELAXED);
+                sntp_set_sync_interval(_intervalMs); // Vale a partir da próxima consulta
+            }
+        }
+    }
+
+    _lastServerMs = serverMs;
+    __atomic_store_n(&_lastSyncMs, nowMs, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&_syncCount, 1, __ATOMIC_RELAXED);
+
+    // Descarta a data/hora em cache: o relógio pode ter saltado
+    portENTER_CRITICAL(&_cacheLock);
+    _cachedSecond = 0;
+    portEXIT_CRITICAL(&_cacheLock);
+
+    bool first = !__atomic_exchange_n(&_synced, true, __ATOMIC_RELEASE);
+    if (first)
+    {
+        LOG_INFO("🕒 Relógio sincronizado por SNTP");
+    }
+    else
+    {
+        LOG_DEBUG("🕒 SNTP: deslocamento %d ppm, próxima consulta em %u s", _driftPpm, _intervalMs / 1000);
+    }
+
+    SyncCallback callback = _callback;
+    if (callback != nullptr)
+    {
+        callback(tv->tv_sec);
+    }
+}
+
+bool OTATime::localTime(struct tm &out)
+{
+    time_t now = OTAClock::time();
+
+    portENTER_CRITICAL(&_cacheLock);
+    bool cached = (now == _cachedSecond);
+    if (cached)
+    {
+        out = _cachedTime;
+    }
+    portEXIT_CRITICAL(&_cacheLock);
+
+    if (!cached)
+    {
+        // localtime_r() aplica o fuso e pode bloquear: fora da seção crítica
+        localtime_r(&now, &out);
+
+        portENTER_CRITICAL(&_cacheLock);
+        _cachedSecond = now;
+        _cachedTime = out;
+        portEXIT_CRITICAL(&_cacheLock);
+    }
+
+    return isSynced();
+}
+
+void OTATime::writeJson(OTAJsonWriter &json)
+{
+    bool synced = isSynced();
+
+    json.beginObject("clock");
+    json.add("synced", synced);
+    if (synced)
+    {
+        json.add("lastSync", (OTAClock::millis() - __atomic_load_n(&_lastSyncMs, __ATOMIC_RELAXED)) / 1000);
+    }
+    else
+    {
+        json.addNull("lastSync");
+    }
+    json.add("syncs", __atomic_load_n(&_syncCount, __ATOMIC_RELAXED));
+    json.add("driftPpm", __atomic_load_n(&_driftPpm, __ATOMIC_RELAXED));
+    json.add("interval", __atomic_load_n(&_intervalMs, __ATOMIC_RELAXED) / 1000);
+    json.endObject();
+}
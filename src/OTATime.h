@@ -0,0 +1,79 @@
+#pragma once
+
+/**
+ * @file OTATime.h
+ * @brief Serviço único de horário: SNTP do ESP-IDF, sem bloquear
+ *
+ * begin() configura o fuso (OTA_TIME_TZ) e o cliente SNTP do lwIP, que
+ * consulta os servidores na task TCP/IP; nenhuma task da biblioteca espera
+ * pela rede. A cada sincronização o deslocamento do cristal é estimado
+ * comparando o avanço do horário do servidor com o de OTAClock::millis(), e o
+ * intervalo até a próxima consulta é ajustado para que o erro acumulado
+ * fique abaixo de OTA_TIME_MAX_ERROR_MS.
+ *
+ * localTime() guarda a data/hora decomposta do segundo atual: as páginas
+ * e a API leem a cópia em vez de chamar localtime_r() a cada requisição.
+ *
+ * Exemplo:
+ * OTATime::onSync([](time_t now) { Serial.println("Relógio sincronizado"); });
+ * OTATime::begin();
+ */
+
+#include "OTAConfig.h"
+#include "OTAJsonWriter.h"
+#include "OTALog.h"
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <time.h>
+
+class OTATime
+{
+public:
+    /**
+     * @brief Chamado a cada sincronização, na task TCP/IP (deve ser curto)
+     */
+    typedef void (*SyncCallback)(time_t now);
+
+    /**
+     * @brief Configura fuso e servidores e inicia o SNTP (idempotente)
+     */
+    static void begin();
+
+    /**
+     * @brief Registra o callback de sincronização
+     */
+    static void onSync(SyncCallback callback);
+
+    /**
+     * @brief Se o relógio já foi sincronizado ao menos uma vez
+     */
+    static bool isSynced();
+
+    /**
+     * @brief Data/hora local decomposta (recalculada no máximo uma vez por segundo)
+     * @return false enquanto o relógio não foi sincronizado
+     */
+    static bool localTime(struct tm &out);
+
+    /**
+     * @brief Escreve o estado da sincronização (objeto "clock" de /api/system)
+     */
+    static void writeJson(OTAJsonWriter &json);
+
+private:
+    static void handleSync(struct timeval *tv);
+
+    static bool _started;
+    static SyncCallback _callback;
+    static bool _synced;
+    static uint32_t _syncCount;
+    static uint32_t _lastSyncMs;   ///< OTAClock::millis() da última sincronização
+    static int64_t _lastServerMs;  ///< Horário do servidor na última sincronização
+    static int32_t _driftPpm;      ///< Deslocamento estimado do cristal (média móvel)
+    static uint32_t _intervalMs;   ///< Intervalo atual entre consultas
+
+    static time_t _cachedSecond;   ///< Segundo de _cachedTime
+    static struct tm _cachedTime;
+    static portMUX_TYPE _cacheLock;
+};
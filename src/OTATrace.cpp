@@ -0,0 +1,136 @@
+#include "OTATrace.h"
+
+#if OTA_TRACE_ENABLED
+
+// ============ INICIALIZAÇÃO DE VARIÁVEIS ESTÁTICAS ============
+
+OTATrace::Event OTATrace::_events[portNUM_PROCESSORS][OTA_TRACE_EVENTS] = {};
+uint32_t OTATrace::_heads[portNUM_PROCESSORS] = {};
+uint32_t OTATrace::_tails[portNUM_PROCESSORS] = {};
+
+// ============ IMPLEMENTAÇÃO DOS MÉTODOS ============
+
+void OTATrace::record(const char *name, BaseType_t core, uint32_t startUs, uint32_t startCycles)
+{
+    uint32_t cycles = ESP.getCycleCount() - startCycles;
+    uint32_t elapsedUs = micros() - startUs;
+    BaseType_t endCore = xPortGetCoreID();
+
+    Event event = {};
+    event.name = name;
+    event.startUs = startUs;
+
+    // O contador de ciclos dá voltas em ~17 s e não vale entre núcleos:
+    // spans longos ou que migraram de núcleo usam micros()
+    if (core == endCore && elapsedUs < 10000000UL)
+    {
+        uint64_t ns = (uint64_t)cycles * 1000 / ESP.getCpuFreqMHz();
+        event.durationUs = ns / 1000;
+        event.fractionNs = ns % 1000;
+    }
+    else
+    {
+        event.durationUs = elapsedUs;
+    }
+
+    const char *task = pcTaskGetName(nullptr);
+    if (task != nullptr)
+    {
+        strncpy(event.task, task, sizeof(event.task) - 1);
+    }
+
+    // Reserva a posição; tasks do mesmo núcleo podem interromper entre si
+    uint32_t position = __atomic_fetch_add(&_heads[endCore], 1, __ATOMIC_RELAXED);
+    Event &slot = _events[endCore][position % OTA_TRACE_EVENTS];
+
+    __atomic_store_n(&slot.sequence, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(&slot, &event, sizeof(slot)); // event.sequence ainda é 0
+    __atomic_store_n(&slot.sequence, position + 1, __ATOMIC_RELEASE);
+}
+
+void OTATrace::clear()
+{
+    for (int core = 0; core < portNUM_PROCESSORS; core++)
+    {
+        __atomic_store_n(&_tails[core], __atomic_load_n(&_heads[core], __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+    }
+}
+
+void OTATrace::writeJson(OTAJsonWriter &json)
+{
+    // Cada task vira uma linha (tid) no visualizador
+    char names[16][sizeof(Event::task)] = {};
+    int taskCount = 0;
+
+    json.beginObject();
+    json.add("displayTimeUnit", "ms");
+    json.beginArray("traceEvents");
+
+    for (int core = 0; core < portNUM_PROCESSORS; core++)
+    {
+        uint32_t head = __atomic_load_n(&_heads[core], __ATOMIC_ACQUIRE);
+        uint32_t tail = __atomic_load_n(&_tails[core], __ATOMIC_RELAXED);
+        uint32_t first = (head - tail > OTA_TRACE_EVENTS) ? head - OTA_TRACE_EVENTS : tail;
+
+        for (uint32_t position = first; position != head; position++)
+        {
+            Event &slot = _events[core][position % OTA_TRACE_EVENTS];
+
+            // Cópia consistente: descarta posições sobrescritas durante a leitura
+            if (__atomic_load_n(&slot.sequence, __ATOMIC_ACQUIRE) != position + 1)
+            {
+                continue;
+            }
+            Event event;
+            memcpy(&event, &slot, sizeof(event));
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (__atomic_load_n(&slot.sequence, __ATOMIC_RELAXED) != position + 1)
+            {
+                continue;
+            }
+            event.task[sizeof(event.task) - 1] = '\0';
+
+            int tid = 0;
+            while (tid < taskCount && strcmp(names[tid], event.task) != 0)
+            {
+                tid++;
+            }
+            if (tid == taskCount && taskCount < 16)
+            {
+                memcpy(names[taskCount++], event.task, sizeof(event.task));
+            }
+
+            json.beginObject();
+            json.add("name", event.name);
+            json.add("ph", "X");
+            json.add("ts", event.startUs);
+            json.add("dur", event.durationUs + event.fractionNs / 1000.0, 3);
+            json.add("pid", 1);
+            json.add("tid", tid + 1);
+            json.beginObject("args");
+            json.add("core", core);
+            json.endObject();
+            json.endObject();
+        }
+    }
+
+    // Metadados: nome de cada linha
+    for (int tid = 0; tid < taskCount; tid++)
+    {
+        json.beginObject();
+        json.add("name", "thread_name");
+        json.add("ph", "M");
+        json.add("pid", 1);
+        json.add("tid", tid + 1);
+        json.beginObject("args");
+        json.add("name", names[tid]);
+        json.endObject();
+        json.endObject();
+    }
+
+    json.endArray();
+    json.endObject();
+}
+
+#endif
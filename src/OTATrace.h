@@ -0,0 +1,95 @@
+#pragma once
+
+/**
+ * @file OTATrace.h
+ * @brief Spans de rastreamento dos caminhos quentes, exportados para o Chrome
+ *
+ * Com OTA_TRACE_ENABLED=1, OTA_TRACE_SCOPE() mede o bloco atual em ciclos
+ * de CPU (ESP.getCycleCount()) e grava o span num buffer circular do núcleo
+ * em que a task está rodando. Cada núcleo tem o seu buffer; as posições são
+ * reservadas com uma soma atômica, sem locks. GET /api/trace devolve os
+ * spans no formato trace_event, que abre em chrome://tracing ou no Perfetto.
+ *
+ * Com OTA_TRACE_ENABLED=0 (padrão) as macros não geram código e a rota
+ * não existe.
+ *
+ * Exemplo:
+ * {
+ *     OTA_TRACE_SCOPE("Update.write");
+ *     Update.write(buffer, length);
+ * }
+ */
+
+#include "OTAConfig.h"
+
+#if OTA_TRACE_ENABLED
+
+#include "OTAJsonWriter.h"
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+class OTATrace
+{
+public:
+    /**
+     * @brief Mede do construtor ao destrutor (use OTA_TRACE_SCOPE)
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(const char *name)
+            : _name(name), _core(xPortGetCoreID()), _startUs(micros()), _startCycles(ESP.getCycleCount()) {}
+        ~Scope() { OTATrace::record(_name, _core, _startUs, _startCycles); }
+
+    private:
+        const char *_name;
+        BaseType_t _core;
+        uint32_t _startUs;
+        uint32_t _startCycles;
+    };
+
+    /**
+     * @brief Grava um span iniciado em startUs/startCycles e terminado agora
+     * @param name Nome do span (deve ser uma string estática)
+     * @param core Núcleo no início (os contadores de ciclos são por núcleo)
+     */
+    static void record(const char *name, BaseType_t core, uint32_t startUs, uint32_t startCycles);
+
+    /**
+     * @brief Descarta os spans gravados
+     */
+    static void clear();
+
+    /**
+     * @brief Escreve os spans no formato trace_event do Chrome
+     */
+    static void writeJson(OTAJsonWriter &json);
+
+private:
+    struct Event
+    {
+        const char *name;
+        uint32_t startUs;
+        uint32_t durationUs;
+        uint16_t fractionNs; ///< Parte sub-microssegundo da duração (0-999)
+        uint16_t reserved;
+        uint32_t sequence; ///< Posição + 1, gravada por último (0 = sendo gravado)
+        char task[12];     ///< Nome da task (truncado)
+    };
+
+    static Event _events[portNUM_PROCESSORS][OTA_TRACE_EVENTS];
+    static uint32_t _heads[portNUM_PROCESSORS]; ///< Próxima posição de cada núcleo
+    static uint32_t _tails[portNUM_PROCESSORS]; ///< Primeira posição após o último clear()
+};
+
+#define OTA_TRACE_CONCAT_(a, b) a##b
+#define OTA_TRACE_CONCAT(a, b) OTA_TRACE_CONCAT_(a, b)
+#define OTA_TRACE_SCOPE(name) OTATrace::Scope OTA_TRACE_CONCAT(_otaTrace, __LINE__)(name)
+
+#else
+
+#define OTA_TRACE_SCOPE(name) ((void)0)
+
+#endif
@@ -0,0 +1,103 @@
+#pragma once
+
+// Página única da interface web (servida estática e em cache).
+// Os dados vêm de /api/status, /api/system e /api/ota.
+// {{CSS_URL}}, {{JS_URL}} e {{FAVICON_URL}} são resolvidos por tools/build_assets.py
+
+const char *htmlApp = R"rawliteral(
+<!DOCTYPE html>
+<html lang="en">
+<head>
+    <meta charset="UTF-8">
+    <meta name="viewport" content="width=device-width, initial-scale=1.0">
+    <title>ESP32 OTA Update</title>
+    <link rel="icon" type="image/png" href="{{FAVICON_URL}}">
+    <link rel="shortcut icon" type="image/png" href="{{FAVICON_URL}}">
+    <link rel="apple-touch-icon" type="image/png" href="{{FAVICON_URL}}">
+    <link rel="stylesheet" href="{{CSS_URL}}">
+</head>
+<body class="dark">
+    <script>document.body.className = localStorage.getItem('ota-theme') || 'dark';</script>
+    <div class="container">
+        <nav class="navbar">
+            <a href="/" class="nav-brand" data-link>OTA Update</a>
+            <div class="nav-links">
+                <a href="/" data-link>Home</a>
+                <a href="/update" data-link>Upload</a>
+                <a href="/system" data-link>System</a>
+                <button class="theme-toggle nav-toggle" onclick="toggleTheme()">☀️</button>
+            </div>
+        </nav>
+
+        <main class="main-content">
+            <section class="view" id="view-home" data-title="ESP32 OTA Update">
+                <div class="header">
+                    <h1>ESP32 OTA Update</h1>
+                    <button class="theme-toggle" onclick="toggleTheme()">☀️</button>
+                </div>
+                <div class="info-grid" id="home-cards"></div>
+                <div class="info-card" id="pull-progress" hidden>
+                    <h3>⬇️ Download OTA</h3>
+                    <div class="progress">
+                        <div class="progress-bar" id="pullProgressBar"></div>
+                    </div>
+                    <div id="pull-status" class="centered"></div>
+                </div>
+                <div class="action-grid">
+                    <a href="/update" class="action-card" data-link>
+                        <div class="action-icon">📤</div>
+                        <h3>Firmware Upload</h3>
+                        <p>Send new .bin firmware</p>
+                    </a>
+                    <a href="/system" class="action-card" data-link>
+                        <div class="action-icon">ℹ️</div>
+                        <h3>System Info</h3>
+                        <p>Complete ESP32 details</p>
+                    </a>
+                </div>
+            </section>
+
+            <section class="view" id="view-update" data-title="Firmware Upload">
+                <div class="header">
+                    <h1>Firmware Upload</h1>
+                </div>
+                <div class="upload-form">
+                    <form id="uploadForm">
+                        <div class="file-input" onclick="document.getElementById('firmwareFile').click()">
+                            <p>Click to select firmware</p>
+                            <p class="muted">File.bin</p>
+                            <input type="file" name="update" id="firmwareFile" accept=".bin" required hidden>
+                        </div>
+                        <div id="fileName" class="centered"></div>
+                        <button type="submit" class="btn" id="submitBtn">Start Upload</button>
+                    </form>
+                    <div class="progress" id="progress" hidden>
+                        <div class="progress-bar" id="progressBar"></div>
+                    </div>
+                    <div id="status" class="centered"></div>
+                </div>
+            </section>
+
+            <section class="view" id="view-system" data-title="System Information">
+                <div class="header">
+                    <div class="header-left">
+                        <h1>System Information</h1>
+                        <div class="time-info">
+                            <div class="system-time" id="system-time"></div>
+                            <div class="uptime" id="system-uptime"></div>
+                        </div>
+                    </div>
+                    <button class="theme-toggle" onclick="toggleTheme()">☀️</button>
+                </div>
+                <div class="info-grid" id="system-cards"></div>
+            </section>
+        </main>
+
+        <footer class="footer">
+            <p>ESP32 OTA Update - <span id="host-info"></span></p>
+        </footer>
+    </div>
+    <script src="{{JS_URL}}"></script>
+</body>
+</html>
+)rawliteral";
@@ -0,0 +1,648 @@
+#pragma once
+
+// Gerado por tools/build_assets.py a partir de src/webPage/* - não editar
+
+#include "../OTAAsset.h"
+
+// /style.css: 1560 bytes (gzip de 6497 bytes)
+const uint8_t assetStyleCssData[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xC5, 0x58, 0x5B, 0x73, 0xA3, 0x36,
+    0x14, 0x7E, 0xCF, 0xAF, 0x60, 0xA6, 0xD3, 0x59, 0xBB, 0x13, 0xA5, 0x18, 0x87, 0xD8, 0x71, 0x5E,
+    0xFA, 0xD6, 0xE9, 0x73, 0x2F, 0x33, 0x7D, 0x14, 0x48, 0x80, 0x1A, 0x40, 0x8C, 0xC0, 0x97, 0x74,
+    0x27, 0xFF, 0xBD, 0x47, 0x42, 0x08, 0x01, 0xC2, 0x38, 0xBB, 0x99, 0x69, 0x36, 0xEB, 0x60, 0x24,
+    0x1D, 0x9D, 0xF3, 0x9D, 0xEF, 0x5C, 0xA4, 0xBB, 0x83, 0xE0, 0xBC, 0xF1, 0xBE, 0xDE, 0x79, 0xF0,
+    0x83, 0x50, 0x94, 0xA2, 0x4A, 0xB0, 0x02, 0x8B, 0xB7, 0x83, 0xF7, 0x43, 0xA2, 0x7E, 0x5E, 0xFA,
+    0xA1, 0x9A, 0xC6, 0xBC, 0x24, 0x7A, 0x70, 0x9F, 0x3C, 0x27, 0xD8, 0x1A, 0x8C, 0xB1, 0x20, 0x93,
+    0x45, 0x0D, 0xBD, 0x34, 0x96, 0xC4, 0x80, 0x6C, 0x77, 0x8F, 0xFB, 0xC1, 0xA0, 0x2D, 0xF3, 0x11,
+    0x87, 0xE1, 0x93, 0x19, 0xC6, 0x71, 0x4C, 0x4B, 0x7B, 0xB5, 0xEF, 0xEF, 0xE2, 0x08, 0x8F, 0x86,
+    0x33, 0x7E, 0xA2, 0x42, 0x0D, 0x86, 0x78, 0xBF, 0x33, 0xFA, 0x70, 0x41, 0xA8, 0x40, 0x31, 0xCF,
+    0xB9, 0x1C, 0xA4, 0x01, 0xDD, 0x27, 0x7E, 0x37, 0x58, 0x67, 0x98, 0xF0, 0xF3, 0xC1, 0xF3, 0xBD,
+    0xC7, 0xEA, 0xE2, 0x3D, 0xC1, 0x7F, 0xB4, 0x81, 0x0F, 0x91, 0x46, 0x78, 0xE5, 0xDF, 0x7B, 0xFA,
+    0xF7, 0x61, 0xB3, 0x36, 0x0B, 0x8E, 0xB0, 0x57, 0x5D, 0x4B, 0x03, 0xF6, 0x78, 0xF7, 0x18, 0x76,
+    0xEF, 0xCF, 0x58, 0x94, 0xAC, 0x4C, 0x95, 0xD5, 0xF1, 0xC6, 0x37, 0xBB, 0x53, 0x21, 0xD4, 0xB6,
+    0x24, 0xDE, 0x86, 0x72, 0xF6, 0xFB, 0xDD, 0x5D, 0xC4, 0xC9, 0xDB, 0x03, 0x98, 0xF9, 0xEA, 0x86,
+    0x7A, 0x83, 0x03, 0x3F, 0x88, 0x67, 0xA0, 0x1E, 0xA2, 0xD6, 0x43, 0xED, 0x40, 0xD3, 0x72, 0xDE,
+    0x2E, 0xC1, 0x49, 0x3C, 0x0B, 0xF5, 0x10, 0x91, 0x09, 0xD4, 0x4F, 0xDB, 0x68, 0x4B, 0xC9, 0x0C,
+    0xD4, 0x8F, 0xC1, 0xF3, 0x33, 0xDD, 0xCC, 0x40, 0x3D, 0xF4, 0xE1, 0x8D, 0x50, 0x6F, 0x1D, 0x50,
+    0x3F, 0xED, 0xC9, 0xF6, 0x79, 0xE3, 0x80, 0x1A, 0x27, 0xFE, 0xFE, 0x79, 0x0C, 0x75, 0x12, 0xEF,
+    0x37, 0xFB, 0x8D, 0x82, 0xFA, 0x27, 0x0D, 0x31, 0x98, 0x92, 0xB2, 0x12, 0xF6, 0x6E, 0xE7, 0x56,
+    0x98, 0x10, 0x25, 0x41, 0x7F, 0x8F, 0xF8, 0x05, 0xD5, 0xEC, 0x5F, 0xF5, 0x4A, 0xDB, 0x00, 0xAF,
+    0x8C, 0xB3, 0xB4, 0x90, 0x84, 0x83, 0xE1, 0x09, 0x2E, 0x58, 0x0E, 0xB0, 0x7C, 0xF9, 0x9D, 0xA6,
+    0x9C, 0x7A, 0x7F, 0xFE, 0xF6, 0xE5, 0xDE, 0xFB, 0x03, 0x67, 0xBC, 0xC0, 0xF7, 0xDE, 0xAF, 0xB4,
+    0xA4, 0x27, 0xF8, 0xFB, 0x17, 0x15, 0x04, 0x97, 0xF0, 0x50, 0xE3, 0xB2, 0x06, 0xA8, 0x05, 0xD3,
+    0x41, 0x10, 0xE1, 0xF8, 0x35, 0x15, 0xFC, 0x58, 0x82, 0xCB, 0x4E, 0x58, 0xAC, 0x6C, 0xCF, 0x6B,
+    0xB3, 0x35, 0x76, 0xED, 0xA8, 0xED, 0x47, 0x3D, 0x9E, 0xB3, 0x92, 0xA2, 0x8C, 0xB2, 0x34, 0x6B,
+    0x0E, 0xDE, 0xE6, 0xE1, 0xA9, 0x7D, 0xDB, 0x08, 0xD8, 0x89, 0x35, 0x8C, 0x83, 0x8D, 0x38, 0xCF,
+    0x25, 0x8C, 0xB5, 0x47, 0x71, 0x4D, 0x95, 0x0D, 0x0F, 0xE0, 0xEB, 0x06, 0xC3, 0x42, 0xD1, 0xC1,
+    0xC1, 0xCA, 0x5E, 0x86, 0xEF, 0x9F, 0xB2, 0x56, 0x0A, 0x61, 0x75, 0x95, 0x63, 0x30, 0x2E, 0xC9,
+    0xE9, 0xA5, 0x7D, 0x25, 0x9F, 0x10, 0x61, 0x82, 0xC6, 0xAD, 0x70, 0x50, 0xEF, 0x58, 0x94, 0xAD,
+    0xD4, 0x12, 0x9F, 0x22, 0xDC, 0x89, 0x74, 0x9A, 0x26, 0xC9, 0xB9, 0x1E, 0x41, 0xBE, 0x11, 0xB4,
+    0xF0, 0x02, 0xF8, 0xB0, 0xA0, 0xD7, 0xCC, 0x68, 0xD7, 0xB5, 0xDF, 0xD6, 0xB3, 0x2A, 0xFD, 0x73,
+    0xAC, 0x1B, 0x96, 0xBC, 0x21, 0x69, 0x14, 0x50, 0xF1, 0xE0, 0xD5, 0x15, 0x8E, 0x29, 0x8A, 0x68,
+    0x73, 0xA6, 0xB4, 0x6C, 0xE7, 0xE0, 0x9C, 0xA5, 0x25, 0x62, 0x0D, 0x2D, 0x80, 0x3E, 0x92, 0xB0,
+    0x54, 0x18, 0x9D, 0x51, 0x04, 0x60, 0x11, 0xDB, 0xA7, 0xE0, 0x7A, 0x2A, 0xC1, 0x0C, 0x8D, 0x56,
+    0xEA, 0xF5, 0x59, 0x23, 0x14, 0xF1, 0x9C, 0x38, 0x9C, 0x33, 0x0C, 0x14, 0xAD, 0xAF, 0xF2, 0x18,
+    0x81, 0xE0, 0x12, 0xB8, 0x05, 0xAC, 0xE4, 0x25, 0xED, 0xB7, 0x06, 0xEF, 0xBD, 0xD6, 0x7A, 0x6B,
+    0x87, 0x69, 0x4E, 0xB5, 0xE5, 0x40, 0x8A, 0xAB, 0x16, 0xB9, 0xB1, 0x28, 0xAC, 0x85, 0x2D, 0xD1,
+    0x66, 0x46, 0xAF, 0x61, 0x30, 0x28, 0x00, 0xF4, 0x36, 0xAD, 0x6F, 0x54, 0x28, 0x08, 0x4C, 0xD8,
+    0xB1, 0x96, 0xE3, 0xDB, 0x5D, 0x0F, 0x91, 0x4D, 0xB9, 0xDE, 0xF9, 0x30, 0x29, 0xA8, 0x27, 0x4A,
+    0x1E, 0x54, 0xBA, 0xB8, 0xC6, 0x14, 0x93, 0x8F, 0xD6, 0xED, 0xE2, 0x26, 0xA3, 0x05, 0x45, 0x0D,
+    0x4F, 0xD3, 0x9C, 0xDE, 0xBA, 0xAE, 0x57, 0xF9, 0x8A, 0x79, 0x4E, 0xCB, 0x42, 0xFF, 0x47, 0xED,
+    0xE0, 0xA3, 0xA8, 0x25, 0x8E, 0x15, 0x67, 0x3D, 0xF8, 0x03, 0x8E, 0x04, 0x4E, 0x00, 0xD4, 0x73,
+    0xC2, 0x45, 0x61, 0xD9, 0x6F, 0x9B, 0x30, 0x00, 0xC0, 0x4C, 0x06, 0xEA, 0xC6, 0x38, 0xA7, 0xAB,
+    0x8D, 0xAA, 0x2F, 0x72, 0x4D, 0x01, 0x51, 0xDA, 0x11, 0xBB, 0x63, 0x28, 0xB0, 0x03, 0x36, 0x1E,
+    0x19, 0xD3, 0xAB, 0x51, 0xE0, 0x0B, 0x3A, 0x33, 0xD2, 0x64, 0x30, 0x29, 0xF0, 0xFD, 0xEA, 0xF2,
+    0x32, 0xCC, 0x78, 0x1E, 0x3E, 0x36, 0xBC, 0x7D, 0xD7, 0x4D, 0xF3, 0xA5, 0xB9, 0x72, 0xBB, 0x8C,
+    0x62, 0x62, 0xD4, 0xFA, 0x8C, 0x50, 0x53, 0xE9, 0xA2, 0x6E, 0xB0, 0x68, 0x6C, 0x2D, 0x20, 0x99,
+    0x36, 0x0D, 0x2F, 0x6C, 0xAD, 0x15, 0xA1, 0x03, 0x43, 0xE8, 0x56, 0x11, 0x94, 0xD3, 0x64, 0x62,
+    0xB6, 0xA5, 0x67, 0xB6, 0x19, 0xA7, 0x73, 0xF9, 0xAF, 0x65, 0xAD, 0x7F, 0x4B, 0x84, 0x2A, 0xB7,
+    0x30, 0xF0, 0x0A, 0x2B, 0x13, 0x3E, 0x6F, 0xF6, 0x5C, 0xD2, 0x33, 0x8A, 0x83, 0x93, 0x43, 0xA3,
+    0x7B, 0xFD, 0x56, 0x83, 0xF1, 0x48, 0xCA, 0x75, 0x24, 0x15, 0x63, 0xF1, 0x52, 0x84, 0x0E, 0x52,
+    0x4E, 0xE8, 0xFB, 0xAD, 0xF0, 0x63, 0xE5, 0x96, 0xEB, 0x3F, 0x3C, 0x5F, 0x91, 0x3C, 0x8E, 0x26,
+    0x69, 0x2E, 0x4A, 0x05, 0x23, 0x63, 0x9B, 0xE5, 0x3B, 0x6D, 0x17, 0x3C, 0xC1, 0xE2, 0x02, 0xDE,
+    0x37, 0x14, 0xB5, 0x16, 0x83, 0x43, 0x05, 0xAD, 0x28, 0x6E, 0x56, 0x92, 0x43, 0x28, 0x61, 0xCD,
+    0xBD, 0x2C, 0x1D, 0xC0, 0xB8, 0xD5, 0x56, 0x32, 0xED, 0xDE, 0xDB, 0x24, 0x62, 0xBD, 0xB6, 0x53,
+    0x94, 0x15, 0x63, 0x4E, 0xDF, 0x1B, 0x6D, 0x64, 0x69, 0xF8, 0x70, 0xE9, 0x98, 0x8F, 0x60, 0xFF,
+    0x61, 0x17, 0xDE, 0x5A, 0x53, 0xBA, 0x1C, 0x21, 0xBB, 0x8F, 0x9A, 0xE7, 0x80, 0x8A, 0xDE, 0xD5,
+    0xEA, 0x5E, 0xD6, 0x63, 0x55, 0xB3, 0xED, 0x80, 0x7B, 0xC6, 0xAC, 0x19, 0x07, 0x3B, 0xA9, 0x97,
+    0xF3, 0xD4, 0xB6, 0x5B, 0x41, 0xDE, 0x22, 0x0D, 0x72, 0xBC, 0x9F, 0xA1, 0x1F, 0xEA, 0xE7, 0x41,
+    0xBD, 0xCE, 0xCD, 0x8E, 0x17, 0x53, 0xAD, 0x03, 0xDF, 0xEC, 0x27, 0x33, 0x4A, 0x92, 0x4B, 0x1B,
+    0xFB, 0x08, 0x1F, 0xB4, 0x28, 0x05, 0x2F, 0xB9, 0x0A, 0xD8, 0x97, 0x29, 0x7B, 0xF6, 0x46, 0xCC,
+    0x39, 0x83, 0xD8, 0x45, 0x6A, 0x1E, 0xE4, 0x3D, 0x41, 0xD1, 0x59, 0xE0, 0xEA, 0x56, 0x62, 0x61,
+    0x15, 0x21, 0x9F, 0x4B, 0xAD, 0x20, 0xBC, 0x4A, 0x2D, 0x6B, 0xDB, 0x6F, 0xE1, 0x50, 0xF0, 0x19,
+    0x0C, 0xBA, 0x52, 0x4D, 0x97, 0xC2, 0xBC, 0x23, 0x5F, 0x60, 0xC8, 0xA7, 0xCA, 0x41, 0x85, 0x05,
+    0xF0, 0x65, 0xB1, 0x99, 0x33, 0x9B, 0xAB, 0xAC, 0x3B, 0x6C, 0x6D, 0x2C, 0x50, 0x86, 0xF5, 0x76,
+    0xD0, 0x94, 0x5F, 0xEB, 0x5D, 0xFA, 0xBA, 0xA4, 0x1E, 0xA5, 0xBB, 0xFE, 0x5E, 0x21, 0xD0, 0x74,
+    0x3D, 0x45, 0xC5, 0xF7, 0xF6, 0x60, 0x41, 0x10, 0xBA, 0x0E, 0x4B, 0xE1, 0x90, 0x1D, 0x0C, 0x38,
+    0x33, 0xCD, 0x60, 0xDB, 0xB9, 0x44, 0xD1, 0xB7, 0x39, 0x09, 0x1C, 0x47, 0xE9, 0xF7, 0x36, 0x98,
+    0x2E, 0xB8, 0x96, 0xC9, 0x6D, 0x01, 0xD7, 0xF0, 0xEA, 0xA6, 0x5C, 0x71, 0xAC, 0x72, 0x8E, 0x09,
+    0x52, 0x5D, 0xC0, 0xFF, 0x41, 0x4A, 0xAB, 0x11, 0x08, 0xE7, 0xFB, 0x00, 0x85, 0x2B, 0xCB, 0x65,
+    0x09, 0xAC, 0x8E, 0x5D, 0xB1, 0x1D, 0x34, 0x06, 0x13, 0x30, 0xA7, 0xC4, 0x25, 0xB8, 0xCE, 0xE8,
+    0x0C, 0x14, 0x4E, 0x2B, 0xC6, 0x55, 0x41, 0x7B, 0xC9, 0x5F, 0x70, 0x91, 0xAB, 0x1B, 0x1B, 0xF4,
+    0x9D, 0xD6, 0xD6, 0x2A, 0x4C, 0xC6, 0xF6, 0x7D, 0x3C, 0x10, 0xE4, 0xFA, 0xA8, 0x29, 0x67, 0x3D,
+    0xE8, 0x8C, 0x1C, 0x2D, 0x52, 0xA5, 0xD2, 0x49, 0xD7, 0xB9, 0x6B, 0xBB, 0xEA, 0x49, 0xED, 0xB2,
+    0xB3, 0xC6, 0x15, 0xC0, 0x16, 0x5B, 0xD2, 0xDB, 0x3A, 0x72, 0x67, 0xFF, 0x07, 0x86, 0x2E, 0xB4,
+    0xE6, 0xF6, 0x71, 0xBF, 0x47, 0xE7, 0x00, 0x59, 0x1E, 0x47, 0x39, 0x9D, 0xCF, 0xBE, 0xCE, 0x80,
+    0xEA, 0x4C, 0x29, 0xB9, 0x74, 0x37, 0x94, 0x2E, 0x79, 0xAD, 0x20, 0x45, 0x56, 0x82, 0xA7, 0x02,
+    0x8E, 0xFA, 0x73, 0x74, 0xFC, 0x40, 0xEB, 0x7F, 0x33, 0xE9, 0xFA, 0xF2, 0x99, 0x31, 0x42, 0x68,
+    0x39, 0xD4, 0x04, 0x5D, 0x3B, 0xD9, 0x3A, 0x39, 0xD0, 0x57, 0xE8, 0x2E, 0xF4, 0xAE, 0x28, 0xA4,
+    0x2D, 0xEC, 0xEC, 0xB3, 0x3D, 0xA7, 0x86, 0x2C, 0x32, 0xEB, 0x5B, 0x10, 0x54, 0xC0, 0x07, 0x4E,
+    0xBB, 0x56, 0x70, 0x2E, 0x64, 0x0C, 0xEF, 0xFA, 0xF4, 0xBA, 0x94, 0x85, 0xBE, 0x31, 0xE5, 0x48,
+    0xDD, 0x4E, 0x8C, 0x9E, 0xC7, 0x75, 0xBF, 0x3F, 0xF0, 0xCA, 0x51, 0x55, 0x03, 0x4E, 0x74, 0x3C,
+    0x29, 0xCA, 0x79, 0xFC, 0xAA, 0xEF, 0x26, 0x94, 0xF6, 0x86, 0x4A, 0x73, 0x86, 0x8D, 0x5D, 0xA8,
+    0x4E, 0x4B, 0xC7, 0x86, 0x92, 0xEF, 0xED, 0x8D, 0xDB, 0x0D, 0x95, 0x47, 0x5D, 0x67, 0x69, 0xF7,
+    0x19, 0x42, 0x09, 0x6A, 0x1D, 0xE3, 0x5A, 0xA4, 0x87, 0xEC, 0xD9, 0xEA, 0x72, 0xCA, 0x35, 0x57,
+    0x0D, 0xE8, 0x99, 0xD5, 0x31, 0xCF, 0xED, 0xAE, 0xE6, 0x83, 0x67, 0x93, 0xC9, 0x71, 0xCD, 0x6E,
+    0x0F, 0x22, 0x4C, 0x52, 0x3A, 0x52, 0x7A, 0x4A, 0x8D, 0x5E, 0xF3, 0xC5, 0xBC, 0x16, 0xDE, 0x76,
+    0x4F, 0x60, 0x0A, 0x50, 0x7B, 0x66, 0x5A, 0xCA, 0xF9, 0x33, 0x37, 0x2F, 0xC3, 0xE6, 0xB5, 0xEF,
+    0x04, 0x21, 0x19, 0x21, 0xC1, 0xCF, 0xF3, 0x78, 0xE9, 0xF3, 0x9A, 0x4B, 0x9F, 0x5D, 0x68, 0x71,
+    0xA9, 0x13, 0x64, 0x25, 0xFF, 0xC1, 0x11, 0x54, 0x8E, 0xD7, 0x85, 0x6C, 0xC7, 0xBE, 0x8E, 0x81,
+    0x78, 0x54, 0x62, 0xAC, 0x96, 0xDA, 0xD1, 0x69, 0x1B, 0x11, 0x37, 0xE3, 0xDF, 0xB6, 0x14, 0xD0,
+    0x7D, 0x20, 0x02, 0x7D, 0xD8, 0x42, 0x74, 0xCC, 0xB0, 0xEF, 0x4A, 0x60, 0xF4, 0x30, 0x58, 0x28,
+    0xFC, 0x52, 0x50, 0xC2, 0xB0, 0xB7, 0xB2, 0x5A, 0x89, 0xDD, 0x13, 0xF4, 0x79, 0x6B, 0xBD, 0xFD,
+    0xF0, 0xCA, 0x6F, 0xA6, 0x51, 0x58, 0x62, 0xE9, 0xE8, 0x3E, 0x4B, 0x7E, 0x7D, 0x57, 0x9F, 0xED,
+    0x16, 0x8E, 0x2B, 0x90, 0x99, 0x8D, 0xEC, 0x55, 0x83, 0x9B, 0x8C, 0x5B, 0x34, 0xB8, 0x7A, 0x6D,
+    0xB1, 0xA0, 0xE2, 0xF8, 0x38, 0x7D, 0xE5, 0x90, 0x03, 0xA7, 0x98, 0x6E, 0xFD, 0xFB, 0xDD, 0x7F,
+    0x25, 0x67, 0x1D, 0x76, 0x61, 0x19, 0x00, 0x00,
+};
+
+const OTAAsset assetStyleCss = {"/style.css", "text/css", assetStyleCssData, sizeof(assetStyleCssData), "\"d234cb9e8c98\"", "d234cb9e8c98", true};
+
+// /script.js: 6195 bytes (gzip de 19605 bytes)
+const uint8_t assetScriptJsData[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xC5, 0x5C, 0xDD, 0x6E, 0xDC, 0x48,
+    0x76, 0xBE, 0xF7, 0x53, 0x94, 0x05, 0xEC, 0x90, 0xB4, 0x5A, 0x54, 0x5B, 0x9E, 0x71, 0x9C, 0x96,
+    0xA5, 0x81, 0x24, 0xCB, 0x63, 0x65, 0x6D, 0x4B, 0xB0, 0x64, 0x4F, 0x10, 0xAD, 0x76, 0x50, 0x22,
+    0x4B, 0xDD, 0x1C, 0xB1, 0x49, 0x0E, 0x8B, 0xDD, 0xB2, 0xC6, 0x23, 0x20, 0x41, 0x12, 0xE4, 0x66,
+    0x83, 0x5C, 0x24, 0x17, 0x09, 0x90, 0x60, 0xE1, 0x04, 0x48, 0x90, 0x8B, 0xBD, 0x5A, 0x04, 0x09,
+    0x72, 0x19, 0xBD, 0xC9, 0xBC, 0x40, 0xF6, 0x11, 0x72, 0xCE, 0xA9, 0x1F, 0x16, 0x7F, 0x5A, 0x92,
+    0x07, 0x0B, 0x44, 0x06, 0xA4, 0x66, 0xB1, 0xEA, 0x54, 0xD5, 0xF9, 0xAB, 0xEF, 0x9C, 0x53, 0xED,
+    0x7B, 0xAB, 0xAB, 0x6C, 0xC3, 0xF9, 0x61, 0x47, 0xBB, 0xAF, 0xB6, 0x98, 0xCF, 0x0B, 0x91, 0x71,
+    0xC9, 0xB2, 0x9C, 0x65, 0x7C, 0x2E, 0xC6, 0x3C, 0xCE, 0xCB, 0xA0, 0xD1, 0xEF, 0xDE, 0xBD, 0xB3,
+    0x59, 0x16, 0x55, 0x49, 0x9E, 0x31, 0x5E, 0x14, 0xE9, 0xE5, 0xD1, 0x44, 0x4C, 0x85, 0x5F, 0xE1,
+    0xEF, 0x80, 0x7D, 0xB8, 0xC7, 0xE0, 0x27, 0xCE, 0xA3, 0xD9, 0x54, 0x64, 0x55, 0x78, 0x9A, 0xC7,
+    0x97, 0x61, 0x94, 0x72, 0x29, 0x5F, 0xF3, 0xA9, 0x60, 0x1B, 0x8C, 0xBA, 0xAD, 0x53, 0xA7, 0x34,
+    0x8F, 0x78, 0x7A, 0x58, 0xE5, 0x25, 0x1F, 0x8B, 0x50, 0x8A, 0x6A, 0xAF, 0x12, 0x53, 0xDF, 0xCB,
+    0x2B, 0xBE, 0x42, 0x9D, 0xBC, 0x81, 0xEA, 0x1C, 0xAC, 0x37, 0x49, 0x7E, 0x37, 0x13, 0xE5, 0xE5,
+    0xA1, 0x48, 0x45, 0x04, 0x43, 0xB7, 0xD2, 0xD4, 0xF7, 0x42, 0xEA, 0xB7, 0x52, 0xE5, 0xE3, 0x71,
+    0x2A, 0xBC, 0x20, 0x3C, 0xCB, 0xCB, 0x5D, 0x1E, 0x4D, 0xFC, 0x53, 0xB6, 0xB1, 0xC9, 0x4E, 0xC3,
+    0x4A, 0xBC, 0xAF, 0x76, 0xF2, 0xAC, 0x82, 0xC1, 0x66, 0x01, 0xB8, 0x1F, 0xE6, 0xC5, 0xBC, 0x3C,
+    0xF7, 0xD8, 0x97, 0xCC, 0xFB, 0xF1, 0xEF, 0xFF, 0xF4, 0x7F, 0xFF, 0xEB, 0x6F, 0x3C, 0x36, 0x62,
+    0xDE, 0xEF, 0x7E, 0xFD, 0xAB, 0x7F, 0xF0, 0x60, 0xCA, 0x2B, 0x67, 0x97, 0x8A, 0xB0, 0xDA, 0xA6,
+    0xD9, 0xA1, 0xB3, 0xF3, 0x85, 0x9B, 0x6D, 0xCC, 0x91, 0x26, 0xE3, 0x49, 0x45, 0x53, 0x50, 0x93,
+    0x9A, 0xA2, 0x2D, 0x81, 0xAD, 0x83, 0xBD, 0xC5, 0xAC, 0x4E, 0xFC, 0x82, 0x57, 0x13, 0xB3, 0x80,
+    0x52, 0x54, 0xB3, 0x32, 0x63, 0x67, 0xA2, 0x82, 0x9D, 0xE2, 0x8B, 0x01, 0xFB, 0xC0, 0x22, 0xD8,
+    0xB6, 0x80, 0x29, 0xB2, 0x7C, 0x45, 0x02, 0x77, 0x84, 0xC7, 0xAE, 0x02, 0xE4, 0x4E, 0xE6, 0x97,
+    0x42, 0x16, 0x79, 0x26, 0x05, 0xB2, 0x44, 0x11, 0xC0, 0x9F, 0xE4, 0x8C, 0xF9, 0xF7, 0xCD, 0xAB,
+    0x30, 0x3F, 0x0F, 0x80, 0x3D, 0x65, 0x7E, 0xC1, 0x32, 0x71, 0xC1, 0x76, 0xCB, 0x32, 0x2F, 0xED,
+    0xB8, 0x50, 0x56, 0xBC, 0x9A, 0x49, 0xB6, 0xCC, 0x3C, 0xF8, 0xB7, 0xCC, 0x5A, 0xED, 0x47, 0xC0,
+    0x63, 0x2D, 0x28, 0x67, 0x71, 0xB6, 0xD3, 0xB7, 0x32, 0xCF, 0x7C, 0xFD, 0xFE, 0xAA, 0xC5, 0x5D,
+    0x21, 0x23, 0x7F, 0xCE, 0xD3, 0x99, 0x55, 0x9E, 0x08, 0x86, 0x54, 0x2C, 0x4E, 0xE6, 0x20, 0x2D,
+    0xCB, 0xDB, 0xA8, 0x14, 0xBC, 0x12, 0xBB, 0xA9, 0xC0, 0x27, 0xDF, 0x83, 0xB7, 0x9E, 0x51, 0x8C,
+    0x64, 0xDE, 0x12, 0x31, 0x51, 0x23, 0xF6, 0xCF, 0xB2, 0x58, 0x9C, 0x25, 0x99, 0x88, 0xD9, 0x0F,
+    0x3F, 0x38, 0xCD, 0xD9, 0x2C, 0x4D, 0x51, 0x26, 0x28, 0x8E, 0xC3, 0xAA, 0x4C, 0xB2, 0xB1, 0x5E,
+    0xC1, 0xBA, 0xCB, 0x5A, 0x24, 0x9C, 0x64, 0x99, 0x28, 0x5F, 0x1C, 0xBD, 0x7A, 0xD9, 0x5C, 0x33,
+    0x68, 0xD8, 0x94, 0x57, 0x6F, 0x8B, 0x2A, 0x01, 0xF9, 0x4B, 0x01, 0x2B, 0x8E, 0x65, 0x73, 0xF9,
+    0x05, 0x8F, 0x61, 0x25, 0x19, 0xB2, 0x5B, 0xCF, 0x90, 0x05, 0x21, 0x34, 0x1E, 0x56, 0xBC, 0xAC,
+    0xFC, 0xB5, 0x01, 0xF3, 0x86, 0x66, 0x03, 0x7A, 0xBF, 0xD0, 0xFD, 0x15, 0x88, 0x31, 0x3C, 0x4B,
+    0x73, 0xE0, 0xBB, 0x26, 0xCA, 0x56, 0xD9, 0x93, 0xC7, 0x9F, 0x0F, 0x87, 0xC1, 0x80, 0x4D, 0xFA,
+    0x3B, 0xFC, 0x4C, 0x75, 0x80, 0x8E, 0x8F, 0x1E, 0x43, 0x3F, 0x97, 0xE4, 0x74, 0xD1, 0x08, 0xEC,
+    0x09, 0x03, 0x1E, 0x23, 0x59, 0x09, 0x9D, 0xEA, 0x37, 0x8F, 0x87, 0x8A, 0x00, 0x2A, 0x46, 0xCC,
+    0x36, 0xD9, 0x30, 0xB0, 0xDC, 0x40, 0xD1, 0xC7, 0x24, 0x7B, 0xD8, 0x86, 0x0F, 0x7A, 0x08, 0xCF,
+    0x13, 0xFB, 0x3C, 0xA5, 0xE7, 0xA9, 0x7D, 0x96, 0xF4, 0x2C, 0xBD, 0x9A, 0xDC, 0xA4, 0x41, 0xEE,
+    0xD3, 0x69, 0x38, 0x03, 0x17, 0x77, 0xEC, 0x0A, 0x69, 0xFB, 0xB2, 0x12, 0xD2, 0x3F, 0xC5, 0xDF,
+    0x46, 0x42, 0xB8, 0x1A, 0x6A, 0x60, 0x9B, 0x1B, 0xEC, 0xE1, 0xF0, 0xF3, 0x27, 0x5F, 0xFC, 0xC1,
+    0x63, 0xBB, 0x30, 0xFD, 0x66, 0xD5, 0xBE, 0x08, 0xAB, 0xFC, 0x79, 0xF2, 0x5E, 0xC4, 0xFE, 0x1A,
+    0xCD, 0xC2, 0x5E, 0x6D, 0x3B, 0x9B, 0x72, 0xC8, 0xAC, 0x7D, 0xDE, 0x47, 0x03, 0x5A, 0x2D, 0x81,
+    0x87, 0x8A, 0xC0, 0xCF, 0xB7, 0x9B, 0x3B, 0x52, 0x9D, 0xF1, 0xCD, 0xB6, 0x67, 0xBC, 0x02, 0x18,
+    0xA1, 0x1C, 0xB1, 0xE3, 0x94, 0x9F, 0x8A, 0x74, 0xA0, 0x34, 0x77, 0xC0, 0xD2, 0x64, 0x2E, 0xBE,
+    0x3C, 0x61, 0x2B, 0xF4, 0x01, 0xC4, 0x16, 0xF1, 0x69, 0x91, 0xB3, 0x98, 0xB3, 0x4A, 0xA0, 0x5D,
+    0x80, 0x9A, 0x71, 0x06, 0xDE, 0x91, 0x81, 0x41, 0xF2, 0x34, 0xF9, 0x9E, 0xB3, 0x1C, 0x47, 0xE6,
+    0x65, 0xCD, 0x92, 0x88, 0x97, 0xB1, 0x5F, 0x25, 0x55, 0x0A, 0xD4, 0x70, 0x8A, 0x01, 0x03, 0xC3,
+    0x29, 0xB9, 0x61, 0x4C, 0x2A, 0x2A, 0x36, 0xA9, 0xA6, 0x29, 0xD0, 0xF6, 0x9E, 0xA2, 0x01, 0x92,
+    0x33, 0xDB, 0x58, 0x4A, 0xB2, 0xB3, 0x7C, 0x05, 0xC7, 0x2E, 0x6D, 0x3E, 0x9D, 0x3C, 0xDA, 0x44,
+    0xB6, 0xA3, 0xD5, 0x12, 0x21, 0xDA, 0xD3, 0xD3, 0x55, 0x6C, 0xD6, 0xBB, 0x02, 0xBA, 0xD6, 0x05,
+    0xFB, 0x3D, 0x5B, 0x38, 0x09, 0xBA, 0x4E, 0x48, 0xD9, 0xE6, 0xFD, 0x86, 0xC9, 0x7E, 0xF6, 0x19,
+    0xAB, 0x9B, 0xC9, 0x64, 0x1B, 0x2D, 0x9E, 0x17, 0x38, 0x44, 0x6A, 0xAD, 0x8F, 0xAC, 0x1F, 0x20,
+    0x36, 0x81, 0x99, 0x3F, 0x95, 0x05, 0x07, 0x05, 0xE6, 0x70, 0xB2, 0x60, 0xD3, 0xC6, 0x12, 0x6E,
+    0x80, 0x5E, 0xC2, 0xD2, 0x97, 0xEC, 0x76, 0xB4, 0x13, 0xA2, 0xED, 0xE0, 0x88, 0x4D, 0x74, 0x0F,
+    0xF5, 0x8B, 0xF5, 0xC6, 0x5C, 0xC4, 0xA6, 0x65, 0xE4, 0x53, 0xB1, 0xF9, 0x54, 0x56, 0x65, 0x9E,
+    0x8D, 0x2D, 0x21, 0xDA, 0x32, 0x11, 0x1A, 0x01, 0x25, 0xF5, 0x8E, 0x74, 0xD5, 0x2C, 0x8D, 0xA6,
+    0x28, 0x0C, 0xC3, 0xC8, 0x29, 0x5A, 0xD7, 0xE8, 0x28, 0x86, 0x9A, 0x83, 0xF9, 0x24, 0x23, 0xF4,
+    0x60, 0xB8, 0x65, 0x1A, 0x0B, 0xB2, 0xD9, 0xF4, 0x7A, 0x4F, 0x90, 0x83, 0xEB, 0x3F, 0xFB, 0x6A,
+    0xEF, 0xF5, 0xD6, 0xE1, 0xA2, 0x63, 0xA4, 0x00, 0x3E, 0xEE, 0xA0, 0x16, 0xC0, 0x39, 0xEB, 0xDA,
+    0x03, 0x3C, 0x86, 0xF8, 0xCE, 0xF8, 0x79, 0x75, 0x78, 0x25, 0x92, 0x9F, 0xA6, 0x22, 0xF6, 0xAC,
+    0x66, 0x7B, 0x30, 0xEB, 0xDD, 0x54, 0x85, 0x66, 0x72, 0x94, 0xE6, 0x77, 0xBF, 0xFE, 0xBB, 0xBF,
+    0x60, 0xFB, 0x47, 0x5B, 0xEC, 0x8D, 0x98, 0xE6, 0x55, 0xEE, 0x6A, 0xCC, 0xC2, 0xF9, 0xF9, 0x9C,
+    0x27, 0x29, 0xAE, 0xA0, 0x21, 0xEA, 0x9A, 0xF5, 0xCE, 0xBC, 0xA7, 0x3C, 0x1E, 0x8B, 0x15, 0x39,
+    0x8B, 0x22, 0x21, 0xE5, 0x12, 0xCC, 0xF6, 0xB7, 0xFF, 0xCA, 0xB6, 0xB4, 0x1D, 0x5C, 0xFF, 0xDB,
+    0xF5, 0xBF, 0xE4, 0xEC, 0x59, 0x82, 0x87, 0xD1, 0xF5, 0x6F, 0xE6, 0x22, 0xB5, 0x0C, 0xBC, 0x99,
+    0x64, 0x95, 0xAD, 0x80, 0x32, 0x2F, 0xF5, 0x77, 0x3C, 0x9D, 0x55, 0x15, 0x5A, 0x94, 0xED, 0xCB,
+    0xB0, 0xBF, 0x9C, 0x72, 0xD0, 0x53, 0xFA, 0xA4, 0x97, 0xC2, 0xF2, 0x2C, 0x4A, 0x93, 0xE8, 0x7C,
+    0x63, 0xA9, 0x10, 0x25, 0xBA, 0xA4, 0x03, 0xD8, 0xE5, 0xDB, 0x02, 0xB4, 0x11, 0xC0, 0xC4, 0x92,
+    0x62, 0xCB, 0x1E, 0xE8, 0x2D, 0x4F, 0x79, 0xC9, 0xE6, 0x46, 0x85, 0x2C, 0x3B, 0x52, 0xE8, 0x27,
+    0xAB, 0x77, 0xA2, 0x94, 0x20, 0x3D, 0x2D, 0x7D, 0x35, 0xF5, 0x27, 0x2F, 0xCB, 0x59, 0x0A, 0xA0,
+    0x84, 0xE8, 0xFC, 0x79, 0x5E, 0xAA, 0x75, 0x48, 0x5C, 0x08, 0x4C, 0x91, 0x9C, 0x25, 0x20, 0xAF,
+    0x9B, 0xE9, 0xBB, 0x9C, 0xBB, 0x62, 0x22, 0x05, 0x44, 0xD1, 0x27, 0x99, 0xC2, 0xAC, 0x60, 0x56,
+    0x00, 0x2E, 0x5B, 0xC1, 0x59, 0x96, 0x36, 0x7F, 0xFC, 0xC7, 0xBF, 0xB4, 0x32, 0x89, 0xF3, 0x96,
+    0x05, 0xF4, 0x8A, 0x20, 0x02, 0x6B, 0x11, 0xA5, 0x40, 0x15, 0xFA, 0xC9, 0x1B, 0x03, 0x0E, 0xFF,
+    0x35, 0xEB, 0xEE, 0xAE, 0xB9, 0x93, 0x1E, 0xB3, 0x6B, 0x98, 0x99, 0xB5, 0x9F, 0x34, 0xE7, 0xF1,
+    0x8B, 0xDC, 0x01, 0x82, 0x7A, 0xD0, 0x41, 0x99, 0x4F, 0x13, 0x40, 0x3A, 0xB0, 0x1C, 0xFF, 0x18,
+    0xB1, 0x9A, 0xB7, 0x0A, 0xBF, 0x57, 0x95, 0x36, 0x7B, 0x70, 0xCE, 0xD6, 0x6D, 0x20, 0x5B, 0x2F,
+    0x38, 0xD1, 0xB8, 0xCC, 0x3F, 0x56, 0x5D, 0x06, 0x0C, 0x9A, 0xDB, 0x9E, 0xD1, 0xA2, 0x9F, 0xB1,
+    0xA8, 0x34, 0xF4, 0xD9, 0xBE, 0xDC, 0x8B, 0x7D, 0x6F, 0x02, 0x2B, 0x20, 0xDB, 0x02, 0xD2, 0x35,
+    0x46, 0x61, 0x1B, 0x4D, 0x77, 0x88, 0x66, 0xEE, 0x7D, 0x9D, 0x3C, 0x4F, 0x00, 0x4A, 0x1F, 0x1F,
+    0x7B, 0x7B, 0x07, 0xF0, 0x57, 0xCD, 0x16, 0x26, 0xC5, 0x09, 0xB4, 0x79, 0xD3, 0x67, 0xAF, 0x0F,
+    0xEB, 0xC6, 0x69, 0x9C, 0x49, 0xF0, 0x97, 0xEE, 0x13, 0xB0, 0x21, 0x24, 0x9C, 0x4E, 0xC8, 0xD5,
+    0xA3, 0x41, 0x87, 0x87, 0x7B, 0xCF, 0xEA, 0x41, 0x52, 0x26, 0xF1, 0x09, 0x2C, 0x7C, 0xB9, 0x67,
+    0xEE, 0xC3, 0x4B, 0x09, 0x98, 0x5E, 0xCD, 0xAE, 0x55, 0xB8, 0x1E, 0x38, 0x57, 0x0D, 0x44, 0xF2,
+    0x85, 0xE0, 0x05, 0x7B, 0x5E, 0x0A, 0x51, 0xBF, 0x9E, 0x40, 0x13, 0xB6, 0xD0, 0xC1, 0x48, 0x47,
+    0x24, 0xBC, 0xF3, 0x4C, 0xAB, 0x5A, 0xC9, 0xCE, 0xC1, 0xDB, 0x7A, 0x40, 0x54, 0xCC, 0xE0, 0xCD,
+    0x77, 0xEA, 0x8C, 0x7E, 0xF1, 0xBD, 0xD7, 0x5D, 0x54, 0xC3, 0xF7, 0xF5, 0x83, 0x51, 0x14, 0xAF,
+    0x5A, 0xB5, 0x15, 0x30, 0x78, 0x58, 0x12, 0x5B, 0x9A, 0x8F, 0x99, 0xBC, 0xFE, 0x2D, 0x9C, 0x98,
+    0x09, 0xBC, 0x07, 0x5F, 0x3E, 0x45, 0x77, 0xF6, 0xCD, 0xCB, 0xFD, 0xAF, 0xBE, 0x79, 0xB6, 0xFB,
+    0x7C, 0xF7, 0xCD, 0x9B, 0xDD, 0x67, 0x1B, 0x0F, 0x1D, 0xF4, 0x85, 0xFD, 0x37, 0x34, 0x3E, 0xF7,
+    0x0C, 0x05, 0xEF, 0x16, 0x94, 0x8E, 0xF2, 0x2F, 0x01, 0x88, 0x83, 0x18, 0x4A, 0x42, 0xB5, 0xB0,
+    0x8C, 0x11, 0x1D, 0x7E, 0x41, 0x18, 0x71, 0x24, 0xE5, 0x93, 0x8E, 0x50, 0xCB, 0xFA, 0x5D, 0x14,
+    0x50, 0x89, 0x00, 0x14, 0x10, 0x66, 0xAF, 0x95, 0x0E, 0xDD, 0x34, 0x35, 0x21, 0x70, 0x6F, 0xAB,
+    0x9D, 0x5A, 0x3F, 0x60, 0x57, 0x86, 0xDD, 0xC2, 0x4C, 0x54, 0x17, 0x79, 0x79, 0x3E, 0x20, 0x3C,
+    0x49, 0x2D, 0x53, 0x70, 0xE1, 0xE5, 0xA5, 0x82, 0xA4, 0xD4, 0x30, 0x01, 0xAE, 0x5E, 0xF0, 0x52,
+    0x28, 0x38, 0x49, 0x4D, 0x6A, 0xE2, 0xF5, 0xDB, 0x75, 0x59, 0x75, 0x5C, 0x41, 0x28, 0x0D, 0xCA,
+    0xDC, 0x44, 0xF2, 0x32, 0xC4, 0xE6, 0xBB, 0x13, 0x99, 0x15, 0xBD, 0x64, 0x3C, 0x85, 0xD4, 0x47,
+    0x74, 0x08, 0x37, 0xB1, 0x7B, 0xA8, 0x86, 0x04, 0x77, 0x9F, 0xE3, 0x6E, 0x66, 0xF7, 0x5A, 0x31,
+    0x4D, 0xE9, 0xFE, 0x4B, 0xB4, 0x20, 0x46, 0xF6, 0x97, 0xB5, 0x4C, 0x2F, 0x33, 0x56, 0x97, 0xDD,
+    0x6A, 0x70, 0x99, 0xB2, 0xB5, 0x41, 0x63, 0xB6, 0xCE, 0xCF, 0xB1, 0xF7, 0x06, 0xFA, 0x53, 0xF7,
+    0x12, 0xFA, 0x93, 0x39, 0xC4, 0xDB, 0x68, 0x84, 0x1E, 0x3E, 0x2B, 0x8A, 0xAF, 0xB6, 0x76, 0xD4,
+    0xDC, 0x3C, 0x5A, 0x64, 0xBB, 0xAF, 0x48, 0xC6, 0x6A, 0xFD, 0xAE, 0x79, 0x4E, 0xEF, 0x64, 0x99,
+    0x34, 0xE2, 0x55, 0x92, 0xD9, 0x01, 0xF0, 0xB9, 0xDB, 0x1F, 0x3B, 0xDC, 0xB2, 0x1F, 0x4D, 0xEA,
+    0x30, 0xF9, 0xBE, 0x9E, 0x1C, 0x1F, 0x1C, 0x62, 0xB7, 0x52, 0x38, 0x38, 0x7C, 0xB3, 0xF5, 0xAA,
+    0x26, 0x51, 0xC8, 0x92, 0x4F, 0x3B, 0x34, 0x6C, 0x3F, 0xBB, 0x4F, 0xEA, 0xD7, 0xDA, 0xE8, 0x22,
+    0x6E, 0xBD, 0xD0, 0x06, 0xA0, 0xF8, 0x05, 0x7E, 0x09, 0xC9, 0x00, 0x16, 0xCF, 0x22, 0x64, 0xE1,
+    0xA4, 0xEB, 0x9C, 0x70, 0xBE, 0xE7, 0x70, 0x96, 0x4D, 0xCC, 0xBA, 0x30, 0x4A, 0x83, 0x47, 0xBB,
+    0x2E, 0x08, 0x33, 0x6E, 0x13, 0x35, 0xAA, 0xC6, 0xB3, 0x9F, 0xB3, 0xDA, 0xB3, 0x4E, 0x42, 0x19,
+    0x9F, 0xBF, 0x73, 0xFC, 0xEA, 0xCE, 0x24, 0x01, 0x31, 0xE4, 0xB1, 0x48, 0xD5, 0x2A, 0xE0, 0x91,
+    0x9E, 0x3E, 0xD1, 0x61, 0x37, 0x7C, 0xB5, 0xB2, 0x1C, 0x68, 0xEE, 0x37, 0x24, 0x10, 0xAD, 0xB6,
+    0x42, 0xB5, 0xC7, 0xA4, 0x9C, 0x22, 0x63, 0xD8, 0xE9, 0x2C, 0x49, 0x2B, 0x22, 0x46, 0x9F, 0x6E,
+    0x15, 0xDA, 0x1B, 0x21, 0x01, 0x62, 0xBE, 0x11, 0x5C, 0xEA, 0x35, 0x94, 0xD8, 0xA0, 0x9E, 0xD5,
+    0xDE, 0x2E, 0xA3, 0x54, 0xB0, 0x9D, 0x7C, 0x96, 0x29, 0xB2, 0x11, 0x3E, 0xD3, 0xE3, 0xAD, 0xB4,
+    0x77, 0xC0, 0xC2, 0xD0, 0x34, 0x23, 0xFC, 0x8B, 0x1E, 0xD0, 0x27, 0x97, 0x45, 0x8F, 0x41, 0x97,
+    0x37, 0x15, 0x97, 0xE7, 0x92, 0x0E, 0x0E, 0xEA, 0x46, 0x8F, 0x08, 0xC7, 0x8F, 0x61, 0x1D, 0x6A,
+    0x60, 0x31, 0xC3, 0xE7, 0x0F, 0x57, 0xED, 0x91, 0xE0, 0x60, 0x69, 0x9C, 0x76, 0xB4, 0x8E, 0x97,
+    0x51, 0x3E, 0xB6, 0x02, 0x7C, 0xEB, 0x66, 0x39, 0x1A, 0xB9, 0x2D, 0x1F, 0x3D, 0xC1, 0x78, 0x05,
+    0xFB, 0x78, 0xCE, 0x48, 0x44, 0xCB, 0xD8, 0x16, 0xD0, 0xE8, 0x50, 0x46, 0x65, 0x9E, 0xA6, 0x47,
+    0x79, 0x81, 0xB9, 0xAD, 0xBA, 0xE1, 0x85, 0xC0, 0x7C, 0x53, 0xFF, 0x21, 0x57, 0x6F, 0x5B, 0xED,
+    0xD8, 0x09, 0x03, 0xEE, 0xEB, 0x16, 0x07, 0xEE, 0x37, 0x5F, 0x81, 0x5F, 0xCF, 0x22, 0x11, 0xD7,
+    0x3D, 0x0E, 0x93, 0x0C, 0x26, 0xCC, 0x00, 0xD2, 0x65, 0x71, 0x1E, 0x86, 0x61, 0x33, 0xB6, 0xF5,
+    0x0E, 0x5F, 0x1F, 0x1D, 0xB0, 0xC9, 0xF5, 0xC7, 0xAE, 0xEB, 0x55, 0xE4, 0x40, 0xE7, 0xAB, 0x43,
+    0x20, 0xA9, 0x42, 0xE3, 0xFF, 0xF9, 0x4F, 0x15, 0x27, 0xD1, 0xAB, 0x18, 0x20, 0x5B, 0x75, 0x50,
+    0x4C, 0xE9, 0x4D, 0x01, 0x7F, 0xE1, 0x2D, 0x07, 0x45, 0x85, 0x80, 0x77, 0x01, 0xB1, 0x04, 0xD1,
+    0x22, 0x44, 0x6B, 0x9D, 0x43, 0x5D, 0x49, 0x01, 0x0F, 0x05, 0x77, 0xB3, 0xF8, 0x6C, 0xF3, 0x41,
+    0x9D, 0x3D, 0x9B, 0xC7, 0xFE, 0xE8, 0x06, 0x25, 0x53, 0x07, 0x37, 0x2F, 0xF3, 0x31, 0x05, 0x34,
+    0x4F, 0x0B, 0xD0, 0x74, 0xDD, 0xD7, 0xC8, 0xAE, 0x0E, 0x30, 0xD5, 0xFC, 0x2A, 0xF8, 0x2B, 0xC5,
+    0x66, 0x2F, 0xBE, 0xAC, 0x75, 0x8D, 0x3E, 0x81, 0x8E, 0x16, 0xB3, 0x56, 0x66, 0x49, 0x94, 0x91,
+    0xCE, 0x73, 0xE1, 0xB1, 0x3D, 0xAF, 0x33, 0x5A, 0x98, 0xE3, 0x6A, 0xA5, 0xBD, 0x20, 0xFA, 0xCD,
+    0x56, 0x39, 0x9E, 0x25, 0xF3, 0x56, 0x1A, 0xE2, 0x67, 0x9E, 0x9B, 0x2A, 0xC2, 0xA0, 0x1D, 0x28,
+    0xEE, 0x9F, 0x7E, 0x0B, 0xAA, 0x17, 0x9E, 0x8B, 0x4B, 0xE9, 0xE3, 0xC4, 0xE1, 0x19, 0x98, 0xAA,
+    0x28, 0x7D, 0x68, 0xC0, 0xB9, 0xF0, 0x0F, 0x85, 0xDE, 0x25, 0x58, 0x19, 0xB0, 0xFD, 0x10, 0x90,
+    0x17, 0x1E, 0x85, 0x53, 0x5E, 0x98, 0x2E, 0xCA, 0xF9, 0xE1, 0x8E, 0xA1, 0x61, 0x60, 0x16, 0x8B,
+    0xC4, 0x8E, 0xA1, 0xE1, 0x04, 0x70, 0xAF, 0x9A, 0x96, 0x76, 0x67, 0xD3, 0x04, 0x55, 0x1F, 0x00,
+    0x01, 0x5C, 0x17, 0x9D, 0xA3, 0x56, 0x87, 0xF4, 0x89, 0x3C, 0xE3, 0x97, 0xE6, 0xE9, 0xAD, 0x14,
+    0xF1, 0x2B, 0xFE, 0x9E, 0x74, 0x63, 0x95, 0xE6, 0x73, 0xBB, 0xD5, 0x0E, 0x1B, 0x76, 0xAE, 0x5F,
+    0xA0, 0x27, 0x6F, 0x9C, 0x42, 0x98, 0x02, 0x00, 0xA7, 0xE2, 0xC4, 0x20, 0x94, 0xBA, 0x28, 0x66,
+    0x72, 0xE2, 0x1F, 0x57, 0x61, 0xC6, 0xA7, 0x80, 0x67, 0xBC, 0x08, 0x00, 0x1A, 0xD1, 0xF7, 0xAB,
+    0x90, 0x3E, 0x3F, 0x65, 0x43, 0x64, 0x2B, 0xCF, 0x2E, 0x15, 0x71, 0x6C, 0xB4, 0xDA, 0x5B, 0x94,
+    0x49, 0xAE, 0x57, 0x83, 0x1F, 0xCB, 0xA4, 0xBA, 0x6C, 0xB9, 0x84, 0xD6, 0x0F, 0x8D, 0x52, 0x3B,
+    0xC5, 0x61, 0xEA, 0x93, 0x26, 0x66, 0x38, 0x69, 0x98, 0x58, 0xA1, 0xA3, 0xB1, 0x1C, 0x6C, 0x25,
+    0x0B, 0x94, 0x03, 0x3F, 0x42, 0xB6, 0x7A, 0x2A, 0xB9, 0xA3, 0xAC, 0x40, 0xF1, 0x72, 0x9E, 0x08,
+    0x12, 0xB0, 0xE2, 0xB1, 0xB7, 0xEA, 0x8D, 0x00, 0x87, 0x26, 0x31, 0x40, 0x0C, 0x7C, 0xB3, 0x82,
+    0xF1, 0x84, 0x37, 0x20, 0xF4, 0x3B, 0xB2, 0x21, 0x0E, 0xBB, 0x1A, 0xE8, 0xDE, 0x33, 0x8A, 0xA6,
+    0x5A, 0x63, 0x74, 0x63, 0xDD, 0x4B, 0x43, 0xCD, 0x66, 0x2F, 0x69, 0x4E, 0x94, 0x9A, 0xB6, 0x3A,
+    0x64, 0x20, 0xE6, 0xBA, 0x5A, 0x77, 0x14, 0x3F, 0xE3, 0xF3, 0x64, 0x8C, 0x41, 0xB1, 0xCA, 0x65,
+    0xA3, 0x14, 0x9A, 0x7A, 0x8F, 0xE4, 0x50, 0xE9, 0x71, 0x27, 0xC7, 0xD8, 0xE9, 0x84, 0x14, 0x9E,
+    0x1E, 0x61, 0x43, 0x27, 0xB7, 0x97, 0x09, 0xB0, 0xAF, 0x53, 0x1E, 0x50, 0xE6, 0xA3, 0x12, 0xF6,
+    0x2F, 0x01, 0xD3, 0x87, 0x2A, 0xCF, 0xEF, 0x7B, 0x1C, 0x56, 0x34, 0x47, 0x7E, 0xCC, 0xC3, 0x24,
+    0x26, 0x83, 0xC2, 0x91, 0xF0, 0x39, 0x68, 0xD7, 0x22, 0x28, 0x03, 0xE6, 0x3A, 0xF0, 0x16, 0x66,
+    0x34, 0xE3, 0x42, 0x4C, 0x3E, 0xC1, 0xF1, 0xA5, 0x06, 0xD4, 0x3E, 0x55, 0xED, 0x72, 0x92, 0x60,
+    0x18, 0x70, 0x49, 0x9A, 0x87, 0x26, 0x25, 0x7C, 0x34, 0x67, 0xD0, 0x3D, 0x58, 0x02, 0xA5, 0xFC,
+    0x1D, 0x27, 0x4C, 0x14, 0x91, 0x8B, 0x41, 0x1B, 0xF8, 0x83, 0x2A, 0xE7, 0xE9, 0x5C, 0xF8, 0x4D,
+    0xB5, 0xB0, 0xFD, 0x7D, 0x13, 0x40, 0x08, 0xCC, 0xEB, 0xE3, 0xD6, 0x91, 0xAD, 0x79, 0x2A, 0x42,
+    0x6A, 0xF0, 0xBD, 0xE7, 0x3C, 0x9D, 0x70, 0xC6, 0x73, 0xD4, 0xA4, 0x52, 0x8C, 0x79, 0xC9, 0x62,
+    0x88, 0xD2, 0xA5, 0x02, 0xCD, 0xD4, 0x27, 0x50, 0x1A, 0x65, 0x37, 0xCB, 0xE3, 0x78, 0x77, 0x0E,
+    0x1F, 0x90, 0x79, 0x02, 0xC0, 0xB0, 0xEF, 0x51, 0x14, 0x8E, 0xD0, 0x40, 0x4B, 0xD5, 0x6F, 0x25,
+    0xF5, 0xD3, 0x24, 0x43, 0x8B, 0x16, 0x70, 0x86, 0x96, 0xC0, 0x2A, 0x3C, 0x71, 0xA5, 0x90, 0x15,
+    0xB0, 0xFC, 0x58, 0xA7, 0xE7, 0xB2, 0xF3, 0x13, 0xCF, 0xD9, 0x2F, 0x36, 0xB8, 0xB9, 0x1F, 0x01,
+    0x66, 0x25, 0x70, 0xCE, 0x67, 0xE2, 0x8C, 0xCF, 0xD2, 0xCA, 0x77, 0x0E, 0x46, 0xAB, 0x41, 0x38,
+    0x08, 0x25, 0xB1, 0x55, 0x55, 0x65, 0x02, 0xE1, 0x3E, 0x88, 0x74, 0x52, 0x8A, 0x33, 0x0A, 0x82,
+    0x16, 0xBD, 0x22, 0xBF, 0x86, 0xC0, 0x1B, 0x97, 0x1D, 0x22, 0xD7, 0xD1, 0xFE, 0x8D, 0xA9, 0xDD,
+    0x43, 0x63, 0xBB, 0x77, 0x91, 0xC0, 0x11, 0x77, 0xD1, 0xB3, 0xED, 0x22, 0x2F, 0x30, 0x08, 0x45,
+    0x95, 0xD1, 0xE1, 0x99, 0x5D, 0x4A, 0x9B, 0x22, 0xF0, 0x86, 0xA7, 0x52, 0x20, 0x2B, 0x3B, 0xB9,
+    0xBB, 0xDD, 0x77, 0xBB, 0xAF, 0x8F, 0xF6, 0x0F, 0xD9, 0xD6, 0x3E, 0x7B, 0xB7, 0xF7, 0x6E, 0x9F,
+    0xF9, 0x14, 0xC1, 0xD1, 0x76, 0x65, 0xBB, 0x04, 0x87, 0xF9, 0x37, 0xF5, 0xE6, 0xA5, 0x4A, 0x06,
+    0x13, 0xD9, 0x75, 0x8C, 0x56, 0x41, 0x21, 0xC6, 0xA0, 0x0C, 0x32, 0x67, 0x73, 0x30, 0xB3, 0x38,
+    0x67, 0xBB, 0x87, 0x07, 0x8F, 0xD6, 0x4C, 0x52, 0x7A, 0x5C, 0xF2, 0x39, 0xCA, 0x15, 0x98, 0x91,
+    0x61, 0x5A, 0x0C, 0xDE, 0x8B, 0x6C, 0x9E, 0xD0, 0x07, 0x5B, 0xF0, 0x33, 0x6E, 0x03, 0x93, 0xA4,
+    0xCF, 0xE9, 0x9C, 0xB5, 0xBE, 0xC3, 0xE0, 0xFC, 0x91, 0x39, 0x7E, 0x1C, 0x54, 0x6F, 0x3B, 0x80,
+    0x9F, 0x5D, 0xF8, 0x1E, 0xA3, 0x90, 0xC6, 0x4B, 0x8A, 0x4E, 0xE8, 0xD5, 0x4C, 0x87, 0x69, 0xF4,
+    0xB2, 0x71, 0xBE, 0xCF, 0x83, 0xA6, 0xB7, 0xC8, 0xB3, 0x23, 0x9D, 0xF3, 0xBE, 0xF4, 0xED, 0x99,
+    0xEE, 0x9E, 0x5E, 0xF5, 0xCA, 0x6B, 0x83, 0xD7, 0x47, 0x54, 0x33, 0xF3, 0x5C, 0xD1, 0xB9, 0xD4,
+    0x3C, 0x36, 0x8D, 0x6D, 0xF5, 0x04, 0x85, 0x5D, 0xB7, 0x72, 0xDC, 0x4A, 0x2C, 0xE3, 0x2C, 0x98,
+    0x57, 0x3E, 0x71, 0x5C, 0x8D, 0x48, 0x71, 0x62, 0x91, 0xB6, 0xE2, 0xD2, 0x7A, 0x91, 0xB4, 0x08,
+    0xBD, 0x96, 0xA0, 0xE5, 0xE0, 0x7F, 0xEF, 0x41, 0x6F, 0x55, 0x07, 0xBD, 0x2E, 0xF4, 0x28, 0xB4,
+    0xDE, 0x10, 0x32, 0x2C, 0x0C, 0x53, 0xE5, 0x45, 0x02, 0x5E, 0x03, 0x5C, 0x55, 0x58, 0x4C, 0xC0,
+    0x85, 0xB9, 0xC6, 0x18, 0xC1, 0x33, 0xF3, 0x24, 0x56, 0xB4, 0xC0, 0xEB, 0x5B, 0xC4, 0x87, 0xCF,
+    0x49, 0x36, 0xAE, 0xB1, 0x60, 0xDD, 0xB7, 0x2A, 0x79, 0x26, 0xCF, 0x44, 0x89, 0x87, 0x44, 0x13,
+    0x28, 0x83, 0x3A, 0x2B, 0x38, 0x46, 0x33, 0x69, 0x88, 0x73, 0xBF, 0x85, 0x65, 0xEC, 0x9B, 0x36,
+    0x96, 0x51, 0xC0, 0x71, 0xA4, 0x13, 0xE4, 0x6E, 0xE1, 0xA7, 0x08, 0x55, 0xE9, 0xA7, 0x99, 0xBD,
+    0x27, 0xDF, 0x1B, 0x9E, 0x16, 0x60, 0x56, 0x34, 0x2B, 0xE6, 0x1D, 0x0D, 0xF8, 0x6C, 0x8D, 0x2E,
+    0x54, 0x71, 0x69, 0xD5, 0xC5, 0x09, 0x35, 0x09, 0x51, 0xF1, 0xE6, 0x2A, 0x5B, 0x04, 0x77, 0x8F,
+    0xB6, 0x88, 0x28, 0x95, 0xE1, 0x22, 0x91, 0xA4, 0x6A, 0x4C, 0xA3, 0xB0, 0xD5, 0x2A, 0x9A, 0xE2,
+    0xF8, 0x76, 0x61, 0xA0, 0xE6, 0x20, 0x4C, 0x82, 0xF9, 0x53, 0xE1, 0x30, 0x9C, 0x72, 0x9B, 0x97,
+    0xC0, 0x71, 0x76, 0x66, 0x82, 0x2D, 0xDF, 0x5B, 0xC0, 0x06, 0x9C, 0x37, 0xE8, 0x93, 0x4C, 0x9C,
+    0x67, 0x2E, 0x4D, 0x95, 0x3F, 0xC5, 0x24, 0x57, 0x01, 0xA2, 0x11, 0xF1, 0x7D, 0x88, 0xC4, 0x64,
+    0xAF, 0x60, 0x63, 0xE5, 0x88, 0xEB, 0xA1, 0x54, 0x37, 0x56, 0x5A, 0x07, 0xD3, 0x4E, 0x41, 0xA1,
+    0xF8, 0x58, 0x50, 0xF5, 0x42, 0x21, 0x06, 0xF0, 0x54, 0x09, 0xD5, 0x14, 0xAC, 0x6F, 0x75, 0x74,
+    0x50, 0x4E, 0xF2, 0x0B, 0xE3, 0xBF, 0xFC, 0x53, 0x5E, 0x9A, 0xEC, 0x1E, 0x1C, 0x84, 0x2E, 0x72,
+    0x5F, 0xA0, 0x22, 0x01, 0x83, 0x21, 0x80, 0xF6, 0x2E, 0xE1, 0x54, 0xBB, 0x48, 0xE2, 0xCA, 0x96,
+    0x4C, 0xA7, 0x49, 0x56, 0x8F, 0x19, 0xB0, 0x87, 0xC3, 0x61, 0x03, 0x03, 0x6B, 0x92, 0xA8, 0xDF,
+    0xAA, 0xF0, 0x60, 0xB9, 0x8C, 0xEB, 0x6E, 0xBC, 0x21, 0x3E, 0xF5, 0xCD, 0xE3, 0x01, 0x51, 0x43,
+    0xAF, 0x7E, 0x7B, 0x0A, 0x70, 0x6E, 0x5C, 0x42, 0x50, 0x8A, 0xE5, 0xDD, 0x2E, 0x21, 0x04, 0x92,
+    0x73, 0x5E, 0xFA, 0x2B, 0xA6, 0x5C, 0x10, 0xA0, 0x16, 0x37, 0xFA, 0xD1, 0xC9, 0xEB, 0x74, 0x54,
+    0x27, 0xB1, 0x52, 0x76, 0x17, 0xC1, 0x47, 0xA9, 0x5C, 0x38, 0x05, 0xAA, 0x94, 0x99, 0xE1, 0x86,
+    0x09, 0xA8, 0x9B, 0x7E, 0x1C, 0xE9, 0x47, 0x1E, 0x21, 0xCB, 0xF4, 0x4C, 0x26, 0x79, 0x5C, 0x67,
+    0xBE, 0x9A, 0xE1, 0x91, 0x8A, 0xDD, 0x64, 0xB3, 0xAC, 0xD6, 0x72, 0x2B, 0xC1, 0xC2, 0xD4, 0x7A,
+    0x9E, 0x59, 0xC9, 0xB7, 0x84, 0x2D, 0xF3, 0x19, 0x48, 0x4E, 0x2D, 0x17, 0x41, 0x52, 0xA3, 0x1C,
+    0xB4, 0xD0, 0x3D, 0x9A, 0x89, 0x41, 0xE1, 0x27, 0x49, 0x1C, 0x8B, 0xCC, 0x9E, 0x92, 0x76, 0x6C,
+    0x43, 0xDD, 0x6E, 0x25, 0xB4, 0xCD, 0x4B, 0xC4, 0x10, 0x8B, 0xFD, 0xB1, 0x4D, 0xF6, 0x17, 0xC1,
+    0x82, 0x0A, 0xC9, 0xE2, 0x39, 0xB0, 0x5A, 0xF6, 0xFB, 0x5B, 0x31, 0x50, 0x3B, 0xB8, 0xE3, 0xAA,
+    0x69, 0xE6, 0x9E, 0xA5, 0x37, 0x53, 0x06, 0x39, 0xC8, 0x3C, 0xAA, 0x08, 0xF7, 0x48, 0xBF, 0x91,
+    0x31, 0xD0, 0xA8, 0x88, 0x5E, 0x1D, 0x92, 0xA0, 0xEA, 0xE3, 0xD3, 0x24, 0xD0, 0xF7, 0x6B, 0x68,
+    0x01, 0xEF, 0x80, 0x18, 0xD0, 0xE2, 0x4C, 0xE6, 0xDF, 0x27, 0xD9, 0x24, 0x67, 0x7E, 0x89, 0xE7,
+    0x38, 0xC1, 0x10, 0xE8, 0x01, 0xE1, 0x4E, 0xAA, 0x31, 0x4B, 0xE0, 0xE8, 0xB7, 0xD1, 0x01, 0x75,
+    0x37, 0xA5, 0x9E, 0x4C, 0xE7, 0xB9, 0x15, 0x16, 0x32, 0x4E, 0x45, 0x75, 0x0E, 0xF3, 0x2C, 0x2F,
+    0x88, 0x89, 0x0A, 0x95, 0x35, 0xF0, 0x52, 0x55, 0xCE, 0x44, 0xAB, 0xB3, 0x46, 0xC6, 0x7D, 0xBD,
+    0x1D, 0x29, 0xE8, 0xEE, 0x5D, 0x14, 0x68, 0xAA, 0xF0, 0x98, 0xF1, 0xA3, 0x7B, 0x36, 0x2E, 0x48,
+    0xF9, 0xA3, 0xC3, 0xFD, 0xD7, 0x00, 0x02, 0x4B, 0x29, 0x7C, 0x41, 0xD1, 0x40, 0x10, 0x04, 0xB7,
+    0xD0, 0xB3, 0xDA, 0x60, 0xC9, 0x59, 0xC1, 0xF7, 0x53, 0xEB, 0x29, 0x07, 0x53, 0xC1, 0x75, 0xF7,
+    0xD5, 0xFE, 0xD1, 0xFE, 0xA2, 0x82, 0x70, 0xA7, 0x62, 0xA6, 0x65, 0x6B, 0x0A, 0x17, 0xF4, 0x5E,
+    0x07, 0x7B, 0xC0, 0x5F, 0xAB, 0x88, 0xDD, 0x6B, 0x45, 0xAD, 0xDB, 0x3E, 0xED, 0xAE, 0xB8, 0xCC,
+    0x26, 0xFC, 0xA2, 0x7B, 0x54, 0xA9, 0x28, 0x2B, 0x7A, 0x67, 0x8E, 0x8A, 0xD6, 0x51, 0x0D, 0x3B,
+    0x32, 0x35, 0x43, 0xA6, 0xAF, 0xA6, 0x51, 0x88, 0x12, 0xAF, 0x33, 0x0E, 0x00, 0x57, 0x95, 0xF5,
+    0x54, 0x85, 0xB7, 0xC8, 0x63, 0x01, 0xC7, 0x67, 0x09, 0xDE, 0x1E, 0xA2, 0x17, 0xC0, 0xBE, 0x52,
+    0x8C, 0xC1, 0xF3, 0xC2, 0x8B, 0x94, 0x67, 0x79, 0x83, 0x2A, 0xC4, 0x62, 0x47, 0x80, 0x80, 0xF2,
+    0x59, 0xE5, 0x9B, 0x70, 0x77, 0x40, 0x37, 0x04, 0x1A, 0xF5, 0x67, 0x98, 0x2E, 0x86, 0x03, 0x0F,
+    0x9D, 0xE3, 0xA3, 0xE1, 0x70, 0x08, 0x4E, 0x71, 0xE8, 0xAC, 0xEE, 0xCA, 0xD9, 0x61, 0x2B, 0xB4,
+    0xEA, 0xDB, 0x23, 0x1D, 0x8C, 0x18, 0x5F, 0x99, 0x45, 0x97, 0xF6, 0xA2, 0x06, 0x2C, 0xFF, 0x3F,
+    0x44, 0x23, 0xD2, 0x72, 0x67, 0x69, 0xA1, 0xB4, 0x6E, 0x15, 0xD9, 0xB1, 0x46, 0xB0, 0x15, 0x04,
+    0x01, 0xBE, 0xF7, 0x4C, 0x48, 0xF1, 0x2D, 0x67, 0x89, 0xA9, 0x2C, 0x73, 0x77, 0x32, 0xE0, 0x15,
+    0x1F, 0xE7, 0x25, 0xFF, 0x12, 0x0C, 0x53, 0x05, 0x07, 0xA5, 0x48, 0xB2, 0x24, 0x4A, 0x78, 0x79,
+    0xFD, 0x91, 0xF1, 0x59, 0x95, 0x03, 0x70, 0x80, 0x15, 0xA2, 0x93, 0x10, 0xA1, 0x17, 0xB8, 0xEE,
+    0xD6, 0xE8, 0x85, 0x5E, 0x87, 0x49, 0x03, 0x04, 0x8D, 0x1D, 0x7F, 0x82, 0x72, 0xDC, 0xA6, 0x20,
+    0x77, 0x52, 0x12, 0xAD, 0x28, 0xAF, 0x72, 0x89, 0x37, 0x25, 0x60, 0xD9, 0xD8, 0x07, 0x62, 0x1F,
+    0x41, 0x1B, 0xBB, 0xFE, 0x4D, 0x94, 0xE4, 0x9D, 0xFE, 0x8E, 0x0A, 0xF8, 0x41, 0xFF, 0xBC, 0x8E,
+    0xF0, 0xDE, 0x68, 0x06, 0xA9, 0x24, 0x27, 0xDB, 0x62, 0xC5, 0xF5, 0xC7, 0x31, 0xE8, 0x19, 0x90,
+    0x21, 0x9E, 0x99, 0xB2, 0x36, 0x47, 0xBD, 0x23, 0xAE, 0x03, 0xEB, 0x64, 0xE8, 0xF5, 0x2C, 0xF4,
+    0x6A, 0x40, 0xDA, 0xD4, 0x7A, 0x73, 0xD5, 0x62, 0xC9, 0x8D, 0x1A, 0xD5, 0xA3, 0x55, 0x5A, 0x7E,
+    0x4D, 0x31, 0xF7, 0xAB, 0x94, 0x1B, 0x5C, 0x5C, 0xF5, 0x79, 0x8D, 0xB7, 0x07, 0x2F, 0xF7, 0xB7,
+    0x9E, 0x2D, 0xF2, 0x18, 0x73, 0xA0, 0x8F, 0x32, 0x37, 0xA9, 0xFD, 0xE7, 0x00, 0xE7, 0xFC, 0xB3,
+    0x24, 0x6D, 0xC5, 0xFA, 0xD8, 0xA2, 0x2F, 0x7D, 0xE2, 0x47, 0xCA, 0xA7, 0x01, 0x6E, 0x7F, 0x99,
+    0x5F, 0x88, 0x72, 0x07, 0xD0, 0x07, 0x86, 0xEE, 0xF5, 0x29, 0x62, 0x7A, 0x87, 0x60, 0x72, 0xF2,
+    0xEB, 0xA4, 0x02, 0x15, 0x0B, 0x4F, 0x93, 0xAC, 0xA9, 0x7B, 0x7A, 0xCB, 0x3F, 0xFE, 0xD3, 0xAF,
+    0xD8, 0x01, 0xB0, 0xE5, 0x8C, 0xCF, 0x73, 0x44, 0x88, 0x18, 0x8D, 0xC1, 0xC2, 0x04, 0x9B, 0x4D,
+    0x19, 0x2F, 0xBF, 0x9B, 0x25, 0xF3, 0x9C, 0xA9, 0xC1, 0x9D, 0x1B, 0x89, 0x8E, 0x1F, 0xBF, 0xB2,
+    0xA7, 0x93, 0xB9, 0x1C, 0x00, 0x94, 0xC0, 0xB7, 0x64, 0x98, 0xFA, 0x02, 0xA7, 0x61, 0x28, 0xE1,
+    0xA5, 0x9D, 0xEB, 0x7F, 0x9F, 0xE2, 0x45, 0xB3, 0x12, 0xCD, 0x14, 0xB5, 0x0A, 0xEB, 0x21, 0xC0,
+    0x5E, 0x37, 0x3B, 0xA5, 0x2A, 0x24, 0x07, 0xBC, 0x02, 0x07, 0x84, 0x47, 0xCE, 0xEA, 0xF1, 0xFC,
+    0xDD, 0xC9, 0x97, 0xBF, 0x88, 0x97, 0x7F, 0x11, 0x9A, 0x5F, 0xAB, 0x35, 0xDA, 0x6C, 0x76, 0x0F,
+    0xF1, 0x8E, 0x87, 0x6F, 0x58, 0xD0, 0xD8, 0x72, 0x83, 0xFA, 0x2B, 0xD4, 0x09, 0xCD, 0x4F, 0x62,
+    0xD6, 0x94, 0x94, 0xA4, 0x49, 0x2C, 0x38, 0x1E, 0x9E, 0xAC, 0xB7, 0x59, 0x66, 0x2E, 0x41, 0x48,
+    0x0A, 0xF9, 0x01, 0xD1, 0xC3, 0xF9, 0x0B, 0xBA, 0x9A, 0xA9, 0xED, 0x2A, 0x35, 0x71, 0x27, 0x09,
+    0x1A, 0x3C, 0x32, 0x91, 0x09, 0x1D, 0x99, 0x6E, 0x06, 0xA8, 0x8D, 0x25, 0xCE, 0x1C, 0x95, 0x00,
+    0x10, 0xD3, 0x93, 0x20, 0x9A, 0xF0, 0x6C, 0x2C, 0x6E, 0xC8, 0x10, 0x99, 0xAD, 0x3D, 0x6B, 0x5E,
+    0xFF, 0xEC, 0x4E, 0xA4, 0xBA, 0xB9, 0xB9, 0x22, 0x9B, 0x55, 0xC2, 0x97, 0x32, 0x4C, 0x45, 0x36,
+    0xAE, 0xE8, 0xD2, 0xA1, 0xBE, 0x37, 0xD6, 0x55, 0xDA, 0xE6, 0x08, 0xE0, 0x5B, 0xD3, 0xD3, 0xD5,
+    0x4B, 0x69, 0x41, 0x5E, 0x7D, 0xA7, 0x4B, 0xA5, 0x01, 0x20, 0x32, 0xC5, 0x9E, 0xAD, 0xAB, 0x5E,
+    0x88, 0x7C, 0x3B, 0xE4, 0x43, 0x37, 0xA7, 0xD4, 0x86, 0x86, 0xB6, 0xB7, 0xBE, 0xA7, 0x8A, 0xF8,
+    0x1E, 0xB5, 0xF3, 0x65, 0x32, 0x2D, 0x38, 0x29, 0x39, 0x99, 0xF4, 0xED, 0xCB, 0xF3, 0x1A, 0x49,
+    0x2B, 0xA0, 0xF0, 0xB6, 0xC0, 0x33, 0x0E, 0xA5, 0x98, 0x4F, 0xAF, 0x3F, 0xCE, 0x45, 0xAA, 0x33,
+    0x4B, 0x33, 0x6A, 0x0F, 0x46, 0xEC, 0x34, 0xCD, 0xA3, 0x5C, 0xD2, 0x95, 0x86, 0x9D, 0x37, 0x3B,
+    0x8F, 0xD6, 0xE0, 0x68, 0x2D, 0xAE, 0x7F, 0x2B, 0xC1, 0x9E, 0xE8, 0x42, 0x21, 0x28, 0x4A, 0x2C,
+    0x90, 0x10, 0x02, 0xB7, 0xF7, 0xA8, 0x41, 0x26, 0x67, 0x84, 0xB6, 0x91, 0x64, 0x33, 0x8E, 0xF6,
+    0x72, 0xFD, 0xDF, 0x69, 0x95, 0x4C, 0x73, 0x45, 0x8C, 0xE9, 0x83, 0xA8, 0x89, 0xE7, 0x4C, 0x5A,
+    0x09, 0x26, 0xF9, 0xE6, 0x68, 0x6B, 0xFB, 0xE5, 0x2E, 0x82, 0x2D, 0xD7, 0xF9, 0x9A, 0xAA, 0xD8,
+    0x69, 0x6A, 0x90, 0xDE, 0xDB, 0x24, 0xAB, 0x1E, 0xAD, 0x6D, 0x95, 0x25, 0xBF, 0xF4, 0xD7, 0xBE,
+    0x78, 0xAC, 0x99, 0x07, 0x27, 0x0F, 0xF3, 0x31, 0x67, 0x80, 0x96, 0x36, 0x5C, 0x87, 0x3F, 0x4F,
+    0x19, 0xBC, 0x85, 0x0F, 0xCB, 0xCB, 0xAE, 0x08, 0xB1, 0x4B, 0x84, 0x94, 0x6A, 0x83, 0xB0, 0x43,
+    0xCF, 0xD5, 0xD0, 0x73, 0x18, 0xFA, 0x04, 0xFE, 0xE0, 0x40, 0xEC, 0x1A, 0xB1, 0xCF, 0xD8, 0x43,
+    0x38, 0xF0, 0x87, 0xEF, 0x77, 0x9F, 0x6D, 0x3F, 0x79, 0xF2, 0x68, 0x6D, 0xC8, 0x7E, 0x09, 0xE7,
+    0x2A, 0xDB, 0xDC, 0xDC, 0x64, 0x0F, 0xF1, 0x32, 0x86, 0xFE, 0x58, 0x53, 0xA4, 0xE5, 0x1E, 0x67,
+    0x27, 0x34, 0x18, 0xDF, 0x0D, 0x7B, 0x2E, 0x15, 0x51, 0x27, 0x30, 0x9E, 0x80, 0xDC, 0x5E, 0x8D,
+    0xBE, 0xCA, 0xE8, 0xD1, 0x5A, 0xF3, 0x76, 0x2A, 0xAD, 0xB9, 0xC4, 0xA5, 0x0C, 0xDF, 0x3F, 0xD7,
+    0x3F, 0xAD, 0x5D, 0x27, 0x6A, 0xE9, 0x09, 0x2C, 0x9D, 0x86, 0x6A, 0x5D, 0x87, 0x16, 0xDA, 0x05,
+    0x0D, 0xB6, 0x3C, 0x3E, 0xF6, 0xB1, 0xE1, 0x97, 0xAA, 0xE7, 0x71, 0x72, 0x12, 0xC0, 0x06, 0x91,
+    0xF2, 0x09, 0xED, 0xAB, 0x54, 0x4B, 0x7E, 0xD2, 0xCC, 0x1A, 0xFB, 0x7A, 0x4C, 0xBD, 0x82, 0x40,
+    0xED, 0x0C, 0x2F, 0xB3, 0xEA, 0xFB, 0xCC, 0x0F, 0x1F, 0x3B, 0x17, 0x9A, 0x9F, 0x98, 0x0B, 0xCD,
+    0xB6, 0xE2, 0x20, 0x53, 0x21, 0xB0, 0x26, 0x39, 0x95, 0x94, 0x10, 0x05, 0x51, 0xEA, 0x44, 0xB5,
+    0xAF, 0x13, 0xD5, 0xD8, 0xEC, 0x9C, 0xC1, 0xBA, 0x75, 0x00, 0x03, 0x82, 0x06, 0x8B, 0x94, 0x96,
+    0xBE, 0xC1, 0x6A, 0x3A, 0x38, 0x49, 0x40, 0xD3, 0x93, 0x3C, 0x1E, 0x30, 0xCA, 0xC3, 0x0D, 0x18,
+    0x5E, 0xB9, 0x1F, 0x60, 0xCA, 0x31, 0x06, 0xE7, 0xD5, 0x7B, 0x35, 0xDE, 0x73, 0x54, 0xFD, 0x4B,
+    0xB4, 0x4C, 0x3D, 0xF2, 0x03, 0x53, 0xA4, 0x46, 0xCC, 0x90, 0x44, 0x5A, 0xA3, 0x26, 0xC5, 0x91,
+    0xF9, 0x30, 0xE8, 0xBD, 0xB4, 0x73, 0x77, 0x30, 0xDC, 0x44, 0x38, 0xFE, 0x07, 0x1D, 0x4A, 0x8F,
+    0xDA, 0xF7, 0xE8, 0x15, 0x08, 0x1D, 0xD1, 0x6F, 0x98, 0x40, 0xA3, 0x7A, 0x8E, 0x45, 0x57, 0xD6,
+    0xE2, 0xC8, 0xCE, 0x64, 0x96, 0x9D, 0x4B, 0x3A, 0x35, 0x06, 0x4E, 0x6C, 0x80, 0xE7, 0xA1, 0x54,
+    0x97, 0x05, 0xED, 0xFD, 0xA5, 0x43, 0x68, 0x41, 0xB3, 0x55, 0x18, 0x01, 0xCC, 0x99, 0x4C, 0xF2,
+    0x6B, 0x71, 0x7A, 0x98, 0x47, 0xE7, 0xA2, 0x1A, 0x35, 0xEC, 0x38, 0x3F, 0x3B, 0xC3, 0xCA, 0x7B,
+    0x6D, 0xC0, 0xF7, 0x1A, 0x25, 0xB9, 0x92, 0xEE, 0xE5, 0xA8, 0x29, 0xC0, 0x4C, 0xF8, 0x05, 0x4F,
+    0xAA, 0x96, 0x8C, 0xBC, 0xAF, 0x76, 0x8F, 0xF0, 0x8A, 0x87, 0xEE, 0xB5, 0x41, 0x85, 0x2D, 0xBD,
+    0xA8, 0x1B, 0x6A, 0x61, 0xA3, 0x7E, 0x62, 0x07, 0xFB, 0x87, 0x8A, 0x5A, 0xF2, 0xBD, 0x20, 0x52,
+    0x84, 0x26, 0xF0, 0xC9, 0xF1, 0xFD, 0xB4, 0x30, 0x83, 0xDD, 0x31, 0x27, 0xE4, 0xD7, 0x4B, 0x5C,
+    0x23, 0xE4, 0xBE, 0x36, 0x7C, 0x18, 0x74, 0xBF, 0xDE, 0xA0, 0xC6, 0xB5, 0x90, 0xA5, 0x0A, 0xCB,
+    0xF4, 0xF8, 0x0D, 0xE6, 0xF4, 0xD1, 0x8D, 0x8D, 0xBC, 0x0B, 0x8A, 0x01, 0x2B, 0x91, 0x8D, 0x8E,
+    0xA6, 0x75, 0xDD, 0x9A, 0xB4, 0x66, 0x6B, 0xA3, 0x97, 0x6A, 0x1B, 0x50, 0x46, 0x6C, 0x06, 0xC2,
+    0x23, 0xB3, 0x56, 0xD3, 0x5F, 0x4C, 0x60, 0x97, 0xCC, 0xC7, 0x23, 0xB7, 0x0B, 0x07, 0x88, 0xBA,
+    0xE3, 0x20, 0x9F, 0x28, 0xFF, 0xA8, 0xD8, 0xA7, 0xD8, 0x93, 0x26, 0x10, 0x1A, 0x1B, 0xFA, 0x7A,
+    0xEE, 0x65, 0xBB, 0x58, 0x38, 0x9A, 0x71, 0xC4, 0xF6, 0xEC, 0xEC, 0x0C, 0x4E, 0xE5, 0xC0, 0xC1,
+    0x49, 0xB8, 0xD4, 0x52, 0x14, 0xE9, 0xA5, 0xE3, 0xDF, 0x20, 0x36, 0xFF, 0xD0, 0xCA, 0x54, 0x42,
+    0x07, 0x98, 0xBF, 0x5F, 0x5E, 0x6F, 0x17, 0x09, 0x1F, 0x33, 0x3F, 0x9F, 0xA9, 0xB5, 0x50, 0xB3,
+    0x59, 0x1E, 0xAD, 0xEA, 0xB6, 0xBB, 0x2E, 0xF5, 0xCF, 0x07, 0xE6, 0xE9, 0x2C, 0xF7, 0xCA, 0xD1,
+    0x65, 0x81, 0x59, 0x4B, 0x0F, 0xBF, 0x8D, 0x93, 0xA8, 0x4A, 0xCB, 0x6A, 0x0E, 0x47, 0x72, 0x05,
+    0x36, 0x5A, 0x0A, 0x4E, 0xB7, 0x9E, 0xFE, 0x78, 0x85, 0xCE, 0x34, 0xE8, 0xA6, 0x9C, 0x2D, 0xCD,
+    0x16, 0x58, 0x00, 0xAC, 0xCE, 0x62, 0x42, 0xDB, 0x4C, 0xC1, 0xED, 0xF6, 0xB5, 0x72, 0x30, 0xA0,
+    0x37, 0x02, 0x40, 0x5F, 0xC4, 0x93, 0x19, 0xE8, 0xE8, 0x78, 0x06, 0xC1, 0x27, 0xC0, 0x7C, 0x92,
+    0xC5, 0x2C, 0xAD, 0xF0, 0x9A, 0x7D, 0xBF, 0xCD, 0xB8, 0xA9, 0xE2, 0xE5, 0x65, 0x2B, 0x64, 0x38,
+    0x3C, 0x86, 0x46, 0x13, 0x69, 0xC2, 0x26, 0x32, 0x77, 0xC2, 0x7C, 0xC3, 0x20, 0xDC, 0x2F, 0xA6,
+    0x4C, 0xD4, 0x65, 0x06, 0x09, 0x2D, 0xF0, 0x7A, 0x36, 0xC5, 0x94, 0xAF, 0xCA, 0xF4, 0x1A, 0xD2,
+    0x26, 0xBB, 0xDB, 0x02, 0xFB, 0x4A, 0x4E, 0xE4, 0x91, 0x7D, 0x9B, 0x0F, 0x5D, 0xFB, 0x62, 0xC8,
+    0x1E, 0xB0, 0x35, 0xF6, 0xE0, 0x81, 0x1D, 0x3F, 0x60, 0x5F, 0x60, 0x60, 0xD2, 0x1A, 0xDD, 0x95,
+    0x7F, 0xC3, 0x21, 0x54, 0x62, 0x91, 0x26, 0xDC, 0xE0, 0x06, 0xBA, 0x51, 0x91, 0xB6, 0xE2, 0x4A,
+    0xB8, 0x56, 0xBC, 0x36, 0x1C, 0xF6, 0xDA, 0x6C, 0x25, 0xC2, 0x5B, 0xA2, 0x41, 0xD7, 0xDC, 0x4C,
+    0x6F, 0xD5, 0xD6, 0x8A, 0x83, 0x8C, 0xE8, 0x93, 0x71, 0x06, 0x5E, 0x3D, 0x06, 0xE1, 0xB3, 0xD5,
+    0x07, 0x80, 0x8A, 0xE7, 0xF8, 0xB5, 0x8A, 0x0C, 0x06, 0x27, 0xF0, 0xE9, 0xC1, 0xAA, 0x93, 0x88,
+    0xD7, 0xBB, 0x47, 0x87, 0x29, 0xDC, 0x44, 0x7D, 0xA3, 0xAC, 0x44, 0x26, 0xE2, 0x26, 0x13, 0x68,
+    0x2B, 0x4D, 0x36, 0x36, 0xCD, 0xBE, 0x77, 0xF5, 0x8A, 0xCC, 0xC2, 0xD5, 0x77, 0x74, 0xA5, 0xA7,
+    0xCE, 0xE1, 0x90, 0xD0, 0xD2, 0x72, 0xF2, 0xD8, 0xF6, 0x8B, 0x5A, 0xB6, 0x8F, 0x66, 0xA9, 0x6B,
+    0x1C, 0x04, 0x54, 0x91, 0xD4, 0xF1, 0xE7, 0xC3, 0xE1, 0x80, 0x7D, 0x3E, 0xFC, 0x43, 0xF8, 0xB5,
+    0xB6, 0x76, 0x02, 0xB0, 0x33, 0x4A, 0x67, 0xB1, 0x90, 0x8D, 0xDD, 0x06, 0x08, 0xB7, 0x3B, 0xEB,
+    0xEE, 0x7E, 0xB7, 0xC3, 0xB1, 0x88, 0xA7, 0x1B, 0x64, 0x12, 0x1F, 0xEE, 0xCA, 0x03, 0x34, 0xC9,
+    0x6D, 0x82, 0x99, 0xA5, 0xF8, 0x56, 0x24, 0x10, 0xCA, 0xE4, 0x78, 0x92, 0x52, 0x02, 0x71, 0xF1,
+    0x11, 0xD6, 0x8B, 0xBA, 0x49, 0xC1, 0x3B, 0xDF, 0x79, 0x6B, 0x73, 0x23, 0xE8, 0x7C, 0x53, 0x43,
+    0x87, 0xCD, 0x1A, 0x5A, 0x17, 0x80, 0xCC, 0xEC, 0x71, 0xAA, 0xD1, 0xF5, 0x85, 0xAC, 0x01, 0x36,
+    0x87, 0x08, 0x92, 0x2D, 0xA9, 0x4C, 0xE9, 0x12, 0x3B, 0x2B, 0x01, 0xB6, 0x4B, 0x06, 0x11, 0xEA,
+    0xF5, 0xC7, 0x32, 0x01, 0xE0, 0x2D, 0xA6, 0x48, 0xAB, 0x2A, 0xAF, 0xFF, 0x39, 0x93, 0x49, 0x95,
+    0xAF, 0x33, 0x53, 0xB3, 0x35, 0x3B, 0x50, 0xB7, 0x9E, 0x68, 0x1C, 0x40, 0xF1, 0x22, 0x4F, 0x28,
+    0x0A, 0xC5, 0x52, 0xEE, 0xF5, 0xC7, 0x95, 0x14, 0x0B, 0xB7, 0x8C, 0x6E, 0x0F, 0x76, 0x60, 0x93,
+    0x5D, 0xD4, 0xED, 0x38, 0x41, 0xAB, 0x82, 0x8B, 0xD4, 0x6A, 0x50, 0x86, 0x7C, 0x8E, 0xAA, 0xDE,
+    0x7B, 0xC2, 0x32, 0x52, 0xDF, 0xA8, 0x74, 0xAA, 0xE7, 0x65, 0x5E, 0x81, 0x70, 0x52, 0xA5, 0x69,
+    0x93, 0xAA, 0x2A, 0xE4, 0x88, 0x0A, 0x0C, 0x17, 0x52, 0x8E, 0x56, 0x57, 0xA9, 0xB8, 0x70, 0x41,
+    0x9F, 0xDA, 0xF7, 0xE1, 0xE8, 0x8E, 0x0A, 0xAE, 0xA0, 0x5E, 0xB7, 0x26, 0xBF, 0x5C, 0x93, 0x9F,
+    0x80, 0x07, 0xA4, 0x92, 0x5C, 0x83, 0xCB, 0x5E, 0xEB, 0x10, 0x53, 0xCC, 0x02, 0xCB, 0x1A, 0x30,
+    0xC5, 0x77, 0xBA, 0x18, 0x44, 0xCF, 0x52, 0x15, 0x48, 0xE1, 0x13, 0x87, 0x29, 0x62, 0xF5, 0xB1,
+    0x98, 0x4D, 0x0B, 0x74, 0xA8, 0x3A, 0xD7, 0x0B, 0x87, 0x32, 0xA0, 0x25, 0x39, 0xA1, 0xD7, 0x3A,
+    0x6B, 0xD0, 0x5A, 0xEC, 0x99, 0xBA, 0xBC, 0xE7, 0x6B, 0x1D, 0xC1, 0x63, 0xBC, 0xE2, 0x69, 0x4F,
+    0x2A, 0x09, 0x4D, 0xC7, 0x50, 0xEB, 0x96, 0x96, 0x55, 0x2C, 0x67, 0xE7, 0xAA, 0xF3, 0xD2, 0xE6,
+    0xE7, 0x42, 0xAA, 0x7B, 0x12, 0x7E, 0xD0, 0xAE, 0x17, 0xA2, 0x4C, 0x7C, 0x5D, 0xF5, 0xE6, 0x20,
+    0xCC, 0x71, 0xE6, 0xD7, 0x5A, 0x6C, 0x54, 0x17, 0xA1, 0xAE, 0x16, 0xF5, 0xC8, 0x7C, 0x30, 0x90,
+    0x60, 0xA4, 0x38, 0xA0, 0x97, 0x3E, 0x52, 0x7F, 0x10, 0x77, 0x3A, 0xFA, 0xDE, 0xD9, 0x37, 0x72,
+    0x0A, 0x5D, 0x3E, 0x81, 0x52, 0x7F, 0xC1, 0x7E, 0x35, 0x3B, 0xFB, 0xB7, 0x5B, 0xF3, 0xBA, 0x67,
+    0xB7, 0x0A, 0xF8, 0xDC, 0xB7, 0x2C, 0x01, 0x57, 0x41, 0x02, 0x7B, 0x5A, 0x03, 0x3F, 0xDB, 0xB6,
+    0xA2, 0x25, 0xF8, 0x54, 0x8B, 0xFB, 0x81, 0x23, 0xEB, 0x60, 0xE1, 0xA1, 0x25, 0xB2, 0xD8, 0x2D,
+    0x0C, 0x4A, 0xF5, 0x95, 0x2C, 0xA2, 0x30, 0xE8, 0xA0, 0xCB, 0xEE, 0x70, 0x85, 0xE2, 0x59, 0x07,
+    0x6D, 0x49, 0xAA, 0x2D, 0x02, 0xF1, 0x16, 0xBA, 0xEA, 0x3F, 0xEB, 0xEC, 0xFE, 0x7E, 0xF8, 0x01,
+    0x25, 0x0C, 0x68, 0x25, 0xBE, 0xA4, 0xCB, 0x3F, 0xE4, 0x29, 0xAD, 0xFE, 0x87, 0xFB, 0x07, 0xBB,
+    0xAF, 0x03, 0x76, 0x0A, 0xEF, 0xCF, 0xBB, 0x84, 0x60, 0x20, 0xCC, 0x1A, 0x53, 0x60, 0xD1, 0x33,
+    0x8F, 0x56, 0x74, 0xE8, 0xD1, 0x3A, 0xF4, 0x16, 0x48, 0xA3, 0x55, 0x6B, 0x72, 0x45, 0x0F, 0x33,
+    0xB5, 0xAA, 0x29, 0x66, 0xEE, 0x1A, 0x68, 0x7B, 0x84, 0x4A, 0xD4, 0x6D, 0x39, 0xD3, 0x0A, 0xA6,
+    0x7E, 0x2A, 0xC6, 0x49, 0xC6, 0xFA, 0x90, 0xBB, 0x25, 0x4C, 0xFA, 0x6D, 0x29, 0xA3, 0x61, 0xF9,
+    0x5E, 0xED, 0x4F, 0xA3, 0x1A, 0xFD, 0x50, 0xC7, 0xD8, 0x33, 0xB7, 0x68, 0x5A, 0x64, 0x4C, 0xB1,
+    0x79, 0x43, 0x15, 0x6F, 0xBA, 0x9A, 0xA9, 0xBF, 0x17, 0x6B, 0xBB, 0xB9, 0x75, 0x14, 0x1C, 0x11,
+    0xF6, 0x30, 0x12, 0x85, 0xA5, 0x47, 0x84, 0x15, 0xE0, 0x4D, 0xE5, 0xD5, 0x48, 0x5E, 0x5E, 0x9F,
+    0x8E, 0xD5, 0x81, 0x83, 0x19, 0xD5, 0x88, 0x1A, 0x1A, 0x66, 0xAF, 0x7D, 0x94, 0xE9, 0x48, 0xCF,
+    0x3D, 0x52, 0x76, 0xFD, 0x97, 0xE9, 0xAB, 0x1A, 0x17, 0xCA, 0xDC, 0x78, 0x36, 0xD3, 0xBD, 0x0F,
+    0x3D, 0xB4, 0x10, 0x04, 0x0D, 0xE9, 0xD1, 0x22, 0xD4, 0x8F, 0xB6, 0x16, 0x3B, 0xA0, 0xA0, 0xCB,
+    0x1B, 0x20, 0xD4, 0xCB, 0x99, 0xFF, 0xCF, 0x35, 0x69, 0xBC, 0xD3, 0x5D, 0xD4, 0x8D, 0xAE, 0xB7,
+    0xB5, 0x9A, 0x9B, 0x7C, 0x83, 0xB9, 0x7E, 0x67, 0xA6, 0xEE, 0x87, 0xA6, 0xBD, 0xF8, 0xC3, 0x60,
+    0xC1, 0xF6, 0xD8, 0x01, 0xAD, 0x28, 0x58, 0x64, 0xBB, 0x57, 0x8D, 0xDB, 0xDD, 0xBD, 0x39, 0x02,
+    0x93, 0xED, 0xEC, 0x9C, 0xFE, 0x6E, 0xB2, 0xC9, 0x9E, 0x09, 0xCA, 0x7C, 0xDD, 0x28, 0x14, 0x79,
+    0x59, 0x1B, 0xA2, 0xC7, 0xC0, 0x8E, 0x95, 0xDE, 0xB9, 0x9C, 0x5C, 0x10, 0xAA, 0x2E, 0x0E, 0x1D,
+    0x34, 0xD2, 0x70, 0x63, 0x86, 0xBB, 0xE0, 0x94, 0x05, 0xC0, 0xBD, 0x37, 0x66, 0xB3, 0x39, 0x61,
+    0x7C, 0x19, 0xEA, 0x83, 0x79, 0x61, 0xC8, 0xD5, 0x34, 0x5B, 0x35, 0x66, 0xA1, 0xD1, 0x52, 0xB9,
+    0xC2, 0xF4, 0x06, 0xE7, 0xBD, 0xBC, 0x6C, 0xF8, 0xB6, 0xC9, 0x1E, 0x2D, 0xF4, 0xD4, 0x8E, 0x16,
+    0x29, 0xFA, 0x77, 0x8D, 0xED, 0x0C, 0xF1, 0x05, 0xA1, 0x5D, 0x3B, 0xBC, 0x73, 0xA2, 0x3A, 0x3D,
+    0x72, 0xB1, 0xFE, 0xB4, 0xCA, 0x20, 0x87, 0x62, 0xEA, 0x82, 0xD8, 0x7C, 0xA6, 0xB3, 0xC0, 0x94,
+    0x01, 0x96, 0x54, 0x4C, 0x4D, 0xE0, 0x43, 0x9D, 0x2F, 0x7E, 0x71, 0x74, 0x74, 0x80, 0xD0, 0x13,
+    0x26, 0x99, 0x72, 0x62, 0xA0, 0xC9, 0x4F, 0x6B, 0x09, 0xDF, 0x31, 0x51, 0x75, 0x73, 0x4D, 0x41,
+    0x6B, 0x72, 0x5E, 0x4E, 0x7B, 0x2B, 0x0A, 0x72, 0x76, 0x3A, 0x4D, 0xAA, 0xDE, 0x8A, 0x42, 0xDF,
+    0x65, 0xD1, 0x56, 0xA9, 0x61, 0x2F, 0x2B, 0x66, 0xD5, 0xCD, 0x85, 0x06, 0xB7, 0xA2, 0xE1, 0x26,
+    0x7E, 0xD4, 0xC4, 0xDB, 0x55, 0x76, 0xD3, 0x70, 0xDB, 0xA9, 0x39, 0xD6, 0x94, 0xF6, 0x6F, 0x1A,
+    0x5A, 0x5F, 0x06, 0xE9, 0x1B, 0xB9, 0xCD, 0xCB, 0xBB, 0x0C, 0xA6, 0xCB, 0x1F, 0xEB, 0xCD, 0x0C,
+    0x1E, 0x45, 0xA4, 0xB7, 0xDF, 0x62, 0x69, 0x57, 0xE7, 0x88, 0x55, 0x8D, 0xDA, 0x8A, 0x6B, 0x74,
+    0xB7, 0x5D, 0x0D, 0xAA, 0xEF, 0x16, 0x2D, 0x6D, 0x1E, 0xA4, 0x02, 0x6F, 0x1F, 0x51, 0xDD, 0xAE,
+    0x62, 0x9C, 0x6A, 0x75, 0x24, 0x8D, 0xCE, 0xF7, 0xB2, 0x5D, 0xF0, 0x78, 0xD5, 0x96, 0x9D, 0x2E,
+    0x84, 0x39, 0xEB, 0xB2, 0x95, 0x2F, 0x75, 0x55, 0x7A, 0x61, 0x9D, 0xF2, 0xA7, 0x2E, 0x7C, 0x2F,
+    0x23, 0x9A, 0xF5, 0x3D, 0xBB, 0xBB, 0x2E, 0xDA, 0xAA, 0x41, 0x68, 0xBE, 0x52, 0xDF, 0xBC, 0x81,
+    0x62, 0x5F, 0x77, 0xAE, 0x70, 0xA2, 0xEE, 0x37, 0xEE, 0xDC, 0x19, 0xC9, 0xF6, 0xDE, 0x10, 0x72,
+    0xC4, 0xDE, 0x77, 0x01, 0xCD, 0xBB, 0xE3, 0x3D, 0x2E, 0xE7, 0xE6, 0xD7, 0xD2, 0xA6, 0xB9, 0xCF,
+    0xA9, 0xAD, 0x19, 0x56, 0x62, 0x77, 0xEC, 0x7A, 0x0E, 0xE7, 0x16, 0xCE, 0x80, 0x4D, 0x55, 0x21,
+    0x3E, 0xB7, 0x0B, 0x6A, 0x14, 0x84, 0x74, 0x38, 0x4B, 0x5E, 0x44, 0xDF, 0xFB, 0xED, 0x39, 0xAC,
+    0x34, 0x9E, 0x36, 0xE7, 0x68, 0xF7, 0xE6, 0xAE, 0x7D, 0xD3, 0x74, 0xFD, 0x9F, 0xB4, 0x39, 0x53,
+    0xAA, 0xB3, 0xB4, 0x96, 0x5B, 0xDF, 0x71, 0x6F, 0x01, 0x8B, 0xFB, 0xF5, 0xAD, 0xA0, 0xFE, 0xFF,
+    0x7D, 0xA2, 0xFE, 0x76, 0x0E, 0x01, 0xB1, 0x07, 0x78, 0xD7, 0x90, 0xAD, 0xD6, 0xC8, 0xB7, 0x15,
+    0x08, 0x75, 0xE4, 0x65, 0xAE, 0x13, 0x1A, 0x3A, 0xCE, 0x2D, 0xC5, 0x9F, 0xB4, 0x41, 0xAB, 0x41,
+    0x23, 0xF7, 0xAB, 0x24, 0xED, 0xFB, 0xB3, 0xDD, 0x2D, 0x6B, 0x68, 0xA1, 0xEA, 0x16, 0x16, 0x30,
+    0xBB, 0x22, 0x58, 0xBC, 0x76, 0xF7, 0x2A, 0xE4, 0x5D, 0xB4, 0xB2, 0x75, 0x03, 0x72, 0xFD, 0xD3,
+    0x6C, 0xD3, 0xFE, 0x9F, 0x0F, 0xB7, 0xCA, 0xF2, 0x2A, 0x58, 0x7C, 0xAB, 0xE2, 0x53, 0xDC, 0x80,
+    0x73, 0xC3, 0x95, 0xCA, 0xBC, 0x74, 0x9E, 0xDF, 0xA8, 0x41, 0xBD, 0xF6, 0xDF, 0xBE, 0xD9, 0xB7,
+    0xC8, 0x09, 0x1C, 0x01, 0x88, 0xDA, 0x1A, 0xF3, 0x24, 0xF3, 0x1C, 0xC0, 0xD7, 0xF7, 0xFD, 0x81,
+    0xBD, 0xD7, 0x7B, 0x3B, 0x7B, 0x5B, 0x2F, 0xF7, 0xFE, 0x64, 0xEB, 0xFA, 0xAF, 0xAE, 0xFF, 0xBC,
+    0x7D, 0xE3, 0xEB, 0xF6, 0xFF, 0xB1, 0x0A, 0x68, 0xE2, 0x5D, 0x3D, 0xA9, 0xBE, 0xF8, 0xA1, 0xFF,
+    0x63, 0x19, 0x38, 0xD8, 0xB1, 0x74, 0xA4, 0xBF, 0x14, 0x82, 0xED, 0x74, 0xB3, 0x05, 0xF3, 0x4F,
+    0xFC, 0xB4, 0x4C, 0xF0, 0x66, 0x91, 0x2D, 0x0B, 0x43, 0x1B, 0xD9, 0x47, 0x2E, 0xEF, 0xDD, 0xFE,
+    0x0D, 0x08, 0xA5, 0x5A, 0x8D, 0x8B, 0x85, 0xB0, 0x80, 0xFF, 0x03, 0xCD, 0x6C, 0x04, 0xBA, 0x95,
+    0x4C, 0x00, 0x00,
+};
+
+const OTAAsset assetScriptJs = {"/script.js", "application/javascript", assetScriptJsData, sizeof(assetScriptJsData), "\"fab774720127\"", "fab774720127", true};
+
+// /favicon.ico: 948 bytes (sem compressão)
+const uint8_t assetFaviconIcoData[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x08, 0x06, 0x00, 0x00, 0x00, 0x8D, 0x89, 0x1D,
+    0x0D, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00,
+    0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61, 0x05, 0x00, 0x00,
+    0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0E, 0xC4, 0x00, 0x00, 0x0E, 0xC4, 0x01, 0x95,
+    0x2B, 0x0E, 0x1B, 0x00, 0x00, 0x03, 0x49, 0x49, 0x44, 0x41, 0x54, 0x38, 0x4F, 0x85, 0x92, 0x5D,
+    0x4C, 0x5B, 0x75, 0x18, 0x87, 0x9F, 0xFF, 0x69, 0x07, 0x25, 0xB2, 0x52, 0x60, 0x93, 0x6F, 0x1C,
+    0xC8, 0x68, 0xC9, 0x58, 0x23, 0x83, 0x61, 0xC6, 0x8A, 0x8E, 0xC4, 0x25, 0x66, 0x89, 0xC9, 0x2E,
+    0xD4, 0x19, 0x67, 0xE2, 0xB2, 0x6C, 0x2E, 0xD3, 0x25, 0xDC, 0x18, 0xB7, 0xA9, 0x89, 0x9A, 0x2D,
+    0x66, 0x17, 0x5C, 0xF8, 0x91, 0x90, 0xE8, 0x62, 0x50, 0xA7, 0x46, 0xDD, 0xD5, 0x5C, 0x9C, 0x41,
+    0x24, 0x65, 0xD9, 0x70, 0x01, 0x94, 0x8F, 0xAA, 0x4B, 0xC7, 0xD8, 0x80, 0x95, 0x0E, 0xBA, 0x41,
+    0x29, 0xB4, 0x70, 0x80, 0x71, 0xCE, 0xF1, 0x02, 0xCF, 0x69, 0x39, 0xD4, 0xEC, 0xB9, 0x7C, 0x7F,
+    0xBF, 0xF7, 0x49, 0xCE, 0xFF, 0x3D, 0x02, 0xE0, 0xF8, 0x1F, 0x6D, 0xC5, 0x92, 0x64, 0xFD, 0x10,
+    0xC1, 0x6E, 0x84, 0x78, 0x94, 0x04, 0xE4, 0xA9, 0x30, 0x81, 0xCE, 0x1E, 0xE6, 0x27, 0xC3, 0x3C,
+    0x92, 0xB3, 0x91, 0x22, 0x4F, 0x2D, 0xB6, 0x0C, 0x7B, 0xBC, 0xA0, 0x6A, 0x73, 0x48, 0xE2, 0x92,
+    0xA6, 0x68, 0x6F, 0x9F, 0xA9, 0x6E, 0x18, 0x12, 0x6F, 0x0D, 0x78, 0x0B, 0x2D, 0x1A, 0x5D, 0x68,
+    0xE4, 0x21, 0x84, 0x48, 0x94, 0x05, 0xAE, 0x76, 0xE3, 0x3B, 0x77, 0x9E, 0xF2, 0x86, 0x7A, 0xCA,
+    0x4A, 0x4B, 0x89, 0xDC, 0x19, 0xA3, 0xE7, 0x37, 0x2F, 0xEE, 0xD7, 0x5E, 0x21, 0x77, 0xDB, 0xD6,
+    0xC4, 0x2A, 0x68, 0xDA, 0x34, 0x51, 0xC5, 0x23, 0x4E, 0xF4, 0x77, 0xB4, 0x08, 0x38, 0x90, 0x98,
+    0xC5, 0xC6, 0x43, 0xC4, 0xC6, 0xEF, 0xD1, 0x7B, 0xF6, 0x1B, 0xF6, 0x37, 0x9D, 0xA2, 0xC1, 0x55,
+    0x89, 0x55, 0x48, 0x00, 0x04, 0x47, 0x46, 0x79, 0xFF, 0x8D, 0x46, 0x3C, 0xA7, 0x8F, 0x93, 0x96,
+    0x9D, 0x19, 0xD7, 0x81, 0x22, 0x16, 0xD5, 0x36, 0x8B, 0xE7, 0xC8, 0x81, 0xCF, 0x84, 0x20, 0x5D,
+    0x4F, 0x7C, 0x5F, 0xFD, 0xC8, 0xF5, 0xF3, 0x17, 0x89, 0xDC, 0x1C, 0xC6, 0xFD, 0xFC, 0x73, 0xBC,
+    0xF0, 0xF4, 0x33, 0x58, 0xA5, 0x15, 0x19, 0x80, 0xDD, 0xE1, 0x60, 0x49, 0x96, 0x19, 0xF4, 0xFB,
+    0xD9, 0xB8, 0xC5, 0xA9, 0x8F, 0x05, 0xA0, 0x0A, 0xD8, 0x24, 0x09, 0x41, 0x8E, 0x3E, 0x5D, 0x8A,
+    0xCD, 0x13, 0xE8, 0xEC, 0xE6, 0xD8, 0xE7, 0x9F, 0xD0, 0xFC, 0xED, 0xD7, 0x1C, 0xD9, 0xF7, 0xF2,
+    0x2A, 0x99, 0x8E, 0xEB, 0x09, 0x37, 0xC3, 0x6D, 0x97, 0x19, 0xFC, 0xA9, 0x15, 0x75, 0x59, 0x81,
+    0x15, 0xA3, 0x15, 0xAB, 0x48, 0x5D, 0xD5, 0x96, 0xA7, 0xC2, 0x3C, 0x90, 0x17, 0xC8, 0x48, 0x4D,
+    0x03, 0x20, 0x45, 0xB2, 0x24, 0xC6, 0x06, 0x95, 0x35, 0xD5, 0xBC, 0xF3, 0x51, 0x13, 0xE9, 0x13,
+    0xD3, 0x5C, 0x6B, 0x6A, 0x5E, 0xF9, 0xE0, 0xFF, 0x30, 0x84, 0x8B, 0xB3, 0x51, 0x3A, 0xCF, 0x7C,
+    0x8A, 0xFB, 0xA5, 0xBD, 0xB4, 0xB6, 0x9C, 0xE3, 0x86, 0xEF, 0x2F, 0xA3, 0x94, 0x8C, 0x72, 0x97,
+    0x8B, 0xC6, 0x53, 0xEF, 0x91, 0xA9, 0x08, 0x42, 0x03, 0xFF, 0x18, 0x73, 0x43, 0x78, 0xE7, 0x4A,
+    0x17, 0x45, 0x3B, 0x6A, 0xC8, 0xB7, 0xD8, 0x38, 0xFC, 0xFA, 0x51, 0x9C, 0x6E, 0xD3, 0x15, 0x93,
+    0x20, 0x84, 0xA0, 0xBA, 0x7E, 0x27, 0xE1, 0xA1, 0x11, 0x63, 0x66, 0x08, 0x97, 0xE7, 0x65, 0xEC,
+    0x59, 0x99, 0x6C, 0xA9, 0xA8, 0xC0, 0xBA, 0x6E, 0x9D, 0x51, 0x78, 0x18, 0x93, 0xA1, 0x10, 0xA9,
+    0xEB, 0x8D, 0x9B, 0xC6, 0x85, 0x39, 0x55, 0x95, 0xF8, 0xDB, 0x2E, 0x93, 0x57, 0x51, 0x6E, 0x84,
+    0x0F, 0xC3, 0xDF, 0xEF, 0xE3, 0x6A, 0xBB, 0x97, 0x82, 0xBA, 0x1A, 0x63, 0x26, 0x4E, 0xF6, 0x77,
+    0x18, 0x2F, 0x3A, 0x74, 0xA9, 0x9D, 0x5B, 0x17, 0x5A, 0x29, 0x73, 0x96, 0x23, 0x59, 0x92, 0x1F,
+    0x44, 0x27, 0x1A, 0x99, 0xE1, 0xEE, 0xFD, 0x7B, 0xD4, 0x36, 0x1E, 0x22, 0x6B, 0x73, 0xA9, 0x31,
+    0x5F, 0x25, 0x04, 0x58, 0x8A, 0xCD, 0x11, 0x0D, 0x8E, 0xA3, 0xA9, 0xAB, 0xC6, 0x6B, 0xB0, 0xA6,
+    0xD9, 0xC8, 0x28, 0x2E, 0x40, 0x98, 0x7E, 0xAB, 0x35, 0x42, 0x9D, 0x65, 0x79, 0x81, 0xE1, 0xF6,
+    0x2B, 0x04, 0xBB, 0x7A, 0x89, 0xDD, 0x0D, 0x81, 0x80, 0xF4, 0xBC, 0x1C, 0x0A, 0x6A, 0xAB, 0x28,
+    0xD9, 0xFD, 0x14, 0x56, 0x9B, 0xCD, 0xBC, 0x02, 0xFF, 0x27, 0x9C, 0xF4, 0x0F, 0xD1, 0xFD, 0xF1,
+    0x59, 0x72, 0xAB, 0xB6, 0xB2, 0x69, 0x57, 0x1D, 0xEB, 0x0B, 0x72, 0x01, 0x98, 0x0D, 0x4E, 0x30,
+    0xDA, 0xD1, 0xC9, 0x44, 0xDF, 0xDF, 0x3C, 0xD9, 0x78, 0x98, 0x6C, 0x57, 0x99, 0x79, 0x35, 0xB9,
+    0x70, 0xEC, 0xF7, 0x1E, 0xD2, 0xB2, 0xB3, 0x90, 0xC3, 0xD3, 0x0C, 0x5E, 0x68, 0x65, 0x26, 0x10,
+    0x44, 0x20, 0xB0, 0x17, 0xE5, 0xE3, 0xDC, 0xFB, 0x2C, 0xA9, 0x0E, 0x3B, 0x0B, 0xE1, 0x08, 0x85,
+    0x75, 0xDB, 0xCD, 0xAB, 0xC9, 0x85, 0x00, 0x91, 0x91, 0x00, 0x7F, 0x36, 0x7F, 0x89, 0xFB, 0xD5,
+    0x17, 0xB1, 0x17, 0xE6, 0x03, 0x1A, 0xB3, 0xC1, 0x71, 0x06, 0x5A, 0x7E, 0x60, 0xFB, 0xB1, 0x83,
+    0x64, 0x3C, 0x56, 0x68, 0x5E, 0x01, 0x40, 0x9C, 0xE8, 0xF3, 0x4E, 0x09, 0x21, 0xB2, 0xCC, 0x01,
+    0x80, 0xA6, 0xA8, 0x5C, 0x6B, 0x6A, 0x66, 0x6A, 0xF0, 0x36, 0x00, 0xD9, 0xCE, 0xC7, 0xD9, 0xF1,
+    0xE6, 0xD1, 0x35, 0x87, 0xD0, 0x91, 0x16, 0xD4, 0x39, 0x71, 0xB2, 0xCF, 0xFB, 0x3D, 0x42, 0xEC,
+    0x33, 0x87, 0x3A, 0xD3, 0xB7, 0x46, 0x71, 0x94, 0x14, 0x01, 0x30, 0x33, 0x3A, 0x86, 0xA3, 0xA4,
+    0xD8, 0x5C, 0x89, 0xB3, 0xA8, 0xFE, 0x22, 0xDE, 0xED, 0xED, 0xD8, 0xAC, 0x40, 0x37, 0x12, 0x0E,
+    0x73, 0xAE, 0xD3, 0xF7, 0xC5, 0x77, 0xA0, 0x69, 0x54, 0x1D, 0xDA, 0x6F, 0x8E, 0xE2, 0x28, 0x5A,
+    0x34, 0x25, 0x24, 0x7B, 0xA4, 0xD3, 0xDB, 0x76, 0xDD, 0x4C, 0x59, 0x5A, 0xDE, 0xC9, 0x03, 0xED,
+    0x67, 0x54, 0x6D, 0xDE, 0xDC, 0x03, 0xD8, 0xE0, 0x2A, 0x63, 0x43, 0x92, 0x8B, 0x6A, 0x9A, 0xA6,
+    0xA0, 0xA8, 0x31, 0x21, 0xAB, 0xBF, 0x5A, 0xEE, 0x2F, 0xD6, 0x7F, 0xB0, 0x67, 0x8F, 0xEF, 0x5F,
+    0x7B, 0x68, 0x3A, 0x44, 0x21, 0xF8, 0x4B, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44,
+    0xAE, 0x42, 0x60, 0x82,
+};
+
+const OTAAsset assetFaviconIco = {"/favicon.ico", "image/png", assetFaviconIcoData, sizeof(assetFaviconIcoData), "\"f894ba1dcdd2\"", "f894ba1dcdd2", false};
+
+// /: 1166 bytes (gzip de 4367 bytes)
+const uint8_t assetAppHtmlData[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xCD, 0x58, 0x3D, 0x6E, 0xE4, 0x36,
+    0x14, 0xEE, 0x7D, 0x0A, 0x86, 0xCD, 0xD8, 0x40, 0x34, 0xB3, 0xFE, 0x01, 0x6C, 0x23, 0x23, 0x05,
+    0xF1, 0xAE, 0x8D, 0xB8, 0xC9, 0x1A, 0xB0, 0x5D, 0xA4, 0xE4, 0x90, 0xD4, 0x0C, 0x63, 0x89, 0x54,
+    0x48, 0xCA, 0x86, 0x81, 0x2D, 0xB6, 0x08, 0x90, 0x32, 0x45, 0x9A, 0x74, 0x69, 0x52, 0xE6, 0x00,
+    0xC9, 0x75, 0x7C, 0x81, 0xE4, 0x08, 0x79, 0x24, 0x25, 0x8D, 0x46, 0x33, 0xB2, 0x66, 0xBD, 0x2E,
+    0xE2, 0xC2, 0x96, 0xA8, 0xF7, 0xFF, 0xF3, 0xBD, 0x47, 0xEF, 0x4C, 0xBF, 0x78, 0xF7, 0xFE, 0xED,
+    0xCD, 0xF7, 0x57, 0xE7, 0x68, 0x61, 0xF3, 0x2C, 0xD9, 0x99, 0xBA, 0x3F, 0x28, 0x23, 0x72, 0x1E,
+    0x63, 0x2E, 0xB1, 0x3B, 0xE0, 0x84, 0x25, 0x3B, 0x08, 0x7E, 0xA6, 0x39, 0xB7, 0x04, 0xD1, 0x05,
+    0xD1, 0x86, 0xDB, 0x18, 0xDF, 0xDE, 0x5C, 0x44, 0x27, 0xB8, 0xFD, 0x49, 0x92, 0x9C, 0xC7, 0xF8,
+    0x5E, 0xF0, 0x87, 0x42, 0x69, 0x8B, 0x11, 0x55, 0xD2, 0x72, 0x09, 0xA4, 0x0F, 0x82, 0xD9, 0x45,
+    0xCC, 0xF8, 0xBD, 0xA0, 0x3C, 0xF2, 0x2F, 0x5F, 0x22, 0x21, 0x85, 0x15, 0x24, 0x8B, 0x0C, 0x25,
+    0x19, 0x8F, 0xF7, 0xC7, 0x6F, 0x6A, 0x51, 0x56, 0xD8, 0x8C, 0x27, 0xE7, 0xD7, 0x57, 0x87, 0x07,
+    0xE8, 0xFD, 0xCD, 0x37, 0xE8, 0xB6, 0x60, 0xC4, 0xF2, 0xE9, 0x24, 0x9C, 0x07, 0x9A, 0x4C, 0xC8,
+    0x3B, 0xA4, 0x79, 0x16, 0x63, 0x01, 0x4A, 0x30, 0xB2, 0x8F, 0x05, 0x68, 0x16, 0x39, 0x99, 0xF3,
+    0x49, 0x21, 0xE7, 0x18, 0x2D, 0x34, 0x4F, 0x63, 0x3C, 0x49, 0xC9, 0xBD, 0x23, 0x18, 0xC3, 0xAF,
+    0xAF, 0xEF, 0xE3, 0xF4, 0xE4, 0xF4, 0x68, 0x46, 0xF6, 0x19, 0x65, 0xEC, 0x00, 0xAF, 0x49, 0x32,
+    0x0B, 0x30, 0x9A, 0x96, 0x16, 0xBD, 0x9E, 0x48, 0x52, 0x14, 0x19, 0x8F, 0xAC, 0x2A, 0xE9, 0x22,
+    0x7A, 0x45, 0x43, 0xED, 0x63, 0xC6, 0xCD, 0x82, 0x73, 0xDB, 0xB0, 0xFB, 0xA3, 0x31, 0x35, 0x06,
+    0x98, 0xD9, 0xC1, 0xE1, 0x11, 0x9D, 0x9D, 0xF2, 0x13, 0x7A, 0xEA, 0xD2, 0x33, 0x9D, 0x84, 0x0C,
+    0x4E, 0x67, 0x8A, 0x3D, 0x22, 0x9A, 0x11, 0x63, 0x62, 0xCC, 0x88, 0xBE, 0xAB, 0x05, 0x1B, 0xAA,
+    0x45, 0x61, 0x13, 0xA6, 0x68, 0x99, 0x43, 0xB6, 0xC6, 0x8E, 0x6E, 0xEC, 0xE9, 0xBE, 0x83, 0x7C,
+    0xA2, 0x18, 0x65, 0x0A, 0x52, 0x74, 0x6D, 0x95, 0x06, 0xA3, 0xC7, 0x73, 0x6E, 0x2F, 0x2D, 0xCF,
+    0x77, 0x47, 0xCA, 0x92, 0xC8, 0x2E, 0x78, 0xCE, 0x47, 0x7B, 0xE8, 0xC3, 0x07, 0x34, 0x72, 0x22,
+    0x47, 0x5F, 0x4D, 0x27, 0x95, 0xB8, 0x20, 0x9B, 0x89, 0xFB, 0x5A, 0xA5, 0x2B, 0x06, 0x22, 0x24,
+    0xD7, 0x95, 0x5E, 0xFF, 0x5D, 0x92, 0xE6, 0x3B, 0x3C, 0xCE, 0x48, 0xFB, 0xA3, 0x27, 0x20, 0xB5,
+    0x87, 0xB8, 0x45, 0x17, 0xCD, 0x34, 0x91, 0x0C, 0x23, 0xA8, 0x0B, 0x12, 0xB9, 0xB8, 0x24, 0xED,
+    0x3A, 0x21, 0x1D, 0x11, 0x2D, 0x1B, 0x1C, 0xAF, 0xA3, 0x37, 0x1D, 0x35, 0x5D, 0x55, 0x4B, 0xC1,
+    0xDF, 0xAA, 0x7C, 0x5D, 0xE4, 0x2A, 0x79, 0xE9, 0xF5, 0xB6, 0x99, 0x6E, 0x8B, 0x4C, 0x11, 0x36,
+    0xC0, 0x66, 0x1E, 0x0D, 0xC4, 0xB1, 0xCD, 0x76, 0xED, 0x4F, 0x36, 0xB3, 0xCD, 0x4A, 0x6B, 0x95,
+    0xAC, 0xFD, 0xF0, 0x71, 0x87, 0xBA, 0x9A, 0xCF, 0x33, 0x8E, 0x9C, 0x53, 0xE1, 0x11, 0x23, 0x25,
+    0x69, 0x26, 0xE8, 0x1D, 0x50, 0xF8, 0x83, 0x1B, 0x47, 0xB7, 0xBB, 0x87, 0x93, 0xA7, 0xDF, 0x3E,
+    0xFE, 0xF3, 0xD7, 0x2F, 0xD3, 0x49, 0x10, 0xD3, 0x09, 0xD0, 0x04, 0x22, 0xD4, 0xCA, 0xC9, 0x04,
+    0x04, 0x26, 0x3B, 0xCB, 0xF7, 0x1C, 0xB2, 0x56, 0x2B, 0x76, 0xCF, 0x51, 0xD5, 0xD6, 0xDD, 0x54,
+    0x19, 0x4E, 0xAD, 0x58, 0xDA, 0xE8, 0x60, 0x00, 0x23, 0xC1, 0xC2, 0x53, 0xB4, 0x80, 0x40, 0x56,
+    0xCE, 0xFA, 0x46, 0x8E, 0x71, 0xB7, 0xC3, 0x37, 0xE5, 0xA4, 0x95, 0x3B, 0x57, 0xC5, 0x5C, 0x6F,
+    0x20, 0xF2, 0x84, 0x8B, 0xFD, 0x0D, 0x88, 0x01, 0x87, 0x9B, 0xA9, 0xFB, 0xA3, 0xF9, 0xB2, 0x10,
+    0x6E, 0x08, 0xE3, 0x26, 0x17, 0x84, 0x4C, 0x55, 0x34, 0xD7, 0x82, 0x85, 0xB8, 0xB8, 0x90, 0x44,
+    0x94, 0x68, 0x06, 0xE5, 0xB8, 0x2D, 0xB7, 0x23, 0x0F, 0xDC, 0x45, 0x99, 0x65, 0x51, 0xA1, 0xD5,
+    0x5C, 0x73, 0x63, 0x00, 0x08, 0x04, 0x63, 0x5C, 0xF6, 0x45, 0xE7, 0x30, 0x79, 0xFA, 0xF3, 0x67,
+    0x30, 0x1F, 0xBD, 0x53, 0x0F, 0xD2, 0x15, 0xA7, 0x8B, 0x13, 0x04, 0xE8, 0xB0, 0x87, 0xA1, 0xA5,
+    0xB6, 0x51, 0xB1, 0x99, 0xB4, 0x8F, 0x3C, 0x72, 0xCD, 0xDC, 0x18, 0x7A, 0x55, 0x9D, 0x9E, 0xB9,
+    0x0E, 0xEF, 0xF1, 0xF5, 0x99, 0x20, 0x36, 0x4A, 0x1A, 0xC7, 0x8D, 0x25, 0xB6, 0x34, 0x0D, 0x28,
+    0x50, 0xA8, 0x47, 0xAE, 0x39, 0xEB, 0x0F, 0xE4, 0x70, 0x7C, 0x89, 0x2F, 0xDF, 0x90, 0x9F, 0x1E,
+    0x13, 0xD6, 0x7A, 0x7E, 0x95, 0x35, 0x24, 0x67, 0xD9, 0xD0, 0x5B, 0x05, 0xAC, 0xE2, 0xF5, 0xE3,
+    0x21, 0xF9, 0xF7, 0xF7, 0x5F, 0xFF, 0x78, 0x26, 0x06, 0x75, 0x32, 0x2F, 0x84, 0xCE, 0x1F, 0x88,
+    0xE6, 0xA8, 0x46, 0x9A, 0xBE, 0x44, 0x7A, 0x86, 0x22, 0xB9, 0xE6, 0x92, 0x21, 0xC9, 0x1F, 0xD0,
+    0x78, 0x06, 0xBD, 0x9C, 0x56, 0xDC, 0xD3, 0x49, 0xD1, 0x97, 0x05, 0x32, 0x14, 0x80, 0x1A, 0xBD,
+    0x5E, 0x3B, 0x00, 0x4F, 0x3F, 0xFD, 0xED, 0xBB, 0x6C, 0x30, 0x04, 0x01, 0x2C, 0xD1, 0x25, 0x34,
+    0xC5, 0xA0, 0xFB, 0x6F, 0x55, 0x0E, 0x73, 0xD8, 0x72, 0x14, 0x20, 0x82, 0xC1, 0xAE, 0x22, 0x32,
+    0xF3, 0x69, 0xEE, 0x6F, 0x30, 0x09, 0x66, 0x5D, 0x80, 0xBC, 0x16, 0x5A, 0x6E, 0x81, 0x84, 0x2B,
+    0xF3, 0xA2, 0xC2, 0xC2, 0x4E, 0x42, 0x3F, 0x17, 0x0A, 0xD7, 0xEB, 0x63, 0xFF, 0x45, 0x2D, 0x51,
+    0x7A, 0xF6, 0x28, 0x55, 0x3A, 0xEF, 0xD3, 0xE6, 0xBE, 0x79, 0xDF, 0x02, 0xED, 0x45, 0x3F, 0x69,
+    0x57, 0x78, 0x2A, 0x60, 0x37, 0x12, 0xB2, 0x28, 0x6D, 0x0B, 0x74, 0x9B, 0x2D, 0x04, 0xF6, 0x8C,
+    0xF3, 0x8C, 0xBB, 0xC7, 0xB3, 0xC7, 0x4B, 0xB6, 0x3B, 0xAA, 0x8B, 0xF6, 0x02, 0xB8, 0x46, 0x7B,
+    0x63, 0x4F, 0xEE, 0x60, 0xB9, 0x57, 0x55, 0x9D, 0x7B, 0x47, 0x88, 0xAC, 0x42, 0x86, 0x67, 0x90,
+    0x96, 0xE1, 0xE2, 0x5F, 0xF2, 0x36, 0x43, 0xAF, 0xB4, 0x0E, 0x59, 0x9C, 0x66, 0xD7, 0x3F, 0xC3,
+    0x9C, 0xDE, 0xA9, 0x6A, 0xD5, 0x73, 0x5E, 0xE2, 0x6A, 0x33, 0xAE, 0x33, 0xEF, 0xC2, 0xD5, 0xF6,
+    0x07, 0x23, 0x42, 0x29, 0x2F, 0x60, 0x51, 0x76, 0xF2, 0x31, 0x6C, 0x79, 0x3F, 0x96, 0x02, 0xD0,
+    0xEC, 0x59, 0x50, 0x1F, 0x80, 0xCB, 0x15, 0xC8, 0x74, 0x46, 0xB8, 0x65, 0x6E, 0x7B, 0xBC, 0xEC,
+    0x8E, 0xCA, 0xE0, 0x8C, 0x29, 0x67, 0xB9, 0xB0, 0x8D, 0x94, 0x99, 0x95, 0xC1, 0x99, 0x70, 0x7E,
+    0x06, 0xAF, 0xC9, 0xB5, 0x25, 0xDA, 0x36, 0x75, 0xD7, 0x37, 0x2C, 0x83, 0xF1, 0xAE, 0x76, 0x3E,
+    0x61, 0x00, 0x05, 0xF4, 0xDF, 0x6A, 0xE2, 0x6D, 0x31, 0x95, 0x5E, 0x71, 0x22, 0xBD, 0xC2, 0x30,
+    0x7A, 0x21, 0x96, 0xAC, 0x2C, 0x91, 0x15, 0x96, 0xB4, 0x90, 0x51, 0xE7, 0xC4, 0x31, 0x7F, 0x16,
+    0x9C, 0xAC, 0x11, 0x46, 0x19, 0x4F, 0xED, 0x73, 0x3D, 0x0E, 0x60, 0xB3, 0x6E, 0x43, 0xFF, 0x36,
+    0xD6, 0xD5, 0x62, 0x45, 0xEE, 0x70, 0x21, 0x55, 0x43, 0xCD, 0xDD, 0xE2, 0x09, 0x71, 0x88, 0x1C,
+    0x6B, 0x55, 0x91, 0xAD, 0x83, 0xA1, 0x1A, 0x5F, 0x47, 0xBD, 0x35, 0x39, 0xD5, 0xD1, 0x60, 0xB7,
+    0xBC, 0xAC, 0x8E, 0xFE, 0x1F, 0xEB, 0x68, 0xE5, 0x6A, 0xFF, 0x42, 0xDA, 0xAA, 0xD1, 0xE5, 0x91,
+    0xBB, 0x11, 0xB4, 0x6F, 0x0B, 0xA9, 0x52, 0x50, 0xFC, 0x0D, 0xC6, 0xFB, 0xB7, 0xEE, 0x4D, 0xA1,
+    0x58, 0xDB, 0xD5, 0x51, 0x04, 0x95, 0x5E, 0x10, 0x59, 0xED, 0xC5, 0xC6, 0x56, 0x05, 0x00, 0x2A,
+    0xE1, 0x34, 0x59, 0x81, 0x5C, 0x87, 0x1B, 0x4E, 0x6A, 0x75, 0xC5, 0x5C, 0xDA, 0x59, 0xDD, 0x64,
+    0x91, 0xD1, 0xD4, 0x6D, 0x28, 0xFE, 0x65, 0xFC, 0x83, 0xBB, 0x12, 0xA7, 0x64, 0x76, 0x7C, 0x7C,
+    0x74, 0x7C, 0xF0, 0x66, 0xFF, 0xE0, 0xD8, 0x0B, 0xAD, 0xEE, 0xA8, 0x10, 0x3E, 0xB8, 0xEC, 0xFA,
+    0x3B, 0xB2, 0xFF, 0xEF, 0xC7, 0x7F, 0x38, 0xB8, 0x71, 0x8B, 0x0F, 0x11, 0x00, 0x00,
+};
+
+const OTAAsset assetAppHtml = {"/", "text/html", assetAppHtmlData, sizeof(assetAppHtmlData), "\"71eccd3320b3\"", "71eccd3320b3", true};
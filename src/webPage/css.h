@@ -161,6 +161,19 @@ body {
     color: var(--accent-primary);
 }
 
+.log-card {
+    grid-column: 1 / -1;
+}
+
+.log-tail {
+    max-height: 20rem;
+    overflow: auto;
+    font-family: monospace;
+    font-size: 0.8rem;
+    white-space: pre-wrap;
+    color: var(--text-secondary);
+}
+
 .action-grid {
     display: grid;
     grid-template-columns: repeat(auto-fit, minmax(250px, 1fr));
@@ -267,6 +280,79 @@ body {
     box-shadow: var(--shadow);
 }
 
+.view {
+    display: none;
+}
+
+.view.active {
+    display: block;
+}
+
+.centered {
+    text-align: center;
+    margin: 1rem 0;
+}
+
+.muted {
+    font-size: 0.9rem;
+    color: var(--text-secondary);
+}
+
+.text-accent {
+    color: var(--accent-primary);
+}
+
+.text-success {
+    color: var(--success);
+}
+
+.text-error {
+    color: var(--error);
+}
+
+.pull-card {
+    display: flex;
+    flex-direction: column;
+    justify-content: center;
+}
+
+.badge-success {
+    background: var(--success);
+    color: white;
+    padding: 0.5rem;
+    border-radius: 0.375rem;
+    margin: 0.25rem 0;
+    text-align: center;
+    font-weight: bold;
+    font-size: 0.85rem;
+}
+
+.btn-row {
+    display: flex;
+    gap: 0.5rem;
+    margin: 0.75rem 0;
+}
+
+.btn-row .btn {
+    flex: 1;
+}
+
+.btn-small {
+    padding: 0.4rem 0.8rem;
+    font-size: 0.8rem;
+}
+
+.btn-success {
+    background: var(--success);
+}
+
+.up-to-date {
+    text-align: center;
+    color: var(--success);
+    font-size: 0.9rem;
+    margin: 0.5rem 0;
+}
+
 @media (max-width: 768px) {
     .navbar {
         padding: 1rem;
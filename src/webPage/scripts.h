@@ -1,13 +1,232 @@
 #pragma once
 
 const char *jsScript = R"rawliteral(
+// ============ TEMA (apenas no navegador) ============
+
+function applyTheme(theme) {
+    document.body.className = theme;
+    localStorage.setItem('ota-theme', theme);
+    document.querySelectorAll('.theme-toggle').forEach(b => b.textContent = theme === 'dark' ? '☀️' : '🌙');
+}
+
+function toggleTheme() {
+    applyTheme(document.body.className === 'dark' ? 'light' : 'dark');
+}
+
+// ============ API ============
+
+function api(path) {
+    return fetch(path, { cache: 'no-store' }).then(response => {
+        if (!response.ok) throw new Error(response.status + ' ' + response.statusText);
+        return response.json();
+    });
+}
+
+function esc(value) {
+    const div = document.createElement('div');
+    div.textContent = value === undefined || value === null ? '' : String(value);
+    return div.innerHTML;
+}
+
+function formatUptime(seconds) {
+    const pad = n => String(n).padStart(2, '0');
+    const d = Math.floor(seconds / 86400), h = Math.floor(seconds % 86400 / 3600);
+    const m = Math.floor(seconds % 3600 / 60), s = seconds % 60;
+    if (d > 0) return d + 'd ' + pad(h) + 'h ' + pad(m) + 'm ' + pad(s) + 's';
+    if (h > 0) return pad(h) + 'h ' + pad(m) + 'm ' + pad(s) + 's';
+    return pad(m) + 'm ' + pad(s) + 's';
+}
+
+function formatBytes(bytes) {
+    if (bytes >= 1048576) return (bytes / 1048576).toFixed(2) + ' MB';
+    if (bytes >= 1024) return (bytes / 1024).toFixed(1) + ' KB';
+    return bytes + ' B';
+}
+
+// rows: [label, value, live?] - live = campo da telemetria que atualiza o valor
+function card(title, rows, extra) {
+    let html = '<div class="info-card"><h3>' + esc(title) + '</h3>';
+    rows.forEach(([label, value, live]) => {
+        if (value !== undefined && value !== null && value !== '') {
+            const content = live ? '<span data-live="' + live + '">' + esc(value) + '</span>' : esc(value);
+            html += '<p><strong>' + esc(label) + ':</strong> ' + content + '</p>';
+        }
+    });
+    return html + (extra || '') + '</div>';
+}
+
+// ============ PÁGINAS ============
+
+function pullCard(ota) {
+    if (ota.pull.status === 'disabled') return '';
+
+    let html = '<div class="info-card pull-card"><h3>🔄 OTA Remoto</h3>';
+    if (ota.pull.status === 'available') {
+        html += '<div class="badge-success">📦 Atualização Disponível</div>';
+        html += '<div class="btn-row">';
+        html += '<button class="btn btn-small btn-success" onclick="performPullUpdate()">🔄 Instalar v' + esc(ota.pull.latestVersion) + '</button>';
+        html += '<button class="btn btn-small" onclick="checkForUpdates()">Verificar</button>';
+        html += '</div>';
+    } else {
+        html += '<p class="up-to-date">✅ Atualizado</p>';
+        html += '<div class="centered"><button class="btn btn-small" onclick="checkForUpdates()">🔍 Verificar</button></div>';
+    }
+    return html + '</div>';
+}
+
+function loadHome() {
+    return Promise.all([api('/api/status'), api('/api/ota')]).then(([status, ota]) => {
+        document.getElementById('home-cards').innerHTML =
+            card('WiFi', [['IP', status.ip], ['mDNS', status.mdns ? status.mdns + '.local' : ''], ['SSID', status.ssid]]) +
+            card('System', [['Version', status.version], ['Heap Free', status.heapFree + ' bytes', 'heapFree'], ['CPU', status.cpuFreq + ' MHz']]) +
+            pullCard(ota);
+    });
+}
+
+function loadSystem() {
+    // /api/log só existe com OTA_LOG_DEFERRED=1
+    const log = fetch('/api/log', { cache: 'no-store' }).then(r => r.ok ? r.text() : null).catch(() => null);
+    return Promise.all([api('/api/system'), log]).then(([info, logText]) => {
+        const n = info.network, m = info.memory, h = info.hardware, s = info.system;
+        document.getElementById('system-time').textContent = s.time;
+        document.getElementById('system-uptime').textContent = 'Uptime: ' + formatUptime(s.uptime);
+        document.getElementById('system-cards').innerHTML =
+            card('Network', [['Local IP', n.ip], ['mDNS', n.mdns ? n.mdns + '.local' : ''], ['SSID', n.ssid],
+                             ['RSSI', n.rssi + ' dBm', 'rssi'], ['MAC', n.mac]]) +
+            card('Memory', [['Heap Free', m.heapFree + ' bytes', 'heapFree'], ['Heap Min', m.heapMin + ' bytes', 'heapMin'],
+                            ['Heap Size', m.heapSize + ' bytes'],
+                            ['PSRAM Size', m.psramSize + ' bytes'], ['PSRAM Free', m.psramFree + ' bytes']]) +
+            card('Hardware', [['CPU Frequency', h.cpuFreq + ' MHz'], ['Flash Size', h.flashSize + ' MB'],
+                              ['SDK Version', h.sdkVersion], ['Chip Model', h.chipModel]]) +
+            card('System', [['Version', s.version], ['Uptime', formatUptime(s.uptime), 'uptime'], ['Firmware built', s.built],
+                            ['Reset Reason', s.resetReason], ['Cycle Count', s.cycleCount],
+                            ['Clock', clockText(info.clock)]]) +
+            tasksCard(info.tasks || [], info.cpu || {}) +
+            logCard(logText);
+        const tail = document.querySelector('.log-tail');
+        if (tail) tail.scrollTop = tail.scrollHeight;
+    });
+}
+
+function clockText(clock) {
+    if (!clock) return '';
+    if (!clock.synced) return 'Sincronizando...';
+    return 'SNTP há ' + formatUptime(clock.lastSync) + ' · ' + clock.driftPpm + ' ppm · a cada ' + formatUptime(clock.interval);
+}
+
+function logCard(text) {
+    if (text === null) return '';
+    return '<div class="info-card log-card"><h3>Log</h3><pre class="log-tail">' + esc(text) + '</pre></div>';
+}
+
+function tasksCard(tasks, cpu) {
+    const percent = v => v === null || v === undefined ? 'n/a' : v.toFixed(1) + '%';
+    const rows = Object.keys(cpu).filter(key => key !== 'runtimeStats').map(key => ['CPU ' + key, percent(cpu[key])]);
+    tasks.forEach(t => {
+        const stack = t.stackSize ? t.stackUsedMax + ' / ' + t.stackSize + ' bytes' : t.stackFreeMin + ' bytes livres';
+        rows.push([t.name, 'core ' + (t.core < 0 ? 'any' : t.core) + ' · prio ' + t.priority +
+                           ' · stack ' + stack + ' · CPU ' + percent(t.cpu)]);
+    });
+    return card('Tasks', rows);
+}
+
+const views = {
+    '/': { id: 'view-home', load: loadHome },
+    '/update': { id: 'view-update' },
+    '/system': { id: 'view-system', load: loadSystem }
+};
+
+function navigate(path, push) {
+    const view = views[path] || views['/'];
+    document.querySelectorAll('.view').forEach(v => v.classList.toggle('active', v.id === view.id));
+    document.title = document.getElementById(view.id).dataset.title;
+    if (push) history.pushState(null, '', path);
+    if (!view.load) return Promise.resolve();
+    return view.load().catch(error => console.error('Falha ao carregar dados: ' + error));
+}
+
+document.addEventListener('click', function(e) {
+    const link = e.target.closest('a[data-link]');
+    if (link) {
+        e.preventDefault();
+        navigate(link.getAttribute('href'), link.getAttribute('href') !== location.pathname);
+    }
+});
+
+window.addEventListener('popstate', () => navigate(location.pathname, false));
+
+// ============ EVENTOS AO VIVO (/api/events) ============
+
+let eventsLive = false; // Progresso vem do ESP32 (bytes gravados), não do envio do navegador
+
+const liveFormat = {
+    heapFree: v => v + ' bytes',
+    heapMin: v => v + ' bytes',
+    rssi: v => v + ' dBm',
+    uptime: v => formatUptime(v)
+};
+
+function onTelemetry(t) {
+    Object.keys(liveFormat).forEach(key => {
+        if (t[key] === undefined) return;
+        document.querySelectorAll('[data-live="' + key + '"]').forEach(el => el.textContent = liveFormat[key](t[key]));
+    });
+    document.getElementById('system-uptime').textContent = 'Uptime: ' + formatUptime(t.uptime);
+}
+
+function progressText(p) {
+    switch (p.phase) {
+        case 'start': return 'Starting...';
+        case 'transfer': {
+            let text = (p.percent !== undefined ? p.percent.toFixed(1) + '% · ' : '') + formatBytes(p.bytes);
+            if (p.bps) text += ' · ' + formatBytes(p.bps) + '/s';
+            if (p.eta !== undefined) text += ' · ETA ' + Math.ceil(p.eta) + 's';
+            return text;
+        }
+        case 'finalize': return 'Verifying firmware (' + formatBytes(p.bytes) + ')...';
+        case 'done': return 'Update completed! Restarting...';
+        default: return 'Error: ' + (p.message || 'update failed');
+    }
+}
+
+function showProgress(bar, status, p) {
+    if (p.percent !== undefined) bar.style.width = Math.min(p.percent, 100) + '%';
+    if (p.phase === 'finalize' || p.phase === 'done') bar.style.width = '100%';
+    bar.style.background = p.phase === 'done' ? 'var(--success)' : p.phase === 'error' ? 'var(--error)' : '';
+    const cls = p.phase === 'done' ? 'text-success' : p.phase === 'error' ? 'text-error' : 'text-accent';
+    status.innerHTML = '<div class="' + cls + '">' + esc(progressText(p)) + '</div>';
+}
+
+function onProgress(p) {
+    if (p.source === 'push') {
+        document.getElementById('progress').hidden = false;
+        showProgress(document.getElementById('progressBar'), document.getElementById('status'), p);
+    } else {
+        document.getElementById('pull-progress').hidden = false;
+        showProgress(document.getElementById('pullProgressBar'), document.getElementById('pull-status'), p);
+    }
+}
+
+function connectEvents() {
+    if (!window.EventSource) return;
+
+    // O navegador reconecta sozinho (retry enviado pelo ESP32)
+    const source = new EventSource('/api/events');
+    source.onopen = () => eventsLive = true;
+    source.onerror = () => eventsLive = false;
+    source.addEventListener('telemetry', e => onTelemetry(JSON.parse(e.data)));
+    source.addEventListener('progress', e => onProgress(JSON.parse(e.data)));
+}
+
+// ============ OTA REMOTO ============
+
 function checkForUpdates() {
     fetch('/check-updates')
         .then(response => response.json())
         .then(data => {
             alert(data.message);
-            // Recarrega a página para atualizar o status
-            setTimeout(() => location.reload(), 2000);
+            // Atualiza apenas o card; a verificação pode terminar em segundo plano
+            setTimeout(loadHome, data.status === 'pending' ? 3000 : 0);
         })
         .catch(error => {
             alert('Erro ao verificar atualizações: ' + error);
@@ -30,25 +249,230 @@ function performPullUpdate() {
             });
     }
 }
-    
-function toggleTheme() {
-    const currentPath = window.location.pathname;
-    const currentTheme = new URLSearchParams(window.location.search).get('theme') || 'dark'; // ✅ PADRÃO DARK
-    const newTheme = currentTheme === 'light' ? 'dark' : 'light';
-    window.location.href = currentPath + '?theme=' + newTheme;
-}
-
-document.addEventListener('DOMContentLoaded', function() {
-    const savedTheme = localStorage.getItem('ota-theme');
-    const currentTheme = new URLSearchParams(window.location.search).get('theme');
-    
-    if (currentTheme) {
-        localStorage.setItem('ota-theme', currentTheme);
-    } else if (savedTheme && !currentTheme) {
-        window.location.href = window.location.pathname + '?theme=' + savedTheme;
-    } else if (!savedTheme && !currentTheme) {
-        // ✅ NOVO: Se não há tema salvo nem parâmetro, redireciona para dark
-        window.location.href = window.location.pathname + '?theme=dark';
+
+// ============ UPLOAD ============
+
+function validateFirmwareFile(file) {
+    const fileName = file.name.toLowerCase();
+
+    if (!fileName.endsWith('.bin')) {
+        alert('❌ Por favor, selecione um arquivo .bin');
+        return false;
+    }
+
+    // Verifica se o nome do arquivo contém padrões de versão
+    const versionPattern = /[vV]?\d+\.\d+\.\d+/;
+    if (versionPattern.test(fileName)) {
+        const versionMatch = fileName.match(versionPattern)[0];
+        alert('🔍 Versão detectada no nome: ' + versionMatch);
+    }
+
+    return true;
+}
+
+document.getElementById('firmwareFile').addEventListener('change', function(e) {
+    const fileNameDiv = document.getElementById('fileName');
+    if (e.target.files.length > 0 && validateFirmwareFile(e.target.files[0])) {
+        fileNameDiv.innerHTML = '<strong>Selected file:</strong> ' + esc(e.target.files[0].name);
+    } else {
+        e.target.value = ''; // Limpa seleção
+        fileNameDiv.innerHTML = '';
     }
 });
-)rawliteral";
\ No newline at end of file
+
+// Upload retomável (/api/upload): blocos com CRC32; após uma queda de
+// conexão o envio continua do último bloco confirmado pelo ESP32
+
+const CRC_TABLE = (() => {
+    const table = new Uint32Array(256);
+    for (let n = 0; n < 256; n++) {
+        let c = n;
+        for (let k = 0; k < 8; k++) c = c & 1 ? 0xEDB88320 ^ (c >>> 1) : c >>> 1;
+        table[n] = c >>> 0;
+    }
+    return table;
+})();
+
+function crc32(bytes) {
+    let crc = 0xFFFFFFFF;
+    for (let i = 0; i < bytes.length; i++) crc = CRC_TABLE[(crc ^ bytes[i]) & 0xFF] ^ (crc >>> 8);
+    return ((crc ^ 0xFFFFFFFF) >>> 0).toString(16).padStart(8, '0');
+}
+
+const sleep = ms => new Promise(resolve => setTimeout(resolve, ms));
+
+function uploadRequest(method, query, body, headers) {
+    return fetch('/api/upload?' + query, { method: method, body: body, headers: headers, cache: 'no-store' })
+        .then(response => response.json().then(data => ({ status: response.status, data: data })));
+}
+
+async function uploadChunks(file, onProgress, session) {
+    // Sessão iniciada pelo WebSocket: continua do offset confirmado
+    const start = session ? await uploadRequest('GET', 'session=' + session)
+                          : await uploadRequest('POST', 'size=' + file.size);
+    if (start.status !== (session ? 200 : 201)) throw new Error(start.data.message);
+
+    session = start.data.session;
+    const chunkMax = start.data.chunkMax;
+    let offset = start.data.offset, failures = 0;
+
+    while (true) {
+        const chunk = new Uint8Array(await file.slice(offset, offset + chunkMax).arrayBuffer());
+        let reply;
+        try {
+            reply = await uploadRequest('PUT', 'session=' + session + '&offset=' + offset, chunk,
+                                        { 'Content-Type': 'application/octet-stream', 'X-CRC32': crc32(chunk) });
+        } catch (error) {
+            // Rede caiu: aguarda e consulta o offset confirmado
+            if (++failures > 10) throw error;
+            onProgress(offset, 'Connection lost, resuming (' + failures + ')...');
+            await sleep(Math.min(250 * 2 ** failures, 5000));
+            try {
+                const state = await uploadRequest('GET', 'session=' + session);
+                if (state.status !== 200) throw new Error(state.data.message);
+                offset = state.data.offset;
+            } catch (ignored) { /* nova tentativa */ }
+            continue;
+        }
+
+        if (reply.status === 200) {
+            failures = 0;
+            offset = reply.data.offset;
+            onProgress(offset);
+            if (reply.data.state === 'done') return reply.data.message;
+        } else if ([400, 409, 422].includes(reply.status) && reply.data.offset !== undefined && ++failures <= 10) {
+            offset = reply.data.offset; // Bloco rejeitado: reenvia do offset confirmado
+        } else {
+            throw new Error(reply.data.message);
+        }
+    }
+}
+
+// Upload por WebSocket (/api/ws/upload): até "window" frames binários em
+// trânsito; o ESP32 confirma cada frame depois de gravá-lo na flash
+
+function uploadWebSocket(file, onProgress, session) {
+    return new Promise((resolve, reject) => {
+        const scheme = location.protocol === 'https:' ? 'wss://' : 'ws://';
+        const ws = new WebSocket(scheme + location.host + '/api/ws/upload');
+        let frame = 0, windowSize = 0, sent = 0, acked = 0, pumping = false, finished = false;
+
+        const fail = (message, fatal) => {
+            if (finished) return;
+            finished = true;
+            ws.close();
+            reject(Object.assign(new Error(message), { session: session, offset: acked, fatal: fatal }));
+        };
+
+        const pump = async () => {
+            if (pumping) return;
+            pumping = true;
+            while (!finished && sent < file.size && sent - acked < frame * windowSize) {
+                const end = Math.min(sent + frame, file.size);
+                const data = await file.slice(sent, end).arrayBuffer();
+                if (finished || ws.readyState !== WebSocket.OPEN) break;
+                ws.send(data);
+                sent = end;
+            }
+            pumping = false;
+        };
+
+        ws.onopen = () => ws.send(session ? 'resume ' + session : 'begin ' + file.size);
+        ws.onclose = () => fail('WebSocket connection closed', false);
+        ws.onmessage = event => {
+            const message = JSON.parse(event.data);
+            if (message.type === 'ready') {
+                session = message.session;
+                frame = message.frame;
+                windowSize = message.window;
+                sent = acked = message.offset;
+                onProgress(acked);
+                pump();
+            } else if (message.type === 'ack') {
+                acked = message.offset;
+                onProgress(acked);
+                pump();
+            } else if (message.type === 'done') {
+                finished = true;
+                onProgress(file.size);
+                resolve(message.message);
+            } else {
+                fail(message.message, true);
+            }
+        };
+    });
+}
+
+async function uploadFirmware(file, onProgress) {
+    let session, resumes = 0;
+
+    if ('WebSocket' in window) {
+        while (true) {
+            try {
+                return await uploadWebSocket(file, onProgress, session);
+            } catch (error) {
+                if (error.fatal) throw error;
+                session = error.session;
+                if (!session || ++resumes > 3) break;
+                onProgress(error.offset, 'Connection lost, resuming (' + resumes + ')...');
+                await sleep(250 * 2 ** resumes);
+            }
+        }
+    }
+
+    // Sem WebSocket (ou após quedas seguidas): blocos HTTP na mesma sessão
+    return uploadChunks(file, onProgress, session);
+}
+
+document.getElementById('uploadForm').addEventListener('submit', function(e) {
+    e.preventDefault();
+
+    const fileInput = document.getElementById('firmwareFile');
+    const submitBtn = document.getElementById('submitBtn');
+    const progress = document.getElementById('progress');
+    const progressBar = document.getElementById('progressBar');
+    const status = document.getElementById('status');
+
+    if (!fileInput.files.length) {
+        status.innerHTML = '<div class="text-error">Please select a .bin file</div>';
+        return;
+    }
+
+    const file = fileInput.files[0];
+    if (!validateFirmwareFile(file)) {
+        status.innerHTML = '<div class="text-error">Invalid firmware file</div>';
+        return;
+    }
+
+    submitBtn.disabled = true;
+    submitBtn.textContent = 'Uploading...';
+    progress.hidden = false;
+    progressBar.style.background = '';
+    status.innerHTML = '<div class="text-accent">Starting upload...</div>';
+
+    // Sem /api/events, mostra o progresso confirmado a cada bloco
+    uploadFirmware(file, (sent, message) => {
+        if (message) {
+            status.innerHTML = '<div class="text-accent">' + esc(message) + '</div>';
+        } else if (!eventsLive) {
+            const percent = sent * 100 / file.size;
+            progressBar.style.width = percent + '%';
+            status.innerHTML = '<div class="text-accent">Uploading: ' + percent.toFixed(1) + '%</div>';
+        }
+    }).then(message => {
+        progressBar.style.width = '100%';
+        progressBar.style.background = 'var(--success)';
+        status.innerHTML = '<div class="text-success">' + esc(message) + '</div>';
+    }).catch(error => {
+        status.innerHTML = '<div class="text-error">Error: ' + esc(error.message) + '</div>';
+        submitBtn.disabled = false;
+        submitBtn.textContent = 'Try Again';
+    });
+});
+
+// ============ INICIALIZAÇÃO ============
+
+applyTheme(document.body.className);
+// Os dados da tela são carregados antes de abrir a conexão de eventos
+navigate(location.pathname, false).then(connectEvents);
+)rawliteral";
@@ -0,0 +1,124 @@
+"""
+Gera src/webPage/assets.h com os arquivos estáticos da interface web
+(CSS, JS e favicon) pré-comprimidos em gzip e com ETag pelo conteúdo.
+
+Fontes: src/webPage/css.h, src/webPage/scripts.h, src/webPage/favicon.h e
+src/webPage/app.h (página única; {{CSS_URL}}, {{JS_URL}} e {{FAVICON_URL}} são
+substituídos pelas URLs versionadas dos demais arquivos).
+O arquivo só é reescrito quando o conteúdo muda.
+
+Uso:
+    platformio.ini -> extra_scripts = pre:tools/build_assets.py
+    ou diretamente: python tools/build_assets.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+# (caminho, tipo, arquivo fonte, nome do objeto C++)
+ASSETS = [
+    ("/style.css", "text/css", "css.h", "assetStyleCss"),
+    ("/script.js", "application/javascript", "scripts.h", "assetScriptJs"),
+    ("/favicon.ico", "image/png", "favicon.h", "assetFaviconIco"),
+    ("/", "text/html", "app.h", "assetAppHtml"),  # deve vir depois dos arquivos que referencia
+]
+
+# Placeholders da página única -> caminho do arquivo referenciado
+URL_PLACEHOLDERS = {
+    "{{CSS_URL}}": "/style.css",
+    "{{JS_URL}}": "/script.js",
+    "{{FAVICON_URL}}": "/favicon.ico",
+}
+
+# gzip só é usado quando reduz o arquivo em pelo menos 10%
+MIN_GZIP_GAIN = 0.10
+
+
+def read_source(path):
+    """Extrai o conteúdo de um header: raw string literal ou array de bytes."""
+    with open(path, "r", encoding="utf-8") as f:
+        text = f.read()
+
+    raw = re.search(r'R"rawliteral\((.*?)\)rawliteral"', text, re.S)
+    if raw:
+        return raw.group(1).encode("utf-8")
+
+    array = re.search(r"\{(.*?)\}", text, re.S)
+    if array:
+        return bytes(int(b, 16) for b in re.findall(r"0x([0-9A-Fa-f]{2})", array.group(1)))
+
+    raise ValueError("Formato não reconhecido: %s" % path)
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def generate(web_dir):
+    out = [
+        "#pragma once",
+        "",
+        "// Gerado por tools/build_assets.py a partir de src/webPage/* - não editar",
+        "",
+        "#include \"../OTAAsset.h\"",
+        "",
+    ]
+
+    versions = {}
+
+    for path, content_type, source, name in ASSETS:
+        data = read_source(os.path.join(web_dir, source))
+        for placeholder, target in URL_PLACEHOLDERS.items():
+            if placeholder.encode() in data:
+                data = data.replace(placeholder.encode(), ("%s?v=%s" % (target, versions[target])).encode())
+
+        version = hashlib.sha256(data).hexdigest()[:12]
+        versions[path] = version
+
+        compressed = gzip.compress(data, 9, mtime=0)
+        use_gzip = len(compressed) <= len(data) * (1 - MIN_GZIP_GAIN)
+        body = compressed if use_gzip else data
+
+        out += [
+            "// %s: %d bytes (%s)" % (path, len(body),
+                                      "gzip de %d bytes" % len(data) if use_gzip else "sem compressão"),
+            "const uint8_t %sData[] = {" % name,
+            c_array(body),
+            "};",
+            "",
+            "const OTAAsset %s = {\"%s\", \"%s\", %sData, sizeof(%sData), \"\\\"%s\\\"\", \"%s\", %s};" % (
+                name, path, content_type, name, name, version, version, "true" if use_gzip else "false"),
+            "",
+        ]
+
+    return "\n".join(out)
+
+
+def build(project_dir):
+    web_dir = os.path.join(project_dir, "src", "webPage")
+    target = os.path.join(web_dir, "assets.h")
+    content = generate(web_dir)
+
+    current = None
+    if os.path.exists(target):
+        with open(target, "r", encoding="utf-8") as f:
+            current = f.read()
+
+    if content != current:
+        with open(target, "w", encoding="utf-8", newline="\n") as f:
+            f.write(content)
+        print("build_assets: %s atualizado" % os.path.relpath(target, project_dir))
+
+
+try:
+    Import("env")  # noqa: F821 - disponível apenas no PlatformIO (SCons)
+    build(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        build(os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0]))))
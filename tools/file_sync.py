@@ -0,0 +1,164 @@
+"""
+Sincronização dos arquivos do LittleFS arquivo a arquivo (OTAFileSync).
+
+O dispositivo informa o que tem num manifesto e recebe um patch só com os
+arquivos novos ou alterados e a lista dos que devem ser apagados. Usado pelo
+servidor do Pull (tools/update_server.py --files) e pelo envio direto
+(tools/ota_push.py sync); também funciona sozinho:
+
+    python tools/file_sync.py data/                          revisão e arquivos da pasta
+    python tools/file_sync.py data/ --manifest m.txt -o p.bin  patch para um manifesto
+    python tools/file_sync.py --info p.bin                   mostra e confere um patch
+
+A pasta é a mesma que "pio run -t buildfs" transforma em littlefs.bin: o
+caminho de cada arquivo no dispositivo é o caminho relativo a ela.
+
+Manifesto (texto): "<md5 hex> <tamanho> <caminho>" por linha.
+
+Patch (inteiros little-endian):
+    "OTAS"  formato (1)  tamanho da revisão (1)  entradas (2)  bytes de dados (4)
+    revisão
+    por entrada: operação ("F" grava, "D" apaga)  tamanho do caminho (1)  caminho
+                 "F": tamanho (4)  MD5 hex (32)  conteúdo
+"""
+
+import argparse
+import hashlib
+import os
+import struct
+import sys
+
+MAGIC = b"OTAS"
+FORMAT = 1
+PATH_MAX = 64      # OTA_FILESYNC_PATH_MAX
+REVISION_MAX = 40  # OTA_FILESYNC_REVISION_MAX
+RESERVED = ("/ota_version.txt", "/ota_files.txt", "/.ota_sync")
+
+
+def reserved(path):
+    return any(path == r or path.startswith(r + "/") for r in RESERVED)
+
+
+def scan(directory):
+    """Arquivos da pasta: {caminho: (md5, tamanho, caminho local)}."""
+    files = {}
+    for root, dirs, names in os.walk(directory):
+        dirs.sort()
+        for name in sorted(names):
+            local = os.path.join(root, name)
+            path = "/" + os.path.relpath(local, directory).replace(os.sep, "/")
+            if reserved(path):
+                continue
+            if len(path.encode()) > PATH_MAX:
+                raise ValueError(f"{path}: caminho com mais de {PATH_MAX} bytes")
+            with open(local, "rb") as f:
+                data = f.read()
+            files[path] = (hashlib.md5(data).hexdigest(), len(data), local)
+    return files
+
+
+def revision(files):
+    """Revisão da pasta: muda sempre que um arquivo muda, entra ou sai."""
+    digest = hashlib.sha256()
+    for path in sorted(files):
+        md5, size = files[path][:2]
+        digest.update(f"{md5} {size} {path}\n".encode())
+    return digest.hexdigest()[:16]
+
+
+def parse_manifest(text):
+    """Manifesto do dispositivo: {caminho: (md5, tamanho)}."""
+    files = {}
+    for line in text.splitlines():
+        parts = line.split(" ", 2)
+        if len(parts) == 3:
+            files[parts[2]] = (parts[0].lower(), int(parts[1]))
+    return files
+
+
+def build_patch(files, device, rev="", delete=True):
+    """Patch que leva o dispositivo (manifesto) ao conteúdo de files."""
+    entries = []
+    data_bytes = 0
+    for path, (md5, size, local) in sorted(files.items()):
+        if device.get(path) == (md5, size):
+            continue
+        with open(local, "rb") as f:
+            data = f.read()
+        name = path.encode()
+        entries.append(struct.pack("<cB", b"F", len(name)) + name + struct.pack("<I32s", len(data), md5.encode()) + data)
+        data_bytes += len(data)
+    if delete:
+        for path in sorted(set(device) - set(files)):
+            if reserved(path):
+                continue
+            name = path.encode()
+            entries.append(struct.pack("<cB", b"D", len(name)) + name)
+
+    rev = rev.encode()[:REVISION_MAX]
+    header = struct.pack("<4sBBHI", MAGIC, FORMAT, len(rev), len(entries), data_bytes) + rev
+    return header + b"".join(entries)
+
+
+def describe(patch, out=sys.stdout):
+    """Lista as entradas de um patch e confere o MD5 de cada arquivo."""
+    magic, fmt, rev_len, count, data_bytes = struct.unpack_from("<4sBBHI", patch)
+    if magic != MAGIC or fmt != FORMAT:
+        raise ValueError("não é um patch de arquivos")
+    offset = 12
+    rev = patch[offset:offset + rev_len].decode()
+    offset += rev_len
+    print(f"revisão {rev or '-'}, {count} entrada(s), {data_bytes} bytes de dados", file=out)
+    for _ in range(count):
+        op, length = struct.unpack_from("<cB", patch, offset)
+        path = patch[offset + 2:offset + 2 + length].decode()
+        offset += 2 + length
+        if op == b"D":
+            print(f"  apaga  {path}", file=out)
+            continue
+        size, md5 = struct.unpack_from("<I32s", patch, offset)
+        offset += 36
+        ok = hashlib.md5(patch[offset:offset + size]).hexdigest().encode() == md5
+        offset += size
+        print(f"  grava  {path}  {size} bytes  {'ok' if ok else 'INVÁLIDO'}", file=out)
+    if offset != len(patch):
+        raise ValueError(f"tamanho {len(patch)} não fecha com as entradas ({offset})")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Patch de arquivos do LittleFS (OTAFileSync)")
+    parser.add_argument("directory", nargs="?", help="pasta com os arquivos do LittleFS")
+    parser.add_argument("--manifest", help="manifesto do dispositivo (GET /api/files); sem ele, patch completo")
+    parser.add_argument("-o", "--output", help="grava o patch neste arquivo")
+    parser.add_argument("--keep", action="store_true", help="não apaga arquivos que só existem no dispositivo")
+    parser.add_argument("--info", metavar="PATCH", help="mostra e confere um patch existente")
+    args = parser.parse_args()
+
+    if args.info:
+        with open(args.info, "rb") as f:
+            describe(f.read())
+        return 0
+    if not args.directory:
+        parser.error("informe a pasta ou --info")
+
+    files = scan(args.directory)
+    rev = revision(files)
+    print(f"{args.directory}: {len(files)} arquivo(s), revisão {rev}", file=sys.stderr)
+    if not args.output:
+        for path, (md5, size, _) in sorted(files.items()):
+            print(f"{md5} {size} {path}")
+        return 0
+
+    device = {}
+    if args.manifest:
+        with open(args.manifest, encoding="utf-8") as f:
+            device = parse_manifest(f.read())
+    patch = build_patch(files, device, rev, delete=not args.keep)
+    with open(args.output, "wb") as f:
+        f.write(patch)
+    describe(patch, sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,104 @@
+"""
+Gera um pacote de atualização com a imagem do app e/ou a do LittleFS.
+
+O Pull baixa o pacote pelo mesmo /firmware de uma imagem comum e o
+OTABundle grava cada parte no alvo certo (app ou partição spiffs),
+conferindo tamanho e MD5. O app novo só vira o de boot depois que todas as
+partes foram conferidas: uma viagem e um reinício para as duas imagens.
+
+Formato (inteiros little-endian):
+    "OTAB"  formato (1)  partes (1-2)  reservado (2)
+    por parte: tipo (0 = app, 1 = LittleFS)  reservado (3)  tamanho (4)  MD5 hex (32)
+    partes, na ordem do cabeçalho (o app primeiro)
+
+Uso:
+    python tools/make_bundle.py -o bundle.bin --app firmware.bin --fs littlefs.bin
+    python tools/make_bundle.py -o bundle.bin --fs littlefs.bin
+    python tools/make_bundle.py --info bundle.bin
+
+A imagem do LittleFS vem de "pio run -t buildfs" (.pio/build/<env>/littlefs.bin)
+e precisa caber na partição spiffs de partitions.csv (448 KB).
+"""
+
+import argparse
+import hashlib
+import struct
+import sys
+
+MAGIC = b"OTAB"
+FORMAT = 1
+PART_APP = 0
+PART_FS = 1
+PART_NAMES = {PART_APP: "app", PART_FS: "LittleFS"}
+APP_PARTITION = 0x1C0000  # app0/app1 em partitions.csv
+FS_PARTITION = 0x70000    # spiffs em partitions.csv
+
+
+def build(parts):
+    header = struct.pack("<4sBBH", MAGIC, FORMAT, len(parts), 0)
+    for kind, data in parts:
+        md5 = hashlib.md5(data).hexdigest().encode()
+        header += struct.pack("<B3xI32s", kind, len(data), md5)
+    return header + b"".join(data for _, data in parts)
+
+
+def describe(bundle):
+    magic, fmt, count, _ = struct.unpack_from("<4sBBH", bundle)
+    if magic != MAGIC:
+        raise ValueError("não é um pacote (imagem de app comum?)")
+    if fmt != FORMAT:
+        raise ValueError(f"formato {fmt} desconhecido")
+
+    offset = 8 + 40 * count
+    for i in range(count):
+        kind, size, md5 = struct.unpack_from("<B3xI32s", bundle, 8 + 40 * i)
+        data = bundle[offset:offset + size]
+        ok = len(data) == size and hashlib.md5(data).hexdigest().encode() == md5
+        print(f"{PART_NAMES.get(kind, kind):>8}  {size:>8} bytes  md5 {md5.decode()}  {'ok' if ok else 'INVÁLIDA'}")
+        offset += size
+    if offset != len(bundle):
+        raise ValueError(f"tamanho {len(bundle)} não fecha com as partes ({offset})")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Gera um pacote app + LittleFS para o Pull")
+    parser.add_argument("-o", "--output", help="arquivo do pacote")
+    parser.add_argument("--app", help="imagem do app (.bin)")
+    parser.add_argument("--fs", help="imagem do LittleFS (littlefs.bin)")
+    parser.add_argument("--info", metavar="PACOTE", help="mostra e confere um pacote existente")
+    args = parser.parse_args()
+
+    if args.info:
+        with open(args.info, "rb") as f:
+            describe(f.read())
+        return 0
+
+    if not args.output or not (args.app or args.fs):
+        parser.error("informe -o e ao menos uma de --app/--fs")
+
+    parts = []
+    if args.app:
+        with open(args.app, "rb") as f:
+            app = f.read()
+        if not app or app[0] != 0xE9:
+            parser.error(f"{args.app} não é uma imagem de app do ESP32 (magic 0xE9)")
+        if len(app) > APP_PARTITION:
+            parser.error(f"{args.app} tem {len(app)} bytes, a partição de app tem {APP_PARTITION}")
+        parts.append((PART_APP, app))
+    if args.fs:
+        with open(args.fs, "rb") as f:
+            fs = f.read()
+        if len(fs) > FS_PARTITION:
+            parser.error(f"{args.fs} tem {len(fs)} bytes, a partição spiffs tem {FS_PARTITION}")
+        parts.append((PART_FS, fs))
+
+    bundle = build(parts)
+    with open(args.output, "wb") as f:
+        f.write(bundle)
+    print(f"{args.output}: {len(bundle)} bytes", file=sys.stderr)
+    describe(bundle)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,339 @@
+"""
+Envia um firmware para um ou vários ESP32 pelo endpoint PUT /api/firmware
+(corpo application/octet-stream, sem multipart).
+
+Cada dispositivo recebe o arquivo em streaming com Content-Length e o MD5 no
+cabeçalho X-MD5, verificado pelo ESP32 antes de ativar a nova imagem. Ao
+final é exibido um relatório com tempo, vazão e resultado de cada envio.
+
+Com --resumable o envio usa o upload retomável (/api/upload): blocos com
+CRC32, e após uma queda de conexão o envio continua do último bloco
+confirmado pelo dispositivo (até --retries tentativas seguidas).
+
+O subcomando sync não envia firmware: os arquivos do LittleFS são
+sincronizados com a pasta (GET /api/files devolve o manifesto do dispositivo
+e PUT /api/files envia só os arquivos novos ou alterados e os apagados; ver
+tools/file_sync.py). O dispositivo não reinicia.
+
+Uso:
+    python tools/ota_push.py firmware.bin 192.168.0.10
+    python tools/ota_push.py firmware.bin esp-a.local esp-b.local -u admin -p senha
+    python tools/ota_push.py firmware.bin --hosts-file dispositivos.txt --jobs 4
+    python tools/ota_push.py firmware.bin 192.168.0.10 --resumable
+    python tools/ota_push.py sync data/ 192.168.0.10 esp-b.local
+
+O código de saída é 0 somente se todos os dispositivos foram atualizados.
+"""
+
+import argparse
+import base64
+import concurrent.futures
+import hashlib
+import http.client
+import json
+import os
+import sys
+import threading
+import time
+import zlib
+
+import file_sync
+
+CHUNK_SIZE = 16 * 1024
+
+
+class Progress:
+    """Linha de progresso única compartilhada pelos envios simultâneos."""
+
+    def __init__(self, hosts, total, enabled):
+        self._sent = {host: 0 for host in hosts}
+        self._total = total
+        self._enabled = enabled
+        self._lock = threading.Lock()
+        self._last = 0.0
+
+    def update(self, host, sent, force=False):
+        with self._lock:
+            self._sent[host] = sent
+            now = time.monotonic()
+            if not self._enabled or (not force and now - self._last < 0.2):
+                return
+            self._last = now
+            parts = ["%s %3d%%" % (h, s * 100 // max(self._total, 1)) for h, s in self._sent.items()]
+            sys.stderr.write("\r" + " | ".join(parts))
+            sys.stderr.flush()
+
+    def finish(self):
+        if self._enabled:
+            sys.stderr.write("\n")
+
+
+def push(host, port, path, firmware, md5, auth, timeout, progress):
+    """Envia o firmware a um dispositivo e retorna o resultado do envio."""
+    result = {"host": host, "ok": False, "status": None, "message": "", "seconds": 0.0, "bytes": 0}
+    size = len(firmware)
+    start = time.monotonic()
+
+    try:
+        # "host:porta" tem precedência sobre --port
+        connection = http.client.HTTPConnection(host, None if ":" in host else port, timeout=timeout)
+        connection.putrequest("PUT", path)
+        connection.putheader("Content-Type", "application/octet-stream")
+        connection.putheader("Content-Length", str(size))
+        connection.putheader("X-MD5", md5)
+        if auth:
+            connection.putheader("Authorization", "Basic " + auth)
+        connection.endheaders()
+
+        view = memoryview(firmware)
+        for offset in range(0, size, CHUNK_SIZE):
+            chunk = view[offset:offset + CHUNK_SIZE]
+            connection.send(chunk)
+            result["bytes"] += len(chunk)
+            progress.update(host, result["bytes"])
+        progress.update(host, result["bytes"], force=True)
+
+        response = connection.getresponse()
+        body = response.read().decode("utf-8", "replace")
+        result["status"] = response.status
+        try:
+            result["message"] = json.loads(body).get("message", body)
+        except ValueError:
+            result["message"] = body.strip() or response.reason
+        result["ok"] = response.status == 200
+        connection.close()
+    except (OSError, http.client.HTTPException) as error:
+        result["message"] = str(error)
+
+    result["seconds"] = time.monotonic() - start
+    return result
+
+
+def request(host, port, method, path, auth, timeout, body=None, headers=None):
+    """Executa uma requisição e retorna (status, JSON da resposta)."""
+    connection = http.client.HTTPConnection(host, None if ":" in host else port, timeout=timeout)
+    try:
+        all_headers = dict(headers or {})
+        if auth:
+            all_headers["Authorization"] = "Basic " + auth
+        connection.request(method, path, body=body, headers=all_headers)
+        response = connection.getresponse()
+        data = response.read().decode("utf-8", "replace")
+        try:
+            return response.status, json.loads(data)
+        except ValueError:
+            return response.status, {"message": data.strip() or response.reason}
+    finally:
+        connection.close()
+
+
+def push_resumable(host, port, path, firmware, md5, auth, timeout, progress, chunk_size, retries):
+    """Envia o firmware em blocos pela sessão de upload retomável."""
+    result = {"host": host, "ok": False, "status": None, "message": "", "seconds": 0.0, "bytes": 0, "resumes": 0}
+    size = len(firmware)
+    start = time.monotonic()
+    failures = 0
+
+    def fail(message, status=None):
+        result["message"] = message
+        result["status"] = status
+        result["seconds"] = time.monotonic() - start
+        return result
+
+    try:
+        status, reply = request(host, port, "POST", "%s?size=%d&md5=%s" % (path, size, md5), auth, timeout)
+    except (OSError, http.client.HTTPException) as error:
+        return fail(str(error))
+    if status != 201:
+        return fail(reply.get("message", ""), status)
+
+    session = reply["session"]
+    # Blocos em múltiplos de um setor (4096), como o dispositivo exige
+    chunk_size = max(4096, min(chunk_size or reply["chunkMax"], reply["chunkMax"]) // 4096 * 4096)
+    offset = 0
+
+    while True:
+        chunk = firmware[offset:offset + chunk_size]
+        headers = {"Content-Type": "application/octet-stream", "X-CRC32": "%08x" % zlib.crc32(chunk)}
+        try:
+            status, reply = request(host, port, "PUT", "%s?session=%s&offset=%d" % (path, session, offset),
+                                    auth, timeout, chunk, headers)
+        except (OSError, http.client.HTTPException) as error:
+            # Conexão caiu: consulta o offset confirmado e continua dele
+            failures += 1
+            if failures > retries:
+                return fail("%s (após %d tentativas)" % (error, retries), None)
+            time.sleep(min(2 ** failures * 0.25, 5))
+            try:
+                status, reply = request(host, port, "GET", "%s?session=%s" % (path, session), auth, timeout)
+            except (OSError, http.client.HTTPException):
+                continue
+            if status != 200:
+                return fail(reply.get("message", ""), status)
+            offset = reply["offset"]
+            result["resumes"] += 1
+            continue
+
+        if status in (409, 422, 400) and "offset" in reply:
+            # Offset divergente, CRC ou bloco incompleto: reenvia do offset informado
+            failures += 1
+            if failures > retries:
+                return fail(reply.get("message", ""), status)
+            offset = reply["offset"]
+            continue
+        if status != 200:
+            return fail(reply.get("message", ""), status)
+
+        failures = 0
+        offset = reply["offset"]
+        result["bytes"] = offset
+        progress.update(host, offset, force=offset >= size)
+        if reply["state"] == "done":
+            result.update(ok=True, status=status, message=reply.get("message", ""))
+            result["seconds"] = time.monotonic() - start
+            return result
+
+
+def sync_files(host, port, files, rev, auth, timeout, keep):
+    """Envia ao dispositivo só o que difere da pasta local."""
+    result = {"host": host, "ok": False, "status": None, "message": "", "seconds": 0.0, "bytes": 0}
+    start = time.monotonic()
+    try:
+        connection = http.client.HTTPConnection(host, None if ":" in host else port, timeout=timeout)
+        headers = {"Authorization": "Basic " + auth} if auth else {}
+        connection.request("GET", "/api/files", headers=headers)
+        response = connection.getresponse()
+        manifest = response.read().decode("utf-8", "replace")
+        connection.close()
+        if response.status != 200:
+            result.update(status=response.status, message=manifest.strip() or response.reason)
+        else:
+            device = file_sync.parse_manifest(manifest)
+            patch = file_sync.build_patch(files, device, rev, delete=not keep)
+            headers["Content-Type"] = "application/octet-stream"
+            status, reply = request(host, port, "PUT", "/api/files", auth, timeout, patch, headers)
+            result.update(status=status, ok=status == 200, bytes=len(patch))
+            result["message"] = "%s (%s gravado(s), %s apagado(s))" % (
+                reply.get("message", ""), reply.get("written", 0), reply.get("deleted", 0)) \
+                if status == 200 else reply.get("message", "")
+    except (OSError, http.client.HTTPException) as error:
+        result["message"] = str(error)
+
+    result["seconds"] = time.monotonic() - start
+    return result
+
+
+def read_hosts(args):
+    hosts = list(args.hosts)
+    if args.hosts_file:
+        with open(args.hosts_file, encoding="utf-8") as f:
+            for line in f:
+                line = line.split("#", 1)[0].strip()
+                if line:
+                    hosts.append(line)
+    # Remove duplicados mantendo a ordem
+    return list(dict.fromkeys(hosts))
+
+
+HOSTS_HELP = "IP ou nome, opcionalmente com :porta (ex: esp32-ota.local)"
+
+
+def common_options():
+    """Opções de conexão comuns ao envio de firmware e ao sync."""
+    parser = argparse.ArgumentParser(add_help=False)
+    parser.add_argument("--hosts-file", help="arquivo com um host por linha")
+    parser.add_argument("--port", type=int, default=80, help="porta do servidor web (padrão: 80)")
+    parser.add_argument("-u", "--username", help="usuário (setCredentials)")
+    parser.add_argument("-p", "--password", help="senha (setCredentials)")
+    parser.add_argument("-j", "--jobs", type=int, default=4, help="envios simultâneos (padrão: 4)")
+    parser.add_argument("--timeout", type=float, default=60, help="timeout de rede em segundos")
+    return parser
+
+
+def main():
+    common = common_options()
+    sync = len(sys.argv) > 1 and sys.argv[1] == "sync"
+    if sync:
+        parser = argparse.ArgumentParser(prog="ota_push.py sync", parents=[common],
+                                         description="Sincroniza os arquivos do LittleFS via /api/files")
+        parser.add_argument("directory", help="pasta com os arquivos do LittleFS (a do buildfs)")
+        parser.add_argument("hosts", nargs="*", help=HOSTS_HELP)
+        parser.add_argument("--keep", action="store_true", help="não apaga arquivos que só existem no dispositivo")
+        args = parser.parse_args(sys.argv[2:])
+    else:
+        parser = argparse.ArgumentParser(description="Envia firmware para ESP32 via PUT /api/firmware", parents=[common],
+                                         epilog="Arquivos do LittleFS: ota_push.py sync PASTA HOST [HOST ...]")
+        parser.add_argument("firmware", help="arquivo .bin")
+        parser.add_argument("hosts", nargs="*", help=HOSTS_HELP)
+        parser.add_argument("--path", default="/api/firmware", help="endpoint de upload (/api/upload com --resumable)")
+        parser.add_argument("-q", "--quiet", action="store_true", help="não exibe o progresso")
+        parser.add_argument("--resumable", action="store_true", help="usa o upload retomável em blocos (/api/upload)")
+        parser.add_argument("--chunk", type=int, default=0, help="tamanho do bloco (padrão: máximo do dispositivo)")
+        parser.add_argument("--retries", type=int, default=10, help="tentativas seguidas por bloco no modo retomável")
+        args = parser.parse_args()
+
+    hosts = read_hosts(args)
+    if not hosts:
+        parser.error("informe ao menos um host")
+
+    auth = None
+    if args.username:
+        auth = base64.b64encode(("%s:%s" % (args.username, args.password or "")).encode()).decode()
+
+    if sync:
+        return main_sync(args, hosts, auth)
+
+    with open(args.firmware, "rb") as f:
+        firmware = f.read()
+    md5 = hashlib.md5(firmware).hexdigest()
+
+    print("Firmware: %s (%d bytes, MD5 %s)" % (os.path.basename(args.firmware), len(firmware), md5))
+    print("Dispositivos: %d, envios simultâneos: %d" % (len(hosts), min(args.jobs, len(hosts))))
+
+    progress = Progress(hosts, len(firmware), not args.quiet and sys.stderr.isatty())
+    start = time.monotonic()
+    with concurrent.futures.ThreadPoolExecutor(max_workers=max(1, args.jobs)) as pool:
+        if args.resumable:
+            path = args.path if args.path != "/api/firmware" else "/api/upload"
+            futures = [pool.submit(push_resumable, host, args.port, path, firmware, md5, auth, args.timeout,
+                                   progress, args.chunk, args.retries) for host in hosts]
+        else:
+            futures = [pool.submit(push, host, args.port, args.path, firmware, md5, auth, args.timeout, progress)
+                       for host in hosts]
+        results = [future.result() for future in futures]
+    progress.finish()
+    elapsed = time.monotonic() - start
+
+    return report(results, elapsed, "atualizados")
+
+
+def main_sync(args, hosts, auth):
+    files = file_sync.scan(args.directory)
+    rev = file_sync.revision(files)
+    print("Arquivos: %s (%d, revisão %s)" % (args.directory, len(files), rev))
+    print("Dispositivos: %d, envios simultâneos: %d" % (len(hosts), min(args.jobs, len(hosts))))
+
+    start = time.monotonic()
+    with concurrent.futures.ThreadPoolExecutor(max_workers=max(1, args.jobs)) as pool:
+        futures = [pool.submit(sync_files, host, args.port, files, rev, auth, args.timeout, args.keep)
+                   for host in hosts]
+        results = [future.result() for future in futures]
+    return report(results, time.monotonic() - start, "sincronizados")
+
+
+def report(results, elapsed, done):
+    width = max(len(r["host"]) for r in results)
+    for r in results:
+        rate = r["bytes"] / r["seconds"] / 1024 if r["seconds"] > 0 else 0
+        resumes = " (%d retomadas)" % r["resumes"] if r.get("resumes") else ""
+        print("%s  %-*s  %6.2fs  %8.1f KB/s  %s  %s%s" % (
+            "OK  " if r["ok"] else "FAIL", width, r["host"], r["seconds"], rate,
+            r["status"] if r["status"] is not None else "---", r["message"], resumes))
+
+    failed = sum(1 for r in results if not r["ok"])
+    print("Total: %d/%d %s em %.2fs" % (len(results) - failed, len(results), done, elapsed))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
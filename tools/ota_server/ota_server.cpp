@@ -0,0 +1,1308 @@
+/**
+ * @file ota_server.cpp
+ * @brief Servidor de atualizações de referência para o Pull (Linux, epoll + sendfile)
+ *
+ * Uso: program <diretório da release> [opções]  (--help lista todas)
+ *
+ *   program releases/atual --port 8000 --workers 4 --client-kbps 2000
+ *
+ * Atende o protocolo do OTAPullUpdateManager sem mudanças (GET /version em
+ * texto e GET /firmware com Content-Length) e acrescenta o que um servidor
+ * de produção precisa:
+ *   - Range de um intervalo (206/416, If-Range) para retomar downloads
+ *   - ETag pelo conteúdo (SHA-256) e 304 com If-None-Match
+ *   - variante comprimida: firmware.bin.gz, servida com Accept-Encoding: gzip
+ *   - deltas: delta/<versão de origem>.bin, servido em /firmware?from=<versão>
+ *   - /manifest.json com versão, tamanhos, SHA-256 e ETags de cada variante
+ *   - limites por cliente (IP): requisições por segundo (429 + Retry-After),
+ *     conexões simultâneas e banda de cada download
+ *
+ * Diretório da release:
+ *   version           versão anunciada (ou --version)
+ *   firmware.bin      imagem completa
+ *   firmware.bin.gz   opcional (gzip -k -9 firmware.bin)
+ *   delta/2.1.8.bin   opcional, um por versão de origem
+ *
+ * Cada worker é uma thread com seu próprio socket (SO_REUSEPORT) e seu laço
+ * epoll; corpos saem por sendfile() direto do cache de páginas. SIGHUP relê
+ * o diretório: conexões em andamento terminam com a release antiga.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/sendfile.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    struct Options
+    {
+        const char *dir = nullptr;
+        const char *bind = "0.0.0.0";
+        uint16_t port = 8000; // Porta do Pull
+        const char *version = nullptr;
+        unsigned workers = 1;
+        double clientRps = 0;      // Requisições por segundo por IP (0 = sem limite)
+        double clientBurst = 10;   // Rajada do limite de requisições
+        unsigned clientConns = 0;  // Conexões simultâneas por IP (0 = sem limite)
+        double clientKbps = 0;     // Banda de cada download (0 = sem limite)
+        unsigned idleS = 30;       // Conexão parada
+        bool writeManifest = false;
+        bool quiet = false;
+    };
+
+    Options opt;
+    std::atomic<bool> stopping{false};
+
+    uint64_t nowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    // ============ SHA-256 ============
+
+    class Sha256
+    {
+    public:
+        Sha256() { reset(); }
+
+        void update(const uint8_t *data, size_t length)
+        {
+            while (length > 0)
+            {
+                size_t take = std::min(length, sizeof(_block) - _used);
+                memcpy(_block + _used, data, take);
+                _used += take;
+                _bits += take * 8;
+                data += take;
+                length -= take;
+                if (_used == sizeof(_block))
+                {
+                    compress(_block);
+                    _used = 0;
+                }
+            }
+        }
+
+        std::string hex()
+        {
+            uint64_t bits = _bits;
+            uint8_t pad = 0x80;
+            update(&pad, 1);
+            pad = 0;
+            while (_used != 56)
+                update(&pad, 1);
+            uint8_t length[8];
+            for (int i = 0; i < 8; i++)
+                length[i] = (uint8_t)(bits >> (56 - 8 * i));
+            update(length, 8);
+
+            char out[65];
+            for (int i = 0; i < 8; i++)
+                snprintf(out + i * 8, 9, "%08x", _state[i]);
+            return out;
+        }
+
+    private:
+        uint32_t _state[8];
+        uint8_t _block[64];
+        size_t _used;
+        uint64_t _bits;
+
+        static uint32_t rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+        void reset()
+        {
+            static const uint32_t initial[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                                0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+            memcpy(_state, initial, sizeof(_state));
+            _used = 0;
+            _bits = 0;
+        }
+
+        void compress(const uint8_t *block)
+        {
+            static const uint32_t k[64] = {
+                0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+                0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+                0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+                0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+                0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+            uint32_t w[64];
+            for (int i = 0; i < 16; i++)
+                w[i] = (uint32_t)block[i * 4] << 24 | (uint32_t)block[i * 4 + 1] << 16 |
+                       (uint32_t)block[i * 4 + 2] << 8 | block[i * 4 + 3];
+            for (int i = 16; i < 64; i++)
+            {
+                uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+            }
+
+            uint32_t a = _state[0], b = _state[1], c = _state[2], d = _state[3];
+            uint32_t e = _state[4], f = _state[5], g = _state[6], h = _state[7];
+            for (int i = 0; i < 64; i++)
+            {
+                uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + k[i] + w[i];
+                uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+                h = g;
+                g = f;
+                f = e;
+                e = d + t1;
+                d = c;
+                c = b;
+                b = a;
+                a = t1 + t2;
+            }
+            _state[0] += a;
+            _state[1] += b;
+            _state[2] += c;
+            _state[3] += d;
+            _state[4] += e;
+            _state[5] += f;
+            _state[6] += g;
+            _state[7] += h;
+        }
+    };
+
+    // ============ RELEASE ============
+
+    struct Variant
+    {
+        std::string name; // Relativo ao diretório da release
+        int fd = -1;
+        off_t size = 0;
+        std::string etag;
+        std::string sha256;
+    };
+
+    struct Release
+    {
+        std::string version;
+        std::string versionEtag;
+        Variant firmware;
+        Variant gzip; // fd < 0: sem variante comprimida
+        std::map<std::string, Variant> deltas;
+        std::string manifest;
+
+        ~Release()
+        {
+            for (const Variant *variant : all())
+                if (variant->fd >= 0)
+                    close(variant->fd);
+        }
+
+        std::vector<const Variant *> all() const
+        {
+            std::vector<const Variant *> variants = {&firmware, &gzip};
+            for (const auto &delta : deltas)
+                variants.push_back(&delta.second);
+            return variants;
+        }
+    };
+
+    std::mutex releaseMutex;
+    std::shared_ptr<const Release> current;
+
+    std::shared_ptr<const Release> release()
+    {
+        std::lock_guard<std::mutex> lock(releaseMutex);
+        return current;
+    }
+
+    bool openVariant(const std::string &name, Variant &variant, std::string &error)
+    {
+        std::string path = std::string(opt.dir) + "/" + name;
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        struct stat info;
+        if (fd < 0 || fstat(fd, &info) != 0)
+        {
+            error = path + ": " + strerror(errno);
+            if (fd >= 0)
+                close(fd);
+            return false;
+        }
+
+        Sha256 sha;
+        uint8_t buffer[65536];
+        ssize_t n;
+        off_t offset = 0;
+        while ((n = pread(fd, buffer, sizeof(buffer), offset)) > 0)
+        {
+            sha.update(buffer, n);
+            offset += n;
+        }
+
+        variant.name = name;
+        variant.fd = fd;
+        variant.size = info.st_size;
+        variant.sha256 = sha.hex();
+        variant.etag = "\"" + variant.sha256.substr(0, 16) + "\"";
+        return true;
+    }
+
+    bool readText(const std::string &path, std::string &text)
+    {
+        FILE *file = fopen(path.c_str(), "r");
+        if (file == nullptr)
+            return false;
+        char buffer[128];
+        size_t n = fread(buffer, 1, sizeof(buffer) - 1, file);
+        fclose(file);
+        text.assign(buffer, n);
+        while (!text.empty() && isspace((unsigned char)text.back()))
+            text.pop_back();
+        return true;
+    }
+
+    std::string variantJson(const Variant &variant, const char *url)
+    {
+        char json[512];
+        snprintf(json, sizeof(json), "{\"url\":\"%s\",\"size\":%ld,\"sha256\":\"%s\",\"etag\":\"%s\"}", url,
+                 (long)variant.size, variant.sha256.c_str(), variant.etag.substr(1, variant.etag.size() - 2).c_str());
+        return json;
+    }
+
+    std::shared_ptr<Release> loadRelease(std::string &error)
+    {
+        auto loaded = std::make_shared<Release>();
+
+        if (opt.version)
+            loaded->version = opt.version;
+        else if (!readText(std::string(opt.dir) + "/version", loaded->version))
+        {
+            error = std::string(opt.dir) + "/version não encontrado (ou use --version)";
+            return nullptr;
+        }
+        if (loaded->version.empty())
+        {
+            error = "versão vazia";
+            return nullptr;
+        }
+        loaded->versionEtag = "\"v" + loaded->version + "\"";
+
+        if (!openVariant("firmware.bin", loaded->firmware, error))
+            return nullptr;
+
+        struct stat info;
+        if (stat((std::string(opt.dir) + "/firmware.bin.gz").c_str(), &info) == 0 &&
+            !openVariant("firmware.bin.gz", loaded->gzip, error))
+            return nullptr;
+
+        DIR *deltas = opendir((std::string(opt.dir) + "/delta").c_str());
+        if (deltas)
+        {
+            while (dirent *entry = readdir(deltas))
+            {
+                std::string file = entry->d_name;
+                if (file.size() <= 4 || file.compare(file.size() - 4, 4, ".bin") != 0)
+                    continue;
+                Variant variant;
+                if (!openVariant("delta/" + file, variant, error))
+                {
+                    closedir(deltas);
+                    return nullptr;
+                }
+                loaded->deltas[file.substr(0, file.size() - 4)] = variant;
+            }
+            closedir(deltas);
+        }
+
+        std::string manifest = "{\"version\":\"" + loaded->version + "\",\"firmware\":" +
+                               variantJson(loaded->firmware, "/firmware");
+        if (loaded->gzip.fd >= 0)
+            manifest += ",\"gzip\":" + variantJson(loaded->gzip, "/firmware");
+        manifest += ",\"deltas\":{";
+        bool first = true;
+        for (const auto &delta : loaded->deltas)
+        {
+            manifest += (first ? "\"" : ",\"") + delta.first + "\":" +
+                        variantJson(delta.second, ("/firmware?from=" + delta.first).c_str());
+            first = false;
+        }
+        manifest += "}}\n";
+        loaded->manifest = manifest;
+        return loaded;
+    }
+
+    // ============ LIMITES POR CLIENTE ============
+
+    class ClientLimits
+    {
+    public:
+        // Conexão nova do IP; false se o IP já está no limite
+        bool connect(uint32_t ip)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            Entry &entry = _clients[ip];
+            if (opt.clientConns > 0 && entry.connections >= opt.clientConns)
+                return false;
+            entry.connections++;
+            return true;
+        }
+
+        void disconnect(uint32_t ip)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _clients.find(ip);
+            if (it == _clients.end())
+                return;
+            if (it->second.connections > 0)
+                it->second.connections--;
+        }
+
+        /**
+         * @brief Balde de fichas por IP
+         * @param retryAfterS Segundos até a próxima ficha, quando recusada
+         */
+        bool request(uint32_t ip, unsigned &retryAfterS)
+        {
+            if (opt.clientRps <= 0)
+                return true;
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            Entry &entry = _clients[ip];
+            uint64_t now = nowNs();
+            if (entry.lastNs == 0)
+                entry.tokens = opt.clientBurst;
+            else
+                entry.tokens = std::min(opt.clientBurst, entry.tokens + (now - entry.lastNs) / 1e9 * opt.clientRps);
+            entry.lastNs = now;
+
+            if (entry.tokens >= 1)
+            {
+                entry.tokens -= 1;
+                return true;
+            }
+            retryAfterS = (unsigned)((1 - entry.tokens) / opt.clientRps) + 1;
+            return false;
+        }
+
+    private:
+        struct Entry
+        {
+            double tokens = 0;
+            uint64_t lastNs = 0;
+            unsigned connections = 0;
+        };
+
+        std::mutex _mutex;
+        std::unordered_map<uint32_t, Entry> _clients;
+    };
+
+    ClientLimits limits;
+
+    // ============ ESTATÍSTICAS ============
+
+    std::atomic<uint64_t> statRequests{0};
+    std::atomic<uint64_t> statBytes{0};
+    std::atomic<uint64_t> statNotModified{0};
+    std::atomic<uint64_t> statPartial{0};
+    std::atomic<uint64_t> statLimited{0};
+    std::atomic<uint64_t> statConnections{0};
+    std::atomic<uint64_t> statPeakConnections{0};
+    std::atomic<uint64_t> statOpen{0};
+
+    // ============ HTTP ============
+
+    struct Request
+    {
+        std::string method;
+        std::string path;
+        std::string query;
+        bool http11 = true;
+        std::map<std::string, std::string> headers; // Nomes em minúsculas
+
+        const std::string *header(const char *name) const
+        {
+            auto it = headers.find(name);
+            return it == headers.end() ? nullptr : &it->second;
+        }
+    };
+
+    struct Connection
+    {
+        int fd = -1;
+        uint32_t ip = 0;
+        std::string address;
+        std::string in;
+        std::string out;
+        size_t outSent = 0;
+
+        std::shared_ptr<const Release> release; // Mantém o arquivo aberto até o fim do corpo
+        const Variant *body = nullptr;
+        off_t offset = 0;
+        off_t end = 0;
+        off_t bodySent = 0;
+        uint64_t bodyStartNs = 0;
+        uint64_t resumeNs = 0; // != 0: pausado pelo limite de banda
+
+        bool keepAlive = true;
+        bool peerClosed = false; // Cliente fechou a escrita: responde e encerra
+        uint64_t lastActivityNs = 0;
+
+        // Para o log de acesso
+        std::string line;
+        int status = 0;
+    };
+
+    const char *reason(int status)
+    {
+        switch (status)
+        {
+        case 200: return "OK";
+        case 206: return "Partial Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 416: return "Range Not Satisfiable";
+        case 429: return "Too Many Requests";
+        case 431: return "Request Header Fields Too Large";
+        default: return "Internal Server Error";
+        }
+    }
+
+    std::string lower(std::string text)
+    {
+        std::transform(text.begin(), text.end(), text.begin(), ::tolower);
+        return text;
+    }
+
+    std::string trim(const std::string &text)
+    {
+        size_t start = text.find_first_not_of(" \t");
+        size_t end = text.find_last_not_of(" \t");
+        return start == std::string::npos ? std::string() : text.substr(start, end - start + 1);
+    }
+
+    bool parseRequest(const std::string &head, Request &request)
+    {
+        size_t lineEnd = head.find("\r\n");
+        std::string line = head.substr(0, lineEnd);
+        size_t first = line.find(' ');
+        size_t second = line.rfind(' ');
+        if (first == std::string::npos || second == first)
+            return false;
+
+        request.method = line.substr(0, first);
+        std::string target = line.substr(first + 1, second - first - 1);
+        std::string version = line.substr(second + 1);
+        if (version.compare(0, 5, "HTTP/") != 0)
+            return false;
+        request.http11 = version != "HTTP/1.0";
+
+        size_t question = target.find('?');
+        request.path = target.substr(0, question);
+        if (question != std::string::npos)
+            request.query = target.substr(question + 1);
+
+        size_t position = lineEnd + 2;
+        while (position < head.size())
+        {
+            size_t next = head.find("\r\n", position);
+            if (next == std::string::npos)
+                next = head.size();
+            std::string field = head.substr(position, next - position);
+            size_t colon = field.find(':');
+            if (colon != std::string::npos)
+                request.headers[lower(trim(field.substr(0, colon)))] = trim(field.substr(colon + 1));
+            position = next + 2;
+        }
+        return true;
+    }
+
+    std::string queryValue(const std::string &query, const char *name)
+    {
+        std::string key = std::string(name) + "=";
+        size_t position = 0;
+        while (position < query.size())
+        {
+            size_t end = query.find('&', position);
+            if (end == std::string::npos)
+                end = query.size();
+            if (query.compare(position, key.size(), key) == 0)
+                return query.substr(position + key.size(), end - position - key.size());
+            position = end + 1;
+        }
+        return std::string();
+    }
+
+    bool etagMatches(const std::string *header, const std::string &etag)
+    {
+        if (header == nullptr)
+            return false;
+        if (*header == "*")
+            return true;
+        size_t position = 0;
+        while (position < header->size())
+        {
+            size_t end = header->find(',', position);
+            if (end == std::string::npos)
+                end = header->size();
+            std::string candidate = trim(header->substr(position, end - position));
+            if (candidate.compare(0, 2, "W/") == 0)
+                candidate = candidate.substr(2);
+            if (candidate == etag)
+                return true;
+            position = end + 1;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Um intervalo "bytes=a-b", "bytes=a-" ou "bytes=-n"
+     * @return 1 intervalo válido, 0 ignorar (vários intervalos, sintaxe), -1 fora do arquivo
+     */
+    int parseRange(const std::string &header, off_t size, off_t &first, off_t &last)
+    {
+        if (header.compare(0, 6, "bytes=") != 0 || header.find(',') != std::string::npos)
+            return 0;
+        std::string spec = trim(header.substr(6));
+        size_t dash = spec.find('-');
+        if (dash == std::string::npos)
+            return 0;
+
+        std::string from = spec.substr(0, dash);
+        std::string to = spec.substr(dash + 1);
+        char *end;
+        if (from.empty())
+        {
+            long long suffix = strtoll(to.c_str(), &end, 10);
+            if (to.empty() || *end || suffix <= 0)
+                return suffix == 0 && !to.empty() && !*end ? -1 : 0;
+            first = suffix >= size ? 0 : size - suffix;
+            last = size - 1;
+        }
+        else
+        {
+            first = strtoll(from.c_str(), &end, 10);
+            if (*end)
+                return 0;
+            if (to.empty())
+                last = size - 1;
+            else
+            {
+                last = strtoll(to.c_str(), &end, 10);
+                if (*end || last < first)
+                    return 0;
+                last = std::min<off_t>(last, size - 1);
+            }
+        }
+        return first < size && size > 0 ? 1 : -1;
+    }
+
+    void header(std::string &out, const char *name, const std::string &value)
+    {
+        out += name;
+        out += ": ";
+        out += value;
+        out += "\r\n";
+    }
+
+    void begin(Connection &connection, int status, bool keepAlive)
+    {
+        connection.status = status;
+        connection.keepAlive = keepAlive;
+        connection.out = "HTTP/1.1 " + std::to_string(status) + " " + reason(status) + "\r\n";
+        header(connection.out, "Server", "ota-server");
+        if (!keepAlive)
+            header(connection.out, "Connection", "close");
+    }
+
+    void respondText(Connection &connection, int status, const std::string &body, bool keepAlive, bool head,
+                     const char *type = "text/plain")
+    {
+        begin(connection, status, keepAlive);
+        header(connection.out, "Content-Type", type);
+        header(connection.out, "Content-Length", std::to_string(body.size()));
+        connection.out += "\r\n";
+        if (!head)
+            connection.out += body;
+    }
+
+    void respondFirmware(Connection &connection, const Request &request, const std::shared_ptr<const Release> &rel,
+                         bool keepAlive, bool head)
+    {
+        const Variant *variant = &rel->firmware;
+        const char *encoding = nullptr;
+        std::string from = queryValue(request.query, "from");
+
+        auto delta = rel->deltas.find(from);
+        if (!from.empty() && delta != rel->deltas.end())
+            variant = &delta->second;
+        else if (rel->gzip.fd >= 0)
+        {
+            const std::string *accept = request.header("accept-encoding");
+            if (accept && lower(*accept).find("gzip") != std::string::npos)
+            {
+                variant = &rel->gzip;
+                encoding = "gzip";
+            }
+        }
+
+        auto common = [&](std::string &out) {
+            header(out, "ETag", variant->etag);
+            header(out, "Accept-Ranges", "bytes");
+            header(out, "Cache-Control", "no-cache");
+            if (rel->gzip.fd >= 0)
+                header(out, "Vary", "Accept-Encoding");
+            header(out, "X-Firmware-Version", rel->version);
+            header(out, "X-Firmware-SHA256", variant->sha256);
+            if (variant != &rel->firmware && encoding == nullptr)
+                header(out, "X-Delta-From", from);
+        };
+
+        if (etagMatches(request.header("if-none-match"), variant->etag))
+        {
+            statNotModified++;
+            begin(connection, 304, keepAlive);
+            common(connection.out);
+            connection.out += "\r\n";
+            return;
+        }
+
+        off_t first = 0;
+        off_t last = variant->size - 1;
+        int ranged = 0;
+        const std::string *range = request.header("range");
+        const std::string *ifRange = request.header("if-range");
+        if (range && (ifRange == nullptr || *ifRange == variant->etag))
+            ranged = parseRange(*range, variant->size, first, last);
+
+        if (ranged < 0)
+        {
+            begin(connection, 416, keepAlive);
+            header(connection.out, "Content-Range", "bytes */" + std::to_string(variant->size));
+            header(connection.out, "Content-Length", "0");
+            connection.out += "\r\n";
+            return;
+        }
+
+        begin(connection, ranged ? 206 : 200, keepAlive);
+        header(connection.out, "Content-Type", "application/octet-stream");
+        if (encoding)
+            header(connection.out, "Content-Encoding", encoding);
+        common(connection.out);
+        header(connection.out, "Content-Length", std::to_string(last - first + 1));
+        if (ranged)
+        {
+            statPartial++;
+            header(connection.out, "Content-Range", "bytes " + std::to_string(first) + "-" + std::to_string(last) +
+                                                        "/" + std::to_string(variant->size));
+        }
+        connection.out += "\r\n";
+
+        if (!head)
+        {
+            connection.release = rel;
+            connection.body = variant;
+            connection.offset = first;
+            connection.end = last + 1;
+            connection.bodySent = 0;
+            connection.bodyStartNs = nowNs();
+        }
+    }
+
+    void respond(Connection &connection, const Request &request)
+    {
+        statRequests++;
+        const std::string *connectionHeader = request.header("connection");
+        std::string wants = connectionHeader ? lower(*connectionHeader) : std::string();
+        bool keepAlive = request.http11 ? wants.find("close") == std::string::npos
+                                        : wants.find("keep-alive") != std::string::npos;
+        bool head = request.method == "HEAD";
+
+        unsigned retryAfterS = 0;
+        if (!limits.request(connection.ip, retryAfterS))
+        {
+            statLimited++;
+            begin(connection, 429, false);
+            header(connection.out, "Retry-After", std::to_string(retryAfterS));
+            header(connection.out, "Content-Length", "0");
+            connection.out += "\r\n";
+            return;
+        }
+
+        if (request.method != "GET" && !head)
+        {
+            respondText(connection, 405, "Method Not Allowed\n", keepAlive, head);
+            return;
+        }
+
+        std::shared_ptr<const Release> rel = release();
+        if (request.path == "/version")
+        {
+            if (etagMatches(request.header("if-none-match"), rel->versionEtag))
+            {
+                statNotModified++;
+                begin(connection, 304, keepAlive);
+                header(connection.out, "ETag", rel->versionEtag);
+                connection.out += "\r\n";
+                return;
+            }
+            begin(connection, 200, keepAlive);
+            header(connection.out, "Content-Type", "text/plain");
+            header(connection.out, "Cache-Control", "no-cache");
+            header(connection.out, "ETag", rel->versionEtag);
+            header(connection.out, "Content-Length", std::to_string(rel->version.size()));
+            connection.out += "\r\n";
+            if (!head)
+                connection.out += rel->version;
+        }
+        else if (request.path == "/firmware")
+            respondFirmware(connection, request, rel, keepAlive, head);
+        else if (request.path == "/manifest.json")
+            respondText(connection, 200, rel->manifest, keepAlive, head, "application/json");
+        else
+            respondText(connection, 404, "Not Found\n", keepAlive, head);
+    }
+
+    // ============ WORKER ============
+
+    class Worker
+    {
+    public:
+        explicit Worker(unsigned index) : _index(index) {}
+
+        bool listen(std::string &error)
+        {
+            _listener = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+            int one = 1;
+            setsockopt(_listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+            setsockopt(_listener, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one));
+
+            sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_port = htons(opt.port);
+            if (inet_pton(AF_INET, opt.bind, &address.sin_addr) != 1)
+            {
+                error = std::string("endereço inválido: ") + opt.bind;
+                return false;
+            }
+            if (bind(_listener, (sockaddr *)&address, sizeof(address)) < 0 || ::listen(_listener, SOMAXCONN) < 0)
+            {
+                error = std::string("porta ") + std::to_string(opt.port) + ": " + strerror(errno);
+                return false;
+            }
+
+            _epoll = epoll_create1(EPOLL_CLOEXEC);
+            epoll_event event = {};
+            event.events = EPOLLIN;
+            event.data.fd = _listener;
+            epoll_ctl(_epoll, EPOLL_CTL_ADD, _listener, &event);
+            return true;
+        }
+
+        void run()
+        {
+            std::vector<epoll_event> events(512);
+            uint64_t lastSweepNs = nowNs();
+
+            while (!stopping)
+            {
+                int count = epoll_wait(_epoll, events.data(), events.size(), nextTimeoutMs());
+                for (int i = 0; i < count; i++)
+                {
+                    int fd = events[i].data.fd;
+                    if (fd == _listener)
+                    {
+                        accept();
+                        continue;
+                    }
+                    auto it = _connections.find(fd);
+                    if (it == _connections.end())
+                        continue;
+                    Connection &connection = *it->second;
+                    if (events[i].events & (EPOLLERR | EPOLLHUP))
+                        drop(connection);
+                    else if (events[i].events & EPOLLIN)
+                        readable(connection);
+                    else if (events[i].events & EPOLLOUT)
+                        writable(connection);
+                }
+
+                uint64_t now = nowNs();
+                resumePaused(now);
+                if (now - lastSweepNs > 1000000000ull)
+                {
+                    sweep(now);
+                    lastSweepNs = now;
+                }
+            }
+
+            std::vector<int> open;
+            for (const auto &entry : _connections)
+                open.push_back(entry.first);
+            for (int fd : open)
+                drop(*_connections[fd]);
+            close(_epoll);
+            close(_listener);
+        }
+
+    private:
+        unsigned _index;
+        int _listener = -1;
+        int _epoll = -1;
+        std::unordered_map<int, std::unique_ptr<Connection>> _connections;
+
+        // Downloads pausados pelo limite de banda: (retomada, fd), validados ao sair
+        typedef std::pair<uint64_t, int> Pause;
+        std::priority_queue<Pause, std::vector<Pause>, std::greater<Pause>> _paused;
+
+        int nextTimeoutMs()
+        {
+            if (_paused.empty())
+                return 1000;
+            uint64_t next = _paused.top().first;
+            uint64_t now = nowNs();
+            return next <= now ? 0 : (int)std::min<uint64_t>((next - now) / 1000000 + 1, 1000);
+        }
+
+        void watch(Connection &connection, uint32_t mask)
+        {
+            epoll_event event = {};
+            event.events = mask;
+            event.data.fd = connection.fd;
+            epoll_ctl(_epoll, EPOLL_CTL_MOD, connection.fd, &event);
+        }
+
+        void accept()
+        {
+            for (;;)
+            {
+                sockaddr_in address;
+                socklen_t length = sizeof(address);
+                int fd = accept4(_listener, (sockaddr *)&address, &length, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                if (fd < 0)
+                {
+                    if (errno == EMFILE || errno == ENFILE)
+                        fprintf(stderr, "⚠️ Limite de descritores atingido (%zu conexões no worker %u)\n",
+                                _connections.size(), _index);
+                    return;
+                }
+
+                uint32_t ip = ntohl(address.sin_addr.s_addr);
+                if (!limits.connect(ip))
+                {
+                    statLimited++;
+                    static const char busy[] =
+                        "HTTP/1.1 429 Too Many Requests\r\nRetry-After: 5\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+                    send(fd, busy, sizeof(busy) - 1, MSG_NOSIGNAL);
+                    close(fd);
+                    continue;
+                }
+
+                int one = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+                auto connection = std::unique_ptr<Connection>(new Connection());
+                connection->fd = fd;
+                connection->ip = ip;
+                char text[INET_ADDRSTRLEN];
+                inet_ntop(AF_INET, &address.sin_addr, text, sizeof(text));
+                connection->address = text;
+                connection->lastActivityNs = nowNs();
+
+                epoll_event event = {};
+                event.events = EPOLLIN;
+                event.data.fd = fd;
+                epoll_ctl(_epoll, EPOLL_CTL_ADD, fd, &event);
+                _connections[fd] = std::move(connection);
+
+                statConnections++;
+                uint64_t open = ++statOpen;
+                uint64_t peak = statPeakConnections;
+                while (open > peak && !statPeakConnections.compare_exchange_weak(peak, open))
+                {
+                }
+            }
+        }
+
+        void drop(Connection &connection)
+        {
+            int fd = connection.fd;
+            limits.disconnect(connection.ip);
+            epoll_ctl(_epoll, EPOLL_CTL_DEL, fd, nullptr);
+            close(fd);
+            statOpen--;
+            _connections.erase(fd); // Destrói a conexão
+        }
+
+        void readable(Connection &connection)
+        {
+            char buffer[4096];
+            for (;;)
+            {
+                ssize_t n = recv(connection.fd, buffer, sizeof(buffer), 0);
+                if (n > 0)
+                {
+                    connection.in.append(buffer, n);
+                    connection.lastActivityNs = nowNs();
+                    if (connection.in.size() > 16384)
+                    {
+                        respondText(connection, 431, "Request Header Fields Too Large\n", false, false);
+                        connection.in.clear();
+                        flush(connection);
+                        return;
+                    }
+                    continue;
+                }
+                if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                    break;
+                if (n < 0 || connection.in.find("\r\n\r\n") == std::string::npos)
+                {
+                    drop(connection); // Fechada pelo cliente
+                    return;
+                }
+                connection.peerClosed = true;
+                watch(connection, 0);
+                break;
+            }
+            next(connection);
+        }
+
+        // Próxima requisição do buffer, se não há resposta em andamento
+        void next(Connection &connection)
+        {
+            if (!connection.out.empty() || connection.body)
+                return;
+
+            size_t end = connection.in.find("\r\n\r\n");
+            if (end == std::string::npos)
+                return;
+
+            std::string head = connection.in.substr(0, end);
+            connection.in.erase(0, end + 4);
+
+            Request request;
+            if (!parseRequest(head, request))
+            {
+                respondText(connection, 400, "Bad Request\n", false, false);
+                connection.line = "-";
+            }
+            else
+            {
+                connection.line = request.method + " " + request.path +
+                                  (request.query.empty() ? "" : "?" + request.query);
+                respond(connection, request);
+            }
+            flush(connection);
+        }
+
+        void flush(Connection &connection)
+        {
+            uint64_t now = nowNs();
+
+            while (connection.outSent < connection.out.size())
+            {
+                ssize_t n = send(connection.fd, connection.out.data() + connection.outSent,
+                                 connection.out.size() - connection.outSent,
+                                 MSG_NOSIGNAL | (connection.body ? MSG_MORE : 0));
+                if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                {
+                    watch(connection, EPOLLOUT);
+                    return;
+                }
+                if (n <= 0)
+                {
+                    drop(connection);
+                    return;
+                }
+                connection.outSent += n;
+                connection.lastActivityNs = now;
+                statBytes += n;
+            }
+
+            while (connection.body && connection.offset < connection.end)
+            {
+                size_t chunk = std::min<off_t>(connection.end - connection.offset, 1 << 20);
+                if (opt.clientKbps > 0)
+                {
+                    // Cota da banda desde o início do corpo, com folga de 16 KB
+                    double allowed = (now - connection.bodyStartNs) / 1e9 * opt.clientKbps * 125 + 16384;
+                    if (allowed < connection.bodySent + 1460) // Menos de um segmento: espera
+                    {
+                        double waitS = (connection.bodySent - allowed + 16384) / (opt.clientKbps * 125);
+                        connection.resumeNs = now + (uint64_t)(waitS * 1e9);
+                        _paused.push(Pause(connection.resumeNs, connection.fd));
+                        watch(connection, 0);
+                        return;
+                    }
+                    chunk = std::min<size_t>(chunk, (size_t)(allowed - connection.bodySent));
+                }
+
+                ssize_t n = sendfile(connection.fd, connection.body->fd, &connection.offset, chunk);
+                if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                {
+                    watch(connection, EPOLLOUT);
+                    return;
+                }
+                if (n <= 0)
+                {
+                    drop(connection);
+                    return;
+                }
+                connection.bodySent += n;
+                connection.lastActivityNs = now;
+                statBytes += n;
+            }
+
+            finished(connection);
+        }
+
+        void finished(Connection &connection)
+        {
+            if (!opt.quiet)
+                fprintf(stderr, "%s \"%s\" %d %ld\n", connection.address.c_str(), connection.line.c_str(),
+                        connection.status, (long)(connection.outSent + connection.bodySent));
+
+            bool keepAlive = connection.keepAlive && !connection.peerClosed;
+            connection.out.clear();
+            connection.outSent = 0;
+            connection.body = nullptr;
+            connection.release.reset();
+            connection.bodySent = 0;
+            connection.resumeNs = 0;
+
+            if (!keepAlive)
+            {
+                shutdown(connection.fd, SHUT_WR);
+                drop(connection);
+                return;
+            }
+            watch(connection, EPOLLIN);
+            next(connection); // Requisições em pipeline
+        }
+
+        void writable(Connection &connection)
+        {
+            flush(connection);
+        }
+
+        void resumePaused(uint64_t now)
+        {
+            while (!_paused.empty() && _paused.top().first <= now)
+            {
+                Pause pause = _paused.top();
+                _paused.pop();
+                auto it = _connections.find(pause.second);
+                if (it == _connections.end() || it->second->resumeNs != pause.first)
+                    continue;
+                it->second->resumeNs = 0;
+                flush(*it->second);
+            }
+        }
+
+        void sweep(uint64_t now)
+        {
+            std::vector<int> idle;
+            for (const auto &entry : _connections)
+            {
+                const Connection &connection = *entry.second;
+                if (connection.resumeNs == 0 && now - connection.lastActivityNs > opt.idleS * 1000000000ull)
+                    idle.push_back(entry.first);
+            }
+            for (int fd : idle)
+                drop(*_connections[fd]);
+        }
+    };
+
+    void usage(const char *program)
+    {
+        fprintf(stderr,
+                "uso: %s <diretório da release> [opções]\n"
+                "  --bind ip            endereço (padrão 0.0.0.0)\n"
+                "  --port n             porta (padrão 8000, a do Pull)\n"
+                "  --version v          versão anunciada (padrão: arquivo version)\n"
+                "  --workers n          threads com SO_REUSEPORT (padrão 1)\n"
+                "  --client-rps r       requisições por segundo por IP (0 = sem limite)\n"
+                "  --client-burst n     rajada do limite de requisições (padrão 10)\n"
+                "  --client-conns n     conexões simultâneas por IP (0 = sem limite)\n"
+                "  --client-kbps k      banda de cada download (0 = sem limite)\n"
+                "  --idle-s s           fecha conexões paradas (padrão 30)\n"
+                "  --write-manifest     grava manifest.json no diretório e sai\n"
+                "  --quiet              sem log de acesso\n",
+                program);
+    }
+
+    bool parse(int argc, char **argv)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const char *name = argv[i];
+            if (name[0] != '-')
+            {
+                if (opt.dir)
+                    return false;
+                opt.dir = name;
+                continue;
+            }
+            if (strcmp(name, "--write-manifest") == 0)
+            {
+                opt.writeManifest = true;
+                continue;
+            }
+            if (strcmp(name, "--quiet") == 0)
+            {
+                opt.quiet = true;
+                continue;
+            }
+            if (i + 1 >= argc)
+                return false;
+            const char *value = argv[++i];
+
+            if (strcmp(name, "--bind") == 0)
+                opt.bind = value;
+            else if (strcmp(name, "--port") == 0)
+                opt.port = atoi(value);
+            else if (strcmp(name, "--version") == 0)
+                opt.version = value;
+            else if (strcmp(name, "--workers") == 0)
+                opt.workers = std::max(1, atoi(value));
+            else if (strcmp(name, "--client-rps") == 0)
+                opt.clientRps = atof(value);
+            else if (strcmp(name, "--client-burst") == 0)
+                opt.clientBurst = std::max(1.0, atof(value));
+            else if (strcmp(name, "--client-conns") == 0)
+                opt.clientConns = atoi(value);
+            else if (strcmp(name, "--client-kbps") == 0)
+                opt.clientKbps = atof(value);
+            else if (strcmp(name, "--idle-s") == 0)
+                opt.idleS = atoi(value);
+            else
+                return false;
+        }
+        return opt.dir != nullptr;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (!parse(argc, argv))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    std::string error;
+    std::shared_ptr<Release> loaded = loadRelease(error);
+    if (!loaded)
+    {
+        fprintf(stderr, "❌ %s\n", error.c_str());
+        return 1;
+    }
+
+    if (opt.writeManifest)
+    {
+        std::string path = std::string(opt.dir) + "/manifest.json";
+        FILE *file = fopen(path.c_str(), "w");
+        if (file == nullptr || fwrite(loaded->manifest.data(), 1, loaded->manifest.size(), file) != loaded->manifest.size())
+        {
+            fprintf(stderr, "❌ %s: %s\n", path.c_str(), strerror(errno));
+            return 1;
+        }
+        fclose(file);
+        fputs(loaded->manifest.c_str(), stdout);
+        return 0;
+    }
+    current = loaded;
+
+    // Um descritor por conexão
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0)
+    {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    // Sinais só na thread principal (sigwait); os workers herdam a máscara
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGHUP);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    signal(SIGPIPE, SIG_IGN);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    for (unsigned i = 0; i < opt.workers; i++)
+    {
+        workers.emplace_back(new Worker(i));
+        if (!workers.back()->listen(error))
+        {
+            fprintf(stderr, "❌ %s\n", error.c_str());
+            return 1;
+        }
+    }
+
+    fprintf(stderr, "🚀 v%s: firmware %ld bytes%s, %zu delta(s), em http://%s:%u (%u worker(s))\n",
+            loaded->version.c_str(), (long)loaded->firmware.size, loaded->gzip.fd >= 0 ? " (+gzip)" : "",
+            loaded->deltas.size(), opt.bind, opt.port, opt.workers);
+
+    std::vector<std::thread> threads;
+    for (auto &worker : workers)
+        threads.emplace_back(&Worker::run, worker.get());
+
+    for (;;)
+    {
+        int received = 0;
+        sigwait(&signals, &received);
+        if (received != SIGHUP)
+            break;
+
+        std::shared_ptr<Release> reloaded = loadRelease(error);
+        if (!reloaded)
+        {
+            fprintf(stderr, "❌ Release não recarregada: %s\n", error.c_str());
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> lock(releaseMutex);
+            current = reloaded;
+        }
+        fprintf(stderr, "🔄 Release recarregada: v%s\n", reloaded->version.c_str());
+    }
+
+    stopping = true;
+    for (auto &thread : threads)
+        thread.join();
+
+    fprintf(stderr, "📊 %llu requisições, %llu conexões (pico %llu), %.1f MB, %llu 304, %llu 206, %llu limitadas\n",
+            (unsigned long long)statRequests, (unsigned long long)statConnections,
+            (unsigned long long)statPeakConnections, statBytes / 1e6, (unsigned long long)statNotModified,
+            (unsigned long long)statPartial, (unsigned long long)statLimited);
+    return 0;
+}
@@ -0,0 +1,101 @@
+"""
+Servidor de atualizações local para o Pull (ambiente nativo e testes).
+
+Atende as rotas consultadas pelo OTAPullUpdateManager:
+    GET /version   versão disponível, em texto
+    GET /firmware  imagem do firmware (com Content-Length)
+
+Com --files, também a sincronização de arquivos do LittleFS
+(OTAPullUpdateManager::setFilesPath("/files"), ver tools/file_sync.py):
+    GET  /files    revisão da pasta, em texto
+    POST /files    corpo = manifesto do dispositivo; resposta = patch
+
+A pasta é relida a cada requisição: basta editar um arquivo para que os
+dispositivos o recebam na próxima verificação, sem gerar firmware novo.
+
+Uso:
+    python tools/update_server.py firmware.bin --version 2.2.0
+    python tools/update_server.py firmware.bin --version 2.2.0 --port 8000 --bind 0.0.0.0
+    python tools/update_server.py firmware.bin --version 2.2.0 --files data/
+
+Com o ambiente nativo (pio run -e native):
+    .pio/build/native/program http://127.0.0.1 8080 automatic
+
+Para produção e frotas grandes, use o servidor de referência em tools/ota_server.
+"""
+
+import argparse
+import http.server
+import sys
+
+import file_sync
+
+
+def make_handler(version, firmware, files_dir):
+    class Handler(http.server.BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.1"
+
+        def do_GET(self):
+            path = self.path.split("?", 1)[0]
+            if path == "/version":
+                self.send_body(version.encode(), "text/plain")
+            elif path == "/firmware":
+                self.send_body(firmware, "application/octet-stream")
+            elif path == "/files" and files_dir:
+                self.send_body(file_sync.revision(file_sync.scan(files_dir)).encode(), "text/plain")
+            else:
+                self.send_error(404)
+
+        def do_POST(self):
+            if self.path.split("?", 1)[0] != "/files" or not files_dir:
+                self.send_error(404)
+                return
+            length = int(self.headers.get("Content-Length", 0))
+            device = file_sync.parse_manifest(self.rfile.read(length).decode("utf-8", "replace"))
+            files = file_sync.scan(files_dir)
+            patch = file_sync.build_patch(files, device, file_sync.revision(files))
+            self.send_body(patch, "application/octet-stream")
+
+        def send_body(self, body, content_type):
+            self.send_response(200)
+            self.send_header("Content-Type", content_type)
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            try:
+                self.wfile.write(body)
+            except (BrokenPipeError, ConnectionResetError):
+                print(f"{self.client_address[0]}: conexão encerrada pelo cliente", file=sys.stderr)
+
+        def log_message(self, format, *args):
+            print(f"{self.client_address[0]} {format % args}", file=sys.stderr)
+
+    return Handler
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Servidor de atualizações local para o Pull")
+    parser.add_argument("firmware", help="arquivo .bin servido em /firmware")
+    parser.add_argument("--version", required=True, help="versão anunciada em /version")
+    parser.add_argument("--port", type=int, default=8000, help="porta (padrão 8000, a do Pull)")
+    parser.add_argument("--bind", default="127.0.0.1", help="endereço (padrão 127.0.0.1)")
+    parser.add_argument("--files", metavar="PASTA", help="sincroniza os arquivos do LittleFS com esta pasta (/files)")
+    args = parser.parse_args()
+
+    with open(args.firmware, "rb") as f:
+        firmware = f.read()
+
+    server = http.server.ThreadingHTTPServer((args.bind, args.port), make_handler(args.version, firmware, args.files))
+    print(f"Servindo {args.firmware} ({len(firmware)} bytes) como v{args.version} "
+          f"em http://{args.bind}:{args.port}", file=sys.stderr)
+    if args.files:
+        files = file_sync.scan(args.files)
+        print(f"Arquivos: {args.files} ({len(files)}, revisão {file_sync.revision(files)}) em /files",
+              file=sys.stderr)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()